@@ -43,6 +43,10 @@
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CachedExpression.h>
+#include <blaze/math/CompactDiagonalMatrix.h>
+#include <blaze/math/CompactSymmetricMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
@@ -54,6 +58,7 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/GappedCompressedMatrix.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/math/InversionFlag.h>
 #include <blaze/math/HermitianMatrix.h>
@@ -62,6 +67,8 @@
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/PlanarMatrix.h>
+#include <blaze/math/PlanarVector.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
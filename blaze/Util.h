@@ -46,9 +46,11 @@
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Algorithm.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/ConcurrentMemoryPool.h>
 #include <blaze/util/Constraints.h>
 #include <blaze/util/Convert.h>
 #include <blaze/util/DimensionOf.h>
@@ -56,17 +58,22 @@
 #include <blaze/util/EmptyType.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/InputString.h>
+#include <blaze/util/InstructionSet.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Limits.h>
 #include <blaze/util/Logging.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryArena.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
+#include <blaze/util/NUMAPolicy.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/NonCreatable.h>
 #include <blaze/util/Null.h>
 #include <blaze/util/NullType.h>
+#include <blaze/util/NumberParser.h>
 #include <blaze/util/PointerCast.h>
 #include <blaze/util/Policies.h>
 #include <blaze/util/PtrIterator.h>
@@ -0,0 +1,116 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/NUMA.h
+//  \brief Configuration of the NUMA-aware memory allocation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_CONFIG_NUMA_H_
+#define _BLAZE_CONFIG_NUMA_H_
+
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Configuration of the NUMA placement policy for large allocations.
+// \ingroup config
+//
+// This setting specifies the NUMA placement policy that is applied to all allocations that are
+// at least blaze::largeAllocationThreshold bytes large (see the blaze::NUMAPolicy enumeration).
+// By default (\a numaFirstTouch) the pages are placed by the operating system on the NUMA node
+// of the thread that first writes to them. With \a numaInterleave the pages are distributed
+// round-robin among all NUMA nodes selected via blaze::numaNodeMask, with \a numaBind they are
+// restricted to these nodes. Note that the interleave and bind policies are only available on
+// Linux systems and are ignored on all other systems.
+//
+// Valid settings for the numaPolicy are blaze::numaFirstTouch, blaze::numaInterleave, and
+// blaze::numaBind.
+*/
+const NUMAPolicy numaPolicy = numaFirstTouch;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selection of the NUMA nodes for the interleave and bind placement policies.
+// \ingroup config
+//
+// This bit mask selects the NUMA nodes that are used by the \a numaInterleave and \a numaBind
+// placement policies. Bit \a i of the mask corresponds to NUMA node \a i. Nodes that are not
+// available on the target system are ignored. The setting has no effect in combination with
+// the \a numaFirstTouch policy.
+*/
+const unsigned long numaNodeMask = ~0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the parallel first-touch initialization.
+// \ingroup config
+//
+// Via this switch the parallel first-touch initialization of large dense vectors and matrices
+// can be (de-)activated. If set to \a true, the constructors of DynamicVector and DynamicMatrix
+// initialize their elements via the active SMP backend, using the same partitioning as the SMP
+// assignment. Therefore the memory pages of the elements are placed on the NUMA nodes of the
+// threads that will later on work with the elements. If set to \a false, all elements are
+// initialized by the constructing thread. Note that the size constructors without initial
+// value do not initialize the elements and therefore leave the first touch to the first
+// assignment to the vector or matrix, independent of this setting.
+*/
+const bool useParallelFirstTouch = true;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the transparent huge page hint.
+// \ingroup config
+//
+// If set to \a true, all allocations that are at least blaze::largeAllocationThreshold bytes
+// large are aligned to huge page boundaries and are marked as eligible for transparent huge
+// pages, which reduces the number of TLB misses for large dense vectors and matrices. If set
+// to \a false, no hint is given. Note that this setting only has an effect on Linux systems.
+*/
+const bool useHugePages = true;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Minimum size of a large allocation.
+// \ingroup config
+//
+// This setting specifies the minimum size in bytes for an allocation to be treated as a large
+// allocation. Only large allocations are aligned to huge page boundaries and are subject to
+// the transparent huge page hint and the NUMA placement policy.
+*/
+const size_t largeAllocationThreshold = 4194304UL;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -51,4 +51,42 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the persistent thread team of the thread-based parallelization
+// \ingroup config
+//
+// This compilation switch selects the execution model of the C++11 and Boost thread-based
+// parallelization. In case the switch is set to 0, all (compound) assignment tasks are inserted
+// into the shared task queue of a thread pool and the calling thread waits on a condition
+// variable for their completion. In case the switch is set to 1, the tasks are statically
+// assigned to the members of a persistent thread team (see the ThreadTeam class template): The
+// calling thread executes the first task itself, and all threads spin briefly on an atomic
+// generation counter before parking. This considerably reduces the latency of a parallel
+// operation and therefore allows to lower the SMP thresholds (see <blaze/config/Thresholds.h>).
+// However, idle threads of the team consume CPU time while spinning.
+//
+// Possible settings for the thread team switch:
+//  - Thread pool: \b 0 (default)
+//  - Thread team: \b 1
+//
+// Note that this switch has no effect in case the OpenMP-based parallelization is active.
+*/
+#define BLAZE_USE_THREAD_TEAM 0
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The number of spin iterations of an idle thread before it is parked.
+// \ingroup config
+//
+// This value specifies how many iterations an idle member of the thread team (see the
+// BLAZE_USE_THREAD_TEAM switch) spins on the atomic generation counter before it is parked on a
+// condition variable. Larger values reduce the latency of consecutive parallel operations at the
+// cost of CPU time consumed by the idle threads. The default setting is 4000 iterations, which
+// corresponds to a few microseconds on current processors.
+*/
+const size_t threadTeamSpinCount = 4000UL;
+//*************************************************************************************************
+
 } // namespace blaze
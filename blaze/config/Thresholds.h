@@ -33,6 +33,40 @@
 //=================================================================================================
 
 
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for runtime-tunable thresholds.
+// \ingroup config
+//
+// This compilation switch specifies whether the thresholds configured in this file can be
+// changed at runtime. In case the switch is set to 1, the thresholds below only serve as
+// defaults. These can be overridden for a particular machine without recompilation, either
+// via environment variables (formed by prepending "BLAZE_" to the name of the threshold, as
+// for instance \c BLAZE_SMP_DVECASSIGN_THRESHOLD) or via the blaze::setThreshold() function:
+
+   \code
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 20000UL );
+   \endcode
+
+// In case the switch is set to 0, all thresholds are compile time constants. Suitable values
+// for the given machine can be determined by the \c calibration tool of the Blaze benchmark
+// suite, which generates a replacement for this file.
+//
+// Possible settings for the runtime threshold switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+*/
+#define BLAZE_USE_RUNTIME_THRESHOLDS 1
+//*************************************************************************************************
+
+
+
+
 namespace blaze {
 
 //=================================================================================================
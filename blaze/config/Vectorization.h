@@ -52,3 +52,28 @@
 */
 #define BLAZE_USE_VECTORIZATION 1
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch of vectorized kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime dispatch of performance critical kernels.
+// In case the switch is set to 1 (i.e. in case the runtime dispatch is enabled), the dense
+// matrix/vector and matrix/matrix multiplication kernels, the dense vector reductions, the
+// addition and subtraction assignment of dense vectors, and the sparse matrix/dense vector
+// multiplication kernels for single and double precision operands are compiled for several
+// instruction sets (SSE2, AVX, AVX2, and AVX-512) within the same executable. The best
+// instruction set supported by the executing CPU is determined once at runtime and the according
+// kernels are used in case they provide a wider vectorization than the instruction set the
+// executable was compiled for. Thus an executable compiled for a conservative baseline (as for
+// instance SSE2) also takes advantage of the AVX2 or AVX-512 instructions of newer CPUs. In case
+// the switch is set to 0, only the vectorization selected at compile time is used. Note that
+// the runtime dispatch is only available for GNU and Clang compilers on x86 architectures.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+*/
+#define BLAZE_USE_RUNTIME_DISPATCH 1
+//*************************************************************************************************
@@ -43,6 +43,7 @@
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/dense/Inversion.h>
 #include <blaze/math/dense/LU.h>
+#include <blaze/math/dense/QuantizedMult.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DMatAbsExpr.h>
 #include <blaze/math/expressions/DMatConjExpr.h>
@@ -0,0 +1,2217 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CompactDiagonalMatrix.h
+//  \brief Header file for the implementation of a diagonal matrix with compact diagonal storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_COMPACTDIAGONALMATRIX_H_
+#define _BLAZE_MATH_DENSE_COMPACTDIAGONALMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/DenseColumn.h>
+#include <blaze/math/views/DenseRow.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/valuetraits/IsTrue.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_diagonal_matrix CompactDiagonalMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a diagonal \f$ N \times N \f$ matrix with compact storage.
+// \ingroup compact_diagonal_matrix
+//
+// The CompactDiagonalMatrix class template is the storage efficient counterpart of a
+// DiagonalMatrix adapting a dense matrix type. Whereas a DiagonalMatrix< DynamicMatrix<Type> >
+// stores all \f$ N^2 \f$ elements of the adapted matrix, the CompactDiagonalMatrix only stores
+// the \f$ N \f$ diagonal elements in a dense column vector. Thus a \f$ 100000 \times 100000 \f$
+// double precision diagonal scaling matrix requires 800 kB instead of 80 GB:
+
+   \code
+   template< typename Type, bool SO >
+   class CompactDiagonalMatrix;
+   \endcode
+
+//  - Type: specifies the type of the diagonal elements. CompactDiagonalMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The CompactDiagonalMatrix is a dense matrix and can be used in all dense matrix operations.
+// All off-diagonal elements are read as 0, all element access via the function call operator
+// and the iterators is restricted to read access. The diagonal elements are accessed via the
+// diagonal() function:
+
+   \code
+   using blaze::CompactDiagonalMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   CompactDiagonalMatrix<double> D( 100000UL );
+   D.diagonal()[0UL] = 2.0;  // Setting the first diagonal element
+   D(0UL,1UL);               // Off-diagonal elements are 0
+
+   DynamicMatrix<double> A( 100000UL, 50UL ), B;
+   CompressedMatrix<double> S( 100000UL, 100000UL ), T;
+   DynamicVector<double> x( 100000UL ), y;
+   // ... Initialization
+
+   B = D * A;   // Row scaling of a dense matrix
+   T = D * S;   // Row scaling of a sparse matrix
+   y = D * x;   // Componentwise scaling of a dense vector
+
+   D = 2.0 * D;  // Assignment of a diagonal matrix expression
+   D = A;        // Throws a std::invalid_argument exception (A is not diagonal)
+   \endcode
+
+// The multiplications of a CompactDiagonalMatrix with dense and sparse matrices and vectors
+// (from both sides) don't create expression templates, but are immediately evaluated as pure
+// scaling passes over the other operand, which is considerably more efficient than a general
+// matrix multiplication.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class CompactDiagonalMatrix : public DenseMatrix< CompactDiagonalMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompactDiagonalMatrix<Type,SO>   This;           //!< Type of this CompactDiagonalMatrix instance.
+   typedef This                             ResultType;     //!< Result type for expression template evaluations.
+   typedef CompactDiagonalMatrix<Type,!SO>  OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompactDiagonalMatrix<Type,!SO>  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;    //!< Type of the matrix elements.
+   typedef typename IntrinsicTrait<Type>::Type  IntrinsicType;  //!< Intrinsic type of the matrix elements.
+   typedef const Type&                      ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;  //!< Data type for composite expression templates.
+
+   typedef const Type&  Reference;       //!< Reference to a matrix value (read access only).
+   typedef const Type&  ConstReference;  //!< Reference to a constant matrix value.
+   typedef const Type*  Pointer;         //!< Pointer to a matrix value (read access only).
+   typedef const Type*  ConstPointer;    //!< Pointer to a constant matrix value.
+
+   typedef DynamicVector<Type,columnVector>  DiagonalType;  //!< Type of the diagonal vector.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompactDiagonalMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompactDiagonalMatrix<ET,SO>  Other;  //!< The type of the other CompactDiagonalMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a row/column of the compact diagonal matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef const Type*                      PointerType;       //!< Pointer return type.
+      typedef const Type&                      ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : diagonal_( NULL )  // Pointer to the diagonal element of the row/column
+         , index_   ( 0UL  )  // Index of the row/column
+         , position_( 0UL  )  // Current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param diagonal Pointer to the diagonal element of the row/column.
+      // \param index Index of the row/column.
+      // \param position The initial position within the row/column.
+      */
+      inline ConstIterator( const Type* diagonal, size_t index, size_t position )
+         : diagonal_( diagonal )  // Pointer to the diagonal element of the row/column
+         , index_   ( index    )  // Index of the row/column
+         , position_( position )  // Current position within the row/column
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         ++position_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++position_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         --position_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         const ConstIterator tmp( *this );
+         --position_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) {
+         position_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) {
+         position_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The current value of the iterator.
+      */
+      inline ReferenceType operator*() const {
+         return ( position_ == index_ )?( *diagonal_ ):( zero_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer to the element at the current iterator position.
+      */
+      inline PointerType operator->() const {
+         return ( position_ == index_ )?( diagonal_ ):( &zero_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return position_ == rhs.position_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return position_ != rhs.position_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return position_ < rhs.position_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const {
+         return position_ > rhs.position_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const {
+         return position_ <= rhs.position_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const {
+         return position_ >= rhs.position_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return static_cast<DifferenceType>( position_ ) - static_cast<DifferenceType>( rhs.position_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
+         return ConstIterator( it.diagonal_, it.index_, it.position_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
+         return ConstIterator( it.diagonal_, it.index_, it.position_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
+         return ConstIterator( it.diagonal_, it.index_, it.position_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* diagonal_;  //!< Pointer to the diagonal element of the row/column.
+      size_t      index_;     //!< Index of the row/column.
+      size_t      position_;  //!< Current position within the row/column.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ConstIterator  Iterator;  //!< Iterator over the elements (read access only).
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the elements of a compact diagonal matrix are
+       not stored contiguously, the \a vectorizable compilation flag is set to \a false. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the compact diagonal matrix cannot be partitioned into submatrices,
+       the \a smpAssignable compilation flag is set to \a false. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompactDiagonalMatrix();
+   explicit inline CompactDiagonalMatrix( size_t n );
+   explicit inline CompactDiagonalMatrix( size_t n, const Type& init );
+
+   template< typename VT >
+   explicit inline CompactDiagonalMatrix( const DenseVector<VT,columnVector>& diagonal );
+
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix( const Matrix<MT,SO2>& m );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference      operator()( size_t i, size_t j ) const;
+   inline ConstIterator       begin ( size_t i ) const;
+   inline ConstIterator       cbegin( size_t i ) const;
+   inline ConstIterator       end   ( size_t i ) const;
+   inline ConstIterator       cend  ( size_t i ) const;
+   inline DiagonalType&       diagonal();
+   inline const DiagonalType& diagonal() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline CompactDiagonalMatrix& operator=( const Type& rhs );
+
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompactDiagonalMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 rows() const;
+                              inline size_t                 columns() const;
+                              inline size_t                 nonZeros() const;
+                              inline size_t                 nonZeros( size_t i ) const;
+                              inline void                   reset();
+                              inline void                   reset( size_t i );
+                              inline void                   clear();
+                              inline void                   resize( size_t n, bool preserve=true );
+                              inline CompactDiagonalMatrix& transpose();
+   template< typename Other > inline CompactDiagonalMatrix& scale( const Other& scalar );
+                              inline void                   swap( CompactDiagonalMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Diagonal extraction functions***************************************************************
+   /*!\name Diagonal extraction functions */
+   //@{
+   template< typename MT, bool SO2 >
+   static inline void extract( const DenseMatrix<MT,SO2>& rhs, DiagonalType& diagonal );
+
+   template< typename MT, bool SO2 >
+   static inline void extract( const SparseMatrix<MT,SO2>& rhs, DiagonalType& diagonal );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DiagonalType diag_;  //!< The diagonal elements of the matrix.
+
+   static const Type zero_;  //!< Neutral element for the off-diagonal elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type CompactDiagonalMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactDiagonalMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix()
+   : diag_()  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a diagonal matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All diagonal elements are initialized to 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( size_t n )
+   : diag_( n, Type() )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all diagonal elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the diagonal elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( size_t n, const Type& init )
+   : diag_( n, init )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a diagonal matrix with the given diagonal.
+//
+// \param diagonal The dense vector of diagonal elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename VT >  // Type of the diagonal vector
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( const DenseVector<VT,columnVector>& diagonal )
+   : diag_( ~diagonal )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of diagonal matrix.
+//
+// This constructor initializes the diagonal matrix as a copy of the given matrix. In case the
+// given matrix is not a square diagonal matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename MT       // Type of the foreign matrix
+        , bool SO2 >        // Storage order of the foreign matrix
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( const Matrix<MT,SO2>& m )
+   : diag_()  // The diagonal elements of the matrix
+{
+   extract( ~m, diag_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// All off-diagonal elements are read as 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstReference
+   CompactDiagonalMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
+
+   return ( i == j )?( diag_[i] ):( zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < diag_.size(), "Invalid dense matrix row/column access index" );
+   return ConstIterator( diag_.data() + i, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < diag_.size(), "Invalid dense matrix row/column access index" );
+   return ConstIterator( diag_.data() + i, i, diag_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the vector of diagonal elements.
+//
+// \return Reference to the vector of diagonal elements.
+//
+// The size of the diagonal matrix is bound to the size of the returned vector, i.e. resizing
+// the vector also resizes the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::DiagonalType&
+   CompactDiagonalMatrix<Type,SO>::diagonal()
+{
+   return diag_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the vector of diagonal elements.
+//
+// \return Reference to the vector of diagonal elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const typename CompactDiagonalMatrix<Type,SO>::DiagonalType&
+   CompactDiagonalMatrix<Type,SO>::diagonal() const
+{
+   return diag_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogeneous assignment to all diagonal elements.
+//
+// \param rhs Scalar value to be assigned to all diagonal elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::operator=( const Type& rhs )
+{
+   diag_ = rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// The matrix is resized according to the given matrix and initialized as a copy of this matrix.
+// In case the given matrix is not a square diagonal matrix, a \a std::invalid_argument exception
+// is thrown. Note that only the diagonal elements of the given matrix are evaluated in case it
+// is a diagonal matrix at compile time (as for instance the product of two compact diagonal
+// matrices).
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   DiagonalType tmp;
+   extract( ~rhs, tmp );
+   diag_.swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// a diagonal matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   DiagonalType tmp;
+   extract( ~rhs, tmp );
+   diag_ += tmp;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match or in case the given matrix is not
+// a diagonal matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   DiagonalType tmp;
+   extract( ~rhs, tmp );
+   diag_ -= tmp;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix<Type,SO> >::Type&
+   CompactDiagonalMatrix<Type,SO>::operator*=( Other rhs )
+{
+   diag_ *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix<Type,SO> >::Type&
+   CompactDiagonalMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   diag_ /= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::rows() const
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::columns() const
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the diagonal matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::nonZeros() const
+{
+   return diag_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < diag_.size(), "Invalid row/column access index" );
+   return ( isDefault( diag_[i] ) )?( 0UL ):( 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reset()
+{
+   diag_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the diagonal element of the specified row/column to its default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < diag_.size(), "Invalid row/column access index" );
+   blaze::reset( diag_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::clear()
+{
+   diag_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix to \f$ n \times n \f$. In contrast to a DynamicMatrix, all
+// new diagonal elements are initialized to 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::resize( size_t n, bool preserve )
+{
+   const size_t oldsize( preserve ? diag_.size() : 0UL );
+
+   diag_.resize( n, preserve );
+
+   for( size_t i=oldsize; i<n; ++i ) {
+      blaze::reset( diag_[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// Since a diagonal matrix is symmetric, the function has no effect.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::transpose()
+{
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::scale( const Other& scalar )
+{
+   diag_.scale( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::swap( CompactDiagonalMatrix& m ) /* throw() */
+{
+   diag_.swap( m.diag_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false.
+//
+// Since the elements of a compact diagonal matrix are not stored contiguously, the matrix is
+// never considered to be aligned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool CompactDiagonalMatrix<Type,SO>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool CompactDiagonalMatrix<Type,SO>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIAGONAL EXTRACTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Extraction of the diagonal of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix.
+// \param diagonal The resulting vector of diagonal elements.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the given matrix is not a square diagonal matrix, a \a std::invalid_argument exception
+// is thrown. Matrices that are diagonal at compile time are not checked and only their diagonal
+// elements are evaluated.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void CompactDiagonalMatrix<Type,SO>::extract( const DenseMatrix<MT,SO2>& rhs,
+                                                     DiagonalType& diagonal )
+{
+   const size_t n( (~rhs).rows() );
+
+   if( n != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   diagonal.resize( n, false );
+
+   if( IsDiagonal<MT>::value ) {
+      for( size_t i=0UL; i<n; ++i )
+         diagonal[i] = (~rhs)(i,i);
+   }
+   else {
+      typename MT::CompositeType A( ~rhs );  // Evaluation of the right-hand side dense matrix
+
+      if( !isDiagonal( A ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+      }
+
+      for( size_t i=0UL; i<n; ++i )
+         diagonal[i] = A(i,i);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extraction of the diagonal of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix.
+// \param diagonal The resulting vector of diagonal elements.
+// \return void
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the given matrix is not a square diagonal matrix, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline void CompactDiagonalMatrix<Type,SO>::extract( const SparseMatrix<MT,SO2>& rhs,
+                                                     DiagonalType& diagonal )
+{
+   typedef typename RemoveReference<typename MT::CompositeType>::Type::ConstIterator  ConstIterator;
+
+   const size_t n( (~rhs).rows() );
+
+   if( n != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   typename MT::CompositeType A( ~rhs );  // Evaluation of the right-hand side sparse matrix
+
+   if( !IsDiagonal<MT>::value && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   diagonal.resize( n, false );
+   diagonal.reset();
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const ConstIterator end( A.end(i) );
+      for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+         if( element->index() == i )
+            diagonal[i] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTDIAGONALMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactDiagonalMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( CompactDiagonalMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isDefault( const CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isIntact( const CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( CompactDiagonalMatrix<Type,SO>& a, CompactDiagonalMatrix<Type,SO>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( CompactDiagonalMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row/column of the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( CompactDiagonalMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( CompactDiagonalMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compact diagonal matrix is in default state.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix has a size of 0, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const CompactDiagonalMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compact diagonal matrix are intact.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const CompactDiagonalMatrix<Type,SO>& m )
+{
+   return isIntact( m.diagonal() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compact diagonal matrices.
+// \ingroup compact_diagonal_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( CompactDiagonalMatrix<Type,SO>& a, CompactDiagonalMatrix<Type,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of two compact diagonal matrices
+//        (\f$ C=D_1*D_2 \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting compact diagonal matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The product of two diagonal matrices is computed as componentwise product of the diagonals.
+*/
+template< typename T1  // Data type of the left-hand side diagonal matrix
+        , bool SO1     // Storage order of the left-hand side diagonal matrix
+        , typename T2  // Data type of the right-hand side diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side diagonal matrix
+inline const CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO1 >
+   operator*( const CompactDiagonalMatrix<T1,SO1>& lhs, const CompactDiagonalMatrix<T2,SO2>& rhs )
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO1 >  ResultType;
+
+   if( lhs.columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return ResultType( lhs.diagonal() * rhs.diagonal() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the row scaling of a row-major dense matrix
+//        (\f$ C=D*A \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side row-major dense matrix for the multiplication.
+// \return The resulting row-major dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is performed as a single scaling pass over the rows of the dense matrix.
+*/
+template< typename T1    // Data type of the left-hand side diagonal matrix
+        , bool SO1       // Storage order of the left-hand side diagonal matrix
+        , typename MT >  // Type of the right-hand side dense matrix
+inline const DynamicMatrix< typename MultTrait<T1,typename MT::ElementType>::Type, rowMajor >
+   operator*( const CompactDiagonalMatrix<T1,SO1>& lhs, const DenseMatrix<MT,rowMajor>& rhs )
+{
+   typedef DynamicMatrix< typename MultTrait<T1,typename MT::ElementType>::Type, rowMajor >  ResultType;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typename MT::CompositeType B( ~rhs );  // Evaluation of the right-hand side dense matrix
+
+   ResultType C( B.rows(), B.columns() );
+
+   for( size_t i=0UL; i<B.rows(); ++i ) {
+      row( C, i ) = lhs.diagonal()[i] * row( B, i );
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the row scaling of a column-major dense matrix
+//        (\f$ C=D*A \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side column-major dense matrix for the multiplication.
+// \return The resulting column-major dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is performed as a single pass over the columns of the dense matrix, which
+// are multiplied componentwise with the diagonal.
+*/
+template< typename T1    // Data type of the left-hand side diagonal matrix
+        , bool SO1       // Storage order of the left-hand side diagonal matrix
+        , typename MT >  // Type of the right-hand side dense matrix
+inline const DynamicMatrix< typename MultTrait<T1,typename MT::ElementType>::Type, columnMajor >
+   operator*( const CompactDiagonalMatrix<T1,SO1>& lhs, const DenseMatrix<MT,columnMajor>& rhs )
+{
+   typedef DynamicMatrix< typename MultTrait<T1,typename MT::ElementType>::Type, columnMajor >  ResultType;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typename MT::CompositeType B( ~rhs );  // Evaluation of the right-hand side dense matrix
+
+   ResultType C( B.rows(), B.columns() );
+
+   for( size_t j=0UL; j<B.columns(); ++j ) {
+      column( C, j ) = lhs.diagonal() * column( B, j );
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the column scaling of a row-major dense matrix
+//        (\f$ C=A*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side row-major dense matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting row-major dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is performed as a single pass over the rows of the dense matrix, which
+// are multiplied componentwise with the diagonal.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename T2  // Data type of the right-hand side diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side diagonal matrix
+inline const DynamicMatrix< typename MultTrait<typename MT::ElementType,T2>::Type, rowMajor >
+   operator*( const DenseMatrix<MT,rowMajor>& lhs, const CompactDiagonalMatrix<T2,SO2>& rhs )
+{
+   typedef DynamicMatrix< typename MultTrait<typename MT::ElementType,T2>::Type, rowMajor >  ResultType;
+
+   if( (~lhs).columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typename MT::CompositeType A( ~lhs );  // Evaluation of the left-hand side dense matrix
+
+   ResultType C( A.rows(), A.columns() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      row( C, i ) = row( A, i ) * trans( rhs.diagonal() );
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the column scaling of a column-major dense matrix
+//        (\f$ C=A*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side column-major dense matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting column-major dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is performed as a single scaling pass over the columns of the dense matrix.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename T2  // Data type of the right-hand side diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side diagonal matrix
+inline const DynamicMatrix< typename MultTrait<typename MT::ElementType,T2>::Type, columnMajor >
+   operator*( const DenseMatrix<MT,columnMajor>& lhs, const CompactDiagonalMatrix<T2,SO2>& rhs )
+{
+   typedef DynamicMatrix< typename MultTrait<typename MT::ElementType,T2>::Type, columnMajor >  ResultType;
+
+   if( (~lhs).columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typename MT::CompositeType A( ~lhs );  // Evaluation of the left-hand side dense matrix
+
+   ResultType C( A.rows(), A.columns() );
+
+   for( size_t j=0UL; j<A.columns(); ++j ) {
+      column( C, j ) = column( A, j ) * rhs.diagonal()[j];
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the row scaling of a sparse matrix (\f$ C=D*A \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side sparse matrix for the multiplication.
+// \return The resulting sparse matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The resulting sparse matrix has the same sparsity pattern as the given sparse matrix. The
+// multiplication is performed as a single scaling pass over its non-zero elements.
+*/
+template< typename T1  // Data type of the left-hand side diagonal matrix
+        , bool SO1     // Storage order of the left-hand side diagonal matrix
+        , typename MT  // Type of the right-hand side sparse matrix
+        , bool SO2 >   // Storage order of the right-hand side sparse matrix
+inline const CompressedMatrix< typename MultTrait<T1,typename MT::ElementType>::Type, SO2 >
+   operator*( const CompactDiagonalMatrix<T1,SO1>& lhs, const SparseMatrix<MT,SO2>& rhs )
+{
+   typedef CompressedMatrix< typename MultTrait<T1,typename MT::ElementType>::Type, SO2 >  ResultType;
+   typedef typename ResultType::Iterator  Iterator;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   ResultType C( ~rhs );
+
+   const size_t n( ( SO2 == rowMajor )?( C.rows() ):( C.columns() ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const Iterator end( C.end(i) );
+      for( Iterator element=C.begin(i); element!=end; ++element ) {
+         const size_t row( ( SO2 == rowMajor )?( i ):( element->index() ) );
+         element->value() = lhs.diagonal()[row] * element->value();
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the column scaling of a sparse matrix (\f$ C=A*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side sparse matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting sparse matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The resulting sparse matrix has the same sparsity pattern as the given sparse matrix. The
+// multiplication is performed as a single scaling pass over its non-zero elements.
+*/
+template< typename MT  // Type of the left-hand side sparse matrix
+        , bool SO1     // Storage order of the left-hand side sparse matrix
+        , typename T2  // Data type of the right-hand side diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side diagonal matrix
+inline const CompressedMatrix< typename MultTrait<typename MT::ElementType,T2>::Type, SO1 >
+   operator*( const SparseMatrix<MT,SO1>& lhs, const CompactDiagonalMatrix<T2,SO2>& rhs )
+{
+   typedef CompressedMatrix< typename MultTrait<typename MT::ElementType,T2>::Type, SO1 >  ResultType;
+   typedef typename ResultType::Iterator  Iterator;
+
+   if( (~lhs).columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   ResultType C( ~lhs );
+
+   const size_t n( ( SO1 == rowMajor )?( C.rows() ):( C.columns() ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const Iterator end( C.end(i) );
+      for( Iterator element=C.begin(i); element!=end; ++element ) {
+         const size_t column( ( SO1 == rowMajor )?( element->index() ):( i ) );
+         element->value() = element->value() * rhs.diagonal()[column];
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        dense vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side dense vector for the multiplication.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// The multiplication is performed as componentwise multiplication with the diagonal.
+*/
+template< typename T1    // Data type of the left-hand side diagonal matrix
+        , bool SO        // Storage order of the left-hand side diagonal matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline const DynamicVector< typename MultTrait<T1,typename VT::ElementType>::Type, columnVector >
+   operator*( const CompactDiagonalMatrix<T1,SO>& lhs, const DenseVector<VT,columnVector>& rhs )
+{
+   typedef DynamicVector< typename MultTrait<T1,typename VT::ElementType>::Type, columnVector >  ResultType;
+
+   if( lhs.columns() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return ResultType( lhs.diagonal() * (~rhs) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
+//        compact diagonal matrix (\f$ \vec{y}^T=\vec{x}^T*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side transpose dense vector for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting transpose dense vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// The multiplication is performed as componentwise multiplication with the diagonal.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , typename T2  // Data type of the right-hand side diagonal matrix
+        , bool SO >    // Storage order of the right-hand side diagonal matrix
+inline const DynamicVector< typename MultTrait<typename VT::ElementType,T2>::Type, rowVector >
+   operator*( const DenseVector<VT,rowVector>& lhs, const CompactDiagonalMatrix<T2,SO>& rhs )
+{
+   typedef DynamicVector< typename MultTrait<typename VT::ElementType,T2>::Type, rowVector >  ResultType;
+
+   if( (~lhs).size() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   return ResultType( (~lhs) * trans( rhs.diagonal() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        sparse vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side sparse vector for the multiplication.
+// \return The resulting sparse vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// The resulting sparse vector has the same sparsity pattern as the given sparse vector. The
+// multiplication is performed as a single scaling pass over its non-zero elements.
+*/
+template< typename T1    // Data type of the left-hand side diagonal matrix
+        , bool SO        // Storage order of the left-hand side diagonal matrix
+        , typename VT >  // Type of the right-hand side sparse vector
+inline const CompressedVector< typename MultTrait<T1,typename VT::ElementType>::Type, columnVector >
+   operator*( const CompactDiagonalMatrix<T1,SO>& lhs, const SparseVector<VT,columnVector>& rhs )
+{
+   typedef CompressedVector< typename MultTrait<T1,typename VT::ElementType>::Type, columnVector >  ResultType;
+   typedef typename ResultType::Iterator  Iterator;
+
+   if( lhs.columns() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   ResultType y( ~rhs );
+
+   const Iterator end( y.end() );
+   for( Iterator element=y.begin(); element!=end; ++element ) {
+      element->value() = lhs.diagonal()[element->index()] * element->value();
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose sparse vector and a
+//        compact diagonal matrix (\f$ \vec{y}^T=\vec{x}^T*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side transpose sparse vector for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting transpose sparse vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// The resulting sparse vector has the same sparsity pattern as the given sparse vector. The
+// multiplication is performed as a single scaling pass over its non-zero elements.
+*/
+template< typename VT  // Type of the left-hand side sparse vector
+        , typename T2  // Data type of the right-hand side diagonal matrix
+        , bool SO >    // Storage order of the right-hand side diagonal matrix
+inline const CompressedVector< typename MultTrait<typename VT::ElementType,T2>::Type, rowVector >
+   operator*( const SparseVector<VT,rowVector>& lhs, const CompactDiagonalMatrix<T2,SO>& rhs )
+{
+   typedef CompressedVector< typename MultTrait<typename VT::ElementType,T2>::Type, rowVector >  ResultType;
+   typedef typename ResultType::Iterator  Iterator;
+
+   if( (~lhs).size() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   ResultType y( ~lhs );
+
+   const Iterator end( y.end() );
+   for( Iterator element=y.begin(); element!=end; ++element ) {
+      element->value() = element->value() * rhs.diagonal()[element->index()];
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsSquare< CompactDiagonalMatrix<T,SO> > : public IsTrue<true>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsSymmetric< CompactDiagonalMatrix<T,SO> > : public IsTrue<true>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHERMITIAN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsHermitian< CompactDiagonalMatrix<T,SO> > : public IsTrue< IsBuiltin<T>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsLower< CompactDiagonalMatrix<T,SO> > : public IsTrue<true>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsUpper< CompactDiagonalMatrix<T,SO> > : public IsTrue<true>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< CompactDiagonalMatrix<T,SO> > : public IsTrue<true>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef CompactDiagonalMatrix< typename AddTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef CompactDiagonalMatrix< typename SubTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, T2, typename EnableIf< IsNumeric<T2> >::Type >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< T1, CompactDiagonalMatrix<T2,SO>, typename EnableIf< IsNumeric<T1> >::Type >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< DynamicVector<T1,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, CompressedVector<T2,false> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< CompressedVector<T1,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct DivTrait< CompactDiagonalMatrix<T1,SO>, T2, typename EnableIf< IsNumeric<T2> >::Type >
+{
+   typedef CompactDiagonalMatrix< typename DivTrait<T1,T2>::Type, SO >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   typedef DynamicMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
@@ -75,6 +76,7 @@
 #include <blaze/system/Blocking.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
 #include <blaze/system/StorageOrder.h>
@@ -314,6 +316,7 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
                               inline size_t         capacity( size_t i ) const;
                               inline size_t         nonZeros() const;
                               inline size_t         nonZeros( size_t i ) const;
+                              inline size_t         version() const;
                               inline void           reset();
                               inline void           reset( size_t i );
                               inline void           clear();
@@ -368,6 +371,19 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::transposition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -395,7 +411,14 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    inline typename EnableIf< VectorizedAssign<MT> >::Type
       assign( const DenseMatrix<MT,SO>& rhs );
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT >
+   inline typename DisableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -407,7 +430,14 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    inline typename EnableIf< VectorizedAddAssign<MT> >::Type
       addAssign( const DenseMatrix<MT,SO>& rhs );
 
-   template< typename MT > inline void addAssign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT >
+   inline typename DisableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void addAssign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void addAssign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -419,7 +449,14 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    inline typename EnableIf< VectorizedSubAssign<MT> >::Type
       subAssign( const DenseMatrix<MT,SO>& rhs );
 
-   template< typename MT > inline void subAssign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT >
+   inline typename DisableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void subAssign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void subAssign( const SparseMatrix<MT,!SO>& rhs );
    //@}
@@ -430,6 +467,8 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    /*!\name Utility functions */
    //@{
    inline size_t adjustColumns( size_t minColumns ) const;
+
+   template< bool Conj > inline void transposeNonSquare();
    //@}
    //**********************************************************************************************
 
@@ -450,6 +489,7 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
                                   \vdots       & \vdots        & \vdots        & \ddots & \vdots      \\
                                   M \cdot N-N  & M \cdot N-N+1 & M \cdot N-N+2 & \cdots & M \cdot N-1 \\
                                   \end{array}\right)\f]. */
+   size_t version_;          //!< The modification counter of the matrix.
    //@}
    //**********************************************************************************************
 
@@ -484,6 +524,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix()
    , nn_      ( 0UL  )  // The alignment adjusted number of columns
    , capacity_( 0UL  )  // The maximum capacity of the matrix
    , v_       ( NULL )  // The matrix elements
+   , version_ ( 0UL )   // The modification counter
 {}
 //*************************************************************************************************
 
@@ -505,6 +546,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
@@ -523,7 +565,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel first-touch
+// initialization is active (see the blaze::useParallelFirstTouch setting), the initialization is
+// performed by the active SMP backend.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -533,15 +577,21 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   if( useParallelFirstTouch ) {
+      smpFill( *this, init );
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            v_[i*nn_+j] = init;
+   }
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=0UL; i<m_; ++i )
          for( size_t j=n_; j<nn_; ++j )
             v_[i*nn_+j] = Type();
-      }
    }
 }
 //*************************************************************************************************
@@ -579,6 +629,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* a
    , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n; ++j )
@@ -625,6 +676,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[M][N] )
    , nn_      ( adjustColumns( N ) )           // The alignment adjusted number of columns
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    for( size_t i=0UL; i<M; ++i ) {
       for( size_t j=0UL; j<N; ++j )
@@ -645,7 +697,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[M][N] )
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. In case the parallel first-touch
+// initialization is active (see the blaze::useParallelFirstTouch setting), the elements are
+// copied by the active SMP backend.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -655,11 +709,23 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
    , nn_      ( m.nn_ )                        // The alignment adjusted number of columns
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   if( useParallelFirstTouch ) {
+      smpAssign( *this, m );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t i=0UL; i<m_; ++i )
+            for( size_t j=n_; j<nn_; ++j )
+               v_[i*nn_+j] = Type();
+      }
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = m.v_[i];
+   }
 }
 //*************************************************************************************************
 
@@ -679,15 +745,26 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
    , nn_      ( adjustColumns( n_ ) )          // The alignment adjusted number of columns
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
-                  j<( IsVectorizable<Type>::value ? nn_ : n_ ); ++j ) {
-         v_[i*nn_+j] = Type();
+   if( IsSparseMatrix<MT>::value ) {
+      if( useParallelFirstTouch ) {
+         smpFill( *this, Type() );
+      }
+      else {
+         for( size_t i=0UL; i<m_; ++i )
+            for( size_t j=0UL; j<n_; ++j )
+               v_[i*nn_+j] = Type();
       }
    }
 
    smpAssign( *this, ~m );
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=n_; j<nn_; ++j )
+            v_[i*nn_+j] = Type();
+   }
 }
 //*************************************************************************************************
 
@@ -1004,6 +1081,8 @@ template< typename Other  // Data type of the initialization array
         , size_t N >      // Number of columns of the initialization array
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Other (&array)[M][N] )
 {
+   ++version_;
+
    resize( M, N, false );
 
    for( size_t i=0UL; i<M; ++i )
@@ -1025,6 +1104,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Type& rhs )
 {
+   ++version_;
+
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
          v_[i*nn_+j] = rhs;
@@ -1047,6 +1128,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicMatrix& rhs )
 {
+   ++version_;
+
    if( &rhs == this ) return *this;
 
    resize( rhs.m_, rhs.n_, false );
@@ -1072,6 +1155,8 @@ template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
 {
+   ++version_;
+
    if( (~rhs).canAlias( this ) ) {
       DynamicMatrix tmp( ~rhs );
       swap( tmp );
@@ -1104,6 +1189,8 @@ template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
 {
+   ++version_;
+
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -1137,6 +1224,8 @@ template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
 {
+   ++version_;
+
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -1170,6 +1259,8 @@ template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
 {
+   ++version_;
+
    if( (~rhs).rows() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -1195,6 +1286,8 @@ template< typename Other >  // Data type of the right-hand side scalar
 inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO> >::Type&
    DynamicMatrix<Type,SO>::operator*=( Other rhs )
 {
+   ++version_;
+
    smpAssign( *this, (*this) * rhs );
    return *this;
 }
@@ -1214,6 +1307,8 @@ template< typename Other >  // Data type of the right-hand side scalar
 inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO> >::Type&
    DynamicMatrix<Type,SO>::operator/=( Other rhs )
 {
+   ++version_;
+
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
    smpAssign( *this, (*this) / rhs );
@@ -1363,6 +1458,27 @@ inline size_t DynamicMatrix<Type,SO>::nonZeros( size_t i ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the current modification counter of the matrix.
+//
+// \return The current value of the modification counter.
+//
+// The modification counter is incremented by every operation that potentially changes the
+// matrix as a whole (assignment, arithmetic assignment, resizing, resetting, swapping, ...).
+// It can for instance be used to detect whether a result computed from the matrix is outdated
+// (see the CachedExpression class template). Note that element accesses via the subscript/
+// function call operator, iterators, or the data() function as well as modifications via
+// views are not tracked.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DynamicMatrix<Type,SO>::version() const
+{
+   return version_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reset to the default initial values.
 //
@@ -1372,6 +1488,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void DynamicMatrix<Type,SO>::reset()
 {
+   ++version_;
+
    using blaze::clear;
 
    for( size_t i=0UL; i<m_; ++i )
@@ -1396,6 +1514,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void DynamicMatrix<Type,SO>::reset( size_t i )
 {
+   ++version_;
+
    using blaze::clear;
 
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
@@ -1459,6 +1579,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 {
+   ++version_;
+
    using blaze::min;
 
    if( m == m_ && n == n_ ) return;
@@ -1561,13 +1683,29 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed in-place by swapping pairs of tiles, which is performed by the
+// active SMP backend. Non-square matrices are transposed within the already allocated memory
+// by a sequence of row and column permutations. Only in case the current capacity
+// is insufficient for the padded transpose, a temporary matrix is used.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 {
-   DynamicMatrix tmp( trans(*this) );
-   swap( tmp );
+   ++version_;
+
+   if( m_ == n_ ) {
+      smpTranspose( *this );
+   }
+   else if( n_ * adjustColumns( m_ ) <= capacity_ ) {
+      transposeNonSquare<false>();
+   }
+   else {
+      DynamicMatrix tmp( trans(*this) );
+      swap( tmp );
+   }
+
    return *this;
 }
 //*************************************************************************************************
@@ -1577,13 +1715,29 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 /*!\brief In-place conjugate transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed in-place by swapping pairs of tiles, which is performed by the
+// active SMP backend. Non-square matrices are transposed within the already allocated memory
+// by a sequence of row and column permutations. Only in case the current capacity
+// is insufficient for the padded transpose, a temporary matrix is used.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
 {
-   DynamicMatrix tmp( ctrans(*this) );
-   swap( tmp );
+   ++version_;
+
+   if( m_ == n_ ) {
+      smpCTranspose( *this );
+   }
+   else if( n_ * adjustColumns( m_ ) <= capacity_ ) {
+      transposeNonSquare<true>();
+   }
+   else {
+      DynamicMatrix tmp( ctrans(*this) );
+      swap( tmp );
+   }
+
    return *this;
 }
 //*************************************************************************************************
@@ -1600,6 +1754,8 @@ template< typename Type     // Data type of the matrix
 template< typename Other >  // Data type of the scalar value
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::scale( const Other& scalar )
 {
+   ++version_;
+
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
          v_[i*nn_+j] *= scalar;
@@ -1625,6 +1781,9 @@ inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) /* throw() */
    std::swap( nn_, m.nn_ );
    std::swap( capacity_, m.capacity_ );
    std::swap( v_ , m.v_  );
+
+   ++version_;
+   ++m.version_;
 }
 //*************************************************************************************************
 
@@ -1646,6 +1805,46 @@ inline size_t DynamicMatrix<Type,SO>::adjustColumns( size_t minColumns ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief In-place (conjugate) transposition of a non-square matrix.
+//
+// \return void
+//
+// This function transposes the non-square matrix within the currently allocated memory. For
+// that purpose, the rows are first compacted by removing the padding elements, the resulting
+// contiguous matrix is transposed in-place by the active SMP backend (see the class template
+// ContiguousTransposition), and finally the new rows are spread according to the new padding.
+// The compaction and the spreading move overlapping memory ranges and are therefore performed
+// serially. The function requires that the current capacity is sufficient for the padded
+// transpose of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< bool Conj >    // Conjugation flag
+inline void DynamicMatrix<Type,SO>::transposeNonSquare()
+{
+   const size_t nn( adjustColumns( m_ ) );
+
+   BLAZE_INTERNAL_ASSERT( n_ * nn <= capacity_, "Insufficient capacity detected" );
+
+   for( size_t i=1UL; i<m_; ++i ) {
+      std::copy( v_+i*nn_, v_+i*nn_+n_, v_+i*n_ );
+   }
+
+   ContiguousTransposition<Conj,Type> kernel( v_, m_, n_ );
+   smpTransposeContiguous( kernel );
+
+   for( size_t i=n_; i>0UL; --i ) {
+      std::copy_backward( v_+(i-1UL)*m_, v_+i*m_, v_+(i-1UL)*nn+m_ );
+      std::fill( v_+(i-1UL)*nn+m_, v_+i*nn, Type() );
+   }
+
+   std::swap( m_, n_ );
+   nn_ = nn;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2032,6 +2231,16 @@ inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vector
       {
          size_t j( 0UL );
 
+         for( ; (j+IT::size*3UL) < jpos; j+=IT::size*4UL ) {
+            const IntrinsicType xmm1( (~rhs).load(i,j             ) );
+            const IntrinsicType xmm2( (~rhs).load(i,j+IT::size    ) );
+            const IntrinsicType xmm3( (~rhs).load(i,j+IT::size*2UL) );
+            const IntrinsicType xmm4( (~rhs).load(i,j+IT::size*3UL) );
+            stream( i, j             , xmm1 );
+            stream( i, j+IT::size    , xmm2 );
+            stream( i, j+IT::size*2UL, xmm3 );
+            stream( i, j+IT::size*3UL, xmm4 );
+         }
          for( ; j<jpos; j+=IT::size ) {
             stream( i, j, (~rhs).load(i,j) );
          }
@@ -2079,7 +2288,8 @@ inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vector
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2103,6 +2313,33 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -2280,7 +2517,8 @@ inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vector
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2316,6 +2554,33 @@ inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
 //
@@ -2493,7 +2758,8 @@ inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vector
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2529,6 +2795,33 @@ inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
 //
@@ -2729,6 +3022,7 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
                               inline size_t         capacity( size_t j ) const;
                               inline size_t         nonZeros() const;
                               inline size_t         nonZeros( size_t j ) const;
+                              inline size_t         version() const;
                               inline void           reset();
                               inline void           reset( size_t j );
                               inline void           clear();
@@ -2777,6 +3071,17 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::transposition };
+   };
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -2804,7 +3109,14 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    inline typename EnableIf< VectorizedAssign<MT> >::Type
       assign( const DenseMatrix<MT,true>& rhs );
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT >
+   inline typename DisableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -2816,7 +3128,14 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    inline typename EnableIf< VectorizedAddAssign<MT> >::Type
       addAssign( const DenseMatrix<MT,true>& rhs );
 
-   template< typename MT > inline void addAssign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT >
+   inline typename DisableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void addAssign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void addAssign( const SparseMatrix<MT,false>& rhs );
 
@@ -2828,7 +3147,14 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    inline typename EnableIf< VectorizedSubAssign<MT> >::Type
       subAssign ( const DenseMatrix<MT,true>& rhs );
 
-   template< typename MT > inline void subAssign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT >
+   inline typename DisableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void subAssign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void subAssign( const SparseMatrix<MT,false>& rhs );
    //@}
@@ -2839,6 +3165,8 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    /*!\name Utility functions */
    //@{
    inline size_t adjustRows( size_t minRows ) const;
+
+   template< bool Conj > inline void transposeNonSquare();
    //@}
    //**********************************************************************************************
 
@@ -2852,6 +3180,7 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
                              /*!< Access to the matrix elements is gained via the function call
                                   operator. */
+   size_t version_;          //!< The modification counter of the matrix.
    //@}
    //**********************************************************************************************
 
@@ -2885,6 +3214,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix()
    , n_       ( 0UL  )  // The current number of columns of the matrix
    , capacity_( 0UL  )  // The maximum capacity of the matrix
    , v_       ( NULL )  // The matrix elements
+   , version_ ( 0UL )   // The modification counter
 {}
 /*! \endcond */
 //*************************************************************************************************
@@ -2907,6 +3237,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , n_       ( n )                            // The current number of columns of the matrix
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
@@ -2927,7 +3258,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the parallel first-touch
+// initialization is active (see the blaze::useParallelFirstTouch setting), the initialization is
+// performed by the active SMP backend.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
@@ -2936,15 +3269,21 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , n_       ( n )                            // The current number of columns of the matrix
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   if( useParallelFirstTouch ) {
+      smpFill( *this, init );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            v_[i+j*mm_] = init;
+   }
 
-      if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value ) {
+      for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i )
             v_[i+j*mm_] = Type();
-      }
    }
 }
 /*! \endcond */
@@ -2983,6 +3322,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other*
    , n_       ( n )                            // The current number of columns of the matrix
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    for( size_t j=0UL; j<n; ++j ) {
       for( size_t i=0UL; i<m; ++i )
@@ -3030,6 +3370,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[M][N] )
    , n_       ( N )                            // The current number of columns of the matrix
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    for( size_t j=0UL; j<N; ++j ) {
       for( size_t i=0UL; i<M; ++i )
@@ -3052,7 +3393,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[M][N] )
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. In case the parallel first-touch
+// initialization is active (see the blaze::useParallelFirstTouch setting), the elements are
+// copied by the active SMP backend.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
@@ -3061,11 +3404,23 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
    , n_       ( m.n_  )                        // The current number of columns of the matrix
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = m.v_[i];
+   if( useParallelFirstTouch ) {
+      smpAssign( *this, m );
+
+      if( IsVectorizable<Type>::value ) {
+         for( size_t j=0UL; j<n_; ++j )
+            for( size_t i=m_; i<mm_; ++i )
+               v_[i+j*mm_] = Type();
+      }
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = m.v_[i];
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3086,15 +3441,26 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
    , n_       ( (~m).columns() )               // The current number of columns of the matrix
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   , version_ ( 0UL )                          // The modification counter
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
-                  i<( IsVectorizable<Type>::value ? mm_ : m_ ); ++i ) {
-         v_[i+j*mm_] = Type();
+   if( IsSparseMatrix<MT>::value ) {
+      if( useParallelFirstTouch ) {
+         smpFill( *this, Type() );
+      }
+      else {
+         for( size_t j=0UL; j<n_; ++j )
+            for( size_t i=0UL; i<m_; ++i )
+               v_[i+j*mm_] = Type();
       }
    }
 
    smpAssign( *this, ~m );
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=m_; i<mm_; ++i )
+            v_[i+j*mm_] = Type();
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3393,6 +3759,8 @@ template< typename Other   // Data type of the initialization array
         , size_t N >       // Number of columns of the initialization array
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Other (&array)[M][N] )
 {
+   ++version_;
+
    resize( M, N, false );
 
    for( size_t j=0UL; j<N; ++j )
@@ -3415,6 +3783,8 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Othe
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Type& rhs )
 {
+   ++version_;
+
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
          v_[i+j*mm_] = rhs;
@@ -3438,6 +3808,8 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Type
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const DynamicMatrix& rhs )
 {
+   ++version_;
+
    if( &rhs == this ) return *this;
 
    resize( rhs.m_, rhs.n_, false );
@@ -3464,6 +3836,8 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matrix<MT,SO>& rhs )
 {
+   ++version_;
+
    if( (~rhs).canAlias( this ) ) {
       DynamicMatrix tmp( ~rhs );
       swap( tmp );
@@ -3497,6 +3871,8 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
 {
+   ++version_;
+
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -3531,6 +3907,8 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
 {
+   ++version_;
+
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -3565,6 +3943,8 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator*=( const Matrix<MT,SO>& rhs )
 {
+   ++version_;
+
    if( (~rhs).rows() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -3591,6 +3971,8 @@ template< typename Other >  // Data type of the right-hand side scalar
 inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true> >::Type&
    DynamicMatrix<Type,true>::operator*=( Other rhs )
 {
+   ++version_;
+
    smpAssign( *this, (*this) * rhs );
    return *this;
 }
@@ -3611,6 +3993,8 @@ template< typename Other >  // Data type of the right-hand side scalar
 inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true> >::Type&
    DynamicMatrix<Type,true>::operator/=( Other rhs )
 {
+   ++version_;
+
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
    smpAssign( *this, (*this) / rhs );
@@ -3756,6 +4140,28 @@ inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current modification counter of the matrix.
+//
+// \return The current value of the modification counter.
+//
+// The modification counter is incremented by every operation that potentially changes the
+// matrix as a whole (assignment, arithmetic assignment, resizing, resetting, swapping, ...).
+// It can for instance be used to detect whether a result computed from the matrix is outdated
+// (see the CachedExpression class template). Note that element accesses via the subscript/
+// function call operator, iterators, or the data() function as well as modifications via
+// views are not tracked.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t DynamicMatrix<Type,true>::version() const
+{
+   return version_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Reset to the default initial values.
@@ -3765,6 +4171,8 @@ inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
 template< typename Type >  // Data type of the matrix
 inline void DynamicMatrix<Type,true>::reset()
 {
+   ++version_;
+
    using blaze::clear;
 
    for( size_t j=0UL; j<n_; ++j )
@@ -3788,6 +4196,8 @@ inline void DynamicMatrix<Type,true>::reset()
 template< typename Type >  // Data type of the matrix
 inline void DynamicMatrix<Type,true>::reset( size_t j )
 {
+   ++version_;
+
    using blaze::clear;
 
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3853,6 +4263,8 @@ inline void DynamicMatrix<Type,true>::clear()
 template< typename Type >  // Data type of the matrix
 void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 {
+   ++version_;
+
    using blaze::min;
 
    if( m == m_ && n == n_ ) return;
@@ -3963,8 +4375,19 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 {
-   DynamicMatrix tmp( trans(*this) );
-   swap( tmp );
+   ++version_;
+
+   if( m_ == n_ ) {
+      smpTranspose( *this );
+   }
+   else if( m_ * adjustRows( n_ ) <= capacity_ ) {
+      transposeNonSquare<false>();
+   }
+   else {
+      DynamicMatrix tmp( trans(*this) );
+      swap( tmp );
+   }
+
    return *this;
 }
 /*! \endcond */
@@ -3980,8 +4403,19 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
 {
-   DynamicMatrix tmp( ctrans(*this) );
-   swap( tmp );
+   ++version_;
+
+   if( m_ == n_ ) {
+      smpCTranspose( *this );
+   }
+   else if( m_ * adjustRows( n_ ) <= capacity_ ) {
+      transposeNonSquare<true>();
+   }
+   else {
+      DynamicMatrix tmp( ctrans(*this) );
+      swap( tmp );
+   }
+
    return *this;
 }
 /*! \endcond */
@@ -3999,6 +4433,8 @@ template< typename Type >   // Data type of the matrix
 template< typename Other >  // Data type of the scalar value
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::scale( const Other& scalar )
 {
+   ++version_;
+
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
          v_[i+j*mm_] *= scalar;
@@ -4025,6 +4461,9 @@ inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) /* throw() */
    std::swap( n_ , m.n_  );
    std::swap( capacity_, m.capacity_ );
    std::swap( v_ , m.v_  );
+
+   ++version_;
+   ++m.version_;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4048,6 +4487,47 @@ inline size_t DynamicMatrix<Type,true>::adjustRows( size_t minRows ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place (conjugate) transposition of a non-square matrix.
+//
+// \return void
+//
+// This function transposes the non-square matrix within the currently allocated memory. For
+// that purpose, the columns are first compacted by removing the padding elements, the resulting
+// contiguous matrix is transposed in-place by the active SMP backend (see the class template
+// ContiguousTransposition), and finally the new columns are spread according to the new padding.
+// The compaction and the spreading move overlapping memory ranges and are therefore performed
+// serially. The function requires that the current capacity is sufficient for the padded
+// transpose of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+template< bool Conj >      // Conjugation flag
+inline void DynamicMatrix<Type,true>::transposeNonSquare()
+{
+   const size_t mm( adjustRows( n_ ) );
+
+   BLAZE_INTERNAL_ASSERT( m_ * mm <= capacity_, "Insufficient capacity detected" );
+
+   for( size_t j=1UL; j<n_; ++j ) {
+      std::copy( v_+j*mm_, v_+j*mm_+m_, v_+j*m_ );
+   }
+
+   ContiguousTransposition<Conj,Type> kernel( v_, n_, m_ );
+   smpTransposeContiguous( kernel );
+
+   for( size_t j=m_; j>0UL; --j ) {
+      std::copy_backward( v_+(j-1UL)*n_, v_+j*n_, v_+(j-1UL)*mm+n_ );
+      std::fill( v_+(j-1UL)*mm+n_, v_+j*mm, Type() );
+   }
+
+   std::swap( m_, n_ );
+   mm_ = mm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -4439,6 +4919,16 @@ inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vect
       {
          size_t i( 0UL );
 
+         for( ; (i+IT::size*3UL) < ipos; i+=IT::size*4UL ) {
+            const IntrinsicType xmm1( (~rhs).load(i             ,j) );
+            const IntrinsicType xmm2( (~rhs).load(i+IT::size    ,j) );
+            const IntrinsicType xmm3( (~rhs).load(i+IT::size*2UL,j) );
+            const IntrinsicType xmm4( (~rhs).load(i+IT::size*3UL,j) );
+            stream( i             , j, xmm1 );
+            stream( i+IT::size    , j, xmm2 );
+            stream( i+IT::size*2UL, j, xmm3 );
+            stream( i+IT::size*3UL, j, xmm4 );
+         }
          for( ; i<ipos; i+=IT::size ) {
             stream( i, j, (~rhs).load(i,j) );
          }
@@ -4487,7 +4977,8 @@ inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vect
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4693,7 +5184,8 @@ inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vect
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4912,7 +5404,8 @@ inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vect
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5060,6 +5553,87 @@ inline void reset( DynamicMatrix<Type,SO>& m )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reset the specified row/column of the given dynamic matrix.
 // \ingroup dynamic_matrix
@@ -43,6 +43,7 @@
 #include <algorithm>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Forward.h>
@@ -67,6 +68,7 @@
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
 #include <blaze/system/Thresholds.h>
@@ -283,6 +285,7 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
                               inline size_t         size() const;
                               inline size_t         capacity() const;
                               inline size_t         nonZeros() const;
+                              inline size_t         version() const;
                               inline void           reset();
                               inline void           clear();
                               inline void           resize( size_t n, bool preserve=true );
@@ -425,6 +428,7 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
                                   \f[\left(\begin{array}{*{5}{c}}
                                   0 & 1 & 2 & \cdots & N-1 \\
                                   \end{array}\right)\f] */
+   size_t version_;          //!< The modification counter of the vector.
    //@}
    //**********************************************************************************************
 
@@ -457,6 +461,7 @@ inline DynamicVector<Type,TF>::DynamicVector()
    : size_    ( 0UL )   // The current size/dimension of the vector
    , capacity_( 0UL )   // The maximum capacity of the vector
    , v_       ( NULL )  // The vector elements
+   , version_ ( 0UL )   // The modification counter
 {}
 //*************************************************************************************************
 
@@ -475,6 +480,7 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    : size_    ( n )                            // The current size/dimension of the vector
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   , version_ ( 0UL )                          // The modification counter
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -490,7 +496,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
 //
-// All vector elements are initialized with the specified value.
+// All vector elements are initialized with the specified value. In case the parallel first-touch
+// initialization is active (see the blaze::useParallelFirstTouch setting), the initialization is
+// performed by the active SMP backend.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -498,9 +506,15 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    : size_    ( n )                            // The current size/dimension of the vector
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   , version_ ( 0UL )                          // The modification counter
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( useParallelFirstTouch ) {
+      smpFill( *this, init );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -537,6 +551,7 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
    : size_    ( n )                            // The current size/dimension of the vector
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   , version_ ( 0UL )                          // The modification counter
 {
    for( size_t i=0UL; i<n; ++i )
       v_[i] = array[i];
@@ -574,6 +589,7 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[N] )
    : size_    ( N )                            // The current size/dimension of the vector
    , capacity_( adjustCapacity( N ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   , version_ ( 0UL )                          // The modification counter
 {
    for( size_t i=0UL; i<N; ++i )
       v_[i] = array[i];
@@ -592,7 +608,9 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[N] )
 // \param v Vector to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. In case the parallel first-touch
+// initialization is active (see the blaze::useParallelFirstTouch setting), the elements are
+// copied by the active SMP backend.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -600,11 +618,20 @@ inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
    : size_    ( v.size_ )                      // The current size/dimension of the vector
    , capacity_( adjustCapacity( v.size_ ) )    // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   , version_ ( 0UL )                          // The modification counter
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
-      v_[i] = v.v_[i];
+   if( useParallelFirstTouch ) {
+      smpAssign( *this, v );
+
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = v.v_[i];
+   }
+   else {
+      for( size_t i=0UL; i<capacity_; ++i )
+         v_[i] = v.v_[i];
+   }
 }
 //*************************************************************************************************
 
@@ -621,6 +648,7 @@ inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
    : size_    ( (~v).size() )                  // The current size/dimension of the vector
    , capacity_( adjustCapacity( size_ ) )      // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   , version_ ( 0UL )                          // The modification counter
 {
    for( size_t i=( IsSparseVector<VT>::value   ? 0UL       : size_ );
                i<( IsVectorizable<Type>::value ? capacity_ : size_ ); ++i ) {
@@ -842,6 +870,8 @@ template< typename Other  // Data type of the initialization array
         , size_t N >      // Dimension of the initialization array
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Other (&array)[N] )
 {
+   ++version_;
+
    resize( N, false );
 
    for( size_t i=0UL; i<N; ++i )
@@ -862,6 +892,8 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Type& rhs )
 {
+   ++version_;
+
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = rhs;
    return *this;
@@ -882,6 +914,8 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicVector& rhs )
 {
+   ++version_;
+
    if( &rhs == this ) return *this;
 
    resize( rhs.size_, false );
@@ -905,6 +939,8 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Vector<VT,TF>& rhs )
 {
+   ++version_;
+
    if( (~rhs).canAlias( this ) ) {
       DynamicVector tmp( ~rhs );
       swap( tmp );
@@ -936,6 +972,8 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
 {
+   ++version_;
+
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
@@ -969,6 +1007,8 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
 {
+   ++version_;
+
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
@@ -1002,6 +1042,8 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator*=( const Vector<VT,TF>& rhs )
 {
+   ++version_;
+
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
@@ -1032,6 +1074,8 @@ template< typename Other >  // Data type of the right-hand side scalar
 inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF> >::Type&
    DynamicVector<Type,TF>::operator*=( Other rhs )
 {
+   ++version_;
+
    smpAssign( *this, (*this) * rhs );
    return *this;
 }
@@ -1053,6 +1097,8 @@ template< typename Other >  // Data type of the right-hand side scalar
 inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF> >::Type&
    DynamicVector<Type,TF>::operator/=( Other rhs )
 {
+   ++version_;
+
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
    smpAssign( *this, (*this) / rhs );
@@ -1121,6 +1167,27 @@ inline size_t DynamicVector<Type,TF>::nonZeros() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the current modification counter of the vector.
+//
+// \return The current value of the modification counter.
+//
+// The modification counter is incremented by every operation that potentially changes the
+// vector as a whole (assignment, arithmetic assignment, resizing, resetting, swapping, ...).
+// It can for instance be used to detect whether a result computed from the vector is outdated
+// (see the CachedExpression class template). Note that element accesses via the subscript/
+// function call operator, iterators, or the data() function as well as modifications via
+// views are not tracked.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline size_t DynamicVector<Type,TF>::version() const
+{
+   return version_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reset to the default initial values.
 //
@@ -1130,6 +1197,8 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline void DynamicVector<Type,TF>::reset()
 {
+   ++version_;
+
    using blaze::clear;
    for( size_t i=0UL; i<size_; ++i )
       clear( v_[i] );
@@ -1186,6 +1255,8 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 {
+   ++version_;
+
    if( n > capacity_ )
    {
       // Allocating a new array
@@ -1286,6 +1357,8 @@ template< typename Type     // Data type of the vector
 template< typename Other >  // Data type of the scalar value
 inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::scale( const Other& scalar )
 {
+   ++version_;
+
    for( size_t i=0UL; i<size_; ++i )
       v_[i] *= scalar;
    return *this;
@@ -1307,6 +1380,9 @@ inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) /* throw() */
    std::swap( size_, v.size_ );
    std::swap( capacity_, v.capacity_ );
    std::swap( v_, v.v_ );
+
+   ++version_;
+   ++v.version_;
 }
 //*************************************************************************************************
 
@@ -1673,10 +1749,24 @@ inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vector
    const size_t ipos( ( remainder )?( size_ & size_t(-IT::size) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (IT::size) ) ) == ipos, "Invalid end calculation" );
 
+   // In the streaming case all loads of a block of four intrinsic elements are performed before
+   // the corresponding non-temporal stores. Thus the loads of all operands of a multi-operand
+   // expression (as for instance 'a*alpha + b*beta - c*gamma') are issued back-to-back, which
+   // keeps the write-combining buffers from being interleaved with the operand streams.
    if( useStreaming && size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
    {
-      size_t i=0UL;
+      size_t i( 0UL );
 
+      for( ; (i+IT::size*3UL) < ipos; i+=IT::size*4UL ) {
+         const IntrinsicType xmm1( (~rhs).load(i             ) );
+         const IntrinsicType xmm2( (~rhs).load(i+IT::size    ) );
+         const IntrinsicType xmm3( (~rhs).load(i+IT::size*2UL) );
+         const IntrinsicType xmm4( (~rhs).load(i+IT::size*3UL) );
+         stream( i             , xmm1 );
+         stream( i+IT::size    , xmm2 );
+         stream( i+IT::size*2UL, xmm3 );
+         stream( i+IT::size*3UL, xmm4 );
+      }
       for( ; i<ipos; i+=IT::size ) {
          stream( i, (~rhs).load(i) );
       }
@@ -1783,6 +1873,9 @@ inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vector
 
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
+   if( dispatchedAddAssign( *this, ~rhs ) )
+      return;
+
    const bool remainder( !usePadding || !IsPadded<VT>::value );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-IT::size) ):( size_ ) );
@@ -1884,6 +1977,9 @@ inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vector
 
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
+   if( dispatchedSubAssign( *this, ~rhs ) )
+      return;
+
    const bool remainder( !usePadding || !IsPadded<VT>::value );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-IT::size) ):( size_ ) );
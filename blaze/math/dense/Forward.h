@@ -51,6 +51,7 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool > class CompactDiagonalMatrix;
 template< typename, bool, bool, bool > class CustomMatrix;
 template< typename, bool, bool, bool > class CustomVector;
 template< typename, bool > class DynamicVector;
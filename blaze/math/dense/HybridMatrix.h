@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
@@ -401,6 +402,20 @@ class HybridMatrix : public DenseMatrix< HybridMatrix<Type,M,N,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::transposition &&
+                     IsColumnMajorMatrix<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -427,6 +442,10 @@ class HybridMatrix : public DenseMatrix< HybridMatrix<Type,M,N,SO>, SO >
    inline typename EnableIf< VectorizedAssign<MT> >::Type
       assign( const DenseMatrix<MT,SO2>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -438,6 +457,10 @@ class HybridMatrix : public DenseMatrix< HybridMatrix<Type,M,N,SO>, SO >
    inline typename EnableIf< VectorizedAddAssign<MT> >::Type
       addAssign( const DenseMatrix<MT,SO2>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void addAssign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void addAssign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -449,6 +472,10 @@ class HybridMatrix : public DenseMatrix< HybridMatrix<Type,M,N,SO>, SO >
    inline typename EnableIf< VectorizedSubAssign<MT> >::Type
       subAssign( const DenseMatrix<MT,SO2>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void subAssign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void subAssign( const SparseMatrix<MT,!SO>& rhs );
    //@}
@@ -2446,6 +2473,33 @@ inline typename EnableIf< typename HybridMatrix<Type,M,N,SO>::BLAZE_TEMPLATE Vec
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename HybridMatrix<Type,M,N,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   HybridMatrix<Type,M,N,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == m_ && (~rhs).columns() == n_, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -2606,6 +2660,33 @@ inline typename EnableIf< typename HybridMatrix<Type,M,N,SO>::BLAZE_TEMPLATE Vec
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename HybridMatrix<Type,M,N,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   HybridMatrix<Type,M,N,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == m_ && (~rhs).columns() == n_, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
 //
@@ -2766,6 +2847,33 @@ inline typename EnableIf< typename HybridMatrix<Type,M,N,SO>::BLAZE_TEMPLATE Vec
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename HybridMatrix<Type,M,N,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   HybridMatrix<Type,M,N,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == m_ && (~rhs).columns() == n_, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
 //
@@ -3041,6 +3149,18 @@ class HybridMatrix<Type,M,N,true> : public DenseMatrix< HybridMatrix<Type,M,N,tr
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::transposition &&
+                     IsRowMajorMatrix<MT>::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -3067,6 +3187,10 @@ class HybridMatrix<Type,M,N,true> : public DenseMatrix< HybridMatrix<Type,M,N,tr
    inline typename EnableIf< VectorizedAssign<MT> >::Type
       assign( const DenseMatrix<MT,SO>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -3078,6 +3202,10 @@ class HybridMatrix<Type,M,N,true> : public DenseMatrix< HybridMatrix<Type,M,N,tr
    inline typename EnableIf< VectorizedAddAssign<MT> >::Type
       addAssign( const DenseMatrix<MT,SO>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void addAssign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void addAssign( const SparseMatrix<MT,false>& rhs );
 
@@ -3089,6 +3217,10 @@ class HybridMatrix<Type,M,N,true> : public DenseMatrix< HybridMatrix<Type,M,N,tr
    inline typename EnableIf< VectorizedSubAssign<MT> >::Type
       subAssign( const DenseMatrix<MT,SO>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void subAssign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void subAssign( const SparseMatrix<MT,false>& rhs );
    //@}
@@ -5091,6 +5223,34 @@ inline typename EnableIf< typename HybridMatrix<Type,M,N,true>::BLAZE_TEMPLATE V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename HybridMatrix<Type,M,N,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   HybridMatrix<Type,M,N,true>::assign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == m_ && (~rhs).columns() == n_, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -5255,6 +5415,34 @@ inline typename EnableIf< typename HybridMatrix<Type,M,N,true>::BLAZE_TEMPLATE V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename HybridMatrix<Type,M,N,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   HybridMatrix<Type,M,N,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == m_ && (~rhs).columns() == n_, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
@@ -5419,6 +5607,34 @@ inline typename EnableIf< typename HybridMatrix<Type,M,N,true>::BLAZE_TEMPLATE V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename HybridMatrix<Type,M,N,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   HybridMatrix<Type,M,N,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == m_ && (~rhs).columns() == n_, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
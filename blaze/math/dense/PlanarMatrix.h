@@ -0,0 +1,735 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PlanarMatrix.h
+//  \brief Header file for the implementation of a planar complex dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PLANARMATRIX_H_
+#define _BLAZE_MATH_DENSE_PLANARMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup planar_matrix PlanarMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a complex matrix with split real and imaginary parts.
+// \ingroup planar_matrix
+//
+// The PlanarMatrix class template is the planar (split) counterpart of a DynamicMatrix of
+// complex values: the real and imaginary parts are stored in two separate dynamic matrices of
+// the underlying floating point type:
+
+   \code
+   template< typename Type, bool SO >
+   class PlanarMatrix;
+   \endcode
+
+//  - Type: specifies the floating point type of the real and imaginary parts (\c float or
+//          \c double).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// All complex operations are decomposed into real operations on the two parts, which are
+// evaluated by the vectorized (and, if available, BLAS accelerated) real kernels of the
+// DynamicMatrix class template. In particular, complex matrix multiplications can be computed
+// either by four real matrix multiplications (see the gemm4m() function) or by three real
+// matrix multiplications (see the gemm3m() function):
+
+   \code
+   using blaze::PlanarMatrix;
+   using blaze::DynamicMatrix;
+
+   DynamicMatrix< complex<double> > A( 500UL, 300UL ), B( 300UL, 400UL );
+   // ... Initialization
+
+   PlanarMatrix<double> PA( A ), PB( B ), PC;
+
+   gemm3m( PC, PA, PB );  // Complex matrix multiplication via three real multiplications
+
+   DynamicMatrix< complex<double> > C( interleave( PC ) );
+   \endcode
+*/
+template< typename Type                 // Floating point type of the real and imaginary parts
+        , bool SO = defaultStorageOrder >  // Storage order
+class PlanarMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef PlanarMatrix<Type,SO>   This;           //!< Type of this PlanarMatrix instance.
+   typedef complex<Type>           ElementType;    //!< Type of the matrix elements.
+   typedef Type                    ValueType;      //!< Type of the real and imaginary parts.
+   typedef DynamicMatrix<Type,SO>  ComponentType;  //!< Type of the real and imaginary part matrices.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PlanarMatrix();
+   explicit inline PlanarMatrix( size_t m, size_t n );
+   explicit inline PlanarMatrix( size_t m, size_t n, const ElementType& init );
+
+   template< typename MT >
+   explicit inline PlanarMatrix( const DenseMatrix<MT,SO>& m );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ElementType operator()( size_t i, size_t j ) const;
+   inline void        set( size_t i, size_t j, const ElementType& value );
+
+   inline ComponentType&       real();
+   inline const ComponentType& real() const;
+   inline ComponentType&       imag();
+   inline const ComponentType& imag() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   template< typename MT > inline PlanarMatrix& operator=( const DenseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t m, size_t n, bool preserve=true );
+   inline void   swap( PlanarMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ComponentType real_;  //!< The real parts of the matrix elements.
+   ComponentType imag_;  //!< The imaginary parts of the matrix elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PlanarMatrix.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline PlanarMatrix<Type,SO>::PlanarMatrix()
+   : real_()  // The real parts of the matrix elements
+   , imag_()  // The imaginary parts of the matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The elements are initialized to zero.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline PlanarMatrix<Type,SO>::PlanarMatrix( size_t m, size_t n )
+   : real_( m, n, Type() )  // The real parts of the matrix elements
+   , imag_( m, n, Type() )  // The imaginary parts of the matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \f$ m \times n \f$ matrix elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param init The initial value of the matrix elements.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline PlanarMatrix<Type,SO>::PlanarMatrix( size_t m, size_t n, const ElementType& init )
+   : real_( m, n, init.real() )  // The real parts of the matrix elements
+   , imag_( m, n, init.imag() )  // The imaginary parts of the matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from an interleaved complex dense matrix.
+//
+// \param m Dense matrix of complex values to be split into real and imaginary parts.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the foreign dense matrix
+inline PlanarMatrix<Type,SO>::PlanarMatrix( const DenseMatrix<MT,SO>& m )
+   : real_( blaze::real( ~m ) )  // The real parts of the matrix elements
+   , imag_( blaze::imag( ~m ) )  // The imaginary parts of the matrix elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The complex value of the accessed element.
+//
+// Since the real and imaginary parts are stored separately, the element is returned by value.
+// Use the set() function or the real() and imag() functions to modify elements.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline typename PlanarMatrix<Type,SO>::ElementType
+   PlanarMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return ElementType( real_(i,j), imag_(i,j) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of a single matrix element.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The new complex value of the element.
+// \return void
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void PlanarMatrix<Type,SO>::set( size_t i, size_t j, const ElementType& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   real_(i,j) = value.real();
+   imag_(i,j) = value.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the real parts of the matrix elements.
+//
+// \return Reference to the dense matrix of real parts.
+//
+// Note that the size of the real part must not be changed via the returned reference.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline typename PlanarMatrix<Type,SO>::ComponentType& PlanarMatrix<Type,SO>::real()
+{
+   return real_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the real parts of the matrix elements.
+//
+// \return Reference to the dense matrix of real parts.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline const typename PlanarMatrix<Type,SO>::ComponentType& PlanarMatrix<Type,SO>::real() const
+{
+   return real_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the imaginary parts of the matrix elements.
+//
+// \return Reference to the dense matrix of imaginary parts.
+//
+// Note that the size of the imaginary part must not be changed via the returned reference.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline typename PlanarMatrix<Type,SO>::ComponentType& PlanarMatrix<Type,SO>::imag()
+{
+   return imag_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the imaginary parts of the matrix elements.
+//
+// \return Reference to the dense matrix of imaginary parts.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline const typename PlanarMatrix<Type,SO>::ComponentType& PlanarMatrix<Type,SO>::imag() const
+{
+   return imag_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment from an interleaved complex dense matrix.
+//
+// \param rhs Dense matrix of complex values to be split into real and imaginary parts.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given dense matrix.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline PlanarMatrix<Type,SO>& PlanarMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   real_ = blaze::real( ~rhs );
+   imag_ = blaze::imag( ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline size_t PlanarMatrix<Type,SO>::rows() const
+{
+   BLAZE_INTERNAL_ASSERT( real_.rows() == imag_.rows(), "Invalid real and imaginary parts" );
+   return real_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline size_t PlanarMatrix<Type,SO>::columns() const
+{
+   BLAZE_INTERNAL_ASSERT( real_.columns() == imag_.columns(), "Invalid real and imaginary parts" );
+   return real_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void PlanarMatrix<Type,SO>::reset()
+{
+   real_.reset();
+   imag_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void PlanarMatrix<Type,SO>::clear()
+{
+   real_.clear();
+   imag_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// In case the size of the matrix is increased, new elements are not initialized.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void PlanarMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   real_.resize( m, n, preserve );
+   imag_.resize( m, n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void PlanarMatrix<Type,SO>::swap( PlanarMatrix& m ) /* throw() */
+{
+   real_.swap( m.real_ );
+   imag_.swap( m.imag_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLANARMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PlanarMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void swap( PlanarMatrix<Type,SO>& a, PlanarMatrix<Type,SO>& b ) /* throw() */;
+
+template< typename Type, bool SO >
+inline const DynamicMatrix<complex<Type>,SO> interleave( const PlanarMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void add( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO>& A, const PlanarMatrix<Type,SO>& B );
+
+template< typename Type, bool SO >
+inline void sub( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO>& A, const PlanarMatrix<Type,SO>& B );
+
+template< typename Type, bool SO >
+inline void conj( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO>& A );
+
+template< typename Type, bool SO, bool SO1, bool SO2 >
+inline void gemm4m( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO1>& A, const PlanarMatrix<Type,SO2>& B );
+
+template< typename Type, bool SO, bool SO1, bool SO2 >
+inline void gemm3m( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO1>& A, const PlanarMatrix<Type,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two planar matrices.
+// \ingroup planar_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void swap( PlanarMatrix<Type,SO>& a, PlanarMatrix<Type,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a planar matrix to an interleaved complex matrix.
+// \ingroup planar_matrix
+//
+// \param m The planar matrix to be converted.
+// \return The according dense matrix of interleaved complex values.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline const DynamicMatrix<complex<Type>,SO> interleave( const PlanarMatrix<Type,SO>& m )
+{
+   const size_t M( m.rows()    );
+   const size_t N( m.columns() );
+
+   DynamicMatrix<complex<Type>,SO> tmp( M, N );
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         tmp(i,j) = complex<Type>( m.real()(i,j), m.imag()(i,j) );
+      }
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of two planar matrices (\f$ C=A+B \f$).
+// \ingroup planar_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The target matrix may be identical to any of the operands.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void add( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO>& A, const PlanarMatrix<Type,SO>& B )
+{
+   if( A.rows() != B.rows() || A.columns() != B.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   C.real() = A.real() + B.real();
+   C.imag() = A.imag() + B.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of two planar matrices (\f$ C=A-B \f$).
+// \ingroup planar_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The target matrix may be identical to any of the operands.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void sub( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO>& A, const PlanarMatrix<Type,SO>& B )
+{
+   if( A.rows() != B.rows() || A.columns() != B.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   C.real() = A.real() - B.real();
+   C.imag() = A.imag() - B.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise complex conjugate of a planar matrix (\f$ C=\overline{A} \f$).
+// \ingroup planar_matrix
+//
+// \param C The target matrix.
+// \param A The operand.
+// \return void
+//
+// The target matrix may be identical to the operand.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO >      // Storage order
+inline void conj( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO>& A )
+{
+   C.real() = A.real();
+   C.imag() = -A.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Complex matrix multiplication by four real matrix multiplications (\f$ C=A*B \f$).
+// \ingroup planar_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the complex matrix product by the conventional 4M algorithm
+
+      \f[ C^r = A^r B^r - A^i B^i, \quad C^i = A^r B^i + A^i B^r, \f]
+
+// i.e. by four real matrix multiplications, which are evaluated by the optimized real kernels.
+// The target matrix may be identical to any of the operands.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO        // Storage order of the target matrix
+        , bool SO1       // Storage order of the left-hand side operand
+        , bool SO2 >     // Storage order of the right-hand side operand
+inline void gemm4m( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO1>& A, const PlanarMatrix<Type,SO2>& B )
+{
+   if( A.columns() != B.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   DynamicMatrix<Type,SO> re( A.real() * B.real() );
+   re -= A.imag() * B.imag();
+
+   DynamicMatrix<Type,SO> im( A.real() * B.imag() );
+   im += A.imag() * B.real();
+
+   C.real().swap( re );
+   C.imag().swap( im );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Complex matrix multiplication by three real matrix multiplications (\f$ C=A*B \f$).
+// \ingroup planar_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the complex matrix product by the 3M algorithm
+
+      \f[ T_1 = A^r B^r, \quad T_2 = A^i B^i, \quad T_3 = (A^r + A^i)(B^r + B^i), \f]
+      \f[ C^r = T_1 - T_2, \quad C^i = T_3 - T_1 - T_2, \f]
+
+// which trades one of the four real matrix multiplications of the gemm4m() function for three
+// matrix additions. For large matrices this saves up to 25% of the floating point operations at
+// the cost of a slightly larger rounding error in the imaginary part. The target matrix may be
+// identical to any of the operands.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool SO        // Storage order of the target matrix
+        , bool SO1       // Storage order of the left-hand side operand
+        , bool SO2 >     // Storage order of the right-hand side operand
+inline void gemm3m( PlanarMatrix<Type,SO>& C, const PlanarMatrix<Type,SO1>& A, const PlanarMatrix<Type,SO2>& B )
+{
+   if( A.columns() != B.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const DynamicMatrix<Type,SO1> AS( A.real() + A.imag() );
+   const DynamicMatrix<Type,SO2> BS( B.real() + B.imag() );
+
+   DynamicMatrix<Type,SO> re( A.real() * B.real() );
+   const DynamicMatrix<Type,SO> T2( A.imag() * B.imag() );
+
+   DynamicMatrix<Type,SO> im( AS * BS );
+   im -= re;
+   im -= T2;
+   re -= T2;
+
+   C.real().swap( re );
+   C.imag().swap( im );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,798 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PlanarVector.h
+//  \brief Header file for the implementation of a planar complex dense vector
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PLANARVECTOR_H_
+#define _BLAZE_MATH_DENSE_PLANARVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup planar_vector PlanarVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a complex vector with split real and imaginary parts.
+// \ingroup planar_vector
+//
+// The PlanarVector class template is the planar (split) counterpart of a DynamicVector of
+// complex values: instead of storing interleaved pairs of real and imaginary parts, the real
+// and imaginary parts are stored in two separate dynamic vectors of the underlying floating
+// point type:
+
+   \code
+   template< typename Type, bool TF >
+   class PlanarVector;
+   \endcode
+
+//  - Type: specifies the floating point type of the real and imaginary parts (\c float or
+//          \c double).
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//
+// Since all element-wise complex operations decompose into real operations on the two parts,
+// the planar layout avoids the shuffles that are necessary to process interleaved complex
+// values and all kernels (see the add(), sub(), mult(), conj() and abs() functions) are
+// evaluated by the fully vectorized real kernels of the DynamicVector class template:
+
+   \code
+   using blaze::PlanarVector;
+   using blaze::DynamicVector;
+
+   DynamicVector< complex<float> > a( 1000UL );
+   // ... Initialization
+
+   PlanarVector<float> x( a ), y( 1000UL ), z;
+   // ... Initialization
+
+   mult( z, x, y );                 // Element-wise complex multiplication
+   z.real() += 2.0F;                // Direct access to the real part
+
+   DynamicVector< complex<float> > b( interleave( z ) );  // Conversion to interleaved storage
+   \endcode
+
+// The choice between interleaved and planar storage is made per container: the PlanarVector
+// class template is meant for complex-heavy computations that are bound by element-wise
+// operations, whereas DynamicVector< complex<T> > remains the general purpose complex vector
+// that participates in all expression templates.
+*/
+template< typename Type                    // Floating point type of the real and imaginary parts
+        , bool TF = defaultTransposeFlag >  // Transpose flag
+class PlanarVector
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef PlanarVector<Type,TF>   This;           //!< Type of this PlanarVector instance.
+   typedef complex<Type>           ElementType;    //!< Type of the vector elements.
+   typedef Type                    ValueType;      //!< Type of the real and imaginary parts.
+   typedef DynamicVector<Type,TF>  ComponentType;  //!< Type of the real and imaginary part vectors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PlanarVector();
+   explicit inline PlanarVector( size_t n );
+   explicit inline PlanarVector( size_t n, const ElementType& init );
+
+   template< typename VT >
+   explicit inline PlanarVector( const DenseVector<VT,TF>& v );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ElementType operator[]( size_t index ) const;
+   inline void        set( size_t index, const ElementType& value );
+
+   inline ComponentType&       real();
+   inline const ComponentType& real() const;
+   inline ComponentType&       imag();
+   inline const ComponentType& imag() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   template< typename VT > inline PlanarVector& operator=( const DenseVector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   swap( PlanarVector& v ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ComponentType real_;  //!< The real parts of the vector elements.
+   ComponentType imag_;  //!< The imaginary parts of the vector elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PlanarVector.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline PlanarVector<Type,TF>::PlanarVector()
+   : real_()  // The real parts of the vector elements
+   , imag_()  // The imaginary parts of the vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a vector of size \a n.
+//
+// \param n The size of the vector.
+//
+// The elements are initialized to zero.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline PlanarVector<Type,TF>::PlanarVector( size_t n )
+   : real_( n, Type() )  // The real parts of the vector elements
+   , imag_( n, Type() )  // The imaginary parts of the vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \a n vector elements.
+//
+// \param n The size of the vector.
+// \param init The initial value of the vector elements.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline PlanarVector<Type,TF>::PlanarVector( size_t n, const ElementType& init )
+   : real_( n, init.real() )  // The real parts of the vector elements
+   , imag_( n, init.imag() )  // The imaginary parts of the vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from an interleaved complex dense vector.
+//
+// \param v Dense vector of complex values to be split into real and imaginary parts.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the foreign dense vector
+inline PlanarVector<Type,TF>::PlanarVector( const DenseVector<VT,TF>& v )
+   : real_( blaze::real( ~v ) )  // The real parts of the vector elements
+   , imag_( blaze::imag( ~v ) )  // The imaginary parts of the vector elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return The complex value of the accessed element.
+//
+// Since the real and imaginary parts are stored separately, the element is returned by value.
+// Use the set() function or the real() and imag() functions to modify elements.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline typename PlanarVector<Type,TF>::ElementType
+   PlanarVector<Type,TF>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid vector access index" );
+   return ElementType( real_[index], imag_[index] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of a single vector element.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The new complex value of the element.
+// \return void
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void PlanarVector<Type,TF>::set( size_t index, const ElementType& value )
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid vector access index" );
+   real_[index] = value.real();
+   imag_[index] = value.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the real parts of the vector elements.
+//
+// \return Reference to the dense vector of real parts.
+//
+// Note that the size of the real part must not be changed via the returned reference.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline typename PlanarVector<Type,TF>::ComponentType& PlanarVector<Type,TF>::real()
+{
+   return real_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the real parts of the vector elements.
+//
+// \return Reference to the dense vector of real parts.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline const typename PlanarVector<Type,TF>::ComponentType& PlanarVector<Type,TF>::real() const
+{
+   return real_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the imaginary parts of the vector elements.
+//
+// \return Reference to the dense vector of imaginary parts.
+//
+// Note that the size of the imaginary part must not be changed via the returned reference.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline typename PlanarVector<Type,TF>::ComponentType& PlanarVector<Type,TF>::imag()
+{
+   return imag_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the imaginary parts of the vector elements.
+//
+// \return Reference to the dense vector of imaginary parts.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline const typename PlanarVector<Type,TF>::ComponentType& PlanarVector<Type,TF>::imag() const
+{
+   return imag_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment from an interleaved complex dense vector.
+//
+// \param rhs Dense vector of complex values to be split into real and imaginary parts.
+// \return Reference to the assigned vector.
+//
+// The vector is resized according to the given dense vector.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline PlanarVector<Type,TF>& PlanarVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
+{
+   real_ = blaze::real( ~rhs );
+   imag_ = blaze::imag( ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the vector.
+//
+// \return The size of the vector.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline size_t PlanarVector<Type,TF>::size() const
+{
+   BLAZE_INTERNAL_ASSERT( real_.size() == imag_.size(), "Invalid real and imaginary parts" );
+   return real_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void PlanarVector<Type,TF>::reset()
+{
+   real_.reset();
+   imag_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the vector.
+//
+// \return void
+//
+// After the clear() function, the size of the vector is 0.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void PlanarVector<Type,TF>::clear()
+{
+   real_.clear();
+   imag_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the vector.
+//
+// \param n The new size of the vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+//
+// In case the size of the vector is increased, new elements are not initialized.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void PlanarVector<Type,TF>::resize( size_t n, bool preserve )
+{
+   real_.resize( n, preserve );
+   imag_.resize( n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vectors.
+//
+// \param v The vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void PlanarVector<Type,TF>::swap( PlanarVector& v ) /* throw() */
+{
+   real_.swap( v.real_ );
+   imag_.swap( v.imag_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLANAR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized planar kernels.
+// \ingroup planar_vector
+*/
+template< typename Type >  // Floating point type of the real and imaginary parts
+struct UseVectorizedPlanarKernel
+{
+   enum { value = IntrinsicTrait<Type>::addition &&
+                  IntrinsicTrait<Type>::subtraction &&
+                  IntrinsicTrait<Type>::multiplication };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized element-wise complex multiplication of planar operands.
+// \ingroup planar_vector
+//
+// \param zr The real parts of the result.
+// \param zi The imaginary parts of the result.
+// \param xr The real parts of the left-hand side operand.
+// \param xi The imaginary parts of the left-hand side operand.
+// \param yr The real parts of the right-hand side operand.
+// \param yi The imaginary parts of the right-hand side operand.
+// \param n The number of elements.
+// \return void
+//
+// The kernel computes the real and imaginary parts in a single pass over the operands. All
+// given arrays are expected to be properly aligned. Since every element of the result depends
+// on the according elements of the operands only, the result may be identical to an operand.
+*/
+template< typename Type >  // Floating point type of the real and imaginary parts
+BLAZE_ALWAYS_INLINE typename EnableIf< UseVectorizedPlanarKernel<Type> >::Type
+   planarMult( Type* zr, Type* zi, const Type* xr, const Type* xi,
+               const Type* yr, const Type* yi, size_t n )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const size_t ipos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=IT::size ) {
+      const IntrinsicType a( loada( xr+i ) );
+      const IntrinsicType b( loada( xi+i ) );
+      const IntrinsicType c( loada( yr+i ) );
+      const IntrinsicType d( loada( yi+i ) );
+      storea( zr+i, a*c - b*d );
+      storea( zi+i, a*d + b*c );
+   }
+
+   for( ; i<n; ++i ) {
+      const Type a( xr[i] ), b( xi[i] ), c( yr[i] ), d( yi[i] );
+      zr[i] = a*c - b*d;
+      zi[i] = a*d + b*c;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default element-wise complex multiplication of planar operands.
+// \ingroup planar_vector
+//
+// \param zr The real parts of the result.
+// \param zi The imaginary parts of the result.
+// \param xr The real parts of the left-hand side operand.
+// \param xi The imaginary parts of the left-hand side operand.
+// \param yr The real parts of the right-hand side operand.
+// \param yi The imaginary parts of the right-hand side operand.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type >  // Floating point type of the real and imaginary parts
+BLAZE_ALWAYS_INLINE typename DisableIf< UseVectorizedPlanarKernel<Type> >::Type
+   planarMult( Type* zr, Type* zi, const Type* xr, const Type* xi,
+               const Type* yr, const Type* yi, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      const Type a( xr[i] ), b( xi[i] ), c( yr[i] ), d( yi[i] );
+      zr[i] = a*c - b*d;
+      zi[i] = a*d + b*c;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLANARVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PlanarVector operators */
+//@{
+template< typename Type, bool TF >
+inline void swap( PlanarVector<Type,TF>& a, PlanarVector<Type,TF>& b ) /* throw() */;
+
+template< typename Type, bool TF >
+inline const DynamicVector<complex<Type>,TF> interleave( const PlanarVector<Type,TF>& v );
+
+template< typename Type, bool TF >
+inline void add( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x, const PlanarVector<Type,TF>& y );
+
+template< typename Type, bool TF >
+inline void sub( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x, const PlanarVector<Type,TF>& y );
+
+template< typename Type, bool TF >
+inline void mult( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x, const PlanarVector<Type,TF>& y );
+
+template< typename Type, bool TF >
+inline void conj( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x );
+
+template< typename Type, bool TF >
+inline void abs( DynamicVector<Type,TF>& r, const PlanarVector<Type,TF>& x );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two planar vectors.
+// \ingroup planar_vector
+//
+// \param a The first vector to be swapped.
+// \param b The second vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void swap( PlanarVector<Type,TF>& a, PlanarVector<Type,TF>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a planar vector to an interleaved complex vector.
+// \ingroup planar_vector
+//
+// \param v The planar vector to be converted.
+// \return The according dense vector of interleaved complex values.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline const DynamicVector<complex<Type>,TF> interleave( const PlanarVector<Type,TF>& v )
+{
+   const size_t n( v.size() );
+
+   DynamicVector<complex<Type>,TF> tmp( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      tmp[i] = complex<Type>( v.real()[i], v.imag()[i] );
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise addition of two planar vectors (\f$ \vec{z}=\vec{x}+\vec{y} \f$).
+// \ingroup planar_vector
+//
+// \param z The target vector.
+// \param x The left-hand side operand.
+// \param y The right-hand side operand.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The target vector may be identical to any of the operands.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void add( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x, const PlanarVector<Type,TF>& y )
+{
+   if( x.size() != y.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   z.real() = x.real() + y.real();
+   z.imag() = x.imag() + y.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise subtraction of two planar vectors (\f$ \vec{z}=\vec{x}-\vec{y} \f$).
+// \ingroup planar_vector
+//
+// \param z The target vector.
+// \param x The left-hand side operand.
+// \param y The right-hand side operand.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The target vector may be identical to any of the operands.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void sub( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x, const PlanarVector<Type,TF>& y )
+{
+   if( x.size() != y.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   z.real() = x.real() - y.real();
+   z.imag() = x.imag() - y.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise multiplication of two planar vectors (\f$ \vec{z}=\vec{x}*\vec{y} \f$).
+// \ingroup planar_vector
+//
+// \param z The target vector.
+// \param x The left-hand side operand.
+// \param y The right-hand side operand.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the element-wise complex product
+// \f$ z_i = (x^r_i y^r_i - x^i_i y^i_i) + i (x^r_i y^i_i + x^i_i y^r_i) \f$ by means of four
+// vectorized real multiplications in a single pass over the operands, i.e. without any shuffle
+// operations. The target vector may be identical to any of the operands.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void mult( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x, const PlanarVector<Type,TF>& y )
+{
+   if( x.size() != y.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const size_t n( x.size() );
+
+   if( &z != &x && &z != &y ) {
+      z.resize( n, false );
+   }
+
+   planarMult( z.real().data(), z.imag().data(), x.real().data(), x.imag().data(),
+               y.real().data(), y.imag().data(), n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise complex conjugate of a planar vector (\f$ \vec{z}=\overline{\vec{x}} \f$).
+// \ingroup planar_vector
+//
+// \param z The target vector.
+// \param x The operand.
+// \return void
+//
+// The target vector may be identical to the operand.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void conj( PlanarVector<Type,TF>& z, const PlanarVector<Type,TF>& x )
+{
+   z.real() = x.real();
+   z.imag() = -x.imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise absolute value of a planar vector (\f$ r_i=|x_i| \f$).
+// \ingroup planar_vector
+//
+// \param r The target vector for the absolute values.
+// \param x The operand.
+// \return void
+//
+// The squared magnitudes are computed by vectorized real operations, followed by a single
+// square root per element.
+*/
+template< typename Type  // Floating point type of the real and imaginary parts
+        , bool TF >      // Transpose flag
+inline void abs( DynamicVector<Type,TF>& r, const PlanarVector<Type,TF>& x )
+{
+   r = x.real() * x.real() + x.imag() * x.imag();
+
+   const size_t n( r.size() );
+   for( size_t i=0UL; i<n; ++i ) {
+      r[i] = std::sqrt( r[i] );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,891 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/QuantizedMult.h
+//  \brief Header file for the quantized dense matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_QUANTIZEDMULT_H_
+#define _BLAZE_MATH_DENSE_QUANTIZEDMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsColumn.h>
+#include <blaze/math/typetraits/IsRow.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSubvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/constraints/Signed.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  QUANTIZED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized quantized kernels.
+// \ingroup dense_matrix
+*/
+template< typename ET >  // Element type of the quantized operands
+struct UseVectorizedQuantizedKernel
+{
+   enum { value = ( BLAZE_SSE2_MODE || BLAZE_AVX2_MODE ) && !BLAZE_MIC_MODE };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot products of a row of \a A with four adjacent columns of \a B.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the row of \a A.
+// \param b Pointer to the first element of the first column of \a B.
+// \param ldb The spacing between two columns of \a B.
+// \param K The number of elements of the row.
+// \param res The four resulting 32-bit dot products.
+// \return void
+*/
+template< typename ET >  // Element type of the quantized operands
+BLAZE_ALWAYS_INLINE typename EnableIf< UseVectorizedQuantizedKernel<ET> >::Type
+   qdot4( const ET* a, const ET* b, size_t ldb, size_t K, int32_t* res )
+{
+   typedef IntrinsicTrait<ET>  IT;
+   typedef typename IT::Type   IntrinsicType;
+
+   const ET* b1( b );
+   const ET* b2( b1 + ldb );
+   const ET* b3( b2 + ldb );
+   const ET* b4( b3 + ldb );
+
+   simd_int32_t xmm1, xmm2, xmm3, xmm4;
+   size_t k( 0UL );
+
+   for( ; (k+IT::size) <= K; k+=IT::size ) {
+      const IntrinsicType a1( loadu( a+k ) );
+      xmm1 = xmm1 + madd( a1, loadu( b1+k ) );
+      xmm2 = xmm2 + madd( a1, loadu( b2+k ) );
+      xmm3 = xmm3 + madd( a1, loadu( b3+k ) );
+      xmm4 = xmm4 + madd( a1, loadu( b4+k ) );
+   }
+
+   res[0] = sum( xmm1 );
+   res[1] = sum( xmm2 );
+   res[2] = sum( xmm3 );
+   res[3] = sum( xmm4 );
+
+   for( ; k<K; ++k ) {
+      const int32_t ak( a[k] );
+      res[0] += ak * b1[k];
+      res[1] += ak * b2[k];
+      res[2] += ak * b3[k];
+      res[3] += ak * b4[k];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot products of a row of \a A with four adjacent columns of \a B.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the row of \a A.
+// \param b Pointer to the first element of the first column of \a B.
+// \param ldb The spacing between two columns of \a B.
+// \param K The number of elements of the row.
+// \param res The four resulting 32-bit dot products.
+// \return void
+*/
+template< typename ET >  // Element type of the quantized operands
+BLAZE_ALWAYS_INLINE typename DisableIf< UseVectorizedQuantizedKernel<ET> >::Type
+   qdot4( const ET* a, const ET* b, size_t ldb, size_t K, int32_t* res )
+{
+   res[0] = res[1] = res[2] = res[3] = 0;
+
+   for( size_t k=0UL; k<K; ++k ) {
+      const int32_t ak( a[k] );
+      res[0] += ak * b[k      ];
+      res[1] += ak * b[k+ldb  ];
+      res[2] += ak * b[k+ldb*2];
+      res[3] += ak * b[k+ldb*3];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot product of a row of \a A with a column of \a B.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the row of \a A.
+// \param b Pointer to the first element of the column of \a B.
+// \param K The number of elements of the row.
+// \return The resulting 32-bit dot product.
+*/
+template< typename ET >  // Element type of the quantized operands
+BLAZE_ALWAYS_INLINE typename EnableIf< UseVectorizedQuantizedKernel<ET>, int32_t >::Type
+   qdot( const ET* a, const ET* b, size_t K )
+{
+   typedef IntrinsicTrait<ET>  IT;
+
+   simd_int32_t xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+IT::size*2UL) <= K; k+=IT::size*2UL ) {
+      xmm1 = xmm1 + madd( loadu( a+k          ), loadu( b+k          ) );
+      xmm2 = xmm2 + madd( loadu( a+k+IT::size ), loadu( b+k+IT::size ) );
+   }
+
+   if( (k+IT::size) <= K ) {
+      xmm1 = xmm1 + madd( loadu( a+k ), loadu( b+k ) );
+      k += IT::size;
+   }
+
+   int32_t res( sum( xmm1 ) + sum( xmm2 ) );
+
+   for( ; k<K; ++k ) {
+      res += int32_t( a[k] ) * b[k];
+   }
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot product of a row of \a A with a column of \a B.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first element of the row of \a A.
+// \param b Pointer to the first element of the column of \a B.
+// \param K The number of elements of the row.
+// \return The resulting 32-bit dot product.
+*/
+template< typename ET >  // Element type of the quantized operands
+BLAZE_ALWAYS_INLINE typename DisableIf< UseVectorizedQuantizedKernel<ET>, int32_t >::Type
+   qdot( const ET* a, const ET* b, size_t K )
+{
+   int32_t res( 0 );
+
+   for( size_t k=0UL; k<K; ++k ) {
+      res += int32_t( a[k] ) * b[k];
+   }
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked quantized matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// This functor computes the 32-bit integral products of the rows of the row-major matrix \a A
+// with the columns of the column-major matrix \a B and passes each result to the output
+// operation \a OP. The rows of \a A are processed in blocks of QGEMM_IBLOCK_SIZE rows, which
+// are independent of each other and can be processed in parallel. Within a block, the columns
+// of \a B are processed in panels of approximately QGEMM_PANEL_SIZE bytes that remain in cache
+// while all rows of the block are multiplied with them.
+*/
+template< typename ET    // Element type of the quantized operands
+        , typename OP >  // Type of the output operation
+class QuantizedMultKernel
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the QuantizedMultKernel class template.
+   //
+   // \param A Pointer to the first element of the row-major \f$ M \times K \f$ matrix \a A.
+   // \param lda The spacing between two rows of \a A.
+   // \param B Pointer to the first element of the column-major \f$ K \times N \f$ matrix \a B.
+   // \param ldb The spacing between two columns of \a B.
+   // \param M The number of rows of \a A.
+   // \param N The number of columns of \a B.
+   // \param K The number of columns of \a A and rows of \a B.
+   // \param op The output operation for the 32-bit results.
+   */
+   inline QuantizedMultKernel( const ET* A, size_t lda, const ET* B, size_t ldb,
+                               size_t M, size_t N, size_t K, const OP& op )
+      : A_  ( A   )  // Pointer to the first element of matrix A
+      , lda_( lda )  // The spacing between two rows of matrix A
+      , B_  ( B   )  // Pointer to the first element of matrix B
+      , ldb_( ldb )  // The spacing between two columns of matrix B
+      , M_  ( M   )  // The number of rows of matrix A
+      , N_  ( N   )  // The number of columns of matrix B
+      , K_  ( K   )  // The number of columns of A and rows of B
+      , op_ ( op  )  // The output operation for the 32-bit results
+   {}
+   //**********************************************************************************************
+
+   //**Blocks function*****************************************************************************
+   /*!\brief Returns the number of independent row blocks.
+   //
+   // \return The number of row blocks.
+   */
+   inline size_t blocks() const {
+      return ( M_ + QGEMM_IBLOCK_SIZE - 1UL ) / QGEMM_IBLOCK_SIZE;
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computation of the given row block.
+   //
+   // \param block The index of the row block.
+   // \return void
+   */
+   inline void operator()( size_t block ) const
+   {
+      const size_t ibegin( block * QGEMM_IBLOCK_SIZE );
+      const size_t iend  ( min( ibegin + QGEMM_IBLOCK_SIZE, M_ ) );
+      const size_t jblock( max( ( QGEMM_PANEL_SIZE / max( K_*sizeof(ET), size_t(1UL) ) ) & size_t(-4), size_t(4UL) ) );
+
+      int32_t res[4];
+
+      for( size_t jj=0UL; jj<N_; jj+=jblock )
+      {
+         const size_t jend( min( jj+jblock, N_ ) );
+
+         for( size_t i=ibegin; i<iend; ++i )
+         {
+            const ET* a( A_ + i*lda_ );
+            size_t j( jj );
+
+            for( ; (j+4UL) <= jend; j+=4UL ) {
+               qdot4( a, B_ + j*ldb_, ldb_, K_, res );
+               op_( i, j    , res[0] );
+               op_( i, j+1UL, res[1] );
+               op_( i, j+2UL, res[2] );
+               op_( i, j+3UL, res[3] );
+            }
+
+            for( ; j<jend; ++j ) {
+               op_( i, j, qdot( a, B_ + j*ldb_, K_ ) );
+            }
+         }
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const ET* A_;    //!< Pointer to the first element of matrix A.
+   size_t    lda_;  //!< The spacing between two rows of matrix A.
+   const ET* B_;    //!< Pointer to the first element of matrix B.
+   size_t    ldb_;  //!< The spacing between two columns of matrix B.
+   size_t    M_;    //!< The number of rows of matrix A.
+   size_t    N_;    //!< The number of columns of matrix B.
+   size_t    K_;    //!< The number of columns of A and rows of B.
+   OP        op_;   //!< The output operation for the 32-bit results.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Contiguous access to the elements of a quantized operand.
+// \ingroup dense_matrix
+//
+// This auxiliary class provides a pointer to the elements of a quantized operand such that
+// either each row (\a SO = rowMajor) or each column (\a SO = columnMajor) of the operand is
+// stored contiguously. In case the given operand does not provide direct access to its elements
+// in the required storage order, the operand is copied into an internal buffer.
+*/
+template< typename ET  // Element type of the quantized operand
+        , bool SO >    // Required storage order
+class QuantizedOperand : private NonCopyable
+{
+ private:
+   //**********************************************************************************************
+   /*!\brief Auxiliary helper struct for the direct access to the elements of a matrix.
+   */
+   template< typename MT >
+   struct UseDirectAccess {
+      enum { value = HasConstDataAccess<MT>::value && ( IsRowMajorMatrix<MT>::value == !SO ) };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Auxiliary helper struct for the direct access to the elements of a vector.
+   */
+   template< typename VT >
+   struct UseDirectVectorAccess {
+      enum { value = HasConstDataAccess<VT>::value && !IsSubvector<VT>::value &&
+                     !IsRow<VT>::value && !IsColumn<VT>::value };
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\brief Constructor for a matrix operand.
+   //
+   // \param A The quantized matrix operand.
+   */
+   template< typename MT, bool SO2 >
+   explicit inline QuantizedOperand( const DenseMatrix<MT,SO2>& A )
+      : matrix_ ()        // The buffer for a matrix operand
+      , vector_ ()        // The buffer for a vector operand
+      , data_   ( NULL )  // Pointer to the first element of the operand
+      , spacing_( 0UL  )  // The spacing between two rows/columns
+   {
+      init( ~A );
+   }
+
+   /*!\brief Constructor for a vector operand.
+   //
+   // \param x The quantized vector operand.
+   */
+   template< typename VT, bool TF >
+   explicit inline QuantizedOperand( const DenseVector<VT,TF>& x )
+      : matrix_ ()        // The buffer for a matrix operand
+      , vector_ ()        // The buffer for a vector operand
+      , data_   ( NULL )  // Pointer to the first element of the operand
+      , spacing_( 0UL  )  // The spacing between two rows/columns
+   {
+      initVector( ~x );
+   }
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\brief Returns a pointer to the first element of the operand.
+   //
+   // \return Pointer to the first element of the operand.
+   */
+   inline const ET* data() const {
+      return data_;
+   }
+
+   /*!\brief Returns the spacing between two rows/columns of the operand.
+   //
+   // \return The spacing between two rows/columns.
+   */
+   inline size_t spacing() const {
+      return spacing_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Initialization functions********************************************************************
+   /*!\brief Initialization for a matrix with direct element access in the required order.
+   */
+   template< typename MT >
+   inline typename EnableIf< UseDirectAccess<MT> >::Type init( const MT& A ) {
+      data_    = A.data();
+      spacing_ = A.spacing();
+   }
+
+   /*!\brief Initialization for a matrix without direct element access in the required order.
+   */
+   template< typename MT >
+   inline typename DisableIf< UseDirectAccess<MT> >::Type init( const MT& A ) {
+      matrix_  = A;
+      data_    = matrix_.data();
+      spacing_ = matrix_.spacing();
+   }
+
+   /*!\brief Initialization for a vector with direct element access.
+   */
+   template< typename VT >
+   inline typename EnableIf< UseDirectVectorAccess<VT> >::Type initVector( const VT& x ) {
+      data_    = x.data();
+      spacing_ = x.size();
+   }
+
+   /*!\brief Initialization for a vector without direct element access.
+   */
+   template< typename VT >
+   inline typename DisableIf< UseDirectVectorAccess<VT> >::Type initVector( const VT& x ) {
+      vector_  = x;
+      data_    = vector_.data();
+      spacing_ = vector_.size();
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   DynamicMatrix<ET,SO> matrix_;   //!< The buffer for a matrix operand.
+   DynamicVector<ET>    vector_;   //!< The buffer for a vector operand.
+   const ET*            data_;     //!< Pointer to the first element of the operand.
+   size_t               spacing_;  //!< The spacing between two rows/columns.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Output operation storing the 32-bit results in a matrix.
+// \ingroup dense_matrix
+*/
+template< typename MT >  // Type of the target matrix
+struct QuantizedStore
+{
+   explicit inline QuantizedStore( MT& C ) : C_( C ) {}
+
+   inline void operator()( size_t i, size_t j, int32_t value ) const {
+      C_(i,j) = value;
+   }
+
+   MT& C_;  //!< The target matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Output operation dequantizing the 32-bit results into a matrix.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the target matrix
+        , typename VT1   // Type of the row scale factors
+        , typename VT2 > // Type of the column scale factors
+struct QuantizedScaledStore
+{
+   inline QuantizedScaledStore( MT& C, const VT1& rowScale, const VT2& colScale )
+      : C_( C ), rowScale_( rowScale ), colScale_( colScale ) {}
+
+   inline void operator()( size_t i, size_t j, int32_t value ) const {
+      typedef typename MT::ElementType  ET;
+      C_(i,j) = ET( rowScale_[i] ) * ET( colScale_[j] ) * ET( value );
+   }
+
+   MT&        C_;         //!< The target matrix.
+   const VT1& rowScale_;  //!< The scale factors of the rows of the left-hand side operand.
+   const VT2& colScale_;  //!< The scale factors of the columns of the right-hand side operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Output operation storing the 32-bit results in a vector.
+// \ingroup dense_matrix
+*/
+template< typename VT >  // Type of the target vector
+struct QuantizedVectorStore
+{
+   explicit inline QuantizedVectorStore( VT& y ) : y_( y ) {}
+
+   inline void operator()( size_t i, size_t /*j*/, int32_t value ) const {
+      y_[i] = value;
+   }
+
+   VT& y_;  //!< The target vector.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Output operation dequantizing the 32-bit results into a vector.
+// \ingroup dense_matrix
+*/
+template< typename VT1   // Type of the target vector
+        , typename VT2   // Type of the row scale factors
+        , typename ST >  // Type of the scale factor of the vector operand
+struct QuantizedScaledVectorStore
+{
+   inline QuantizedScaledVectorStore( VT1& y, const VT2& rowScale, ST scale )
+      : y_( y ), rowScale_( rowScale ), scale_( scale ) {}
+
+   inline void operator()( size_t i, size_t /*j*/, int32_t value ) const {
+      typedef typename VT1::ElementType  ET;
+      y_[i] = ET( rowScale_[i] ) * ET( scale_ ) * ET( value );
+   }
+
+   VT1&       y_;         //!< The target vector.
+   const VT2& rowScale_;  //!< The scale factors of the rows of the matrix operand.
+   ST         scale_;     //!< The scale factor of the vector operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution of a quantized multiplication kernel.
+// \ingroup dense_matrix
+//
+// \param kernel The kernel to be executed.
+// \return void
+//
+// The row blocks of the kernel are processed in parallel in case a parallel execution is
+// possible.
+*/
+template< typename ET    // Element type of the quantized operands
+        , typename OP >  // Type of the output operation
+inline void runQuantizedMultKernel( QuantizedMultKernel<ET,OP>& kernel )
+{
+   smpFor( kernel.blocks(), kernel );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  QUANTIZED MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Quantized multiplication functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+inline void qgemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                   const DenseMatrix<MT3,SO3>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3
+        , typename VT1, bool TF1, typename VT2, bool TF2 >
+inline void qgemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                   const DenseMatrix<MT3,SO3>& B, const DenseVector<VT1,TF1>& rowScale,
+                   const DenseVector<VT2,TF2>& colScale );
+
+template< typename VT1, typename MT, bool SO, typename VT2 >
+inline void qgemv( DenseVector<VT1,false>& y, const DenseMatrix<MT,SO>& A,
+                   const DenseVector<VT2,false>& x );
+
+template< typename VT1, typename MT, bool SO, typename VT2, typename VT3, bool TF, typename ST >
+inline void qgemv( DenseVector<VT1,false>& y, const DenseMatrix<MT,SO>& A,
+                   const DenseVector<VT2,false>& x, const DenseVector<VT3,TF>& rowScale, ST scale );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Quantized dense matrix multiplication with 32-bit accumulation (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target matrix for the 32-bit integral results.
+// \param A The left-hand side quantized matrix.
+// \param B The right-hand side quantized matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the product of two matrices of signed 8-bit or 16-bit integral values
+// (e.g. \c signed \c char or \c short). In contrast to the regular multiplication, all products
+// are accumulated in 32-bit integral values by means of the according multiply-add intrinsics,
+// i.e. the computation is exact as long as the 32-bit results don't overflow:
+
+   \code
+   blaze::DynamicMatrix<signed char,blaze::rowMajor> A( 64UL, 256UL );
+   blaze::DynamicMatrix<signed char,blaze::columnMajor> B( 256UL, 32UL );
+   blaze::DynamicMatrix<int> C;
+   // ... Initialization
+
+   qgemm( C, A, B );
+   \endcode
+
+// The target matrix is resized to the size of the result. The kernels require the rows of \a A
+// and the columns of \a B to be stored contiguously, i.e. \a A is ideally a row-major and \a B a
+// column-major matrix. Operands in a different storage order (or without direct access to their
+// elements) are copied into a temporary matrix. Note that this function must not be used for
+// adaptors (as for instance SymmetricMatrix) as target matrix.
+*/
+template< typename MT1  // Type of the target matrix
+        , bool SO1      // Storage order of the target matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , bool SO2      // Storage order of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , bool SO3 >    // Storage order of the right-hand side matrix operand
+inline void qgemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                   const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+
+   typedef typename MT2::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE    ( ET, typename MT3::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SIGNED_TYPE  ( ET );
+   BLAZE_STATIC_ASSERT( sizeof(ET) == 1UL || sizeof(ET) == 2UL );
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   resize( ~C, (~A).rows(), (~B).columns(), false );
+
+   const QuantizedOperand<ET,rowMajor>    a( ~A );
+   const QuantizedOperand<ET,columnMajor> b( ~B );
+
+   QuantizedMultKernel< ET, QuantizedStore<MT1> > kernel(
+      a.data(), a.spacing(), b.data(), b.spacing(),
+      (~A).rows(), (~B).columns(), (~A).columns(), QuantizedStore<MT1>( ~C ) );
+
+   runQuantizedMultKernel( kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Quantized dense matrix multiplication with dequantization of the result
+//        (\f$ C_{ij}=r_i \cdot c_j \cdot (A*B)_{ij} \f$).
+// \ingroup dense_matrix
+//
+// \param C The target matrix for the dequantized results.
+// \param A The left-hand side quantized matrix.
+// \param B The right-hand side quantized matrix.
+// \param rowScale The scale factors \f$ r_i \f$ of the rows of \a A.
+// \param colScale The scale factors \f$ c_j \f$ of the columns of \a B.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid number of scale factors.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the product of two matrices of signed 8-bit or 16-bit integral values
+// with 32-bit integral accumulation and converts each 32-bit result into the element type of
+// the target matrix (typically \c float) by means of the given per-row scale factors of \a A and
+// the given per-column scale factors of \a B:
+
+   \code
+   blaze::DynamicMatrix<signed char,blaze::rowMajor> W( 64UL, 256UL );     // Quantized weights
+   blaze::DynamicMatrix<signed char,blaze::columnMajor> X( 256UL, 32UL );  // Quantized input
+   blaze::DynamicVector<float> ws( 64UL ), xs( 32UL );                     // Scale factors
+   blaze::DynamicMatrix<float> Y;
+   // ... Initialization
+
+   qgemm( Y, W, X, ws, xs );
+   \endcode
+
+// The target matrix is resized to the size of the result. For the storage order of the
+// operands the same restrictions as for the unscaled qgemm() function apply.
+*/
+template< typename MT1  // Type of the target matrix
+        , bool SO1      // Storage order of the target matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , bool SO2      // Storage order of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , bool SO3      // Storage order of the right-hand side matrix operand
+        , typename VT1  // Type of the row scale factors
+        , bool TF1      // Transpose flag of the row scale factors
+        , typename VT2  // Type of the column scale factors
+        , bool TF2 >    // Transpose flag of the column scale factors
+inline void qgemm( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                   const DenseMatrix<MT3,SO3>& B, const DenseVector<VT1,TF1>& rowScale,
+                   const DenseVector<VT2,TF2>& colScale )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
+
+   typedef typename MT2::ElementType  ET;
+   typedef QuantizedScaledStore<MT1,VT1,VT2>  Store;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE    ( ET, typename MT3::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SIGNED_TYPE  ( ET );
+   BLAZE_STATIC_ASSERT( sizeof(ET) == 1UL || sizeof(ET) == 2UL );
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rowScale).size() != (~A).rows() || (~colScale).size() != (~B).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of scale factors" );
+   }
+
+   resize( ~C, (~A).rows(), (~B).columns(), false );
+
+   const QuantizedOperand<ET,rowMajor>    a( ~A );
+   const QuantizedOperand<ET,columnMajor> b( ~B );
+
+   QuantizedMultKernel<ET,Store> kernel(
+      a.data(), a.spacing(), b.data(), b.spacing(),
+      (~A).rows(), (~B).columns(), (~A).columns(), Store( ~C, ~rowScale, ~colScale ) );
+
+   runQuantizedMultKernel( kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Quantized dense matrix/dense vector multiplication with 32-bit accumulation
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target vector for the 32-bit integral results.
+// \param A The quantized matrix.
+// \param x The quantized vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function computes the product of a matrix and a vector of signed 8-bit or 16-bit
+// integral values with 32-bit integral accumulation. The target vector is resized to the size
+// of the result. Matrix \a A is ideally a row-major matrix, column-major matrices are copied
+// into a temporary row-major matrix.
+*/
+template< typename VT1  // Type of the target vector
+        , typename MT   // Type of the matrix operand
+        , bool SO       // Storage order of the matrix operand
+        , typename VT2 >  // Type of the vector operand
+inline void qgemv( DenseVector<VT1,false>& y, const DenseMatrix<MT,SO>& A,
+                   const DenseVector<VT2,false>& x )
+{
+   typedef typename MT::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE    ( ET, typename VT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SIGNED_TYPE  ( ET );
+   BLAZE_STATIC_ASSERT( sizeof(ET) == 1UL || sizeof(ET) == 2UL );
+
+   if( (~A).columns() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   resize( ~y, (~A).rows(), false );
+
+   const QuantizedOperand<ET,rowMajor>    a( ~A );
+   const QuantizedOperand<ET,columnMajor> b( ~x );
+
+   QuantizedMultKernel< ET, QuantizedVectorStore<VT1> > kernel(
+      a.data(), a.spacing(), b.data(), b.spacing(),
+      (~A).rows(), 1UL, (~A).columns(), QuantizedVectorStore<VT1>( ~y ) );
+
+   runQuantizedMultKernel( kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Quantized dense matrix/dense vector multiplication with dequantization of the result
+//        (\f$ y_i=r_i \cdot s \cdot (A*\vec{x})_i \f$).
+// \ingroup dense_matrix
+//
+// \param y The target vector for the dequantized results.
+// \param A The quantized matrix.
+// \param x The quantized vector.
+// \param rowScale The scale factors \f$ r_i \f$ of the rows of \a A.
+// \param scale The scale factor \f$ s \f$ of the vector \a x.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid number of scale factors.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function computes the product of a matrix and a vector of signed 8-bit or 16-bit
+// integral values with 32-bit integral accumulation and converts each 32-bit result into the
+// element type of the target vector (typically \c float) by means of the given per-row scale
+// factors of \a A and the scale factor of \a x:
+
+   \code
+   blaze::DynamicMatrix<signed char> W( 64UL, 256UL );  // Quantized weights
+   blaze::DynamicVector<signed char> x( 256UL );        // Quantized input
+   blaze::DynamicVector<float> ws( 64UL );              // Scale factors of the weights
+   blaze::DynamicVector<float> y;
+   // ... Initialization
+
+   qgemv( y, W, x, ws, 0.05F );
+   \endcode
+*/
+template< typename VT1  // Type of the target vector
+        , typename MT   // Type of the matrix operand
+        , bool SO       // Storage order of the matrix operand
+        , typename VT2  // Type of the vector operand
+        , typename VT3  // Type of the row scale factors
+        , bool TF       // Transpose flag of the row scale factors
+        , typename ST > // Type of the scale factor of the vector operand
+inline void qgemv( DenseVector<VT1,false>& y, const DenseMatrix<MT,SO>& A,
+                   const DenseVector<VT2,false>& x, const DenseVector<VT3,TF>& rowScale, ST scale )
+{
+   typedef typename MT::ElementType  ET;
+   typedef QuantizedScaledVectorStore<VT1,VT3,ST>  Store;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE    ( ET, typename VT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SIGNED_TYPE  ( ET );
+   BLAZE_STATIC_ASSERT( sizeof(ET) == 1UL || sizeof(ET) == 2UL );
+
+   if( (~A).columns() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (~rowScale).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of scale factors" );
+   }
+
+   resize( ~y, (~A).rows(), false );
+
+   const QuantizedOperand<ET,rowMajor>    a( ~A );
+   const QuantizedOperand<ET,columnMajor> b( ~x );
+
+   QuantizedMultKernel<ET,Store> kernel(
+      a.data(), a.spacing(), b.data(), b.spacing(),
+      (~A).rows(), 1UL, (~A).columns(), Store( ~y, ~rowScale, scale ) );
+
+   runQuantizedMultKernel( kernel );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
@@ -411,6 +412,20 @@ class StaticMatrix : public DenseMatrix< StaticMatrix<Type,M,N,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::transposition &&
+                     IsColumnMajorMatrix<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -437,6 +452,10 @@ class StaticMatrix : public DenseMatrix< StaticMatrix<Type,M,N,SO>, SO >
    inline typename EnableIf< VectorizedAssign<MT> >::Type
       assign( const DenseMatrix<MT,SO2>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -448,6 +467,10 @@ class StaticMatrix : public DenseMatrix< StaticMatrix<Type,M,N,SO>, SO >
    inline typename EnableIf< VectorizedAddAssign<MT> >::Type
       addAssign( const DenseMatrix<MT,SO2>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void addAssign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void addAssign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -459,6 +482,10 @@ class StaticMatrix : public DenseMatrix< StaticMatrix<Type,M,N,SO>, SO >
    inline typename EnableIf< VectorizedSubAssign<MT> >::Type
       subAssign( const DenseMatrix<MT,SO2>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,!SO>& rhs );
+
    template< typename MT > inline void subAssign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void subAssign( const SparseMatrix<MT,!SO>& rhs );
    //@}
@@ -2964,6 +2991,33 @@ inline typename EnableIf< typename StaticMatrix<Type,M,N,SO>::BLAZE_TEMPLATE Vec
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename StaticMatrix<Type,M,N,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   StaticMatrix<Type,M,N,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -3124,6 +3178,33 @@ inline typename EnableIf< typename StaticMatrix<Type,M,N,SO>::BLAZE_TEMPLATE Vec
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename StaticMatrix<Type,M,N,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   StaticMatrix<Type,M,N,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
 //
@@ -3284,6 +3365,33 @@ inline typename EnableIf< typename StaticMatrix<Type,M,N,SO>::BLAZE_TEMPLATE Vec
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename StaticMatrix<Type,M,N,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   StaticMatrix<Type,M,N,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
 //
@@ -3571,6 +3679,18 @@ class StaticMatrix<Type,M,N,true> : public DenseMatrix< StaticMatrix<Type,M,N,tr
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::transposition &&
+                     IsRowMajorMatrix<MT>::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -3597,6 +3717,10 @@ class StaticMatrix<Type,M,N,true> : public DenseMatrix< StaticMatrix<Type,M,N,tr
    inline typename EnableIf< VectorizedAssign<MT> >::Type
       assign( const DenseMatrix<MT,SO>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      assign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -3608,6 +3732,10 @@ class StaticMatrix<Type,M,N,true> : public DenseMatrix< StaticMatrix<Type,M,N,tr
    inline typename EnableIf< VectorizedAddAssign<MT> >::Type
       addAssign( const DenseMatrix<MT,SO>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void addAssign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void addAssign( const SparseMatrix<MT,false>& rhs );
 
@@ -3619,6 +3747,10 @@ class StaticMatrix<Type,M,N,true> : public DenseMatrix< StaticMatrix<Type,M,N,tr
    inline typename EnableIf< VectorizedSubAssign<MT> >::Type
       subAssign( const DenseMatrix<MT,SO>& rhs );
 
+   template< typename MT >
+   inline typename EnableIf< VectorizedTransposeAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,false>& rhs );
+
    template< typename MT > inline void subAssign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void subAssign( const SparseMatrix<MT,false>& rhs );
    //@}
@@ -6135,6 +6267,34 @@ inline typename EnableIf< typename StaticMatrix<Type,M,N,true>::BLAZE_TEMPLATE V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename StaticMatrix<Type,M,N,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   StaticMatrix<Type,M,N,true>::assign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -6299,6 +6459,34 @@ inline typename EnableIf< typename StaticMatrix<Type,M,N,true>::BLAZE_TEMPLATE V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename StaticMatrix<Type,M,N,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   StaticMatrix<Type,M,N,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
@@ -6463,6 +6651,34 @@ inline typename EnableIf< typename StaticMatrix<Type,M,N,true>::BLAZE_TEMPLATE V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a dense matrix with opposite
+//        storage order.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename StaticMatrix<Type,M,N,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT> >::Type
+   StaticMatrix<Type,M,N,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
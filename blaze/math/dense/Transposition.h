@@ -0,0 +1,932 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transposition.h
+//  \brief Header file for the in-place transposition kernels for dense matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSITION_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  IN-PLACE TRANSPOSITION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the (conjugate) transposition of a single element.
+// \ingroup dense_matrix
+*/
+template< bool Conj >  // Conjugation flag
+struct TransposeElement
+{
+   template< typename Type >
+   static BLAZE_ALWAYS_INLINE Type apply( const Type& value ) { return value; }
+};
+
+template<>
+struct TransposeElement<true>
+{
+   template< typename Type >
+   static BLAZE_ALWAYS_INLINE Type apply( const Type& value ) { return conj( value ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the edge length of the tiles of the blocked in-place transposition.
+// \ingroup dense_matrix
+//
+// \return The edge length of a tile.
+//
+// The tile size is chosen such that a pair of tiles fits into the L1 cache.
+*/
+template< typename Type >  // Data type of the matrix elements
+BLAZE_ALWAYS_INLINE size_t transpositionTileSize()
+{
+   return ( sizeof(Type) <= 8UL )?( 32UL ):( 16UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place (conjugate) transposition of a tile on the diagonal of a square matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param spacing The spacing between the beginning of two rows/columns.
+// \param i The index of the first row/column of the tile.
+// \param size The edge length of the tile.
+// \return void
+//
+// This function is used for all element types that don't support the in-register transposition.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+inline typename DisableIfTrue< IntrinsicTrait<Type>::transposition >::Type
+   transposeDiagonalTile( Type* v, size_t spacing, size_t i, size_t size )
+{
+   for( size_t ii=i; ii<i+size; ++ii )
+   {
+      if( Conj ) {
+         v[ii*spacing+ii] = TransposeElement<Conj>::apply( v[ii*spacing+ii] );
+      }
+
+      for( size_t jj=ii+1UL; jj<i+size; ++jj ) {
+         const Type tmp( TransposeElement<Conj>::apply( v[ii*spacing+jj] ) );
+         v[ii*spacing+jj] = TransposeElement<Conj>::apply( v[jj*spacing+ii] );
+         v[jj*spacing+ii] = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized in-place transposition of a tile on the diagonal of a square matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param spacing The spacing between the beginning of two rows/columns.
+// \param i The index of the first row/column of the tile.
+// \param size The edge length of the tile.
+// \return void
+//
+// This function is used for all element types that support the in-register transposition. The
+// tile is processed in micro-tiles of \f$ IT::size \times IT::size \f$ elements, which are
+// transposed in-register (see the transpose() functions). The remaining elements are swapped
+// element-wise. Since the in-register transposition is only available for real element types,
+// the conjugation is a no-op.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+inline typename EnableIfTrue< IntrinsicTrait<Type>::transposition >::Type
+   transposeDiagonalTile( Type* v, size_t spacing, size_t i, size_t size )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const size_t iend( i + size );
+   const size_t ipos( i + ( size & size_t(-IT::size) ) );
+
+   IntrinsicType r[IT::size];
+   IntrinsicType s[IT::size];
+
+   for( size_t ii=i; ii<ipos; ii+=IT::size )
+   {
+      for( size_t k=0UL; k<IT::size; ++k ) {
+         r[k] = loadu( v+(ii+k)*spacing+ii );
+      }
+
+      transpose( r );
+
+      for( size_t k=0UL; k<IT::size; ++k ) {
+         storeu( v+(ii+k)*spacing+ii, r[k] );
+      }
+
+      for( size_t jj=ii+IT::size; jj<ipos; jj+=IT::size )
+      {
+         for( size_t k=0UL; k<IT::size; ++k ) {
+            r[k] = loadu( v+(ii+k)*spacing+jj );
+            s[k] = loadu( v+(jj+k)*spacing+ii );
+         }
+
+         transpose( r );
+         transpose( s );
+
+         for( size_t k=0UL; k<IT::size; ++k ) {
+            storeu( v+(jj+k)*spacing+ii, r[k] );
+            storeu( v+(ii+k)*spacing+jj, s[k] );
+         }
+      }
+   }
+
+   for( size_t ii=i; ii<iend; ++ii ) {
+      for( size_t jj=max( ii+1UL, ipos ); jj<iend; ++jj ) {
+         const Type tmp( v[ii*spacing+jj] );
+         v[ii*spacing+jj] = v[jj*spacing+ii];
+         v[jj*spacing+ii] = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swaps a tile of a square matrix with the (conjugate) transpose of its mirror tile.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param spacing The spacing between the beginning of two rows/columns.
+// \param i The index of the first row/column of the upper tile.
+// \param j The index of the first column/row of the upper tile.
+// \param m The number of rows/columns of the upper tile.
+// \param n The number of columns/rows of the upper tile.
+// \return void
+//
+// This function swaps the \f$ m \times n \f$ tile starting at position \f$ (i,j) \f$ with the
+// (conjugate) transpose of the \f$ n \times m \f$ tile starting at position \f$ (j,i) \f$. It
+// is used for all element types that don't support the in-register transposition.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+inline typename DisableIfTrue< IntrinsicTrait<Type>::transposition >::Type
+   swapTiles( Type* v, size_t spacing, size_t i, size_t j, size_t m, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( i + m <= j, "Overlapping tiles detected" );
+
+   for( size_t ii=i; ii<i+m; ++ii ) {
+      for( size_t jj=j; jj<j+n; ++jj ) {
+         const Type tmp( TransposeElement<Conj>::apply( v[ii*spacing+jj] ) );
+         v[ii*spacing+jj] = TransposeElement<Conj>::apply( v[jj*spacing+ii] );
+         v[jj*spacing+ii] = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized swap of a tile of a square matrix with the transpose of its mirror
+//        tile.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param spacing The spacing between the beginning of two rows/columns.
+// \param i The index of the first row/column of the upper tile.
+// \param j The index of the first column/row of the upper tile.
+// \param m The number of rows/columns of the upper tile.
+// \param n The number of columns/rows of the upper tile.
+// \return void
+//
+// This function swaps the \f$ m \times n \f$ tile starting at position \f$ (i,j) \f$ with the
+// transpose of the \f$ n \times m \f$ tile starting at position \f$ (j,i) \f$. It is used for
+// all element types that support the in-register transposition. Both tiles are processed in
+// pairs of mirrored micro-tiles of \f$ IT::size \times IT::size \f$ elements, which are
+// transposed in-register. The remaining elements are swapped element-wise.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+inline typename EnableIfTrue< IntrinsicTrait<Type>::transposition >::Type
+   swapTiles( Type* v, size_t spacing, size_t i, size_t j, size_t m, size_t n )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   BLAZE_INTERNAL_ASSERT( i + m <= j, "Overlapping tiles detected" );
+
+   const size_t ipos( i + ( m & size_t(-IT::size) ) );
+   const size_t jpos( j + ( n & size_t(-IT::size) ) );
+
+   IntrinsicType r[IT::size];
+   IntrinsicType s[IT::size];
+
+   for( size_t ii=i; ii<ipos; ii+=IT::size )
+   {
+      for( size_t jj=j; jj<jpos; jj+=IT::size )
+      {
+         for( size_t k=0UL; k<IT::size; ++k ) {
+            r[k] = loadu( v+(ii+k)*spacing+jj );
+            s[k] = loadu( v+(jj+k)*spacing+ii );
+         }
+
+         transpose( r );
+         transpose( s );
+
+         for( size_t k=0UL; k<IT::size; ++k ) {
+            storeu( v+(jj+k)*spacing+ii, r[k] );
+            storeu( v+(ii+k)*spacing+jj, s[k] );
+         }
+      }
+   }
+
+   for( size_t ii=i; ii<i+m; ++ii ) {
+      for( size_t jj=( ii<ipos )?( jpos ):( j ); jj<j+n; ++jj ) {
+         const Type tmp( v[ii*spacing+jj] );
+         v[ii*spacing+jj] = v[jj*spacing+ii];
+         v[jj*spacing+ii] = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked in-place (conjugate) transposition of a square matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param n The number of rows/columns of the matrix.
+// \param spacing The spacing between the beginning of two rows/columns.
+// \param first The index of the first tile row/column to be processed.
+// \param increment The increment between two processed tile rows/columns.
+// \return void
+//
+// This function transposes the given square matrix in-place by swapping pairs of mirrored
+// tiles. It processes the tile rows/columns \a first, \a first + \a increment, ... (including
+// all tiles right of/below the diagonal). Therefore the transposition can be distributed among
+// several threads, each processing a disjoint set of tile rows/columns.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+void transposeSquare( Type* v, size_t n, size_t spacing, size_t first, size_t increment )
+{
+   BLAZE_INTERNAL_ASSERT( increment > 0UL, "Invalid increment detected" );
+
+   const size_t tile( transpositionTileSize<Type>() );
+
+   for( size_t i=first*tile; i<n; i+=increment*tile )
+   {
+      const size_t m( ( i+tile < n )?( tile ):( n-i ) );
+
+      transposeDiagonalTile<Conj>( v, spacing, i, m );
+
+      for( size_t j=i+tile; j<n; j+=tile ) {
+         swapTiles<Conj>( v, spacing, i, j, m, ( ( j+tile < n )?( tile ):( n-j ) ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked in-place (conjugate) transposition kernel for square matrices.
+// \ingroup dense_matrix
+//
+// This functor distributes the tile rows/columns of the in-place transposition of a square
+// matrix (see transposeSquare()) among several work items. The work item \a k processes the
+// tile rows/columns \a k, \a k + \a increment, ..., such that \a increment work items cover
+// the complete matrix.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+class SquareTransposition
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SquareTransposition class template.
+   //
+   // \param v Pointer to the first element of the matrix.
+   // \param n The number of rows/columns of the matrix.
+   // \param spacing The spacing between the beginning of two rows/columns.
+   // \param increment The total number of work items.
+   */
+   inline SquareTransposition( Type* v, size_t n, size_t spacing, size_t increment )
+      : v_        ( v         )  // Pointer to the first element of the matrix
+      , n_        ( n         )  // The number of rows/columns of the matrix
+      , spacing_  ( spacing   )  // The spacing between two rows/columns
+      , increment_( increment )  // The total number of work items
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Transposition of the tile rows/columns of the given work item.
+   //
+   // \param k The index of the work item.
+   // \return void
+   */
+   inline void operator()( size_t k ) const {
+      transposeSquare<Conj>( v_, n_, spacing_, k, increment_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*  v_;          //!< Pointer to the first element of the matrix.
+   size_t n_;          //!< The number of rows/columns of the matrix.
+   size_t spacing_;    //!< The spacing between the beginning of two rows/columns.
+   size_t increment_;  //!< The total number of work items.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the greatest common divisor of two non-negative integral values.
+// \ingroup dense_matrix
+//
+// \param a The first value.
+// \param b The second value.
+// \return The greatest common divisor of \a a and \a b.
+*/
+inline size_t transpositionGcd( size_t a, size_t b )
+{
+   while( b != 0UL ) {
+      const size_t tmp( a % b );
+      a = b;
+      b = tmp;
+   }
+   return a;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place (conjugate) transposition kernel for contiguous non-square matrices.
+// \ingroup dense_matrix
+//
+// This functor transposes the given contiguous (i.e. unpadded) \f$ m \times n \f$ matrix
+// in-place, i.e. the element at position \f$ i \cdot n + j \f$ is moved to position
+// \f$ j \cdot m + i \f$. Instead of following the cycles of the transposition permutation,
+// the permutation is decomposed into three passes, each of which only permutes the elements
+// within the rows or within the columns of the \f$ m \times n \f$ matrix (see Catanzaro et
+// al., "A Decomposition for In-place Matrix Transposition", PPoPP 2014). With
+// \f$ c = \gcd(m,n) \f$ and \f$ b = n / c \f$, the passes are
+//
+//  -# a rotation of each column \f$ j \f$ by \f$ \lfloor j / b \rfloor \f$ rows (only if c > 1),
+//  -# a scatter of each row \f$ i \f$, moving the element of column \f$ j \f$ to column
+//     \f$ (j \cdot m + (i + \lfloor j / b \rfloor) \bmod m) \bmod n \f$, and
+//  -# a gather of each column, which moves all elements to their final rows.
+//
+// The column passes are performed on blocks of adjacent columns in order to use complete cache
+// lines, the row pass is performed on blocks of adjacent rows. The blocks within a pass are
+// independent of each other and can therefore be processed in parallel, whereas the passes
+// have to be performed one after another:
+
+   \code
+   ContiguousTransposition<false,double> kernel( v, m, n );
+
+   for( size_t pass=0UL; pass<kernel.passes(); ++pass ) {
+      kernel.select( pass );
+      for( size_t k=0UL; k<kernel.blocks(); ++k )
+         kernel( k );
+   }
+   \endcode
+
+// Each block requires additional memory for \f$ \max(n,m \cdot w) \f$ elements, where \a w is
+// the width of a block of columns.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+class ContiguousTransposition
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ContiguousTransposition class template.
+   //
+   // \param v Pointer to the first element of the matrix.
+   // \param m The number of rows/columns of the matrix.
+   // \param n The number of columns/rows of the matrix.
+   */
+   inline ContiguousTransposition( Type* v, size_t m, size_t n )
+      : v_   ( v )                            // Pointer to the first element of the matrix
+      , m_   ( m )                            // The number of rows of the contiguous matrix
+      , n_   ( n )                            // The number of columns of the contiguous matrix
+      , c_   ( transpositionGcd( m, n ) )     // The greatest common divisor of m and n
+      , b_   ( ( c_ != 0UL )?( n/c_ ):( 0UL ) )  // The number of columns per rotation step
+      , w_   ( max( 1UL, min( n/8UL, transpositionTileSize<Type>() ) ) )  // The block width
+      , pass_( 0UL )                          // The currently selected pass
+   {}
+   //**********************************************************************************************
+
+   //**Passes function*****************************************************************************
+   /*!\brief Returns the number of passes of the transposition.
+   //
+   // \return The number of passes.
+   */
+   inline size_t passes() const {
+      return 3UL;
+   }
+   //**********************************************************************************************
+
+   //**Select function*****************************************************************************
+   /*!\brief Selects the pass to be performed by the following calls of the function call operator.
+   //
+   // \param pass The index of the pass \f$ [0..2] \f$.
+   // \return void
+   */
+   inline void select( size_t pass ) {
+      BLAZE_INTERNAL_ASSERT( pass < passes(), "Invalid pass detected" );
+      pass_ = pass;
+   }
+   //**********************************************************************************************
+
+   //**Blocks function*****************************************************************************
+   /*!\brief Returns the number of independent blocks of the currently selected pass.
+   //
+   // \return The number of blocks.
+   */
+   inline size_t blocks() const
+   {
+      if( m_ < 2UL || n_ < 2UL )
+         return ( pass_ == 1UL && m_*n_ != 0UL )?( 1UL ):( 0UL );
+
+      switch( pass_ ) {
+         case 0UL: return ( c_ > 1UL )?( ( n_ - b_ + w_ - 1UL ) / w_ ):( 0UL );
+         case 1UL: return ( m_ + w_ - 1UL ) / w_;
+         default : return ( n_ + w_ - 1UL ) / w_;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the currently selected pass for the given block.
+   //
+   // \param block The index of the block.
+   // \return void
+   */
+   inline void operator()( size_t block ) const
+   {
+      if( m_ < 2UL || n_ < 2UL ) {
+         for( size_t k=0UL; k<m_*n_; ++k )
+            v_[k] = TransposeElement<Conj>::apply( v_[k] );
+         return;
+      }
+
+      switch( pass_ ) {
+         case 0UL: rotate ( b_ + block*w_ ); break;
+         case 1UL: scatter( block*w_ );      break;
+         default : gather ( block*w_ );      break;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Parallel execution check********************************************************************
+   /*!\brief Returns whether the kernel can be executed in parallel.
+   //
+   // \return \a true in case the kernel can be executed in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return ( max( m_, n_ ) > SMP_DMATASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Rotate function*****************************************************************************
+   /*!\brief Rotates each column \a j of the block starting at column \a jj by floor(j/b) rows.
+   //
+   // \param jj The index of the first column of the block.
+   // \return void
+   */
+   void rotate( size_t jj ) const
+   {
+      const size_t jend( min( jj+w_, n_ ) );
+
+      std::vector<Type> tmp( m_*w_ );
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=jj; j<jend; ++j ) {
+            tmp[i*w_+j-jj] = v_[i*n_+j];
+         }
+      }
+
+      for( size_t j=jj; j<jend; ++j ) {
+         const size_t shift( j/b_ );
+         for( size_t i=0UL; i<m_; ++i ) {
+            const size_t row( ( i+shift < m_ )?( i+shift ):( i+shift-m_ ) );
+            v_[i*n_+j] = tmp[row*w_+j-jj];
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Scatter function****************************************************************************
+   /*!\brief Scatters the elements of each row of the block starting at row \a ii to their final columns.
+   //
+   // \param ii The index of the first row of the block.
+   // \return void
+   */
+   void scatter( size_t ii ) const
+   {
+      const size_t iend( min( ii+w_, m_ ) );
+      const size_t mn( m_ % n_ );
+
+      std::vector<Type> tmp( n_ );
+
+      for( size_t i=ii; i<iend; ++i )
+      {
+         size_t j( 0UL );
+
+         for( size_t u=0UL; u<c_; ++u )
+         {
+            const size_t offset( ( ( i+u < m_ )?( i+u ):( i+u-m_ ) ) % n_ );
+            size_t col( ( j*m_ ) % n_ );
+
+            for( size_t jend=j+b_; j<jend; ++j ) {
+               const size_t k( ( col+offset < n_ )?( col+offset ):( col+offset-n_ ) );
+               tmp[k] = TransposeElement<Conj>::apply( v_[i*n_+j] );
+               col = ( col+mn < n_ )?( col+mn ):( col+mn-n_ );
+            }
+         }
+
+         std::copy( tmp.begin(), tmp.end(), v_+i*n_ );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Gather function*****************************************************************************
+   /*!\brief Gathers the elements of each column of the block starting at column \a jj.
+   //
+   // \param jj The index of the first column of the block.
+   // \return void
+   */
+   void gather( size_t jj ) const
+   {
+      const size_t jend( min( jj+w_, n_ ) );
+
+      std::vector<Type> tmp( m_*w_ );
+
+      for( size_t i=0UL; i<m_; ++i )
+      {
+         size_t index( ( i*n_+jj ) / m_ );
+         size_t pos  ( ( i*n_+jj ) % m_ );
+         size_t shift( index / b_ );
+
+         for( size_t j=jj; j<jend; ++j ) {
+            const size_t row( ( pos >= shift )?( pos-shift ):( pos+m_-shift ) );
+            tmp[i*w_+j-jj] = v_[row*n_+j];
+            if( ++pos == m_ ) {
+               pos = 0UL;
+               shift = ++index / b_;
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=jj; j<jend; ++j ) {
+            v_[i*n_+j] = tmp[i*w_+j-jj];
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*  v_;     //!< Pointer to the first element of the matrix.
+   size_t m_;     //!< The number of rows of the contiguous matrix.
+   size_t n_;     //!< The number of columns of the contiguous matrix.
+   size_t c_;     //!< The greatest common divisor of \a m and \a n.
+   size_t b_;     //!< The number of columns per rotation step (n/c).
+   size_t w_;     //!< The width of a block of columns/height of a block of rows.
+   size_t pass_;  //!< The currently selected pass.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial in-place (conjugate) transposition of a contiguous non-square matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param m The number of rows/columns of the matrix.
+// \param n The number of columns/rows of the matrix.
+// \return void
+//
+// This function transposes the given contiguous (i.e. unpadded) \f$ m \times n \f$ matrix
+// in-place by serially performing all passes of a ContiguousTransposition kernel.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+void transposeContiguous( Type* v, size_t m, size_t n )
+{
+   ContiguousTransposition<Conj,Type> kernel( v, m, n );
+
+   for( size_t pass=0UL; pass<kernel.passes(); ++pass ) {
+      kernel.select( pass );
+      for( size_t k=0UL; k<kernel.blocks(); ++k )
+         kernel( k );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSED ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment policy for the tiled assignment of a dense matrix with opposite storage order.
+// \ingroup dense_matrix
+*/
+struct TileAssign
+{
+   template< typename MT, typename T >
+   static BLAZE_ALWAYS_INLINE void apply( MT& lhs, size_t i, size_t j, const T& value ) {
+      lhs(i,j) = value;
+   }
+
+   template< typename MT, typename IT >
+   static BLAZE_ALWAYS_INLINE void applyIntrinsic( MT& lhs, size_t i, size_t j, const IT& value ) {
+      lhs.store( i, j, value );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment policy for the tiled addition assignment of a dense matrix with
+//        opposite storage order.
+// \ingroup dense_matrix
+*/
+struct TileAddAssign
+{
+   template< typename MT, typename T >
+   static BLAZE_ALWAYS_INLINE void apply( MT& lhs, size_t i, size_t j, const T& value ) {
+      lhs(i,j) += value;
+   }
+
+   template< typename MT, typename IT >
+   static BLAZE_ALWAYS_INLINE void applyIntrinsic( MT& lhs, size_t i, size_t j, const IT& value ) {
+      lhs.store( i, j, lhs.load(i,j) + value );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment policy for the tiled subtraction assignment of a dense matrix
+//        with opposite storage order.
+// \ingroup dense_matrix
+*/
+struct TileSubAssign
+{
+   template< typename MT, typename T >
+   static BLAZE_ALWAYS_INLINE void apply( MT& lhs, size_t i, size_t j, const T& value ) {
+      lhs(i,j) -= value;
+   }
+
+   template< typename MT, typename IT >
+   static BLAZE_ALWAYS_INLINE void applyIntrinsic( MT& lhs, size_t i, size_t j, const IT& value ) {
+      lhs.store( i, j, lhs.load(i,j) - value );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized (addition/subtraction) assignment of a column-major dense matrix to
+//        a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side row-major dense matrix.
+// \param rhs The right-hand side column-major dense matrix.
+// \return void
+//
+// This function loads square tiles of the right-hand side column-major dense matrix column by
+// column into intrinsic registers, transposes the tiles in-register, and applies the given
+// assignment policy \a Op row by row to the left-hand side row-major dense matrix. In order to
+// reuse the loaded cache lines of the right-hand side matrix, the columns are processed in blocks
+// of \c TRANSPOSE_BLOCK_SIZE columns. The elements outside of complete tiles are handled
+// element-wise. The function requires that the element
+// type of both matrices supports the in-register transposition.
+*/
+template< typename Op     // Type of the assignment policy
+        , typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+void tiledTransposeAssign( DenseMatrix<MT1,rowMajor>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   typedef IntrinsicTrait<typename MT1::ElementType>  IT;
+   typedef typename IT::Type                           IntrinsicType;
+
+   BLAZE_STATIC_ASSERT( IT::transposition );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( (~lhs).rows()    );
+   const size_t N( (~lhs).columns() );
+
+   const size_t ipos( M & size_t(-IT::size) );
+   const size_t jpos( N & size_t(-IT::size) );
+
+   IntrinsicType r[IT::size];
+
+   for( size_t jjj=0UL; jjj<jpos; jjj+=TRANSPOSE_BLOCK_SIZE )
+   {
+      const size_t jend( min( jjj+TRANSPOSE_BLOCK_SIZE, jpos ) );
+
+      for( size_t ii=0UL; ii<ipos; ii+=IT::size )
+      {
+         for( size_t jj=jjj; jj<jend; jj+=IT::size )
+         {
+            for( size_t k=0UL; k<IT::size; ++k ) {
+               r[k] = (~rhs).load( ii, jj+k );
+            }
+
+            transpose( r );
+
+            for( size_t k=0UL; k<IT::size; ++k ) {
+               Op::applyIntrinsic( ~lhs, ii+k, jj, r[k] );
+            }
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<ipos; ++i ) {
+      for( size_t j=jpos; j<N; ++j ) {
+         Op::apply( ~lhs, i, j, (~rhs)(i,j) );
+      }
+   }
+
+   for( size_t i=ipos; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         Op::apply( ~lhs, i, j, (~rhs)(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized (addition/subtraction) assignment of a row-major dense matrix to
+//        a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side column-major dense matrix.
+// \param rhs The right-hand side row-major dense matrix.
+// \return void
+//
+// This function loads square tiles of the right-hand side row-major dense matrix row by row
+// into intrinsic registers, transposes the tiles in-register, and applies the given assignment
+// policy \a Op column by column to the left-hand side column-major dense matrix. In order to
+// reuse the loaded cache lines of the right-hand side matrix, the rows are processed in blocks
+// of \c TRANSPOSE_BLOCK_SIZE rows. The elements outside of complete tiles are handled
+// element-wise. The function requires that the element
+// type of both matrices supports the in-register transposition.
+*/
+template< typename Op     // Type of the assignment policy
+        , typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+void tiledTransposeAssign( DenseMatrix<MT1,columnMajor>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   typedef IntrinsicTrait<typename MT1::ElementType>  IT;
+   typedef typename IT::Type                           IntrinsicType;
+
+   BLAZE_STATIC_ASSERT( IT::transposition );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( (~lhs).rows()    );
+   const size_t N( (~lhs).columns() );
+
+   const size_t ipos( M & size_t(-IT::size) );
+   const size_t jpos( N & size_t(-IT::size) );
+
+   IntrinsicType r[IT::size];
+
+   for( size_t iii=0UL; iii<ipos; iii+=TRANSPOSE_BLOCK_SIZE )
+   {
+      const size_t iend( min( iii+TRANSPOSE_BLOCK_SIZE, ipos ) );
+
+      for( size_t jj=0UL; jj<jpos; jj+=IT::size )
+      {
+         for( size_t ii=iii; ii<iend; ii+=IT::size )
+         {
+            for( size_t k=0UL; k<IT::size; ++k ) {
+               r[k] = (~rhs).load( ii+k, jj );
+            }
+
+            transpose( r );
+
+            for( size_t k=0UL; k<IT::size; ++k ) {
+               Op::applyIntrinsic( ~lhs, ii, jj+k, r[k] );
+            }
+         }
+      }
+   }
+
+   for( size_t j=0UL; j<jpos; ++j ) {
+      for( size_t i=ipos; i<M; ++i ) {
+         Op::apply( ~lhs, i, j, (~rhs)(i,j) );
+      }
+   }
+
+   for( size_t j=jpos; j<N; ++j ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         Op::apply( ~lhs, i, j, (~rhs)(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
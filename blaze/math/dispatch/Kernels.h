@@ -0,0 +1,1396 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Kernels.h
+//  \brief Header file for the runtime dispatched kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DISPATCH_KERNELS_H_
+#define _BLAZE_MATH_DISPATCH_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  include <immintrin.h>
+#endif
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/InstructionSet.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBaseOf.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsPointer.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+#include <blaze/util/typetraits/RemovePointer.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TARGET SPECIFICATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dispatch Runtime instruction set dispatch
+// \ingroup math
+//
+// In addition to the compile time vectorization, the Blaze library provides kernels for the most
+// important dense and sparse operations that are compiled for several instruction sets (SSE2,
+// AVX, AVX2 and AVX-512) within the same executable. In case the instruction set selected at
+// runtime (see the instructionSet() and setInstructionSet() functions) is more powerful than the
+// instruction set the executable has been compiled for, these kernels are used instead of the
+// compile time vectorized kernels. Thus a single binary compiled for a generic x86 target makes
+// use of the full SIMD width of the executing CPU. The runtime dispatch can be disabled via the
+// BLAZE_USE_RUNTIME_DISPATCH switch (see <tt>./blaze/config/Vectorization.h</tt>).
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Function attributes for the compilation of kernels for specific instruction sets.
+// \ingroup dispatch
+*/
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  define BLAZE_TARGET_SSE2    __attribute__((target("sse2")))
+#  define BLAZE_TARGET_AVX     __attribute__((target("avx")))
+#  define BLAZE_TARGET_AVX2    __attribute__((target("avx2,fma")))
+#  define BLAZE_TARGET_AVX512  __attribute__((target("avx512f")))
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DISPATCHPACK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vector types for the runtime dispatched kernels.
+// \ingroup dispatch
+//
+// The DispatchPack class template provides the vector type \a Type for \a N packed values of
+// type \a T and the according type \a Unaligned for unaligned memory accesses. In contrast to
+// the intrinsic types of the compile time vectorization, these generic vector types can be used
+// within kernels that are compiled for a specific instruction set: Within a function compiled
+// for AVX a 256-bit vector type is mapped to a single AVX register, whereas it is mapped to two
+// SSE registers within a function compiled for SSE2.
+*/
+template< typename T, size_t N >
+struct DispatchPack;
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+template<>
+struct DispatchPack<float,4UL> {
+   typedef float Type      __attribute__((vector_size(16)));
+   typedef float Unaligned __attribute__((vector_size(16),aligned(4),may_alias));
+};
+
+template<>
+struct DispatchPack<float,8UL> {
+   typedef float Type      __attribute__((vector_size(32)));
+   typedef float Unaligned __attribute__((vector_size(32),aligned(4),may_alias));
+};
+
+template<>
+struct DispatchPack<float,16UL> {
+   typedef float Type      __attribute__((vector_size(64)));
+   typedef float Unaligned __attribute__((vector_size(64),aligned(4),may_alias));
+};
+
+template<>
+struct DispatchPack<double,2UL> {
+   typedef double Type      __attribute__((vector_size(16)));
+   typedef double Unaligned __attribute__((vector_size(16),aligned(8),may_alias));
+};
+
+template<>
+struct DispatchPack<double,4UL> {
+   typedef double Type      __attribute__((vector_size(32)));
+   typedef double Unaligned __attribute__((vector_size(32),aligned(8),may_alias));
+};
+
+template<>
+struct DispatchPack<double,8UL> {
+   typedef double Type      __attribute__((vector_size(64)));
+   typedef double Unaligned __attribute__((vector_size(64),aligned(8),may_alias));
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GENERIC KERNELS
+//
+//=================================================================================================
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the addition assignment of two dense arrays (\f$ \vec{y}+=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements.
+// \param x Pointer to the first element of the right-hand side array.
+// \param y Pointer to the first element of the target array.
+// \return void
+*/
+template< typename T, size_t N >
+BLAZE_ALWAYS_INLINE void addAssignKernel( size_t n, const T* x, T* y )
+{
+   typedef typename DispatchPack<T,N>::Unaligned  U;
+
+   size_t i( 0UL );
+
+   for( ; (i+N*2UL) <= n; i+=N*2UL ) {
+      *reinterpret_cast<U*>( y+i   ) += *reinterpret_cast<const U*>( x+i   );
+      *reinterpret_cast<U*>( y+i+N ) += *reinterpret_cast<const U*>( x+i+N );
+   }
+   for( ; i<n; ++i ) {
+      y[i] += x[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the subtraction assignment of two dense arrays (\f$ \vec{y}-=\vec{x} \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements.
+// \param x Pointer to the first element of the right-hand side array.
+// \param y Pointer to the first element of the target array.
+// \return void
+*/
+template< typename T, size_t N >
+BLAZE_ALWAYS_INLINE void subAssignKernel( size_t n, const T* x, T* y )
+{
+   typedef typename DispatchPack<T,N>::Unaligned  U;
+
+   size_t i( 0UL );
+
+   for( ; (i+N*2UL) <= n; i+=N*2UL ) {
+      *reinterpret_cast<U*>( y+i   ) -= *reinterpret_cast<const U*>( x+i   );
+      *reinterpret_cast<U*>( y+i+N ) -= *reinterpret_cast<const U*>( x+i+N );
+   }
+   for( ; i<n; ++i ) {
+      y[i] -= x[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the scalar product of two dense arrays (\f$ s=\vec{x}*\vec{y} \f$).
+// \ingroup dispatch
+//
+// \param n The number of elements.
+// \param x Pointer to the first element of the left-hand side array.
+// \param y Pointer to the first element of the right-hand side array.
+// \return The scalar product.
+*/
+template< typename T, size_t N >
+BLAZE_ALWAYS_INLINE T dotKernel( size_t n, const T* x, const T* y )
+{
+   typedef typename DispatchPack<T,N>::Type       V;
+   typedef typename DispatchPack<T,N>::Unaligned  U;
+
+   V xmm1 = V(), xmm2 = V(), xmm3 = V(), xmm4 = V();
+   size_t i( 0UL );
+
+   for( ; (i+N*4UL) <= n; i+=N*4UL ) {
+      xmm1 += *reinterpret_cast<const U*>( x+i       ) * *reinterpret_cast<const U*>( y+i       );
+      xmm2 += *reinterpret_cast<const U*>( x+i+N     ) * *reinterpret_cast<const U*>( y+i+N     );
+      xmm3 += *reinterpret_cast<const U*>( x+i+N*2UL ) * *reinterpret_cast<const U*>( y+i+N*2UL );
+      xmm4 += *reinterpret_cast<const U*>( x+i+N*3UL ) * *reinterpret_cast<const U*>( y+i+N*3UL );
+   }
+   for( ; (i+N) <= n; i+=N ) {
+      xmm1 += *reinterpret_cast<const U*>( x+i ) * *reinterpret_cast<const U*>( y+i );
+   }
+
+   xmm1 += xmm2 + xmm3 + xmm4;
+
+   T sp = T();
+   for( size_t k=0UL; k<N; ++k ) {
+      sp += xmm1[k];
+   }
+   for( ; i<n; ++i ) {
+      sp += x[i] * y[i];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for a row-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dispatch
+//
+// \param m The number of rows of matrix \a A.
+// \param n The number of columns of matrix \a A.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the row-major matrix \a A.
+// \param lda The total number of elements between two rows of matrix \a A.
+// \param x Pointer to the first element of vector \a x.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of vector \a y.
+// \return void
+//
+// In case \a beta is 0, the initial values of \a y are not accessed.
+*/
+template< typename T, size_t N >
+BLAZE_ALWAYS_INLINE void gemvKernel( size_t m, size_t n, T alpha, const T* A, size_t lda,
+                                     const T* x, T beta, T* y )
+{
+   typedef typename DispatchPack<T,N>::Type       V;
+   typedef typename DispatchPack<T,N>::Unaligned  U;
+
+   const size_t jpos( n & size_t(-N) );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + (i    )*lda );
+      const T* a2( A + (i+1UL)*lda );
+      const T* a3( A + (i+2UL)*lda );
+      const T* a4( A + (i+3UL)*lda );
+
+      V xmm1 = V(), xmm2 = V(), xmm3 = V(), xmm4 = V();
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=N ) {
+         const V x1( *reinterpret_cast<const U*>( x+j ) );
+         xmm1 += *reinterpret_cast<const U*>( a1+j ) * x1;
+         xmm2 += *reinterpret_cast<const U*>( a2+j ) * x1;
+         xmm3 += *reinterpret_cast<const U*>( a3+j ) * x1;
+         xmm4 += *reinterpret_cast<const U*>( a4+j ) * x1;
+      }
+
+      T value1 = T(), value2 = T(), value3 = T(), value4 = T();
+
+      for( size_t k=0UL; k<N; ++k ) {
+         value1 += xmm1[k];
+         value2 += xmm2[k];
+         value3 += xmm3[k];
+         value4 += xmm4[k];
+      }
+      for( ; j<n; ++j ) {
+         value1 += a1[j] * x[j];
+         value2 += a2[j] * x[j];
+         value3 += a3[j] * x[j];
+         value4 += a4[j] * x[j];
+      }
+
+      if( beta == T(0) ) {
+         y[i    ] = alpha * value1;
+         y[i+1UL] = alpha * value2;
+         y[i+2UL] = alpha * value3;
+         y[i+3UL] = alpha * value4;
+      }
+      else {
+         y[i    ] = alpha * value1 + beta * y[i    ];
+         y[i+1UL] = alpha * value2 + beta * y[i+1UL];
+         y[i+2UL] = alpha * value3 + beta * y[i+2UL];
+         y[i+3UL] = alpha * value4 + beta * y[i+3UL];
+      }
+   }
+
+   for( ; i<m; ++i )
+   {
+      const T value( dotKernel<T,N>( n, A + i*lda, x ) );
+
+      if( beta == T(0) )
+         y[i] = alpha * value;
+      else
+         y[i] = alpha * value + beta * y[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for a single block of a row-major dense matrix/dense matrix multiplication.
+// \ingroup dispatch
+//
+// \param m The number of rows of the block of \a C.
+// \param n The number of columns of the block of \a C.
+// \param k The number of columns of the block of \a A.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of the block of \a A.
+// \param lda The total number of elements between two rows of matrix \a A.
+// \param B Pointer to the first element of the block of \a B.
+// \param ldb The total number of elements between two rows of matrix \a B.
+// \param beta The scaling factor for \f$ C \f$.
+// \param C Pointer to the first element of the block of \a C.
+// \param ldc The total number of elements between two rows of matrix \a C.
+// \return void
+//
+// The block is computed in tiles of 4 rows and two vector widths. In case \a beta is 0, the
+// initial values of \a C are not accessed.
+*/
+template< typename T, size_t N >
+BLAZE_ALWAYS_INLINE void gemmBlockKernel( size_t m, size_t n, size_t k, T alpha,
+                                          const T* A, size_t lda, const T* B, size_t ldb,
+                                          T beta, T* C, size_t ldc )
+{
+   typedef typename DispatchPack<T,N>::Type       V;
+   typedef typename DispatchPack<T,N>::Unaligned  U;
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + (i    )*lda );
+      const T* a2( A + (i+1UL)*lda );
+      const T* a3( A + (i+2UL)*lda );
+      const T* a4( A + (i+3UL)*lda );
+
+      T* c1( C + (i    )*ldc );
+      T* c2( C + (i+1UL)*ldc );
+      T* c3( C + (i+2UL)*ldc );
+      T* c4( C + (i+3UL)*ldc );
+
+      size_t j( 0UL );
+
+      for( ; (j+N*2UL) <= n; j+=N*2UL )
+      {
+         V xmm1 = V(), xmm2 = V(), xmm3 = V(), xmm4 = V();
+         V xmm5 = V(), xmm6 = V(), xmm7 = V(), xmm8 = V();
+
+         for( size_t l=0UL; l<k; ++l ) {
+            const V b1( *reinterpret_cast<const U*>( B + l*ldb + j     ) );
+            const V b2( *reinterpret_cast<const U*>( B + l*ldb + j + N ) );
+            xmm1 += a1[l] * b1;
+            xmm2 += a1[l] * b2;
+            xmm3 += a2[l] * b1;
+            xmm4 += a2[l] * b2;
+            xmm5 += a3[l] * b1;
+            xmm6 += a3[l] * b2;
+            xmm7 += a4[l] * b1;
+            xmm8 += a4[l] * b2;
+         }
+
+         U* const p1( reinterpret_cast<U*>( c1+j ) );
+         U* const p2( reinterpret_cast<U*>( c2+j ) );
+         U* const p3( reinterpret_cast<U*>( c3+j ) );
+         U* const p4( reinterpret_cast<U*>( c4+j ) );
+
+         if( beta == T(0) ) {
+            p1[0] = alpha * xmm1; p1[1] = alpha * xmm2;
+            p2[0] = alpha * xmm3; p2[1] = alpha * xmm4;
+            p3[0] = alpha * xmm5; p3[1] = alpha * xmm6;
+            p4[0] = alpha * xmm7; p4[1] = alpha * xmm8;
+         }
+         else {
+            p1[0] = alpha * xmm1 + beta * p1[0]; p1[1] = alpha * xmm2 + beta * p1[1];
+            p2[0] = alpha * xmm3 + beta * p2[0]; p2[1] = alpha * xmm4 + beta * p2[1];
+            p3[0] = alpha * xmm5 + beta * p3[0]; p3[1] = alpha * xmm6 + beta * p3[1];
+            p4[0] = alpha * xmm7 + beta * p4[0]; p4[1] = alpha * xmm8 + beta * p4[1];
+         }
+      }
+
+      for( ; j<n; ++j )
+      {
+         T value1 = T(), value2 = T(), value3 = T(), value4 = T();
+
+         for( size_t l=0UL; l<k; ++l ) {
+            const T b1( B[l*ldb+j] );
+            value1 += a1[l] * b1;
+            value2 += a2[l] * b1;
+            value3 += a3[l] * b1;
+            value4 += a4[l] * b1;
+         }
+
+         if( beta == T(0) ) {
+            c1[j] = alpha * value1;
+            c2[j] = alpha * value2;
+            c3[j] = alpha * value3;
+            c4[j] = alpha * value4;
+         }
+         else {
+            c1[j] = alpha * value1 + beta * c1[j];
+            c2[j] = alpha * value2 + beta * c2[j];
+            c3[j] = alpha * value3 + beta * c3[j];
+            c4[j] = alpha * value4 + beta * c4[j];
+         }
+      }
+   }
+
+   for( ; i<m; ++i )
+   {
+      const T* a1( A + i*lda );
+      T* c1( C + i*ldc );
+
+      size_t j( 0UL );
+
+      for( ; (j+N) <= n; j+=N )
+      {
+         V xmm1 = V();
+
+         for( size_t l=0UL; l<k; ++l ) {
+            xmm1 += a1[l] * *reinterpret_cast<const U*>( B + l*ldb + j );
+         }
+
+         U* const p1( reinterpret_cast<U*>( c1+j ) );
+
+         if( beta == T(0) )
+            *p1 = alpha * xmm1;
+         else
+            *p1 = alpha * xmm1 + beta * (*p1);
+      }
+
+      for( ; j<n; ++j )
+      {
+         T value = T();
+
+         for( size_t l=0UL; l<k; ++l ) {
+            value += a1[l] * B[l*ldb+j];
+         }
+
+         if( beta == T(0) )
+            c1[j] = alpha * value;
+         else
+            c1[j] = alpha * value + beta * c1[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for a row-major dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dispatch
+//
+// \param m The number of rows of matrix \a C.
+// \param n The number of columns of matrix \a C.
+// \param k The number of columns of matrix \a A.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of the row-major matrix \a A.
+// \param lda The total number of elements between two rows of matrix \a A.
+// \param B Pointer to the first element of the row-major matrix \a B.
+// \param ldb The total number of elements between two rows of matrix \a B.
+// \param beta The scaling factor for \f$ C \f$.
+// \param C Pointer to the first element of the row-major matrix \a C.
+// \param ldc The total number of elements between two rows of matrix \a C.
+// \return void
+//
+// The multiplication is performed in blocks of 256 columns of \a A (i.e. rows of \a B) and
+// panels of eight vector widths of \a B and \a C, which keeps the active panel of \a B in
+// cache while it is combined with all rows of \a A. In case \a beta is 0, the initial values
+// of \a C are not accessed.
+*/
+template< typename T, size_t N >
+BLAZE_ALWAYS_INLINE void gemmKernel( size_t m, size_t n, size_t k, T alpha,
+                                     const T* A, size_t lda, const T* B, size_t ldb,
+                                     T beta, T* C, size_t ldc )
+{
+   const size_t kblock( 256UL );
+   const size_t jblock( N*8UL );
+
+   if( k == 0UL ) {
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            C[i*ldc+j] = ( beta == T(0) )?( T() ):( beta * C[i*ldc+j] );
+      return;
+   }
+
+   for( size_t jj=0UL; jj<n; jj+=jblock )
+   {
+      const size_t jsize( ( n - jj < jblock )?( n - jj ):( jblock ) );
+
+      for( size_t kk=0UL; kk<k; kk+=kblock )
+      {
+         const size_t ksize( ( k - kk < kblock )?( k - kk ):( kblock ) );
+
+         gemmBlockKernel<T,N>( m, jsize, ksize, alpha, A+kk, lda, B+kk*ldb+jj, ldb,
+                               ( kk == 0UL )?( beta ):( T(1) ), C+jj, ldc );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the scalar product of a sparse row and a dense array.
+// \ingroup dispatch
+//
+// \param begin Pointer to the first non-zero element of the sparse row.
+// \param end Pointer one past the last non-zero element of the sparse row.
+// \param x Pointer to the first element of the dense array.
+// \return The scalar product.
+*/
+template< typename T >
+BLAZE_ALWAYS_INLINE T sparseDotKernel( const ValueIndexPair<T>* begin,
+                                       const ValueIndexPair<T>* end, const T* x )
+{
+   T value1 = T(), value2 = T(), value3 = T(), value4 = T();
+
+   for( ; (begin+4) <= end; begin+=4 ) {
+      value1 += begin[0].value() * x[begin[0].index()];
+      value2 += begin[1].value() * x[begin[1].index()];
+      value3 += begin[2].value() * x[begin[2].index()];
+      value4 += begin[3].value() * x[begin[3].index()];
+   }
+   for( ; begin!=end; ++begin ) {
+      value1 += begin->value() * x[begin->index()];
+   }
+
+   return ( value1 + value2 ) + ( value3 + value4 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  GATHER KERNELS
+//
+//=================================================================================================
+
+#if BLAZE_RUNTIME_DISPATCH_MODE && defined(__x86_64__)
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel for the scalar product of a sparse row and a dense array of double
+//        precision values.
+// \ingroup dispatch
+//
+// \param begin Pointer to the first non-zero element of the sparse row.
+// \param end Pointer one past the last non-zero element of the sparse row.
+// \param x Pointer to the first element of the dense array.
+// \return The scalar product.
+//
+// This kernel loads four value-index pairs by means of two vector loads, separates the values
+// from the indices, and gathers the according elements of the dense array.
+*/
+BLAZE_TARGET_AVX2 inline double sparseDotGather( const ValueIndexPair<double>* begin,
+                                                 const ValueIndexPair<double>* end,
+                                                 const double* x )
+{
+   BLAZE_STATIC_ASSERT( sizeof( ValueIndexPair<double> ) == 2UL*sizeof( double ) );
+
+   __m256d xmm1( _mm256_setzero_pd() );
+   __m256d xmm2( _mm256_setzero_pd() );
+
+   for( ; (begin+8) <= end; begin+=8 ) {
+      const double* p( reinterpret_cast<const double*>( begin ) );
+      const __m256d a1( _mm256_loadu_pd( p     ) );
+      const __m256d a2( _mm256_loadu_pd( p+4UL ) );
+      const __m256d a3( _mm256_loadu_pd( p+8UL ) );
+      const __m256d a4( _mm256_loadu_pd( p+12UL ) );
+      const __m256i i1( _mm256_castpd_si256( _mm256_unpackhi_pd( a1, a2 ) ) );
+      const __m256i i2( _mm256_castpd_si256( _mm256_unpackhi_pd( a3, a4 ) ) );
+      xmm1 = _mm256_fmadd_pd( _mm256_unpacklo_pd( a1, a2 ), _mm256_i64gather_pd( x, i1, 8 ), xmm1 );
+      xmm2 = _mm256_fmadd_pd( _mm256_unpacklo_pd( a3, a4 ), _mm256_i64gather_pd( x, i2, 8 ), xmm2 );
+   }
+
+   xmm1 = _mm256_add_pd( xmm1, xmm2 );
+
+   const __m128d low( _mm_add_pd( _mm256_castpd256_pd128( xmm1 ), _mm256_extractf128_pd( xmm1, 1 ) ) );
+   double value( _mm_cvtsd_f64( _mm_add_sd( low, _mm_unpackhi_pd( low, low ) ) ) );
+
+   for( ; begin!=end; ++begin ) {
+      value += begin->value() * x[begin->index()];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel for the scalar product of a sparse row and a dense array of single
+//        precision values.
+// \ingroup dispatch
+//
+// \param begin Pointer to the first non-zero element of the sparse row.
+// \param end Pointer one past the last non-zero element of the sparse row.
+// \param x Pointer to the first element of the dense array.
+// \return The scalar product.
+//
+// This kernel loads four value-index pairs by means of two vector loads, separates the values
+// from the indices, and gathers the according elements of the dense array.
+*/
+BLAZE_TARGET_AVX2 inline float sparseDotGather( const ValueIndexPair<float>* begin,
+                                                const ValueIndexPair<float>* end,
+                                                const float* x )
+{
+   BLAZE_STATIC_ASSERT( sizeof( ValueIndexPair<float> ) == 2UL*sizeof( double ) );
+
+   const __m256i perm( _mm256_setr_epi32( 0, 2, 4, 6, 0, 2, 4, 6 ) );
+
+   __m128 xmm1( _mm_setzero_ps() );
+
+   for( ; (begin+4) <= end; begin+=4 ) {
+      const double* p( reinterpret_cast<const double*>( begin ) );
+      const __m256d a1( _mm256_loadu_pd( p     ) );
+      const __m256d a2( _mm256_loadu_pd( p+4UL ) );
+      const __m256i i1( _mm256_castpd_si256( _mm256_unpackhi_pd( a1, a2 ) ) );
+      const __m256  v1( _mm256_permutevar8x32_ps( _mm256_castpd_ps( _mm256_unpacklo_pd( a1, a2 ) ), perm ) );
+      xmm1 = _mm_fmadd_ps( _mm256_castps256_ps128( v1 ), _mm256_i64gather_ps( x, i1, 4 ), xmm1 );
+   }
+
+   const __m128 low( _mm_add_ps( xmm1, _mm_movehl_ps( xmm1, xmm1 ) ) );
+   float value( _mm_cvtss_f32( _mm_add_ss( low, _mm_shuffle_ps( low, low, 1 ) ) ) );
+
+   for( ; begin!=end; ++begin ) {
+      value += begin->value() * x[begin->index()];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DISPATCHEDKERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernels compiled for a specific instruction set.
+// \ingroup dispatch
+//
+// The specializations of the DispatchedKernels class template compile the generic kernels
+// for the instruction set \a ISA and the element type \a T.
+*/
+template< typename T, InstructionSet ISA >
+struct DispatchedKernels;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the definition of a specialization of the DispatchedKernels class template.
+// \ingroup dispatch
+*/
+#define BLAZE_DEFINE_DISPATCHED_KERNELS( TYPE, ISA, TARGET, SIZE, SPARSEDOT ) \
+template<> \
+struct DispatchedKernels<TYPE,ISA> \
+{ \
+   static TARGET void addAssign( size_t n, const TYPE* x, TYPE* y ) { \
+      addAssignKernel<TYPE,SIZE>( n, x, y ); \
+   } \
+   static TARGET void subAssign( size_t n, const TYPE* x, TYPE* y ) { \
+      subAssignKernel<TYPE,SIZE>( n, x, y ); \
+   } \
+   static TARGET TYPE dot( size_t n, const TYPE* x, const TYPE* y ) { \
+      return dotKernel<TYPE,SIZE>( n, x, y ); \
+   } \
+   static TARGET void gemv( size_t m, size_t n, TYPE alpha, const TYPE* A, size_t lda, \
+                            const TYPE* x, TYPE beta, TYPE* y ) { \
+      gemvKernel<TYPE,SIZE>( m, n, alpha, A, lda, x, beta, y ); \
+   } \
+   static TARGET void gemm( size_t m, size_t n, size_t k, TYPE alpha, const TYPE* A, size_t lda, \
+                            const TYPE* B, size_t ldb, TYPE beta, TYPE* C, size_t ldc ) { \
+      gemmKernel<TYPE,SIZE>( m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); \
+   } \
+   static TARGET TYPE sparseDot( const ValueIndexPair<TYPE>* begin, \
+                                 const ValueIndexPair<TYPE>* end, const TYPE* x ) { \
+      return SPARSEDOT( begin, end, x ); \
+   } \
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  if defined(__x86_64__)
+#    define BLAZE_SPARSEDOT_GENERIC  sparseDotKernel
+#    define BLAZE_SPARSEDOT_GATHER   sparseDotGather
+#  else
+#    define BLAZE_SPARSEDOT_GENERIC  sparseDotKernel
+#    define BLAZE_SPARSEDOT_GATHER   sparseDotKernel
+#  endif
+
+BLAZE_DEFINE_DISPATCHED_KERNELS( float , sse2InstructionSet  , BLAZE_TARGET_SSE2  ,  4UL, BLAZE_SPARSEDOT_GENERIC );
+BLAZE_DEFINE_DISPATCHED_KERNELS( float , avxInstructionSet   , BLAZE_TARGET_AVX   ,  8UL, BLAZE_SPARSEDOT_GENERIC );
+BLAZE_DEFINE_DISPATCHED_KERNELS( float , avx2InstructionSet  , BLAZE_TARGET_AVX2  ,  8UL, BLAZE_SPARSEDOT_GATHER  );
+BLAZE_DEFINE_DISPATCHED_KERNELS( float , avx512InstructionSet, BLAZE_TARGET_AVX512, 16UL, BLAZE_SPARSEDOT_GATHER  );
+BLAZE_DEFINE_DISPATCHED_KERNELS( double, sse2InstructionSet  , BLAZE_TARGET_SSE2  ,  2UL, BLAZE_SPARSEDOT_GENERIC );
+BLAZE_DEFINE_DISPATCHED_KERNELS( double, avxInstructionSet   , BLAZE_TARGET_AVX   ,  4UL, BLAZE_SPARSEDOT_GENERIC );
+BLAZE_DEFINE_DISPATCHED_KERNELS( double, avx2InstructionSet  , BLAZE_TARGET_AVX2  ,  4UL, BLAZE_SPARSEDOT_GATHER  );
+BLAZE_DEFINE_DISPATCHED_KERNELS( double, avx512InstructionSet, BLAZE_TARGET_AVX512,  8UL, BLAZE_SPARSEDOT_GATHER  );
+
+#  undef BLAZE_SPARSEDOT_GENERIC
+#  undef BLAZE_SPARSEDOT_GATHER
+#endif
+
+#undef BLAZE_DEFINE_DISPATCHED_KERNELS
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS KERNELTABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of the kernels compiled for a specific instruction set.
+// \ingroup dispatch
+*/
+template< typename T >
+struct KernelTable
+{
+   void (*addAssign)( size_t n, const T* x, T* y );
+   void (*subAssign)( size_t n, const T* x, T* y );
+   T    (*dot      )( size_t n, const T* x, const T* y );
+   void (*gemv     )( size_t m, size_t n, T alpha, const T* A, size_t lda, const T* x, T beta, T* y );
+   void (*gemm     )( size_t m, size_t n, size_t k, T alpha, const T* A, size_t lda,
+                      const T* B, size_t ldb, T beta, T* C, size_t ldc );
+   T    (*sparseDot)( const ValueIndexPair<T>* begin, const ValueIndexPair<T>* end, const T* x );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the kernel table for the given element type and instruction set.
+// \ingroup dispatch
+//
+// \return The kernel table for element type \a T and instruction set \a ISA.
+*/
+template< typename T, InstructionSet ISA >
+inline KernelTable<T> makeKernelTable()
+{
+   typedef DispatchedKernels<T,ISA>  Kernels;
+
+   const KernelTable<T> table = { &Kernels::addAssign, &Kernels::subAssign, &Kernels::dot,
+                                  &Kernels::gemv, &Kernels::gemm, &Kernels::sparseDot };
+   return table;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the kernel table for the currently selected instruction set.
+// \ingroup dispatch
+//
+// \return The kernel table for element type \a T and the currently selected instruction set.
+*/
+template< typename T >
+inline const KernelTable<T>& kernelTable()
+{
+   static const KernelTable<T> tables[4] = { makeKernelTable<T,sse2InstructionSet  >()
+                                           , makeKernelTable<T,avxInstructionSet   >()
+                                           , makeKernelTable<T,avx2InstructionSet  >()
+                                           , makeKernelTable<T,avx512InstructionSet>() };
+
+   BLAZE_INTERNAL_ASSERT( instructionSet() > defaultInstructionSet, "Invalid instruction set" );
+
+   return tables[instructionSet()-1];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the runtime dispatched kernels are used.
+// \ingroup dispatch
+//
+// \return \a true in case the runtime dispatched kernels are used, \a false if not.
+//
+// The runtime dispatched kernels are used in case the runtime dispatch mode is enabled (see the
+// BLAZE_USE_RUNTIME_DISPATCH switch) and the currently selected instruction set is more powerful
+// than the instruction set the executable has been compiled for.
+*/
+inline bool useDispatchedKernels()
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   return instructionSet() > compiledInstructionSet();
+#else
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SFINAE HELPERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the runtime dispatched kernels.
+// \ingroup dispatch
+//
+// In case the given type is an element type supported by the runtime dispatched kernels (i.e.
+// \c float or \c double) and the runtime dispatch mode is enabled, the \a value member
+// enumeration is set to 1, otherwise it is set to 0.
+*/
+template< typename T >
+struct IsDispatchable
+{
+   enum { value = BLAZE_RUNTIME_DISPATCH_MODE && ( IsFloat<T>::value || IsDouble<T>::value ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the runtime dispatched dense vector kernels.
+// \ingroup dispatch
+*/
+template< typename T1, typename T2 >
+struct UseDispatchedVectorKernel
+{
+   enum { value = HasMutableDataAccess<T1>::value &&
+                  HasConstDataAccess<T2>::value &&
+                  T1::vectorizable && T2::vectorizable &&
+                  IsDispatchable<typename T1::ElementType>::value &&
+                  IsSame<typename T1::ElementType,typename T2::ElementType>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the runtime dispatched scalar product kernel.
+// \ingroup dispatch
+*/
+template< typename T1, typename T2 >
+struct UseDispatchedDotKernel
+{
+   enum { value = HasConstDataAccess<T1>::value &&
+                  HasConstDataAccess<T2>::value &&
+                  T1::vectorizable && T2::vectorizable &&
+                  IsDispatchable<typename T1::ElementType>::value &&
+                  IsSame<typename T1::ElementType,typename T2::ElementType>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the runtime dispatched multiplication kernels.
+// \ingroup dispatch
+//
+// The runtime dispatched matrix/vector and matrix/matrix multiplication kernels are selected for
+// the same operand types as the according BLAS kernels, restricted to row-major matrices and to
+// single and double precision elements.
+*/
+template< typename T1, typename T2, typename T3 >
+struct UseDispatchedMultKernel
+{
+   enum { value = HasMutableDataAccess<T1>::value &&
+                  HasConstDataAccess<T2>::value &&
+                  HasConstDataAccess<T3>::value &&
+                  !IsDiagonal<T2>::value && !IsDiagonal<T3>::value &&
+                  T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                  IsDispatchable<typename T1::ElementType>::value &&
+                  IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                  IsSame<typename T1::ElementType,typename T3::ElementType>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the runtime dispatched sparse row kernel.
+// \ingroup dispatch
+//
+// The runtime dispatched kernel for the scalar product of a sparse row and a dense vector is
+// selected in case the iterator over the sparse row is a pointer to a value-index pair (as for
+// instance in case of the CompressedMatrix class template).
+*/
+template< typename IteratorType, typename VT >
+struct UseDispatchedSparseKernel
+{
+   typedef typename RemoveConst< typename RemovePointer<IteratorType>::Type >::Type  Element;
+   typedef ValueIndexPair<typename VT::ElementType>                                  Pair;
+
+   enum { value = IsPointer<IteratorType>::value &&
+                  HasConstDataAccess<VT>::value && VT::vectorizable &&
+                  IsDispatchable<typename VT::ElementType>::value &&
+                  IsBaseOf<Pair,Element>::value && sizeof( Element ) == sizeof( Pair ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched addition assignment of a dense vector (\f$ \vec{a}+=\vec{b} \f$).
+// \ingroup dispatch
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return \a true in case the addition assignment has been performed, \a false if not.
+//
+// This function performs the addition assignment of two contiguous single or double precision
+// dense vectors by means of the kernel for the currently selected instruction set, in case this
+// instruction set is more powerful than the compiled instruction set (see the
+// useDispatchedKernels() function). Otherwise the function returns \a false without accessing
+// the operands and the caller is expected to perform the addition assignment.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline typename EnableIf< UseDispatchedVectorKernel<VT1,VT2>, bool >::Type
+   dispatchedAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( !useDispatchedKernels() )
+      return false;
+
+   kernelTable<ET>().addAssign( (~lhs).size(), (~rhs).data(), (~lhs).data() );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched addition assignment of a dense vector (\f$ \vec{a}+=\vec{b} \f$).
+// \ingroup dispatch
+//
+// \return \a false.
+//
+// This function is selected for operands that are not supported by the runtime dispatched
+// kernels.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline typename DisableIf< UseDispatchedVectorKernel<VT1,VT2>, bool >::Type
+   dispatchedAddAssign( DenseVector<VT1,TF>& /*lhs*/, const DenseVector<VT2,TF>& /*rhs*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched subtraction assignment of a dense vector (\f$ \vec{a}-=\vec{b} \f$).
+// \ingroup dispatch
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return \a true in case the subtraction assignment has been performed, \a false if not.
+//
+// This function performs the subtraction assignment of two contiguous single or double precision
+// dense vectors by means of the kernel for the currently selected instruction set, in case this
+// instruction set is more powerful than the compiled instruction set (see the
+// useDispatchedKernels() function). Otherwise the function returns \a false without accessing
+// the operands and the caller is expected to perform the subtraction assignment.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline typename EnableIf< UseDispatchedVectorKernel<VT1,VT2>, bool >::Type
+   dispatchedSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( !useDispatchedKernels() )
+      return false;
+
+   kernelTable<ET>().subAssign( (~lhs).size(), (~rhs).data(), (~lhs).data() );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched subtraction assignment of a dense vector (\f$ \vec{a}-=\vec{b} \f$).
+// \ingroup dispatch
+//
+// \return \a false.
+//
+// This function is selected for operands that are not supported by the runtime dispatched
+// kernels.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline typename DisableIf< UseDispatchedVectorKernel<VT1,VT2>, bool >::Type
+   dispatchedSubAssign( DenseVector<VT1,TF>& /*lhs*/, const DenseVector<VT2,TF>& /*rhs*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched scalar product of two dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dispatch
+//
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \param result The resulting scalar product.
+// \return \a true in case the scalar product has been computed, \a false if not.
+//
+// This function computes the scalar product of two contiguous single or double precision dense
+// vectors by means of the kernel for the currently selected instruction set, in case this
+// instruction set is more powerful than the compiled instruction set (see the
+// useDispatchedKernels() function). Otherwise the function returns \a false without accessing
+// the operands and the caller is expected to compute the scalar product.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , typename ET >  // Type of the result
+inline typename EnableIf< UseDispatchedDotKernel<VT1,VT2>, bool >::Type
+   dispatchedDot( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs, ET& result )
+{
+   typedef typename VT1::ElementType  ET1;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( !useDispatchedKernels() )
+      return false;
+
+   result = kernelTable<ET1>().dot( (~lhs).size(), (~lhs).data(), (~rhs).data() );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched scalar product of two dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dispatch
+//
+// \return \a false.
+//
+// This function is selected for operands that are not supported by the runtime dispatched
+// kernels.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , typename ET >  // Type of the result
+inline typename DisableIf< UseDispatchedDotKernel<VT1,VT2>, bool >::Type
+   dispatchedDot( const DenseVector<VT1,true>& /*lhs*/, const DenseVector<VT2,false>& /*rhs*/,
+                  ET& /*result*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dispatch
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side row-major dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the dense matrix/dense vector multiplication for single or double
+// precision operands by means of the kernel for the currently selected instruction set, in case
+// this instruction set is more powerful than the compiled instruction set (see the
+// useDispatchedKernels() function). Otherwise the function returns \a false without accessing
+// the operands and the caller is expected to perform the multiplication. In case \a beta is 0,
+// the initial values of \a y are not accessed.
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename MT1  // Type of the left-hand side matrix operand
+        , typename VT2  // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scalar factors
+inline typename EnableIf< UseDispatchedMultKernel<VT1,MT1,VT2>, bool >::Type
+   dispatchedGemv( DenseVector<VT1,false>& y, const DenseMatrix<MT1,false>& A,
+                   const DenseVector<VT2,false>& x, ST alpha, ST beta )
+{
+   typedef typename VT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == (~A).rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == (~A).columns(), "Invalid vector size" );
+
+   if( !useDispatchedKernels() )
+      return false;
+
+   kernelTable<ET>().gemv( (~A).rows(), (~A).columns(), ET( alpha ), (~A).data(), (~A).spacing(),
+                           (~x).data(), ET( beta ), (~y).data() );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dispatch
+//
+// \return \a false.
+//
+// This function is selected for operands that are not supported by the runtime dispatched
+// kernels.
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename MT1  // Type of the left-hand side matrix operand
+        , typename VT2  // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scalar factors
+inline typename DisableIf< UseDispatchedMultKernel<VT1,MT1,VT2>, bool >::Type
+   dispatchedGemv( DenseVector<VT1,false>& /*y*/, const DenseMatrix<MT1,false>& /*A*/,
+                   const DenseVector<VT2,false>& /*x*/, ST /*alpha*/, ST /*beta*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dispatch
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side row-major dense matrix operand.
+// \param B The right-hand side row-major dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the multiplication of two row-major dense matrices with single or
+// double precision elements by means of the kernel for the currently selected instruction set,
+// in case this instruction set is more powerful than the compiled instruction set (see the
+// useDispatchedKernels() function) and the target matrix is a row-major matrix. Otherwise the
+// function returns \a false without accessing the operands and the caller is expected to
+// perform the multiplication. In case \a beta is 0, the initial values of \a C are not
+// accessed.
+*/
+template< typename MT1  // Type of the left-hand side target matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , bool SO       // Storage order of the target matrix
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scalar factors
+inline typename EnableIf< UseDispatchedMultKernel<MT1,MT2,MT3>, bool >::Type
+   dispatchedGemm( DenseMatrix<MT1,SO>& C, const DenseMatrix<MT2,false>& A,
+                   const DenseMatrix<MT3,false>& B, ST alpha, ST beta )
+{
+   typedef typename MT1::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   if( SO || !useDispatchedKernels() )
+      return false;
+
+   kernelTable<ET>().gemm( (~A).rows(), (~B).columns(), (~A).columns(), ET( alpha ),
+                           (~A).data(), (~A).spacing(), (~B).data(), (~B).spacing(),
+                           ET( beta ), (~C).data(), (~C).spacing() );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dispatch
+//
+// \return \a false.
+//
+// This function is selected for operands that are not supported by the runtime dispatched
+// kernels.
+*/
+template< typename MT1  // Type of the left-hand side target matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , bool SO       // Storage order of the target matrix
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scalar factors
+inline typename DisableIf< UseDispatchedMultKernel<MT1,MT2,MT3>, bool >::Type
+   dispatchedGemm( DenseMatrix<MT1,SO>& /*C*/, const DenseMatrix<MT2,false>& /*A*/,
+                   const DenseMatrix<MT3,false>& /*B*/, ST /*alpha*/, ST /*beta*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtime dispatched scalar product of a sparse row and a dense vector.
+// \ingroup dispatch
+//
+// \param begin Iterator to the first non-zero element of the sparse row.
+// \param end Iterator one past the last non-zero element of the sparse row.
+// \param x The dense vector.
+// \param result The resulting scalar product.
+// \return \a true in case the scalar product has been computed, \a false if not.
+//
+// This function computes the scalar product of a sparse row (as for instance a row of a
+// row-major CompressedMatrix) with a contiguous single or double precision dense vector by means
+// of the kernel for the currently selected instruction set, in case this instruction set is more
+// powerful than the compiled instruction set (see the useDispatchedKernels() function) and the
+// row contains at least 16 non-zero elements. Otherwise the function returns \a false without
+// accessing the operands and the caller is expected to compute the scalar product.
+*/
+template< typename IteratorType  // Type of the sparse row iterator
+        , typename VT            // Type of the dense vector
+        , typename ET >          // Type of the result
+inline typename EnableIf< UseDispatchedSparseKernel<IteratorType,VT>, bool >::Type
+   dispatchedSparseDot( IteratorType begin, IteratorType end,
+                        const DenseVector<VT,false>& x, ET& result )
+{
+   typedef typename VT::ElementType       XET;
+   typedef const ValueIndexPair<XET>*     Pointer;
+
+   if( end - begin < 16 || !useDispatchedKernels() )
+      return false;
+
+   result = kernelTable<XET>().sparseDot( static_cast<Pointer>( begin ), static_cast<Pointer>( end ),
+                                          (~x).data() );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched scalar product of a sparse row and a dense vector.
+// \ingroup dispatch
+//
+// \return \a false.
+//
+// This function is selected for operands that are not supported by the runtime dispatched
+// kernels.
+*/
+template< typename IteratorType  // Type of the sparse row iterator
+        , typename VT            // Type of the dense vector
+        , typename ET >          // Type of the result
+inline typename DisableIf< UseDispatchedSparseKernel<IteratorType,VT>, bool >::Type
+   dispatchedSparseDot( IteratorType /*begin*/, IteratorType /*end*/,
+                        const DenseVector<VT,false>& /*x*/, ET& /*result*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,374 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/CachedExpression.h
+//  \brief Header file for the CachedExpression class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_CACHEDEXPRESSION_H_
+#define _BLAZE_MATH_EXPRESSIONS_CACHEDEXPRESSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/IsVector.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for the repeated use of the result of a vector or matrix expression.
+// \ingroup math
+//
+// The CachedExpression class template wraps a vector or matrix expression, evaluates it on
+// first use into an internal buffer and returns this buffer on all subsequent uses. This avoids
+// the repeated evaluation of a subexpression that feeds several assignments:
+
+   \code
+   blaze::DynamicMatrix<double> A( N, N );
+   blaze::DynamicVector<double> x( N ), y, z;
+
+   blaze::CachedExpression< ... > Atx( blaze::cache( trans(A) * x ) );  // or 'auto Atx = ...' in C++11
+   Atx.track( A ).track( x );
+
+   for( ... ) {
+      y = Atx.get() + z;      // Evaluates trans(A)*x
+      z = 2.0 * Atx.get();    // Reuses the cached result
+      x = y;                  // Modifies x, the next call of get() reevaluates trans(A)*x
+   }
+   \endcode
+
+// The cache is invalidated whenever the modification counter (see for instance the version()
+// function of DynamicVector and DynamicMatrix) of one of the tracked operands changes. The
+// buffer is reused for every reevaluation, i.e. as long as the size of the result does not grow
+// no reallocation takes place. Note that the counters only track operations that change the
+// operands as a whole (assignments, resizing, ...). In case an operand is modified via element
+// access, iterators, or views, the cache has to be invalidated explicitly via invalidate().
+// Also note that the handle stores references to all operands of the wrapped expression and all
+// tracked operands, which therefore must outlive the handle.
+*/
+template< typename ET >  // Type of the wrapped vector or matrix expression
+class CachedExpression
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the wrapped expression.
+   typedef typename SelectType< IsExpression<ET>::value, const ET, const ET& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**Dependency**********************************************************************************
+   /*!\brief Tracked operand of the wrapped expression.
+   */
+   struct Dependency
+   {
+      const void* source_;                      //!< Pointer to the tracked operand.
+      size_t (*version_)( const void* source );  //!< Access function to the modification counter.
+      size_t snapshot_;                         //!< The counter value at the last evaluation.
+   };
+   //**********************************************************************************************
+
+   //**Version access function*********************************************************************
+   /*!\brief Returns the current modification counter of the given operand.
+   //
+   // \param source Pointer to the tracked operand.
+   // \return The current modification counter of the operand.
+   */
+   template< typename T >  // Type of the tracked operand
+   static size_t versionOf( const void* source ) {
+      return static_cast<const T*>( source )->version();
+   }
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef CachedExpression<ET>     This;        //!< Type of this CachedExpression instance.
+   typedef typename ET::ResultType  ResultType;  //!< Result type of the wrapped expression.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline CachedExpression( const ET& expr );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   inline CachedExpression&  track( const T& source );
+
+   inline const ResultType&  get();
+   inline void               invalidate();
+   inline bool               isValid() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand    expr_;    //!< The wrapped vector or matrix expression.
+   ResultType result_;  //!< The buffer for the result of the expression.
+   bool       valid_;   //!< Validity flag of the buffer.
+
+   std::vector<Dependency> dependencies_;  //!< The tracked operands of the expression.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( IsVector<ET>::value || IsMatrix<ET>::value );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CachedExpression class template.
+//
+// \param expr The vector or matrix expression to be wrapped.
+//
+// The expression is not evaluated before the first call of the get() function.
+*/
+template< typename ET >  // Type of the wrapped vector or matrix expression
+inline CachedExpression<ET>::CachedExpression( const ET& expr )
+   : expr_        ( expr  )  // The wrapped vector or matrix expression
+   , result_      ()         // The buffer for the result of the expression
+   , valid_       ( false )  // Validity flag of the buffer
+   , dependencies_()         // The tracked operands of the expression
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registers an operand whose modifications invalidate the cached result.
+//
+// \param source The operand to be tracked.
+// \return Reference to the cached expression.
+//
+// The given operand must provide a \a version() member function returning its modification
+// counter (as for instance DynamicVector and DynamicMatrix). A change of the counter invalidates
+// the cached result. The operand must outlive the cached expression.
+*/
+template< typename ET >  // Type of the wrapped vector or matrix expression
+template< typename T >   // Type of the tracked operand
+inline CachedExpression<ET>& CachedExpression<ET>::track( const T& source )
+{
+   const Dependency dependency = { &source, &This::template versionOf<T>, source.version() };
+   dependencies_.push_back( dependency );
+   valid_ = false;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the result of the wrapped expression.
+//
+// \return Reference to the cached result.
+//
+// In case the cache is invalid, either since the expression has not been evaluated yet, since
+// invalidate() has been called, or since any of the tracked operands has been modified, the
+// expression is reevaluated into the existing buffer. Otherwise the cached result is returned
+// without any computation.
+*/
+template< typename ET >  // Type of the wrapped vector or matrix expression
+inline const typename CachedExpression<ET>::ResultType& CachedExpression<ET>::get()
+{
+   typedef typename std::vector<Dependency>::iterator  Iterator;
+
+   for( Iterator d=dependencies_.begin(); d!=dependencies_.end(); ++d ) {
+      const size_t version( d->version_( d->source_ ) );
+      if( version != d->snapshot_ ) {
+         d->snapshot_ = version;
+         valid_ = false;
+      }
+   }
+
+   if( !valid_ ) {
+      result_ = expr_;
+      valid_  = true;
+   }
+
+   return result_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Invalidates the cached result.
+//
+// \return void
+//
+// The next call of the get() function reevaluates the wrapped expression. This function has to
+// be used in case an operand has been modified in a way that is not reflected by its modification
+// counter (e.g. via element access or views).
+*/
+template< typename ET >  // Type of the wrapped vector or matrix expression
+inline void CachedExpression<ET>::invalidate()
+{
+   valid_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the cached result is valid.
+//
+// \return \a true in case the cached result is up to date, \a false if not.
+*/
+template< typename ET >  // Type of the wrapped vector or matrix expression
+inline bool CachedExpression<ET>::isValid() const
+{
+   if( !valid_ ) return false;
+
+   typedef typename std::vector<Dependency>::const_iterator  ConstIterator;
+
+   for( ConstIterator d=dependencies_.begin(); d!=dependencies_.end(); ++d ) {
+      if( d->version_( d->source_ ) != d->snapshot_ )
+         return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CachedExpression functions */
+//@{
+template< typename VT, bool TF >
+inline CachedExpression<VT> cache( const Vector<VT,TF>& vec );
+
+template< typename MT, bool SO >
+inline CachedExpression<MT> cache( const Matrix<MT,SO>& mat );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a cached handle for the given vector expression.
+// \ingroup math
+//
+// \param vec The vector expression to be cached.
+// \return The cached handle for the vector expression.
+//
+// \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x;
+   // ... Resizing and initialization
+
+   auto Atx = blaze::cache( trans(A) * x );  // C++11
+   Atx.track( A ).track( x );
+   \endcode
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline CachedExpression<VT> cache( const Vector<VT,TF>& vec )
+{
+   return CachedExpression<VT>( ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a cached handle for the given matrix expression.
+// \ingroup math
+//
+// \param mat The matrix expression to be cached.
+// \return The cached handle for the matrix expression.
+//
+// \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+
+   auto AtA = blaze::cache( trans(A) * A );  // C++11
+   AtA.track( A );
+   \endcode
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline CachedExpression<MT> cache( const Matrix<MT,SO>& mat )
+{
+   return CachedExpression<MT>( ~mat );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -71,6 +72,7 @@
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
@@ -93,6 +95,8 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/views/DenseSubmatrix.h>
+#include <blaze/math/views/Submatrix.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Blocking.h>
 #include <blaze/system/Optimizations.h>
@@ -164,6 +168,25 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    enum { evaluateRight = IsComputation<MT2>::value || RequiresEvaluation<MT2>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Compilation switch for the panel-wise evaluation of the left-hand side operand.
+   /*! In case the left-hand side operand is an element-wise computation (as for instance A+B)
+       with a general, resizable result type, it is evaluated in row panels. */
+   enum { tileLeft = evaluateLeft && !RequiresEvaluation<MT1>::value &&
+                     !IsTriangular<MT1>::value && !IsAdaptor<RT1>::value &&
+                     IsResizable<RT1>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the panel-wise evaluation of the right-hand side operand.
+   /*! In case the left-hand side operand cannot be evaluated panel-wise and the right-hand side
+       operand is an element-wise computation with a general, resizable result type, the right-
+       hand side operand is evaluated in column panels. */
+   enum { tileRight = !tileLeft && evaluateRight && !RequiresEvaluation<MT2>::value &&
+                      !IsTriangular<MT2>::value && !IsAdaptor<RT2>::value &&
+                      IsResizable<RT2>::value };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -180,6 +203,22 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseTiledEvaluation struct is a helper struct for the selection of the tiled evaluation
+       strategy. In case the target matrix is a general, resizable dense matrix, no symmetry can
+       be exploited and either of the two matrix operands can be evaluated panel-wise, the nested
+       \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseTiledEvaluation {
+      enum { value = ( tileLeft || tileRight ) &&
+                     IsDenseMatrix<T1>::value && IsResizable<T1>::value && !IsAdaptor<T1>::value &&
+                     !CanExploitSymmetry<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -189,7 +228,67 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename T1, typename T2, typename T3 >
    struct IsEvaluationRequired {
       enum { value = ( evaluateLeft || evaluateRight ) &&
-                     !CanExploitSymmetry<T1,T2,T3>::value };
+                     !CanExploitSymmetry<T1,T2,T3>::value &&
+                     !UseTiledEvaluation<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structures for the panel-wise assignment of a multiplication to a target panel.
+   struct PanelAssign {
+      template< typename MT3, typename MT4 >
+      inline void operator()( MT3& C, const MT4& rhs ) const { assign( C, rhs ); }
+   };
+
+   struct PanelAddAssign {
+      template< typename MT3, typename MT4 >
+      inline void operator()( MT3& C, const MT4& rhs ) const { addAssign( C, rhs ); }
+   };
+
+   struct PanelSubAssign {
+      template< typename MT3, typename MT4 >
+      inline void operator()( MT3& C, const MT4& rhs ) const { subAssign( C, rhs ); }
+   };
+
+   struct PanelSMPAssign {
+      template< typename MT3, typename MT4 >
+      inline void operator()( MT3& C, const MT4& rhs ) const { smpAssign( C, rhs ); }
+   };
+
+   struct PanelSMPAddAssign {
+      template< typename MT3, typename MT4 >
+      inline void operator()( MT3& C, const MT4& rhs ) const { smpAddAssign( C, rhs ); }
+   };
+
+   struct PanelSMPSubAssign {
+      template< typename MT3, typename MT4 >
+      inline void operator()( MT3& C, const MT4& rhs ) const { smpSubAssign( C, rhs ); }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the left-hand side operand is evaluated in row panels, the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseLeftPanels {
+      enum { value = tileLeft && IsDenseMatrix<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the right-hand side operand is evaluated in column panels, the nested \a value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseRightPanels {
+      enum { value = tileRight && IsDenseMatrix<T1>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -448,7 +547,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+   friend inline typename DisableIf< Or< CanExploitSymmetry<MT,MT1,MT2>
+                                       , UseTiledEvaluation<MT,MT1,MT2> > >::Type
       assign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -479,6 +579,142 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Tiled assignment to dense matrices**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Tiled assignment of a dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-dense matrix multiplication
+   // expression with an element-wise operand (as for instance \f$ (A+B)*C \f$). Instead of
+   // evaluating the operand into a full-size temporary, it is evaluated panel by panel into a
+   // cache-sized buffer that directly feeds the multiplication kernel. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case either of the two matrix operands can be evaluated panel-wise.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTiledEvaluation<MT,MT1,MT2> >::Type
+      assign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      DMatDMatMultExpr::tiledAssign( ~lhs, rhs, PanelAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Tiled assignment to dense matrices (row panels)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Panel-wise evaluation of the left-hand side operand of a dense matrix-dense matrix
+   //        multiplication (\f$ C=(A+B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression.
+   // \param op The assignment operation for a single panel of the target matrix.
+   // \return void
+   //
+   // This function evaluates the left-hand side operand in panels of consecutive rows. Each
+   // panel is multiplied with the evaluated right-hand side operand and assigned to the
+   // according rows of the target matrix. In case the left-hand side operand is aliased with
+   // the target matrix, the operand is evaluated as a single panel.
+   */
+   template< typename MT3   // Type of the left-hand side target matrix
+           , typename OP >  // Type of the panel assignment operation
+   static inline typename EnableIf< UseLeftPanels<MT3> >::Type
+      tiledAssign( MT3& C, const DMatDMatMultExpr& rhs, OP op )
+   {
+      typedef typename SubmatrixExprTrait<MT3,unaligned>::Type  Target;
+
+      const size_t M( rhs.rows()        );
+      const size_t N( rhs.columns()     );
+      const size_t K( rhs.lhs_.columns() );
+
+      const size_t block( ( rhs.lhs_.isAliased( &C ) )
+                          ?( M )
+                          :( max( DMATDMATMULT_IBLOCK_SIZE, DMATDMATMULT_PANEL_SIZE / K ) ) );
+
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+      RT1 A;                       // Panel of the left-hand side dense matrix operand
+
+      for( size_t i=0UL; i<M; i+=block )
+      {
+         const size_t m( min( block, M-i ) );
+
+         A.resize( m, K, false );
+         assign( A, submatrix( rhs.lhs_, i, 0UL, m, K ) );
+
+         Target target( submatrix( C, i, 0UL, m, N ) );
+         op( target, A * B );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Tiled assignment to dense matrices (column panels)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Panel-wise evaluation of the right-hand side operand of a dense matrix-dense matrix
+   //        multiplication (\f$ C=A*(B+D) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression.
+   // \param op The assignment operation for a single panel of the target matrix.
+   // \return void
+   //
+   // This function evaluates the right-hand side operand in panels of consecutive columns.
+   // The evaluated left-hand side operand is multiplied with each panel and the result is
+   // assigned to the according columns of the target matrix. In case the right-hand side
+   // operand is aliased with the target matrix, the operand is evaluated as a single panel.
+   */
+   template< typename MT3   // Type of the left-hand side target matrix
+           , typename OP >  // Type of the panel assignment operation
+   static inline typename EnableIf< UseRightPanels<MT3> >::Type
+      tiledAssign( MT3& C, const DMatDMatMultExpr& rhs, OP op )
+   {
+      typedef typename SubmatrixExprTrait<MT3,unaligned>::Type  Target;
+
+      const size_t M( rhs.rows()        );
+      const size_t N( rhs.columns()     );
+      const size_t K( rhs.lhs_.columns() );
+
+      const size_t block( ( rhs.rhs_.isAliased( &C ) )
+                          ?( N )
+                          :( max( DMATDMATMULT_JBLOCK_SIZE, DMATDMATMULT_PANEL_SIZE / K ) ) );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      RT2 B;                       // Panel of the right-hand side dense matrix operand
+
+      for( size_t j=0UL; j<N; j+=block )
+      {
+         const size_t n( min( block, N-j ) );
+
+         B.resize( K, n, false );
+         assign( B, submatrix( rhs.rhs_, 0UL, j, K, n ) );
+
+         Target target( submatrix( C, 0UL, j, M, n ) );
+         op( target, A * B );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices (kernel selection)*********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Selection of the kernel for an assignment of a dense matrix-dense matrix
@@ -1433,8 +1669,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a large dense
-   // matrix-dense matrix multiplication expression to a dense matrix.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemm() function) or,
+   // in case these are not applicable, to the default implementation of the assignment of a large
+   // dense matrix-dense matrix multiplication expression to a dense matrix.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1442,7 +1679,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename DisableIf< UseBlasKernel<MT3,MT4,MT5> >::Type
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeAssignKernel( C, A, B );
+      if( !dispatchedGemm( C, A, B, 1, 0 ) )
+         selectLargeAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1574,7 +1812,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+   friend inline typename DisableIf< Or< CanExploitSymmetry<MT,MT1,MT2>
+                                       , UseTiledEvaluation<MT,MT1,MT2> > >::Type
       addAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -1601,6 +1840,42 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Tiled addition assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Tiled addition assignment of a dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the addition assignment of a dense matrix-dense matrix multiplication
+   // expression with an element-wise operand (as for instance \f$ (A+B)*C \f$). Instead of
+   // evaluating the operand into a full-size temporary, it is evaluated panel by panel into a
+   // cache-sized buffer that directly feeds the multiplication kernel. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case either of the two matrix operands can be evaluated panel-wise.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTiledEvaluation<MT,MT1,MT2> >::Type
+      addAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
+         return;
+      }
+
+      DMatDMatMultExpr::tiledAssign( ~lhs, rhs, PanelAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices (kernel selection)************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Selection of the kernel for an addition assignment of a dense matrix-dense matrix
@@ -2533,8 +2808,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a large
-   // dense matrix-dense matrix multiplication expression to a dense matrix.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemm() function) or,
+   // in case these are not applicable, to the default implementation of the addition assignment of
+   // a large dense matrix-dense matrix multiplication expression to a dense matrix.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2542,7 +2818,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename DisableIf< UseBlasKernel<MT3,MT4,MT5> >::Type
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeAddAssignKernel( C, A, B );
+      if( !dispatchedGemm( C, A, B, 1, 1 ) )
+         selectLargeAddAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2643,7 +2920,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+   friend inline typename DisableIf< Or< CanExploitSymmetry<MT,MT1,MT2>
+                                       , UseTiledEvaluation<MT,MT1,MT2> > >::Type
       subAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -2670,6 +2948,42 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Tiled subtraction assignment to dense matrices*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Tiled subtraction assignment of a dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a dense matrix-dense matrix multiplication
+   // expression with an element-wise operand (as for instance \f$ (A+B)*C \f$). Instead of
+   // evaluating the operand into a full-size temporary, it is evaluated panel by panel into a
+   // cache-sized buffer that directly feeds the multiplication kernel. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case either of the two matrix operands can be evaluated panel-wise.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTiledEvaluation<MT,MT1,MT2> >::Type
+      subAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
+         return;
+      }
+
+      DMatDMatMultExpr::tiledAssign( ~lhs, rhs, PanelSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to dense matrices (kernel selection)*********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Selection of the kernel for a subtraction assignment of a dense matrix-dense matrix
@@ -3602,8 +3916,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a large
-   // dense matrix-dense matrix multiplication expression to a dense matrix.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemm() function) or,
+   // in case these are not applicable, to the default implementation of the subtraction assignment
+   // of a large dense matrix-dense matrix multiplication expression to a dense matrix.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3611,7 +3926,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename DisableIf< UseBlasKernel<MT3,MT4,MT5> >::Type
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeSubAssignKernel( C, A, B );
+      if( !dispatchedGemm( C, A, B, -1, 1 ) )
+         selectLargeSubAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3753,6 +4069,46 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Tiled SMP assignment to dense matrices*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Tiled smp assignment of a dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the smp assignment of a dense matrix-dense matrix multiplication
+   // expression with an element-wise operand (as for instance \f$ (A+B)*C \f$). Instead of
+   // evaluating the operand into a full-size temporary, it is evaluated panel by panel into a
+   // cache-sized buffer that directly feeds the multiplication kernel. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case either of the two matrix operands can be evaluated panel-wise.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTiledEvaluation<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      DMatDMatMultExpr::tiledAssign( ~lhs, rhs, PanelSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense matrix-dense matrix multiplication to a sparse matrix
@@ -3874,6 +4230,42 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Tiled SMP addition assignment to dense matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Tiled smp addition assignment of a dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the smp addition assignment of a dense matrix-dense matrix multiplication
+   // expression with an element-wise operand (as for instance \f$ (A+B)*C \f$). Instead of
+   // evaluating the operand into a full-size temporary, it is evaluated panel by panel into a
+   // cache-sized buffer that directly feeds the multiplication kernel. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case either of the two matrix operands can be evaluated panel-wise.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTiledEvaluation<MT,MT1,MT2> >::Type
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
+         return;
+      }
+
+      DMatDMatMultExpr::tiledAssign( ~lhs, rhs, PanelSMPAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP addition assignment to column-major matrices******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP addition assignment of a dense matrix-dense matrix multiplication
@@ -3959,6 +4351,42 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Tiled SMP subtraction assignment to dense matrices*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Tiled smp subtraction assignment of a dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the smp subtraction assignment of a dense matrix-dense matrix multiplication
+   // expression with an element-wise operand (as for instance \f$ (A+B)*C \f$). Instead of
+   // evaluating the operand into a full-size temporary, it is evaluated panel by panel into a
+   // cache-sized buffer that directly feeds the multiplication kernel. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case either of the two matrix operands can be evaluated panel-wise.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTiledEvaluation<MT,MT1,MT2> >::Type
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
+         return;
+      }
+
+      DMatDMatMultExpr::tiledAssign( ~lhs, rhs, PanelSMPSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment to column-major matrices***************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP subtraction assignment of a dense matrix-dense matrix multiplication
@@ -5289,8 +5717,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a large scaled
-   // dense matrix-dense matrix multiplication expression to a dense matrix.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemm() function) or,
+   // in case these are not applicable, to the default implementation of the assignment of a large
+   // scaled dense matrix-dense matrix multiplication expression to a dense matrix.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5299,7 +5728,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename DisableIf< UseBlasKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeAssignKernel( C, A, B, scalar );
+      if( !dispatchedGemm( C, A, B, scalar, ST2(0) ) )
+         selectLargeAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -6317,8 +6747,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a large
-   // scaled dense matrix-dense matrix multiplication expression to a dense matrix.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemm() function) or,
+   // in case these are not applicable, to the default implementation of the addition assignment of
+   // a large scaled dense matrix-dense matrix multiplication expression to a dense matrix.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -6327,7 +6758,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename DisableIf< UseBlasKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeAddAssignKernel( C, A, B, scalar );
+      if( !dispatchedGemm( C, A, B, scalar, ST2(1) ) )
+         selectLargeAddAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
@@ -7314,8 +7746,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a large
-   // scaled dense matrix-dense matrix multiplication expression to a dense matrix.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemm() function) or,
+   // in case these are not applicable, to the default implementation of the subtraction assignment
+   // of a large scaled dense matrix-dense matrix multiplication expression to a dense matrix.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -7324,7 +7757,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename DisableIf< UseBlasKernel<MT3,MT4,MT5,ST2> >::Type
       selectBlasSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectLargeSubAssignKernel( C, A, B, scalar );
+      if( !dispatchedGemm( C, A, B, -scalar, ST2(1) ) )
+         selectLargeSubAssignKernel( C, A, B, scalar );
    }
    //**********************************************************************************************
 
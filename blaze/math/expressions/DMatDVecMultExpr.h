@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -64,13 +65,16 @@
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsBlasCompatible.h>
+#include <blaze/math/typetraits/IsColumn.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsRow.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsSubvector.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -195,6 +199,30 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the matrix and vector operands store their elements in a different type than the
+       target vector (as for instance float16 matrices multiplied with float vectors or float
+       operands accumulated into a double vector) and the operands can be converted on the fly
+       by intrinsic loads, the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseConvertingKernel {
+      enum { value = useOptimizedKernels &&
+                     HasConstDataAccess<T2>::value &&
+                     HasConstDataAccess<T3>::value &&
+                     !IsDiagonal<T2>::value &&
+                     !IsSubvector<T3>::value && !IsRow<T3>::value && !IsColumn<T3>::value &&
+                     !( IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                        IsSame<typename T1::ElementType,typename T3::ElementType>::value ) &&
+                     IntrinsicConversion<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IntrinsicConversion<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDVecMultExpr<MT,VT>                     This;           //!< Type of this DMatDVecMultExpr instance.
@@ -453,13 +481,114 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< UseConvertingKernel<VT1,MT1,VT2> >::Type
+      selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       y.assign( A * x );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Converting default assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Converting default assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the default assignment kernel for dense matrix-dense vector
+   // multiplications with mixed element types. The elements of both operands are converted to
+   // the element type of the target vector by intrinsic loads, i.e. the computation and the
+   // accumulation are performed in the element type of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseConvertingKernel<VT1,MT1,VT2> >::Type
+      selectDefaultAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename VT1::ElementType  AT;
+      typedef typename MT1::ElementType  AET;
+      typedef typename VT2::ElementType  XET;
+      typedef IntrinsicTrait<AT>         IT;
+      typedef typename IT::Type          AIT;
+      typedef IntrinsicConversion<AT,AET>  AConversion;
+      typedef IntrinsicConversion<AT,XET>  XConversion;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+
+      const size_t jpos( N & size_t(-IT::size) );
+      BLAZE_INTERNAL_ASSERT( ( N - ( N % (IT::size) ) ) == jpos, "Invalid end calculation" );
+
+      const XET* xp( x.data() );
+
+      size_t i( 0UL );
+
+      for( ; (i+4UL) <= M; i+=4UL )
+      {
+         const AET* a1( A.data(i    ) );
+         const AET* a2( A.data(i+1UL) );
+         const AET* a3( A.data(i+2UL) );
+         const AET* a4( A.data(i+3UL) );
+
+         AIT xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            const AIT x1( XConversion::load( xp+j ) );
+            xmm1 = xmm1 + AConversion::load( a1+j ) * x1;
+            xmm2 = xmm2 + AConversion::load( a2+j ) * x1;
+            xmm3 = xmm3 + AConversion::load( a3+j ) * x1;
+            xmm4 = xmm4 + AConversion::load( a4+j ) * x1;
+         }
+
+         AT value1( sum( xmm1 ) );
+         AT value2( sum( xmm2 ) );
+         AT value3( sum( xmm3 ) );
+         AT value4( sum( xmm4 ) );
+
+         for( ; j<N; ++j ) {
+            const AT x1( xp[j] );
+            value1 += AT( a1[j] ) * x1;
+            value2 += AT( a2[j] ) * x1;
+            value3 += AT( a3[j] ) * x1;
+            value4 += AT( a4[j] ) * x1;
+         }
+
+         y[i    ] = value1;
+         y[i+1UL] = value2;
+         y[i+2UL] = value3;
+         y[i+3UL] = value4;
+      }
+
+      for( ; i<M; ++i )
+      {
+         const AET* a1( A.data(i) );
+
+         AIT xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            xmm1 = xmm1 + AConversion::load( a1+j ) * XConversion::load( xp+j );
+         }
+
+         AT value( sum( xmm1 ) );
+
+         for( ; j<N; ++j ) {
+            value += AT( a1[j] ) * AT( xp[j] );
+         }
+
+         y[i] = value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors (small matrices)****************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a small dense matrix-dense vector multiplication
@@ -981,8 +1110,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    // \param x The right-hand side dense vector operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a large dense
-   // matrix-dense vector multiplication expression to a dense vector.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemv() function) or,
+   // in case these are not applicable, to the default implementation of the assignment of a large
+   // dense matrix-dense vector multiplication expression to a dense vector.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -990,7 +1120,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline typename DisableIf< UseBlasKernel<VT1,MT1,VT2> >::Type
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAssignKernel( y, A, x );
+      if( !dispatchedGemv( y, A, x, 1, 0 ) )
+         selectLargeAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1140,13 +1271,114 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< UseConvertingKernel<VT1,MT1,VT2> >::Type
+      selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       y.addAssign( A * x );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Converting default addition assignment to dense vectors*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Converting default addition assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the default addition assignment kernel for dense matrix-dense vector
+   // multiplications with mixed element types. The elements of both operands are converted to
+   // the element type of the target vector by intrinsic loads, i.e. the computation and the
+   // accumulation are performed in the element type of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseConvertingKernel<VT1,MT1,VT2> >::Type
+      selectDefaultAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename VT1::ElementType  AT;
+      typedef typename MT1::ElementType  AET;
+      typedef typename VT2::ElementType  XET;
+      typedef IntrinsicTrait<AT>         IT;
+      typedef typename IT::Type          AIT;
+      typedef IntrinsicConversion<AT,AET>  AConversion;
+      typedef IntrinsicConversion<AT,XET>  XConversion;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+
+      const size_t jpos( N & size_t(-IT::size) );
+      BLAZE_INTERNAL_ASSERT( ( N - ( N % (IT::size) ) ) == jpos, "Invalid end calculation" );
+
+      const XET* xp( x.data() );
+
+      size_t i( 0UL );
+
+      for( ; (i+4UL) <= M; i+=4UL )
+      {
+         const AET* a1( A.data(i    ) );
+         const AET* a2( A.data(i+1UL) );
+         const AET* a3( A.data(i+2UL) );
+         const AET* a4( A.data(i+3UL) );
+
+         AIT xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            const AIT x1( XConversion::load( xp+j ) );
+            xmm1 = xmm1 + AConversion::load( a1+j ) * x1;
+            xmm2 = xmm2 + AConversion::load( a2+j ) * x1;
+            xmm3 = xmm3 + AConversion::load( a3+j ) * x1;
+            xmm4 = xmm4 + AConversion::load( a4+j ) * x1;
+         }
+
+         AT value1( sum( xmm1 ) );
+         AT value2( sum( xmm2 ) );
+         AT value3( sum( xmm3 ) );
+         AT value4( sum( xmm4 ) );
+
+         for( ; j<N; ++j ) {
+            const AT x1( xp[j] );
+            value1 += AT( a1[j] ) * x1;
+            value2 += AT( a2[j] ) * x1;
+            value3 += AT( a3[j] ) * x1;
+            value4 += AT( a4[j] ) * x1;
+         }
+
+         y[i    ] += value1;
+         y[i+1UL] += value2;
+         y[i+2UL] += value3;
+         y[i+3UL] += value4;
+      }
+
+      for( ; i<M; ++i )
+      {
+         const AET* a1( A.data(i) );
+
+         AIT xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            xmm1 = xmm1 + AConversion::load( a1+j ) * XConversion::load( xp+j );
+         }
+
+         AT value( sum( xmm1 ) );
+
+         for( ; j<N; ++j ) {
+            value += AT( a1[j] ) * AT( xp[j] );
+         }
+
+         y[i] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors (small matrices)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a small dense matrix-dense vector multiplication
@@ -1666,8 +1898,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    // \param x The right-hand side dense vector operand.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a large
-   // dense matrix-dense vector multiplication expression to a dense vector.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemv() function) or,
+   // in case these are not applicable, to the default implementation of the addition assignment of
+   // a large dense matrix-dense vector multiplication expression to a dense vector.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -1675,7 +1908,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline typename DisableIf< UseBlasKernel<VT1,MT1,VT2> >::Type
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeAddAssignKernel( y, A, x );
+      if( !dispatchedGemv( y, A, x, 1, 1 ) )
+         selectLargeAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1800,13 +2034,114 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< UseConvertingKernel<VT1,MT1,VT2> >::Type
+      selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       y.subAssign( A * x );
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Converting default subtraction assignment to dense vectors**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Converting default subtraction assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the default subtraction assignment kernel for dense matrix-dense vector
+   // multiplications with mixed element types. The elements of both operands are converted to
+   // the element type of the target vector by intrinsic loads, i.e. the computation and the
+   // accumulation are performed in the element type of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseConvertingKernel<VT1,MT1,VT2> >::Type
+      selectDefaultSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename VT1::ElementType  AT;
+      typedef typename MT1::ElementType  AET;
+      typedef typename VT2::ElementType  XET;
+      typedef IntrinsicTrait<AT>         IT;
+      typedef typename IT::Type          AIT;
+      typedef IntrinsicConversion<AT,AET>  AConversion;
+      typedef IntrinsicConversion<AT,XET>  XConversion;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+
+      const size_t jpos( N & size_t(-IT::size) );
+      BLAZE_INTERNAL_ASSERT( ( N - ( N % (IT::size) ) ) == jpos, "Invalid end calculation" );
+
+      const XET* xp( x.data() );
+
+      size_t i( 0UL );
+
+      for( ; (i+4UL) <= M; i+=4UL )
+      {
+         const AET* a1( A.data(i    ) );
+         const AET* a2( A.data(i+1UL) );
+         const AET* a3( A.data(i+2UL) );
+         const AET* a4( A.data(i+3UL) );
+
+         AIT xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            const AIT x1( XConversion::load( xp+j ) );
+            xmm1 = xmm1 + AConversion::load( a1+j ) * x1;
+            xmm2 = xmm2 + AConversion::load( a2+j ) * x1;
+            xmm3 = xmm3 + AConversion::load( a3+j ) * x1;
+            xmm4 = xmm4 + AConversion::load( a4+j ) * x1;
+         }
+
+         AT value1( sum( xmm1 ) );
+         AT value2( sum( xmm2 ) );
+         AT value3( sum( xmm3 ) );
+         AT value4( sum( xmm4 ) );
+
+         for( ; j<N; ++j ) {
+            const AT x1( xp[j] );
+            value1 += AT( a1[j] ) * x1;
+            value2 += AT( a2[j] ) * x1;
+            value3 += AT( a3[j] ) * x1;
+            value4 += AT( a4[j] ) * x1;
+         }
+
+         y[i    ] -= value1;
+         y[i+1UL] -= value2;
+         y[i+2UL] -= value3;
+         y[i+3UL] -= value4;
+      }
+
+      for( ; i<M; ++i )
+      {
+         const AET* a1( A.data(i) );
+
+         AIT xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            xmm1 = xmm1 + AConversion::load( a1+j ) * XConversion::load( xp+j );
+         }
+
+         AT value( sum( xmm1 ) );
+
+         for( ; j<N; ++j ) {
+            value += AT( a1[j] ) * AT( xp[j] );
+         }
+
+         y[i] -= value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors (small matrices)****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a small dense matrix-dense vector multiplication
@@ -2326,8 +2661,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    // \param x The right-hand side dense vector operand.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a large
-   // dense matrix-dense vector multiplication expression to a dense vector.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemv() function) or,
+   // in case these are not applicable, to the default implementation of the subtraction assignment
+   // of a large dense matrix-dense vector multiplication expression to a dense vector.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -2335,7 +2671,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    static inline typename DisableIf< UseBlasKernel<VT1,MT1,VT2> >::Type
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      selectLargeSubAssignKernel( y, A, x );
+      if( !dispatchedGemv( y, A, x, -1, 1 ) )
+         selectLargeSubAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3504,8 +3841,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a large scaled
-   // dense matrix-dense vector multiplication expression to a dense vector.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemv() function) or,
+   // in case these are not applicable, to the default implementation of the assignment of a large
+   // scaled dense matrix-dense vector multiplication expression to a dense vector.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -3514,7 +3852,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename DisableIf< UseBlasKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAssignKernel( y, A, x, scalar );
+      if( !dispatchedGemv( y, A, x, scalar, ST2(0) ) )
+         selectLargeAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -4188,8 +4527,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a large
-   // scaled dense matrix-dense vector multiplication expression to a dense vector.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemv() function) or,
+   // in case these are not applicable, to the default implementation of the addition assignment of
+   // a large scaled dense matrix-dense vector multiplication expression to a dense vector.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -4198,7 +4538,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename DisableIf< UseBlasKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeAddAssignKernel( y, A, x, scalar );
+      if( !dispatchedGemv( y, A, x, scalar, ST2(1) ) )
+         selectLargeAddAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -4849,8 +5190,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a large
-   // scaled dense matrix-dense vector multiplication expression to a dense vector.
+   // This function relays to the runtime dispatched kernels (see the dispatchedGemv() function) or,
+   // in case these are not applicable, to the default implementation of the subtraction assignment
+   // of a large scaled dense matrix-dense vector multiplication expression to a dense vector.
    */
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
@@ -4859,7 +5201,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline typename DisableIf< UseBlasKernel<VT1,MT1,VT2,ST2> >::Type
       selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      selectLargeSubAssignKernel( y, A, x, scalar );
+      if( !dispatchedGemv( y, A, x, -scalar, ST2(1) ) )
+         selectLargeSubAssignKernel( y, A, x, scalar );
    }
    //**********************************************************************************************
 
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/SparseMatrix.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -227,6 +228,9 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
          // Calculating element 'index' for numeric data types
          if( IsNumeric<ElementType>::value )
          {
+            if( dispatchedSparseDot( element, end, vec_, tmp ) )
+               return tmp;
+
             const size_t ipos( A.nonZeros(index) & size_t(-2) );
             ElementType tmp2 = ElementType();
 
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/dispatch/Kernels.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -211,6 +212,11 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
 
+   MultType sp;
+
+   if( dispatchedDot( left, right, sp ) )
+      return sp;
+
    typename IT::Type xmm1, xmm2, xmm3, xmm4;
 
    const size_t N   ( left.size() );
@@ -224,7 +230,7 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
       xmm4 = xmm4 + ( left.load(i+IT::size*3UL) * right.load(i+IT::size*3UL) );
    }
 
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+   sp = sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
    for( size_t i=iend; i<N; ++i )
       sp += left[i] * right[i];
@@ -0,0 +1,221 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Conversion.h
+//  \brief Header file for the intrinsic converting load functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_CONVERSION_H_
+#define _BLAZE_MATH_INTRINSICS_CONVERSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/Float16.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS INTRINSICCONVERSION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Intrinsic converting load of stored values into an arithmetic type.
+// \ingroup intrinsics
+//
+// The IntrinsicConversion class template loads a vector of values of storage type \a T2 and
+// converts them into an intrinsic vector of the arithmetic type \a T1. It enables kernels that
+// keep their operands in a compact storage format (as for instance float16 or bfloat16) or
+// accumulate in a wider type (as for instance \c double accumulators for \c float operands)
+// to convert the operands on the fly. In case the conversion is available for the current
+// instruction set, the nested \a value is set to 1 and the static \a load() function loads
+// IntrinsicTrait<T1>::size values of type \a T2 from the given (potentially unaligned)
+// address. Otherwise \a value is set to 0 and no \a load() function is available.
+*/
+template< typename T1    // Arithmetic type of the resulting intrinsic vector
+        , typename T2 >  // Storage type of the loaded values
+struct IntrinsicConversion
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   enum { value = 0 };
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversion class template for 'float' values.
+// \ingroup intrinsics
+*/
+template<>
+struct IntrinsicConversion<float,float>
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 1 };
+
+   static BLAZE_ALWAYS_INLINE simd_float_t load( const float* address )
+   {
+      return loadu( address );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversion class template for 'double' values.
+// \ingroup intrinsics
+*/
+template<>
+struct IntrinsicConversion<double,double>
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 1 };
+
+   static BLAZE_ALWAYS_INLINE simd_double_t load( const double* address )
+   {
+      return loadu( address );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversion class template for 'float16' values.
+// \ingroup intrinsics
+*/
+#if BLAZE_F16C_MODE && !BLAZE_MIC_MODE
+template<>
+struct IntrinsicConversion<float,float16>
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 1 };
+
+   static BLAZE_ALWAYS_INLINE simd_float_t load( const float16* address )
+   {
+      return _mm256_cvtph_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) ) );
+   }
+   //**********************************************************************************************
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversion class template for 'bfloat16' values.
+// \ingroup intrinsics
+*/
+#if ( BLAZE_AVX_MODE || BLAZE_SSE2_MODE ) && !BLAZE_MIC_MODE
+template<>
+struct IntrinsicConversion<float,bfloat16>
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 1 };
+
+   static BLAZE_ALWAYS_INLINE simd_float_t load( const bfloat16* address )
+   {
+#if BLAZE_AVX2_MODE
+      const __m128i v( _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) ) );
+      return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( v ), 16 ) );
+#elif BLAZE_AVX_MODE
+      const __m128i v( _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) ) );
+      const __m128i lo( _mm_unpacklo_epi16( _mm_setzero_si128(), v ) );
+      const __m128i hi( _mm_unpackhi_epi16( _mm_setzero_si128(), v ) );
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( lo ) ),
+                                   _mm_castsi128_ps( hi ), 1 );
+#else
+      const __m128i v( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( address ) ) );
+      return _mm_castsi128_ps( _mm_unpacklo_epi16( _mm_setzero_si128(), v ) );
+#endif
+   }
+   //**********************************************************************************************
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversion class template for the conversion of 'float'
+//        values to 'double' values.
+// \ingroup intrinsics
+*/
+#if ( BLAZE_AVX_MODE || BLAZE_SSE2_MODE ) && !BLAZE_MIC_MODE
+template<>
+struct IntrinsicConversion<double,float>
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 1 };
+
+   static BLAZE_ALWAYS_INLINE simd_double_t load( const float* address )
+   {
+#if BLAZE_AVX_MODE
+      return _mm256_cvtps_pd( _mm_loadu_ps( address ) );
+#else
+      const __m128i v( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( address ) ) );
+      return _mm_cvtps_pd( _mm_castsi128_ps( v ) );
+#endif
+   }
+   //**********************************************************************************************
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -43,6 +43,7 @@
 #include <blaze/math/intrinsics/Abs.h>
 #include <blaze/math/intrinsics/Addition.h>
 #include <blaze/math/intrinsics/Conj.h>
+#include <blaze/math/intrinsics/Conversion.h>
 #include <blaze/math/intrinsics/Division.h>
 #include <blaze/math/intrinsics/Loada.h>
 #include <blaze/math/intrinsics/Loadu.h>
@@ -54,5 +55,6 @@
 #include <blaze/math/intrinsics/Storeu.h>
 #include <blaze/math/intrinsics/Stream.h>
 #include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/math/intrinsics/Transpose.h>
 
 #endif
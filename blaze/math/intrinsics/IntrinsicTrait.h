@@ -87,7 +87,8 @@ struct IntrinsicTraitHelper<false,1UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 1,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -100,7 +101,8 @@ struct IntrinsicTraitHelper<false,1UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = BLAZE_SSSE3_MODE,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -123,7 +125,8 @@ struct IntrinsicTraitHelper<false,2UL>
           multiplication = 1,
           division       = 0,
           absoluteValue  = 1,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -136,7 +139,8 @@ struct IntrinsicTraitHelper<false,2UL>
           multiplication = BLAZE_SSE2_MODE,
           division       = 0,
           absoluteValue  = BLAZE_SSSE3_MODE,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -159,7 +163,8 @@ struct IntrinsicTraitHelper<false,4UL>
           multiplication = 1,
           division       = 1,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -172,7 +177,8 @@ struct IntrinsicTraitHelper<false,4UL>
           multiplication = 1,
           division       = 0,
           absoluteValue  = 1,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -185,7 +191,8 @@ struct IntrinsicTraitHelper<false,4UL>
           multiplication = BLAZE_SSE4_MODE,
           division       = 0,
           absoluteValue  = BLAZE_SSSE3_MODE,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -208,7 +215,8 @@ struct IntrinsicTraitHelper<false,8UL>
           multiplication = 1,
           division       = 1,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -221,7 +229,8 @@ struct IntrinsicTraitHelper<false,8UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -234,7 +243,8 @@ struct IntrinsicTraitHelper<false,8UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -257,7 +267,8 @@ struct IntrinsicTraitHelper<true,1UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 0 };
+          conjugate      = 0,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -270,7 +281,8 @@ struct IntrinsicTraitHelper<true,1UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 0 };
+          conjugate      = 0,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -293,7 +305,8 @@ struct IntrinsicTraitHelper<true,2UL>
           multiplication = 1,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -306,7 +319,8 @@ struct IntrinsicTraitHelper<true,2UL>
           multiplication = BLAZE_SSE2_MODE,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = BLAZE_SSE2_MODE };
+          conjugate      = BLAZE_SSE2_MODE,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -329,7 +343,8 @@ struct IntrinsicTraitHelper<true,4UL>
           multiplication = 1,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -342,7 +357,8 @@ struct IntrinsicTraitHelper<true,4UL>
           multiplication = 1,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -355,7 +371,8 @@ struct IntrinsicTraitHelper<true,4UL>
           multiplication = BLAZE_SSE4_MODE,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = BLAZE_SSE4_MODE };
+          conjugate      = BLAZE_SSE4_MODE,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -378,7 +395,8 @@ struct IntrinsicTraitHelper<true,8UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 0 };
+          conjugate      = 0,
+          transposition  = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -391,7 +409,8 @@ struct IntrinsicTraitHelper<true,8UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 0 };
+          conjugate      = 0,
+          transposition  = 0 };
 };
 #else
 template<>
@@ -404,7 +423,8 @@ struct IntrinsicTraitHelper<true,8UL>
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 0 };
+          conjugate      = 0,
+          transposition  = 0 };
 };
 #endif
 /*! \endcond */
@@ -435,7 +455,8 @@ struct IntrinsicTraitBase
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 0 };
+          conjugate      = 0,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -461,7 +482,8 @@ struct IntrinsicTraitBase<char>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -487,7 +509,8 @@ struct IntrinsicTraitBase<signed char>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -513,7 +536,8 @@ struct IntrinsicTraitBase<unsigned char>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -539,7 +563,8 @@ struct IntrinsicTraitBase<wchar_t>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -565,7 +590,8 @@ struct IntrinsicTraitBase<short>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -591,7 +617,8 @@ struct IntrinsicTraitBase<unsigned short>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -617,7 +644,8 @@ struct IntrinsicTraitBase<int>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -643,7 +671,8 @@ struct IntrinsicTraitBase<unsigned int>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -669,7 +698,8 @@ struct IntrinsicTraitBase<long>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -695,7 +725,8 @@ struct IntrinsicTraitBase<unsigned long>
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -717,7 +748,8 @@ struct IntrinsicTraitBase<float>
           multiplication = 1,
           division       = 1,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -731,7 +763,8 @@ struct IntrinsicTraitBase<float>
           multiplication = 1,
           division       = 1,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 1 };
 };
 #else
 template<>
@@ -745,7 +778,8 @@ struct IntrinsicTraitBase<float>
           multiplication = BLAZE_SSE_MODE,
           division       = BLAZE_SSE_MODE,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = BLAZE_SSE_MODE };
 };
 #endif
 /*! \endcond */
@@ -769,7 +803,8 @@ struct IntrinsicTraitBase<double>
           multiplication = 1,
           division       = 1,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -783,7 +818,8 @@ struct IntrinsicTraitBase<double>
           multiplication = 1,
           division       = 1,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 1 };
 };
 #else
 template<>
@@ -797,7 +833,8 @@ struct IntrinsicTraitBase<double>
           multiplication = BLAZE_SSE2_MODE,
           division       = BLAZE_SSE2_MODE,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = BLAZE_SSE2_MODE };
 };
 #endif
 /*! \endcond */
@@ -824,7 +861,8 @@ struct IntrinsicTraitBase< complex<char> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<char> ) == 2UL*sizeof( char ) );
 };
@@ -852,7 +890,8 @@ struct IntrinsicTraitBase< complex<signed char> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<signed char> ) == 2UL*sizeof( signed char ) );
 };
@@ -880,7 +919,8 @@ struct IntrinsicTraitBase< complex<unsigned char> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<unsigned char> ) == 2UL*sizeof( unsigned char ) );
 };
@@ -908,7 +948,8 @@ struct IntrinsicTraitBase< complex<wchar_t> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<wchar_t> ) == 2UL*sizeof( wchar_t ) );
 };
@@ -936,7 +977,8 @@ struct IntrinsicTraitBase< complex<short> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<short> ) == 2UL*sizeof( short ) );
 };
@@ -964,7 +1006,8 @@ struct IntrinsicTraitBase< complex<unsigned short> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<unsigned short> ) == 2UL*sizeof( unsigned short ) );
 };
@@ -992,7 +1035,8 @@ struct IntrinsicTraitBase< complex<int> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<int> ) == 2UL*sizeof( int ) );
 };
@@ -1020,7 +1064,8 @@ struct IntrinsicTraitBase< complex<unsigned int> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<unsigned int> ) == 2UL*sizeof( unsigned int ) );
 };
@@ -1048,7 +1093,8 @@ struct IntrinsicTraitBase< complex<long> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = Helper::absoluteValue,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<long> ) == 2UL*sizeof( long ) );
 };
@@ -1076,7 +1122,8 @@ struct IntrinsicTraitBase< complex<unsigned long> >
           multiplication = Helper::multiplication,
           division       = Helper::division,
           absoluteValue  = 0,
-          conjugate      = Helper::conjugate };
+          conjugate      = Helper::conjugate,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<unsigned long> ) == 2UL*sizeof( unsigned long ) );
 };
@@ -1101,7 +1148,8 @@ struct IntrinsicTraitBase< complex<float> >
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -1117,7 +1165,8 @@ struct IntrinsicTraitBase< complex<float> >
           multiplication = 1,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -1133,7 +1182,8 @@ struct IntrinsicTraitBase< complex<float> >
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = BLAZE_SSE_MODE };
+          conjugate      = BLAZE_SSE_MODE,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -1159,7 +1209,8 @@ struct IntrinsicTraitBase< complex<double> >
           multiplication = 0,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -1175,7 +1226,8 @@ struct IntrinsicTraitBase< complex<double> >
           multiplication = 1,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = 1 };
+          conjugate      = 1,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -1191,7 +1243,8 @@ struct IntrinsicTraitBase< complex<double> >
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
           absoluteValue  = 0,
-          conjugate      = BLAZE_SSE2_MODE };
+          conjugate      = BLAZE_SSE2_MODE,
+          transposition  = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -1227,6 +1280,9 @@ struct IntrinsicTraitBase< complex<double> >
 //    Else it is set to 0.
 //  - If the data type supports vectorized multiplications, the \a multiplication value is set to
 //    1. If it cannot be used in multiplications, it is set to 0.
+//  - In case a square tile of \a size x \a size values can be transposed within the intrinsic
+//    registers (see the \c transpose() intrinsic function), the \a transposition value is set
+//    to 1. Otherwise it is set to 0.
 */
 template< typename T >
 class IntrinsicTrait : public IntrinsicTraitBase< typename RemoveCV<T>::Type >
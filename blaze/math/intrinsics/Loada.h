@@ -61,6 +61,34 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Loads a vector of 1-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \return The loaded vector of integral values.
+//
+// This function loads a vector of 1-byte integral values. The given address must be aligned
+// according to the enabled instruction set (16-byte alignment in case of SSE, 31-byte alignment
+// in case of AVX, and 64-byte alignment in case of MIC.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> >, simd_int8_t >::Type
+   loada( const T* address )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Loads a vector of 2-byte integral values.
 // \ingroup intrinsics
@@ -205,6 +233,35 @@ BLAZE_ALWAYS_INLINE simd_double_t loada( const double* address )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Loads a vector of 1-byte integral complex values.
+// \ingroup intrinsics
+//
+// \param address The first integral complex value to be loaded.
+// \return The loaded vector of integral complex values.
+//
+// This function loads a vector of 1-byte integral complex values. The given address must be
+// aligned according to the enabled instruction set (16-byte alignment in case of SSE, 31-byte
+// alignment in case of AVX, and 64-byte alignment in case of MIC.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> >, simd_cint8_t >::Type
+   loada( const complex<T>* address )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Loads a vector of 2-byte integral complex values.
 // \ingroup intrinsics
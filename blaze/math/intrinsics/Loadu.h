@@ -59,6 +59,31 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Loads a vector of 1-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \return The loaded vector of integral values.
+//
+// This function loads a vector of 1-byte integral values. In contrast to the according load
+// function, the given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> >, simd_int8_t >::Type
+   loadu( const T* address )
+{
+#if BLAZE_AVX2_MODE
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Loads a vector of 2-byte integral values.
 // \ingroup intrinsics
@@ -200,6 +225,33 @@ BLAZE_ALWAYS_INLINE simd_double_t loadu( const double* address )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Loads a vector of 1-byte integral complex values.
+// \ingroup intrinsics
+//
+// \param address The first integral complex value to be loaded.
+// \return The loaded vector of integral complex values.
+//
+// This function loads a vector of 1-byte integral complex values. In contrast to the according
+// load function, the given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> >, simd_cint8_t >::Type
+   loadu( const complex<T>* address )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+
+#if BLAZE_AVX2_MODE
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Loads a vector of 2-byte integral complex values.
 // \ingroup intrinsics
@@ -353,6 +353,78 @@ BLAZE_ALWAYS_INLINE simd_cdouble_t operator*( const simd_cdouble_t& a, const sim
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC MULTIPLY-ADD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn simd_int32_t madd( simd_int8_t, simd_int8_t )
+// \brief Multiplication of two vectors of signed 8-bit integral values with horizontal addition.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The 32-bit sums of four adjacent products.
+//
+// This function multiplies the signed 8-bit values of the two given vectors and adds each group
+// of four adjacent products into a 32-bit integral value. The computation is exact, i.e. the
+// products are neither truncated nor saturated.
+*/
+#if BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE simd_int32_t madd( const simd_int8_t& a, const simd_int8_t& b )
+{
+   const __m256i aeven( _mm256_srai_epi16( _mm256_slli_epi16( a.value, 8 ), 8 ) );
+   const __m256i beven( _mm256_srai_epi16( _mm256_slli_epi16( b.value, 8 ), 8 ) );
+   const __m256i aodd ( _mm256_srai_epi16( a.value, 8 ) );
+   const __m256i bodd ( _mm256_srai_epi16( b.value, 8 ) );
+
+   return _mm256_add_epi32( _mm256_madd_epi16( aeven, beven ), _mm256_madd_epi16( aodd, bodd ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE simd_int32_t madd( const simd_int8_t& a, const simd_int8_t& b )
+{
+   const __m128i aeven( _mm_srai_epi16( _mm_slli_epi16( a.value, 8 ), 8 ) );
+   const __m128i beven( _mm_srai_epi16( _mm_slli_epi16( b.value, 8 ), 8 ) );
+   const __m128i aodd ( _mm_srai_epi16( a.value, 8 ) );
+   const __m128i bodd ( _mm_srai_epi16( b.value, 8 ) );
+
+   return _mm_add_epi32( _mm_madd_epi16( aeven, beven ), _mm_madd_epi16( aodd, bodd ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn simd_int32_t madd( simd_int16_t, simd_int16_t )
+// \brief Multiplication of two vectors of signed 16-bit integral values with horizontal addition.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The 32-bit sums of two adjacent products.
+//
+// This function multiplies the signed 16-bit values of the two given vectors and adds each pair
+// of adjacent products into a 32-bit integral value. Note that the sum only overflows in case
+// all four involved values are -32768.
+*/
+#if BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE simd_int32_t madd( const simd_int16_t& a, const simd_int16_t& b )
+{
+   return _mm256_madd_epi16( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE simd_int32_t madd( const simd_int16_t& a, const simd_int16_t& b )
+{
+   return _mm_madd_epi16( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -61,6 +61,35 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Aligned store of a vector of 1-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 1-byte integral vector to be stored.
+// \return void
+//
+// This function stores a vector of 1-byte integral values. The given address must be aligned
+// according to the enabled instruction set (16-byte alignment in case of SSE, 31-byte alignment
+// in case of AVX, and 64-byte alignment in case of MIC.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> > >::Type
+   storea( T* address, const simd_int8_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_store_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned store of a vector of 2-byte integral values.
 // \ingroup intrinsics
@@ -210,6 +239,36 @@ BLAZE_ALWAYS_INLINE void storea( double* address, const simd_double_t& value )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Aligned store of a vector of 1-byte integral complex values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 1-byte integral complex vector to be stored.
+// \return void
+//
+// This function stores a vector of 1-byte integral complex values. The given address must be
+// aligned according to the enabled instruction set (16-byte alignment in case of SSE, 31-byte
+// alignment in case of AVX, and 64-byte alignment in case of MIC.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> > >::Type
+   storea( complex<T>* address, const simd_cint8_t& value )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_store_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned store of a vector of 2-byte integral complex values.
 // \ingroup intrinsics
@@ -59,6 +59,32 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 1-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 1-byte integral vector to be stored.
+// \return void
+//
+// This function stores a vector of 1-byte integral values. In contrast to the according store
+// function, the given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> > >::Type
+   storeu( T* address, const simd_int8_t& value )
+{
+#if BLAZE_AVX2_MODE
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Unaligned store of a vector of 2-byte integral values.
 // \ingroup intrinsics
@@ -197,6 +223,34 @@ BLAZE_ALWAYS_INLINE void storeu( double* address, const simd_double_t& value )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 1-byte integral complex values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 1-byte integral complex vector to be stored.
+// \return void
+//
+// This function stores a vector of 1-byte integral complex values. In contrast to the according
+// store function, the given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> > >::Type
+   storeu( complex<T>* address, const simd_cint8_t& value )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+
+#if BLAZE_AVX2_MODE
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Unaligned store of a vector of 2-byte integral complex values.
 // \ingroup intrinsics
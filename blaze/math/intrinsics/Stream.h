@@ -61,6 +61,31 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a vector of 1-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 1-byte integral vector to be streamed.
+// \return void
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> > >::Type
+   stream( T* address, const simd_int8_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_stream_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned, non-temporal store of a vector of 2-byte integral values.
 // \ingroup intrinsics
@@ -190,6 +215,32 @@ BLAZE_ALWAYS_INLINE void stream( double* address, const simd_double_t& value )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a vector of 1-byte integral complex values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 1-byte integral complex vector to be streamed.
+// \return void
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,1UL> > >::Type
+   stream( complex<T>* address, const simd_cint8_t& value )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<T> ) == 2UL*sizeof( T ) );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_stream_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned, non-temporal store of a vector of 2-byte integral complex values.
 // \ingroup intrinsics
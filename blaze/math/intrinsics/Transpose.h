@@ -0,0 +1,144 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Transpose.h
+//  \brief Header file for the intrinsic register transposition functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_TRANSPOSE_H_
+#define _BLAZE_MATH_INTRINSICS_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC TRANSPOSE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-register transposition of a square tile of 32-bit single precision values.
+// \ingroup intrinsics
+//
+// \param r Pointer to the first of the intrinsic registers forming the tile.
+// \return void
+//
+// This function transposes the tile formed by the given intrinsic registers, i.e. after the
+// transposition the \a i-th value of the \a j-th register is the former \a j-th value of the
+// \a i-th register. The tile consists of 8 registers (AVX) or 4 registers (SSE).
+*/
+#if BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE void transpose( simd_float_t* r )
+{
+   const __m256 t0( _mm256_unpacklo_ps( r[0].value, r[1].value ) );
+   const __m256 t1( _mm256_unpackhi_ps( r[0].value, r[1].value ) );
+   const __m256 t2( _mm256_unpacklo_ps( r[2].value, r[3].value ) );
+   const __m256 t3( _mm256_unpackhi_ps( r[2].value, r[3].value ) );
+   const __m256 t4( _mm256_unpacklo_ps( r[4].value, r[5].value ) );
+   const __m256 t5( _mm256_unpackhi_ps( r[4].value, r[5].value ) );
+   const __m256 t6( _mm256_unpacklo_ps( r[6].value, r[7].value ) );
+   const __m256 t7( _mm256_unpackhi_ps( r[6].value, r[7].value ) );
+
+   const __m256 s0( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s1( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 s2( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s3( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 s4( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s5( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 s6( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s7( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+
+   r[0].value = _mm256_permute2f128_ps( s0, s4, 0x20 );
+   r[1].value = _mm256_permute2f128_ps( s1, s5, 0x20 );
+   r[2].value = _mm256_permute2f128_ps( s2, s6, 0x20 );
+   r[3].value = _mm256_permute2f128_ps( s3, s7, 0x20 );
+   r[4].value = _mm256_permute2f128_ps( s0, s4, 0x31 );
+   r[5].value = _mm256_permute2f128_ps( s1, s5, 0x31 );
+   r[6].value = _mm256_permute2f128_ps( s2, s6, 0x31 );
+   r[7].value = _mm256_permute2f128_ps( s3, s7, 0x31 );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE void transpose( simd_float_t* r )
+{
+   _MM_TRANSPOSE4_PS( r[0].value, r[1].value, r[2].value, r[3].value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-register transposition of a square tile of 64-bit double precision values.
+// \ingroup intrinsics
+//
+// \param r Pointer to the first of the intrinsic registers forming the tile.
+// \return void
+//
+// This function transposes the tile formed by the given intrinsic registers, i.e. after the
+// transposition the \a i-th value of the \a j-th register is the former \a j-th value of the
+// \a i-th register. The tile consists of 4 registers (AVX) or 2 registers (SSE2).
+*/
+#if BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE void transpose( simd_double_t* r )
+{
+   const __m256d t0( _mm256_unpacklo_pd( r[0].value, r[1].value ) );
+   const __m256d t1( _mm256_unpackhi_pd( r[0].value, r[1].value ) );
+   const __m256d t2( _mm256_unpacklo_pd( r[2].value, r[3].value ) );
+   const __m256d t3( _mm256_unpackhi_pd( r[2].value, r[3].value ) );
+
+   r[0].value = _mm256_permute2f128_pd( t0, t2, 0x20 );
+   r[1].value = _mm256_permute2f128_pd( t1, t3, 0x20 );
+   r[2].value = _mm256_permute2f128_pd( t0, t2, 0x31 );
+   r[3].value = _mm256_permute2f128_pd( t1, t3, 0x31 );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+BLAZE_ALWAYS_INLINE void transpose( simd_double_t* r )
+{
+   const __m128d t0( _mm_unpacklo_pd( r[0].value, r[1].value ) );
+   const __m128d t1( _mm_unpackhi_pd( r[0].value, r[1].value ) );
+
+   r[0].value = t0;
+   r[1].value = t1;
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
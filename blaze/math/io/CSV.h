@@ -0,0 +1,512 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/io/CSV.h
+//  \brief Header file for the CSV file reader
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_IO_CSV_H_
+#define _BLAZE_MATH_IO_CSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/io/TextParsing.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Triplet.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CSV PARSING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Skips all blanks, tabs, and carriage returns that do not act as delimiter.
+// \ingroup math
+//
+// \param pos The current position within the line.
+// \param end The end of the line.
+// \param delimiter The field delimiter.
+// \return Pointer to the first non-blank character, \a end if there is none.
+*/
+inline const char* skipCSVBlanks( const char* pos, const char* end, char delimiter )
+{
+   while( pos != end && *pos != delimiter && ( *pos == ' ' || *pos == '\t' || *pos == '\r' ) )
+      ++pos;
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing the next field of a CSV line.
+// \ingroup math
+//
+// \param pos Reference to the current position within the line.
+// \param end The end of the line.
+// \param delimiter The field delimiter.
+// \param last \a true in case the field is the last field of the line, \a false if not.
+// \param value Reference to the parsed value.
+// \return \a true in case the field was parsed, \a false if not.
+//
+// This function parses a single numeric field and consumes the following delimiter. The last
+// field of a line must not be followed by a delimiter.
+*/
+inline bool parseCSVField( const char*& pos, const char* end, char delimiter, bool last, double& value )
+{
+   pos = skipCSVBlanks( pos, end, delimiter );
+
+   if( !parseNumber( pos, end, value ) )
+      return false;
+
+   pos = skipCSVBlanks( pos, end, delimiter );
+
+   if( last )
+      return pos == end;
+
+   if( pos == end || *pos != delimiter )
+      return false;
+
+   ++pos;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the number of columns of a CSV file.
+// \ingroup math
+//
+// \param first The beginning of the file content.
+// \param last The end of the file content.
+// \param delimiter The field delimiter.
+// \return The number of fields in the first data line (0 in case of an empty file).
+*/
+inline size_t countCSVColumns( const char* first, const char* last, char delimiter )
+{
+   while( first != last )
+   {
+      const char* end( findLineEnd( first, last ) );
+
+      if( isDataLine( first, end, '\0' ) ) {
+         size_t columns( 1UL );
+         for( ; first!=end; ++first ) {
+            if( *first == delimiter ) ++columns;
+         }
+         return columns;
+      }
+
+      first = ( end != last )?( end+1 ):( end );
+   }
+
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS CSVPARSER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parser for the chunks of a CSV file.
+// \ingroup math
+//
+// The parser processes all data lines of a chunk and passes the parsed values to the given
+// target \a TT, which either writes the values into a dense matrix or collects all non-zero
+// values as triplets. The row index of the first line of a chunk is given by the number of
+// data lines in all preceding chunks.
+*/
+template< typename TT >  // Type of the target
+struct CSVParser
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the CSVParser class template.
+   //
+   // \param chunks The chunks of the file.
+   // \param columns The number of columns of the matrix.
+   // \param delimiter The field delimiter.
+   // \param target The target of the parsed values.
+   */
+   explicit inline CSVParser( std::vector<TextChunk>& chunks, size_t columns, char delimiter, TT& target )
+      : chunks_   ( chunks    )  // The chunks of the file
+      , columns_  ( columns   )  // The number of columns of the matrix
+      , delimiter_( delimiter )  // The field delimiter
+      , target_   ( target    )  // The target of the parsed values
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Parses the chunk with the given index.
+   //
+   // \param k The index of the chunk.
+   // \return void
+   */
+   void operator()( size_t k ) const
+   {
+      TextChunk& chunk( chunks_[k] );
+      size_t i( chunk.offset );
+
+      for( const char* pos=chunk.first; pos!=chunk.last; )
+      {
+         const char* end( findLineEnd( pos, chunk.last ) );
+
+         if( isDataLine( pos, end, '\0' ) )
+         {
+            for( size_t j=0UL; j<columns_; ++j )
+            {
+               double value;
+
+               if( !parseCSVField( pos, end, delimiter_, j+1UL == columns_, value ) ) {
+                  chunk.error = "Invalid CSV line";
+                  return;
+               }
+
+               target_.set( k, i, j, value );
+            }
+
+            ++i;
+         }
+
+         pos = ( end != chunk.last )?( end+1 ):( end );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<TextChunk>& chunks_;     //!< The chunks of the file.
+   size_t                  columns_;    //!< The number of columns of the matrix.
+   char                    delimiter_;  //!< The field delimiter.
+   TT&                     target_;     //!< The target of the parsed values.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Target of a CSVParser writing all values into a dense matrix.
+// \ingroup math
+*/
+template< typename Type  // Type of the matrix elements
+        , bool SO >      // Storage order
+struct CSVDenseTarget
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the CSVDenseTarget class template.
+   //
+   // \param dm The target dense matrix.
+   */
+   explicit inline CSVDenseTarget( DynamicMatrix<Type,SO>& dm )
+      : dm_( dm )  // The target dense matrix
+   {}
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   /*!\brief Setting the element \f$ (i,j) \f$ of the dense matrix.
+   //
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \param value The parsed value.
+   // \return void
+   */
+   inline void set( size_t /*chunk*/, size_t i, size_t j, double value ) {
+      dm_(i,j) = makeElement( value, 0.0, static_cast<Type*>( NULL ) );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   DynamicMatrix<Type,SO>& dm_;  //!< The target dense matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Target of a CSVParser collecting all non-zero values as triplets.
+// \ingroup math
+*/
+template< typename Type >  // Type of the matrix elements
+struct CSVSparseTarget
+{
+   //**Type definitions****************************************************************************
+   typedef std::vector< Triplet<Type> >  Triplets;  //!< Type of the triplets of a chunk.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the CSVSparseTarget class template.
+   //
+   // \param chunks The total number of chunks.
+   */
+   explicit inline CSVSparseTarget( size_t chunks )
+      : triplets_( chunks )  // The triplets of all chunks
+   {}
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   /*!\brief Collecting the element \f$ (i,j) \f$ in case it is non-zero.
+   //
+   // \param k The index of the current chunk.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \param value The parsed value.
+   // \return void
+   */
+   inline void set( size_t k, size_t i, size_t j, double value ) {
+      if( !isDefault( value ) )
+         triplets_[k].push_back( Triplet<Type>( i, j, makeElement( value, 0.0, static_cast<Type*>( NULL ) ) ) );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<Triplets> triplets_;  //!< The triplets of all chunks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CSV READER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CSV reader functions */
+//@{
+template< typename Type, bool SO >
+void readCSV( const std::string& filename, DynamicMatrix<Type,SO>& dm, char delimiter=',' );
+
+template< typename Type, bool SO >
+void readCSV( const std::string& filename, CompressedMatrix<Type,SO>& sm, char delimiter=',' );
+
+template< typename MT, bool SO >
+void readCSV( const std::string& filename, Matrix<MT,SO>& m, char delimiter=',' );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the CSV reader functions.
+// \ingroup math
+//
+// \param file The memory mapped CSV file.
+// \param delimiter The field delimiter.
+// \param chunks The chunks of the file.
+// \param rows Reference to the number of rows of the matrix.
+// \param columns Reference to the number of columns of the matrix.
+// \return void
+//
+// This function splits the given file into chunks and counts the data lines of all chunks.
+*/
+inline void prepareCSV( const MappedFile& file, char delimiter, std::vector<TextChunk>& chunks,
+                        size_t& rows, size_t& columns )
+{
+   const char* const first( file.data() );
+   const char* const last ( file.data() + file.size() );
+
+   columns = countCSVColumns( first, last, delimiter );
+   splitIntoChunks( first, last, chunks );
+
+   TextLineCounter counter( chunks, '\0' );
+   smpFor( chunks.size(), counter );
+
+   rows = computeLineOffsets( chunks );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a CSV file into a dynamic matrix.
+// \ingroup math
+//
+// \param filename The name of the CSV file.
+// \param dm The target dynamic matrix.
+// \param delimiter The field delimiter (default: \c ',').
+// \return void
+// \exception std::runtime_error Invalid CSV file.
+//
+// This function reads the numeric values of the given CSV file into the dynamic matrix \a dm,
+// which is resized accordingly. Each non-blank line of the file represents a row of the matrix
+// and all rows are required to contain the same number of fields:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::readCSV( "matrix.csv", A );       // Comma-separated values
+   blaze::readCSV( "matrix.tsv", A, '\t' );  // Tab-separated values
+   \endcode
+
+// The file is memory mapped and parsed concurrently in chunks of complete lines via the active
+// shared-memory parallelization. In case the file cannot be read or contains a non-numeric field
+// or a line with a deviating number of fields, a \a std::runtime_error exception is thrown.
+//
+// Note that the file readers are not part of <tt><blaze/Math.h></tt>, since the memory mapping
+// requires platform specific system headers. They are made available via
+// <tt><blaze/math/IO.h></tt>.
+*/
+template< typename Type  // Type of the matrix elements
+        , bool SO >      // Storage order
+void readCSV( const std::string& filename, DynamicMatrix<Type,SO>& dm, char delimiter )
+{
+   MappedFile file( filename );
+   std::vector<TextChunk> chunks;
+   size_t rows( 0UL ), columns( 0UL );
+
+   prepareCSV( file, delimiter, chunks, rows, columns );
+
+   dm.resize( rows, columns, false );
+
+   CSVDenseTarget<Type,SO> target( dm );
+   CSVParser< CSVDenseTarget<Type,SO> > parser( chunks, columns, delimiter, target );
+
+   smpFor( chunks.size(), parser );
+
+   if( const char* error = firstError( chunks ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( error );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a CSV file into a compressed matrix.
+// \ingroup math
+//
+// \param filename The name of the CSV file.
+// \param sm The target compressed matrix.
+// \param delimiter The field delimiter (default: \c ',').
+// \return void
+// \exception std::runtime_error Invalid CSV file.
+//
+// This function reads the numeric values of the given CSV file into the compressed matrix
+// \a sm, which is resized accordingly. All zero values are skipped and all non-zero values
+// are assembled via a single call to the setFromTriplets() function. In case the file cannot
+// be read or contains a non-numeric field or a line with a deviating number of fields, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Type of the matrix elements
+        , bool SO >      // Storage order
+void readCSV( const std::string& filename, CompressedMatrix<Type,SO>& sm, char delimiter )
+{
+   typedef typename CSVSparseTarget<Type>::Triplets  Triplets;
+
+   MappedFile file( filename );
+   std::vector<TextChunk> chunks;
+   size_t rows( 0UL ), columns( 0UL );
+
+   prepareCSV( file, delimiter, chunks, rows, columns );
+
+   CSVSparseTarget<Type> target( chunks.size() );
+   CSVParser< CSVSparseTarget<Type> > parser( chunks, columns, delimiter, target );
+
+   smpFor( chunks.size(), parser );
+
+   if( const char* error = firstError( chunks ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( error );
+   }
+
+   Triplets all;
+   for( size_t k=0UL; k<target.triplets_.size(); ++k ) {
+      all.insert( all.end(), target.triplets_[k].begin(), target.triplets_[k].end() );
+      Triplets().swap( target.triplets_[k] );
+   }
+
+   sm.resize( rows, columns, false );
+   sm.setFromTriplets( all.begin(), all.end() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a CSV file into an arbitrary matrix.
+// \ingroup math
+//
+// \param filename The name of the CSV file.
+// \param m The target matrix.
+// \param delimiter The field delimiter (default: \c ',').
+// \return void
+// \exception std::runtime_error Invalid CSV file.
+// \exception std::invalid_argument Invalid assignment to the target matrix.
+//
+// This function reads the numeric values of the given CSV file into a temporary dynamic matrix,
+// which is subsequently assigned to the matrix \a m. This enables reading into adapted matrices,
+// as for instance a SymmetricMatrix. In case the file cannot be read or contains a non-numeric
+// field or a line with a deviating number of fields, a \a std::runtime_error exception is thrown.
+// In case the matrix cannot be assigned to \a m (for instance due to a size mismatch or a
+// violated invariant of an adaptor), a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the target matrix
+        , bool SO >    // Storage order
+void readCSV( const std::string& filename, Matrix<MT,SO>& m, char delimiter )
+{
+   DynamicMatrix<typename MT::ElementType,SO> tmp;
+   readCSV( filename, tmp, delimiter );
+   ~m = tmp;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
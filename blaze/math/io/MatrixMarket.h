@@ -0,0 +1,787 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/io/MatrixMarket.h
+//  \brief Header file for the Matrix Market file reader
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_IO_MATRIXMARKET_H_
+#define _BLAZE_MATH_IO_MATRIXMARKET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cctype>
+#include <string>
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/io/TextParsing.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Triplet.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MATRIXMARKETHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The header information of a Matrix Market file.
+// \ingroup math
+*/
+struct MatrixMarketHeader
+{
+   //**Type definitions****************************************************************************
+   enum Format   { coordinate, array };                               //!< Storage formats.
+   enum Field    { real, integer, complexValued, pattern };           //!< Element types.
+   enum Symmetry { general, symmetric, skewSymmetric, hermitian };    //!< Symmetry structures.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Format      format;    //!< The storage format of the matrix.
+   Field       field;     //!< The type of the matrix elements.
+   Symmetry    symmetry;  //!< The symmetry structure of the matrix.
+   size_t      rows;      //!< The number of rows of the matrix.
+   size_t      columns;   //!< The number of columns of the matrix.
+   size_t      entries;   //!< The number of entries in a coordinate file.
+   const char* data;      //!< The beginning of the data section.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX MARKET PARSING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Case-insensitive matching of the next blank-separated token of a line.
+// \ingroup math
+//
+// \param pos Reference to the current position within the line.
+// \param end The end of the line.
+// \param token The expected lower-case token.
+// \return \a true in case the token matches, \a false if not.
+*/
+inline bool matchToken( const char*& pos, const char* end, const char* token )
+{
+   const char* p( skipBlanks( pos, end ) );
+
+   for( ; *token != '\0'; ++p, ++token ) {
+      if( p == end || std::tolower( static_cast<unsigned char>( *p ) ) != *token )
+         return false;
+   }
+
+   if( p != end && *p != ' ' && *p != '\t' && *p != '\r' )
+      return false;
+
+   pos = p;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing the banner, the comments, and the size line of a Matrix Market file.
+// \ingroup math
+//
+// \param first The beginning of the file content.
+// \param last The end of the file content.
+// \param header The resulting header information.
+// \return void
+// \exception std::runtime_error Invalid Matrix Market header.
+*/
+inline void parseMatrixMarketHeader( const char* first, const char* last, MatrixMarketHeader& header )
+{
+   const char* pos( first );
+   const char* end( findLineEnd( pos, last ) );
+
+   if( !matchToken( pos, end, "%%matrixmarket" ) || !matchToken( pos, end, "matrix" ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid Matrix Market banner" );
+   }
+
+   if     ( matchToken( pos, end, "coordinate" ) ) header.format = MatrixMarketHeader::coordinate;
+   else if( matchToken( pos, end, "array"      ) ) header.format = MatrixMarketHeader::array;
+   else BLAZE_THROW_RUNTIME_ERROR( "Invalid Matrix Market format" );
+
+   if     ( matchToken( pos, end, "real"    ) ) header.field = MatrixMarketHeader::real;
+   else if( matchToken( pos, end, "double"  ) ) header.field = MatrixMarketHeader::real;
+   else if( matchToken( pos, end, "integer" ) ) header.field = MatrixMarketHeader::integer;
+   else if( matchToken( pos, end, "complex" ) ) header.field = MatrixMarketHeader::complexValued;
+   else if( matchToken( pos, end, "pattern" ) ) header.field = MatrixMarketHeader::pattern;
+   else BLAZE_THROW_RUNTIME_ERROR( "Invalid Matrix Market field" );
+
+   if     ( matchToken( pos, end, "general"        ) ) header.symmetry = MatrixMarketHeader::general;
+   else if( matchToken( pos, end, "symmetric"      ) ) header.symmetry = MatrixMarketHeader::symmetric;
+   else if( matchToken( pos, end, "skew-symmetric" ) ) header.symmetry = MatrixMarketHeader::skewSymmetric;
+   else if( matchToken( pos, end, "hermitian"      ) ) header.symmetry = MatrixMarketHeader::hermitian;
+   else BLAZE_THROW_RUNTIME_ERROR( "Invalid Matrix Market symmetry" );
+
+   if( header.format == MatrixMarketHeader::array && header.field == MatrixMarketHeader::pattern ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid Matrix Market field" );
+   }
+
+   // Skipping all comment and blank lines
+   pos = end;
+   while( pos != last ) {
+      ++pos;
+      end = findLineEnd( pos, last );
+      if( isDataLine( pos, end, '%' ) ) break;
+      pos = end;
+   }
+
+   if( pos == last ||
+       !parseIndexToken( pos, end, header.rows ) || !parseIndexToken( pos, end, header.columns ) ||
+       ( header.format == MatrixMarketHeader::coordinate && !parseIndexToken( pos, end, header.entries ) ) ||
+       skipBlanks( pos, end ) != end ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid Matrix Market size line" );
+   }
+
+   if( header.format == MatrixMarketHeader::array ) {
+      header.entries = 0UL;
+   }
+
+   if( header.symmetry != MatrixMarketHeader::general && header.rows != header.columns ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid non-square symmetric Matrix Market matrix" );
+   }
+
+   header.data = ( end != last )?( end+1 ):( end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing the value of a Matrix Market entry.
+// \ingroup math
+//
+// \param pos Reference to the current position within the line.
+// \param end The end of the line.
+// \param field The type of the matrix elements.
+// \param value Reference to the parsed value.
+// \return \a true in case the value was parsed, \a false if not.
+*/
+template< typename Type >  // Type of the matrix elements
+inline bool parseMatrixMarketValue( const char*& pos, const char* end,
+                                    MatrixMarketHeader::Field field, Type& value )
+{
+   double real( 1.0 ), imag( 0.0 );
+
+   if( field != MatrixMarketHeader::pattern && !parseNumberToken( pos, end, real ) )
+      return false;
+
+   if( field == MatrixMarketHeader::complexValued && !parseNumberToken( pos, end, imag ) )
+      return false;
+
+   value = makeElement( real, imag, static_cast<Type*>( NULL ) );
+
+   return skipBlanks( pos, end ) == end;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the mirrored counterpart of an off-diagonal entry of a symmetric matrix.
+// \ingroup math
+//
+// \param value The value of the stored entry.
+// \param symmetry The symmetry structure of the matrix.
+// \return The value of the mirrored entry.
+*/
+template< typename Type >  // Type of the matrix elements
+inline Type mirrorValue( const Type& value, MatrixMarketHeader::Symmetry symmetry )
+{
+   if( symmetry == MatrixMarketHeader::skewSymmetric ) return -value;
+   if( symmetry == MatrixMarketHeader::hermitian ) return conj( value );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATRIXMARKETCOORDINATEPARSER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parser for the chunks of a Matrix Market file in coordinate format.
+// \ingroup math
+//
+// The parser converts all entries of a chunk into triplets with zero-based indices. In case of
+// a symmetric, skew-symmetric, or Hermitian matrix all off-diagonal entries are mirrored.
+*/
+template< typename Type >  // Type of the matrix elements
+struct MatrixMarketCoordinateParser
+{
+   //**Type definitions****************************************************************************
+   typedef std::vector< Triplet<Type> >  Triplets;  //!< Type of the triplets of a chunk.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MatrixMarketCoordinateParser class template.
+   //
+   // \param header The header information of the file.
+   // \param chunks The chunks of the data section.
+   // \param triplets The triplets of all chunks.
+   */
+   explicit inline MatrixMarketCoordinateParser( const MatrixMarketHeader& header,
+                                                 std::vector<TextChunk>& chunks,
+                                                 std::vector<Triplets>& triplets )
+      : header_  ( header   )  // The header information of the file
+      , chunks_  ( chunks   )  // The chunks of the data section
+      , triplets_( triplets )  // The triplets of all chunks
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Parses the chunk with the given index.
+   //
+   // \param k The index of the chunk.
+   // \return void
+   */
+   void operator()( size_t k ) const
+   {
+      TextChunk& chunk( chunks_[k] );
+      Triplets&  triplets( triplets_[k] );
+
+      for( const char* pos=chunk.first; pos!=chunk.last; )
+      {
+         const char* end( findLineEnd( pos, chunk.last ) );
+
+         if( isDataLine( pos, end, '%' ) )
+         {
+            size_t i( 0UL ), j( 0UL );
+            Type value;
+
+            if( !parseIndexToken( pos, end, i ) || !parseIndexToken( pos, end, j ) ||
+                !parseMatrixMarketValue( pos, end, header_.field, value ) ) {
+               chunk.error = "Invalid Matrix Market entry";
+               return;
+            }
+
+            if( i == 0UL || i > header_.rows || j == 0UL || j > header_.columns ) {
+               chunk.error = "Invalid Matrix Market index";
+               return;
+            }
+
+            triplets.push_back( Triplet<Type>( i-1UL, j-1UL, value ) );
+
+            if( header_.symmetry != MatrixMarketHeader::general && i != j ) {
+               triplets.push_back( Triplet<Type>( j-1UL, i-1UL, mirrorValue( value, header_.symmetry ) ) );
+            }
+
+            ++chunk.lines;
+         }
+
+         pos = ( end != chunk.last )?( end+1 ):( end );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MatrixMarketHeader& header_;    //!< The header information of the file.
+   std::vector<TextChunk>&   chunks_;    //!< The chunks of the data section.
+   std::vector<Triplets>&    triplets_;  //!< The triplets of all chunks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATRIXMARKETARRAYPARSER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parser for the chunks of a Matrix Market file in array format.
+// \ingroup math
+//
+// The parser writes all entries of a chunk directly into the given dense matrix. The position
+// of the first entry of a chunk is determined by the number of entries in all preceding chunks.
+// Since the entries of the chunks map to disjoint elements, all chunks can be processed
+// concurrently.
+*/
+template< typename Type  // Type of the matrix elements
+        , bool SO >      // Storage order
+struct MatrixMarketArrayParser
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MatrixMarketArrayParser class template.
+   //
+   // \param header The header information of the file.
+   // \param chunks The chunks of the data section.
+   // \param dm The target dense matrix.
+   */
+   explicit inline MatrixMarketArrayParser( const MatrixMarketHeader& header,
+                                            std::vector<TextChunk>& chunks,
+                                            DynamicMatrix<Type,SO>& dm )
+      : header_( header )  // The header information of the file
+      , chunks_( chunks )  // The chunks of the data section
+      , dm_    ( dm     )  // The target dense matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Parses the chunk with the given index.
+   //
+   // \param k The index of the chunk.
+   // \return void
+   */
+   void operator()( size_t k ) const
+   {
+      TextChunk& chunk( chunks_[k] );
+
+      if( chunk.lines == 0UL ) return;
+
+      // Computing the position of the first entry of the chunk (column-wise storage)
+      size_t entry( chunk.offset ), i( 0UL ), j( 0UL );
+
+      while( entry >= header_.rows - firstRow( j ) ) {
+         entry -= header_.rows - firstRow( j );
+         ++j;
+      }
+      i = firstRow( j ) + entry;
+
+      for( const char* pos=chunk.first; pos!=chunk.last; )
+      {
+         const char* end( findLineEnd( pos, chunk.last ) );
+
+         if( isDataLine( pos, end, '%' ) )
+         {
+            Type value;
+
+            if( !parseMatrixMarketValue( pos, end, header_.field, value ) ) {
+               chunk.error = "Invalid Matrix Market entry";
+               return;
+            }
+
+            dm_(i,j) = value;
+
+            if( header_.symmetry != MatrixMarketHeader::general && i != j ) {
+               dm_(j,i) = mirrorValue( value, header_.symmetry );
+            }
+
+            if( ++i == header_.rows ) {
+               ++j;
+               i = firstRow( j );
+            }
+         }
+
+         pos = ( end != chunk.last )?( end+1 ):( end );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the first stored row of the given column.
+   //
+   // \param j The index of the column.
+   // \return The index of the first stored row of column \a j.
+   */
+   inline size_t firstRow( size_t j ) const
+   {
+      if( header_.symmetry == MatrixMarketHeader::general ) return 0UL;
+      if( header_.symmetry == MatrixMarketHeader::skewSymmetric ) return j+1UL;
+      return j;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MatrixMarketHeader& header_;  //!< The header information of the file.
+   std::vector<TextChunk>&   chunks_;  //!< The chunks of the data section.
+   DynamicMatrix<Type,SO>&   dm_;      //!< The target dense matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATRIXMARKETREADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reader for Matrix Market files.
+// \ingroup math
+//
+// The MatrixMarketReader class maps a Matrix Market file into memory, splits the data section
+// into chunks of complete lines and parses all chunks concurrently via the active shared-memory
+// parallelization. Files in coordinate format are assembled into a CompressedMatrix via a single
+// bulk construction, files in array format are directly written into a DynamicMatrix.
+*/
+template< typename Type >  // Type of the matrix elements
+class MatrixMarketReader : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   explicit inline MatrixMarketReader( const std::string& filename );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline bool isCoordinate() const;
+
+   template< bool SO > void read( CompressedMatrix<Type,SO>& sm );
+   template< bool SO > void read( DynamicMatrix<Type,SO>& dm );
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MappedFile             file_;    //!< The memory mapped Matrix Market file.
+   MatrixMarketHeader     header_;  //!< The header information of the file.
+   std::vector<TextChunk> chunks_;  //!< The chunks of the data section.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the MatrixMarketReader class template.
+//
+// \param filename The name of the Matrix Market file.
+// \exception std::runtime_error Invalid Matrix Market file.
+*/
+template< typename Type >  // Type of the matrix elements
+inline MatrixMarketReader<Type>::MatrixMarketReader( const std::string& filename )
+   : file_  ( filename )  // The memory mapped Matrix Market file
+   , header_()            // The header information of the file
+   , chunks_()            // The chunks of the data section
+{
+   const char* const first( file_.data() );
+   const char* const last ( file_.data() + file_.size() );
+
+   parseMatrixMarketHeader( first, last, header_ );
+
+   if( header_.field == MatrixMarketHeader::complexValued && !IsComplex<Type>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Complex Matrix Market file for real matrix detected" );
+   }
+
+   splitIntoChunks( header_.data, last, chunks_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the Matrix Market file is stored in coordinate format.
+//
+// \return \a true in case of the coordinate format, \a false in case of the array format.
+*/
+template< typename Type >  // Type of the matrix elements
+inline bool MatrixMarketReader<Type>::isCoordinate() const
+{
+   return header_.format == MatrixMarketHeader::coordinate;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading the Matrix Market file into a compressed matrix.
+//
+// \param sm The target compressed matrix.
+// \return void
+// \exception std::runtime_error Invalid Matrix Market file.
+*/
+template< typename Type >  // Type of the matrix elements
+template< bool SO >        // Storage order of the target matrix
+void MatrixMarketReader<Type>::read( CompressedMatrix<Type,SO>& sm )
+{
+   typedef typename MatrixMarketCoordinateParser<Type>::Triplets  Triplets;
+
+   if( !isCoordinate() ) {
+      DynamicMatrix<Type,SO> tmp;
+      read( tmp );
+      sm = tmp;
+      return;
+   }
+
+   std::vector<Triplets> triplets( chunks_.size() );
+   MatrixMarketCoordinateParser<Type> parser( header_, chunks_, triplets );
+
+   smpFor( chunks_.size(), parser );
+
+   if( const char* error = firstError( chunks_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( error );
+   }
+
+   if( computeLineOffsets( chunks_ ) != header_.entries ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of Matrix Market entries" );
+   }
+
+   Triplets all;
+   if( triplets.size() == 1UL ) {
+      all.swap( triplets[0UL] );
+   }
+   else {
+      size_t total( 0UL );
+      for( size_t k=0UL; k<triplets.size(); ++k )
+         total += triplets[k].size();
+      all.reserve( total );
+      for( size_t k=0UL; k<triplets.size(); ++k ) {
+         all.insert( all.end(), triplets[k].begin(), triplets[k].end() );
+         Triplets().swap( triplets[k] );
+      }
+   }
+
+   sm.resize( header_.rows, header_.columns, false );
+   sm.setFromTriplets( all.begin(), all.end() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading the Matrix Market file into a dynamic matrix.
+//
+// \param dm The target dynamic matrix.
+// \return void
+// \exception std::runtime_error Invalid Matrix Market file.
+*/
+template< typename Type >  // Type of the matrix elements
+template< bool SO >        // Storage order of the target matrix
+void MatrixMarketReader<Type>::read( DynamicMatrix<Type,SO>& dm )
+{
+   if( isCoordinate() ) {
+      CompressedMatrix<Type,SO> tmp;
+      read( tmp );
+      dm = tmp;
+      return;
+   }
+
+   TextLineCounter counter( chunks_, '%' );
+   smpFor( chunks_.size(), counter );
+
+   const size_t n( header_.rows );
+   const size_t expected( header_.symmetry == MatrixMarketHeader::general       ? n * header_.columns
+                        : header_.symmetry == MatrixMarketHeader::skewSymmetric ? n * ( n - ( n != 0UL ) ) / 2UL
+                        :                                                         n * ( n + 1UL ) / 2UL );
+
+   if( computeLineOffsets( chunks_ ) != expected ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of Matrix Market entries" );
+   }
+
+   dm.resize( header_.rows, header_.columns, false );
+
+   if( header_.symmetry == MatrixMarketHeader::skewSymmetric ) {
+      dm.reset();
+   }
+
+   MatrixMarketArrayParser<Type,SO> parser( header_, chunks_, dm );
+
+   smpFor( chunks_.size(), parser );
+
+   if( const char* error = firstError( chunks_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( error );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX MARKET READER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Matrix Market reader functions */
+//@{
+template< typename Type, bool SO >
+void readMatrixMarket( const std::string& filename, DynamicMatrix<Type,SO>& dm );
+
+template< typename Type, bool SO >
+void readMatrixMarket( const std::string& filename, CompressedMatrix<Type,SO>& sm );
+
+template< typename MT, bool SO >
+void readMatrixMarket( const std::string& filename, Matrix<MT,SO>& m );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a Matrix Market file into a dynamic matrix.
+// \ingroup math
+//
+// \param filename The name of the Matrix Market file.
+// \param dm The target dynamic matrix.
+// \return void
+// \exception std::runtime_error Invalid Matrix Market file.
+//
+// This function reads the matrix stored in the given Matrix Market file into the dynamic matrix
+// \a dm, which is resized accordingly. Files in array format are parsed concurrently and written
+// directly into the matrix. Files in coordinate format are assembled via a temporary compressed
+// matrix (see the readMatrixMarket() function for compressed matrices). Symmetric, skew-symmetric,
+// and Hermitian files are expanded to the full matrix. In case the file cannot be read or does
+// not contain a valid Matrix Market matrix, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Type of the matrix elements
+        , bool SO >      // Storage order
+void readMatrixMarket( const std::string& filename, DynamicMatrix<Type,SO>& dm )
+{
+   MatrixMarketReader<Type> reader( filename );
+   reader.read( dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a Matrix Market file into a compressed matrix.
+// \ingroup math
+//
+// \param filename The name of the Matrix Market file.
+// \param sm The target compressed matrix.
+// \return void
+// \exception std::runtime_error Invalid Matrix Market file.
+//
+// This function reads the matrix stored in the given Matrix Market file into the compressed
+// matrix \a sm, which is resized accordingly:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::readMatrixMarket( "matrix.mtx", A );
+   \endcode
+
+// The file is memory mapped and the entries are parsed concurrently in chunks of complete lines
+// via the active shared-memory parallelization. The resulting entries are assembled via a single
+// call to the setFromTriplets() function. Duplicate entries are summed up and the off-diagonal
+// entries of symmetric, skew-symmetric, and Hermitian files are mirrored. In case the file cannot
+// be read or does not contain a valid Matrix Market matrix, a \a std::runtime_error exception is
+// thrown.
+//
+// In order to use this function, the header <tt><blaze/math/IO.h></tt> has to be included
+// explicitly.
+*/
+template< typename Type  // Type of the matrix elements
+        , bool SO >      // Storage order
+void readMatrixMarket( const std::string& filename, CompressedMatrix<Type,SO>& sm )
+{
+   MatrixMarketReader<Type> reader( filename );
+   reader.read( sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a Matrix Market file into an arbitrary matrix.
+// \ingroup math
+//
+// \param filename The name of the Matrix Market file.
+// \param m The target matrix.
+// \return void
+// \exception std::runtime_error Invalid Matrix Market file.
+// \exception std::invalid_argument Invalid assignment to the target matrix.
+//
+// This function reads the matrix stored in the given Matrix Market file into a temporary dynamic
+// (array format) or compressed (coordinate format) matrix, which is subsequently assigned to the
+// matrix \a m. This enables reading into adapted matrices, as for instance a SymmetricMatrix:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > S;
+   blaze::readMatrixMarket( "symmetric.mtx", S );
+   \endcode
+
+// In case the file cannot be read or does not contain a valid Matrix Market matrix, a
+// \a std::runtime_error exception is thrown. In case the matrix cannot be assigned to \a m
+// (for instance due to a size mismatch or a violated invariant of an adaptor), a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the target matrix
+        , bool SO >    // Storage order
+void readMatrixMarket( const std::string& filename, Matrix<MT,SO>& m )
+{
+   typedef typename MT::ElementType  ET;
+
+   MatrixMarketReader<ET> reader( filename );
+
+   if( reader.isCoordinate() ) {
+      CompressedMatrix<ET,SO> tmp;
+      reader.read( tmp );
+      ~m = tmp;
+   }
+   else {
+      DynamicMatrix<ET,SO> tmp;
+      reader.read( tmp );
+      ~m = tmp;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,374 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/io/TextParsing.h
+//  \brief Header file for the auxiliary functionality of the text file readers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_IO_TEXTPARSING_H_
+#define _BLAZE_MATH_IO_TEXTPARSING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <vector>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/NumberParser.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The minimum size of a chunk of a text file in bytes.
+// \ingroup math
+//
+// The text file readers split the data section of a file into chunks of at least this size,
+// which are parsed concurrently. Chunks always end at a line boundary.
+*/
+const size_t textChunkSize = 1048576UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEXTCHUNK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief A contiguous range of complete lines of a text file.
+// \ingroup math
+*/
+struct TextChunk
+{
+   const char* first;   //!< The first character of the chunk.
+   const char* last;    //!< One past the last character of the chunk.
+   size_t      lines;   //!< The number of data lines within the chunk.
+   size_t      offset;  //!< The number of data lines in all preceding chunks.
+   const char* error;   //!< The error detected during the parsing of the chunk (if any).
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEXT PARSING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the end of the line starting at the given position.
+// \ingroup math
+//
+// \param pos The beginning of the line.
+// \param end The end of the character range.
+// \return Pointer to the terminating newline character, \a end if the line is not terminated.
+*/
+inline const char* findLineEnd( const char* pos, const char* end )
+{
+   const void* newline( std::memchr( pos, '\n', end - pos ) );
+   return ( newline != NULL )?( static_cast<const char*>( newline ) ):( end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Skips all blanks, tabs, and carriage returns at the given position.
+// \ingroup math
+//
+// \param pos The current position within the character range.
+// \param end The end of the character range.
+// \return Pointer to the first non-blank character, \a end if there is none.
+*/
+inline const char* skipBlanks( const char* pos, const char* end )
+{
+   while( pos != end && ( *pos == ' ' || *pos == '\t' || *pos == '\r' ) )
+      ++pos;
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given line contains data, i.e. is neither blank nor a comment.
+// \ingroup math
+//
+// \param pos The beginning of the line.
+// \param end The end of the line.
+// \param comment The character introducing a comment line (\c '\\0' for no comments).
+// \return \a true in case the line contains data, \a false if not.
+*/
+inline bool isDataLine( const char* pos, const char* end, char comment )
+{
+   pos = skipBlanks( pos, end );
+   return pos != end && ( comment == '\0' || *pos != comment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits the given character range into chunks of complete lines.
+// \ingroup math
+//
+// \param first The beginning of the character range.
+// \param last The end of the character range.
+// \param chunks The resulting chunks.
+// \return void
+*/
+inline void splitIntoChunks( const char* first, const char* last, std::vector<TextChunk>& chunks )
+{
+   chunks.clear();
+
+   while( first != last )
+   {
+      const char* next( last );
+
+      if( static_cast<size_t>( last - first ) > textChunkSize ) {
+         next = findLineEnd( first + textChunkSize, last );
+         if( next != last ) ++next;
+      }
+
+      const TextChunk chunk = { first, next, 0UL, 0UL, NULL };
+      chunks.push_back( chunk );
+      first = next;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the data lines of a chunk.
+// \ingroup math
+//
+// \param chunk The chunk to be processed.
+// \param comment The character introducing a comment line (\c '\\0' for no comments).
+// \return void
+*/
+inline void countDataLines( TextChunk& chunk, char comment )
+{
+   size_t lines( 0UL );
+
+   for( const char* pos=chunk.first; pos!=chunk.last; ) {
+      const char* lineEnd( findLineEnd( pos, chunk.last ) );
+      if( isDataLine( pos, lineEnd, comment ) ) ++lines;
+      pos = ( lineEnd != chunk.last )?( lineEnd+1 ):( lineEnd );
+   }
+
+   chunk.lines = lines;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the concurrent counting of the data lines of several chunks.
+// \ingroup math
+*/
+struct TextLineCounter
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TextLineCounter class.
+   //
+   // \param chunks The chunks to be processed.
+   // \param comment The character introducing a comment line (\c '\\0' for no comments).
+   */
+   explicit inline TextLineCounter( std::vector<TextChunk>& chunks, char comment )
+      : chunks_ ( chunks  )  // The chunks to be processed
+      , comment_( comment )  // The character introducing a comment line
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Counts the data lines of the chunk with the given index.
+   //
+   // \param k The index of the chunk.
+   // \return void
+   */
+   inline void operator()( size_t k ) const {
+      countDataLines( chunks_[k], comment_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<TextChunk>& chunks_;   //!< The chunks to be processed.
+   char                    comment_;  //!< The character introducing a comment line.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the line offsets of all chunks and returns the total number of data lines.
+// \ingroup math
+//
+// \param chunks The chunks to be processed.
+// \return The total number of data lines in all chunks.
+*/
+inline size_t computeLineOffsets( std::vector<TextChunk>& chunks )
+{
+   size_t total( 0UL );
+
+   for( size_t k=0UL; k<chunks.size(); ++k ) {
+      chunks[k].offset = total;
+      total += chunks[k].lines;
+   }
+
+   return total;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the first error detected in any of the given chunks.
+// \ingroup math
+//
+// \param chunks The parsed chunks.
+// \return The first detected error message, \c NULL in case no error was detected.
+*/
+inline const char* firstError( const std::vector<TextChunk>& chunks )
+{
+   for( size_t k=0UL; k<chunks.size(); ++k ) {
+      if( chunks[k].error != NULL ) return chunks[k].error;
+   }
+   return NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses an index following optional blanks.
+// \ingroup math
+//
+// \param pos Reference to the current position within the line.
+// \param end The end of the line.
+// \param value Reference to the parsed index.
+// \return \a true in case an index was parsed, \a false if not.
+*/
+inline bool parseIndexToken( const char*& pos, const char* end, size_t& value )
+{
+   pos = skipBlanks( pos, end );
+   return parseIndex( pos, end, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses a floating point number following optional blanks.
+// \ingroup math
+//
+// \param pos Reference to the current position within the line.
+// \param end The end of the line.
+// \param value Reference to the parsed number.
+// \return \a true in case a number was parsed, \a false if not.
+*/
+inline bool parseNumberToken( const char*& pos, const char* end, double& value )
+{
+   pos = skipBlanks( pos, end );
+   return parseNumber( pos, end, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a parsed real and imaginary part into a real matrix element.
+// \ingroup math
+//
+// \param real The parsed real part.
+// \param imag The parsed imaginary part (ignored).
+// \return The resulting matrix element.
+*/
+template< typename Type >  // Type of the matrix element
+inline Type makeElement( double real, double /*imag*/, Type* /*dummy*/ )
+{
+   return static_cast<Type>( real );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a parsed real and imaginary part into a complex matrix element.
+// \ingroup math
+//
+// \param real The parsed real part.
+// \param imag The parsed imaginary part.
+// \return The resulting matrix element.
+*/
+template< typename Type >  // Type of the real and imaginary part
+inline complex<Type> makeElement( double real, double imag, complex<Type>* /*dummy*/ )
+{
+   return complex<Type>( static_cast<Type>( real ), static_cast<Type>( imag ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1032 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/AssignmentBatch.h
+//  \brief Header file for the AssignmentBatch class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_ASSIGNMENTBATCH_H_
+#define _BLAZE_MATH_SMP_ASSIGNMENTBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <condition_variable>
+#  include <mutex>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/thread/condition.hpp>
+#  include <boost/thread/mutex.hpp>
+#elif BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
+#include <exception>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partitioning.h>
+#include <blaze/math/SparseSubvector.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ISBATCHELEMENTWISE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the detection of element-wise dense vector operands.
+// \ingroup smp
+//
+// This auxiliary type trait tests whether the \a i-th element of the given dense vector operand
+// only depends on the \a i-th elements of the vectors it refers to. This is the case for all
+// dense vectors (except views) and for all element-wise expressions (as for instance additions,
+// subtractions and scalings) on such operands. In this case the \a value member enumeration is
+// set to 1, otherwise it is set to 0.
+*/
+template< typename T >
+struct IsBatchElementwise
+{
+   enum { value = IsDenseVector<T>::value && !IsExpression<T>::value };
+};
+
+template< typename T >
+struct IsBatchElementwise<const T>
+{
+   enum { value = IsBatchElementwise<T>::value };
+};
+
+template< typename VT1, typename VT2, bool TF >
+struct IsBatchElementwise< DVecDVecAddExpr<VT1,VT2,TF> >
+{
+   enum { value = IsBatchElementwise<VT1>::value && IsBatchElementwise<VT2>::value };
+};
+
+template< typename VT1, typename VT2, bool TF >
+struct IsBatchElementwise< DVecDVecSubExpr<VT1,VT2,TF> >
+{
+   enum { value = IsBatchElementwise<VT1>::value && IsBatchElementwise<VT2>::value };
+};
+
+template< typename VT1, typename VT2, bool TF >
+struct IsBatchElementwise< DVecDVecMultExpr<VT1,VT2,TF> >
+{
+   enum { value = IsBatchElementwise<VT1>::value && IsBatchElementwise<VT2>::value };
+};
+
+template< typename VT, typename ST, bool TF >
+struct IsBatchElementwise< DVecScalarMultExpr<VT,ST,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, typename ST, bool TF >
+struct IsBatchElementwise< DVecScalarDivExpr<VT,ST,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, bool TF >
+struct IsBatchElementwise< DVecAbsExpr<VT,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, bool TF >
+struct IsBatchElementwise< DVecConjExpr<VT,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, bool TF >
+struct IsBatchElementwise< DVecRealExpr<VT,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, bool TF >
+struct IsBatchElementwise< DVecImagExpr<VT,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, bool TF >
+struct IsBatchElementwise< DVecEvalExpr<VT,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, bool TF >
+struct IsBatchElementwise< DVecSerialExpr<VT,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+
+template< typename VT, bool TF >
+struct IsBatchElementwise< DVecTransExpr<VT,TF> >
+{
+   enum { value = IsBatchElementwise<VT>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS BATCHSTATEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class for all statements of an assignment batch.
+// \ingroup smp
+//
+// The BatchStatement class represents a single recorded assignment of an AssignmentBatch. It
+// provides the information required to build the dependency graph of the batch (the target
+// vector, the size, the element-wise property and the vectors read by the statement) and the
+// functionality to execute either the complete statement or a single tile of it.
+*/
+class BatchStatement : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchStatement class.
+   //
+   // \param target The target vector of the statement.
+   // \param size The size of the target vector.
+   // \param elementwise \a true in case the statement is element-wise, \a false if not.
+   */
+   explicit inline BatchStatement( const void* target, size_t size, bool elementwise )
+      : target_     ( target      )  // The target vector of the statement
+      , size_       ( size        )  // The size of the target vector
+      , elementwise_( elementwise )  // The element-wise flag of the statement
+   {}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor for the BatchStatement class.
+   */
+   virtual ~BatchStatement()
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the target vector of the statement.
+   //
+   // \return Pointer to the target vector.
+   */
+   inline const void* target() const {
+      return target_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the size of the target vector.
+   //
+   // \return The size of the target vector.
+   */
+   inline size_t size() const {
+      return size_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the statement is element-wise.
+   //
+   // \return \a true in case the statement is element-wise, \a false if not.
+   */
+   inline bool isElementwise() const {
+      return elementwise_;
+   }
+   //**********************************************************************************************
+
+   //**Assignment functions************************************************************************
+   /*!\name Assignment functions */
+   //@{
+   virtual bool reads   ( const void* vector ) const = 0;
+   virtual void execute () = 0;
+   virtual void execute ( size_t index, size_t size ) = 0;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const void* target_;  //!< The target vector of the statement.
+   size_t size_;         //!< The size of the target vector.
+   bool elementwise_;    //!< The element-wise flag of the statement.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE BATCHASSIGNER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recorded assignment of a vector expression to a dense vector.
+// \ingroup smp
+//
+// The BatchAssigner class template represents the recorded assignment of the source operand of
+// type \a Source to the dense target vector of type \a Target. Expressions are stored by value,
+// all other operands are stored by reference.
+*/
+template< typename Target    // Type of the target dense vector
+        , typename Source >  // Type of the source operand
+class BatchAssigner : public BatchStatement
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Storage type of the source operand.
+   typedef typename If< IsExpression<Source>, const Source, const Source& >::Type  Operand;
+
+   //! Type of a tile of the target vector.
+   typedef typename SubvectorExprTrait<Target,unaligned>::Type  TargetTile;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BatchAssigner class template.
+   //
+   // \param target The target dense vector to be assigned to.
+   // \param source The source operand to be assigned to the target.
+   */
+   explicit inline BatchAssigner( Target& target, const Source& source )
+      : BatchStatement( &target, source.size(), IsBatchElementwise<Source>::value )
+      , target_( target )  // The target dense vector
+      , source_( source )  // The source operand
+   {}
+   //**********************************************************************************************
+
+   //**Assignment functions************************************************************************
+   /*!\brief Returns whether the source operand reads the given vector.
+   //
+   // \param vector The vector to be checked.
+   // \return \a true in case the vector is read by the statement, \a false if not.
+   */
+   virtual bool reads( const void* vector ) const {
+      return source_.isAliased( vector );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Executes the complete statement.
+   //
+   // \return void
+   */
+   virtual void execute() {
+      target_ = source_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Executes the given tile of the statement.
+   //
+   // \param index The index of the first element of the tile.
+   // \param size The number of elements of the tile.
+   // \return void
+   */
+   virtual void execute( size_t index, size_t size ) {
+      TargetTile tile( subvector<unaligned>( target_, index, size ) );
+      assign( tile, subvector<unaligned>( source_, index, size ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Target& target_;  //!< The target dense vector.
+   Operand source_;  //!< The source operand.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE    ( Target );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( Target );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASSIGNMENTBATCH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batch of dense vector assignments executed as a dependency graph.
+// \ingroup smp
+//
+// Iterative algorithms typically execute sequences of dense vector assignments, as for instance
+// in the conjugate gradient method:
+
+   \code
+   r = b - A*x;
+   p = r + beta*p;
+   q = A*p;
+   \endcode
+
+// In case every single assignment is parallelized individually, each one of them ends with a
+// barrier that waits for all threads. The AssignmentBatch class provides an alternative: It
+// records a sequence of assignments and executes them in a single parallel run:
+
+   \code
+   blaze::AssignmentBatch batch;
+
+   batch.assign( r, b - A*x );
+   batch.assign( p, r + beta*p );
+   batch.assign( q, A*p );
+
+   batch.run();
+   \endcode
+
+// On execution, every recorded assignment is split into tiles (i.e. contiguous ranges of the
+// target vector). Based on the vectors read and written by the assignments, a dependency graph
+// of the tiles is built: A tile of an element-wise assignment (as for instance an addition or a
+// scaling of vectors) only depends on the same tile of a preceding assignment, whereas all other
+// assignments (as for instance matrix/vector multiplications) depend on all tiles of a preceding
+// conflicting assignment. Consecutive element-wise assignments of the same size are fused, i.e.
+// they are executed tile by tile within the same task. In the example above, the first tile of
+// \c p can be computed as soon as the first tile of \c r is available, and the computation of
+// \c q starts as soon as all tiles of \c p are available. Independent assignments are executed
+// concurrently. The result is the same as for the sequential execution of the assignments.
+//
+// Note that the assignments are not executed before the run() function is called. Therefore
+// none of the operands must be modified or destroyed before run() has been called. Also note
+// that the target vectors are resized immediately when an assignment is recorded. In case no
+// parallelization is active, run() executes the assignments sequentially.
+*/
+class AssignmentBatch : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef boost::shared_ptr<BatchStatement>  Statement;   //!< Handle to a recorded statement.
+   typedef std::vector<Statement>             Statements;  //!< List of recorded statements.
+   //**********************************************************************************************
+
+   //**Private class Group*************************************************************************
+   /*!\brief A group of fused statements.
+   */
+   struct Group
+   {
+      size_t first;               //!< The index of the first statement of the group.
+      size_t last;                //!< The index one past the last statement of the group.
+      size_t size;                //!< The size of the target vectors of the group.
+      bool tiled;                 //!< Flag for a group executed tile by tile.
+      std::vector<size_t> nodes;  //!< The nodes of the group (one per tile).
+   };
+   //**********************************************************************************************
+
+   //**Private class Node**************************************************************************
+   /*!\brief A single tile of a group of statements.
+   */
+   struct Node
+   {
+      size_t group;                    //!< The index of the group of the node.
+      size_t index;                    //!< The index of the first element of the tile.
+      size_t size;                     //!< The number of elements of the tile.
+      size_t dependencies;             //!< The number of preceding nodes.
+      std::vector<size_t> successors;  //!< The indices of all succeeding nodes.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<Group>  Groups;  //!< The groups of the dependency graph.
+   typedef std::vector<Node>   Nodes;   //!< The nodes of the dependency graph.
+   //**********************************************************************************************
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   //**Type definitions****************************************************************************
+#  if BLAZE_CPP_THREADS_PARALLEL_MODE
+   typedef std::mutex                        Mutex;      //!< Type of the mutex.
+   typedef std::unique_lock<std::mutex>      Lock;       //!< Type of a locking object.
+   typedef std::condition_variable           Condition;  //!< Condition variable type.
+#  else
+   typedef boost::mutex                      Mutex;      //!< Type of the mutex.
+   typedef boost::unique_lock<boost::mutex>  Lock;       //!< Type of a locking object.
+   typedef boost::condition_variable         Condition;  //!< Condition variable type.
+#  endif
+   //**********************************************************************************************
+
+   //**Private class Scheduler*********************************************************************
+   /*!\brief Shared state of all worker tasks executing a dependency graph.
+   */
+   struct Scheduler
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Scheduler class.
+      //
+      // \param nodes The total number of nodes of the dependency graph.
+      */
+      explicit inline Scheduler( size_t nodes )
+         : mutex    ()         // Synchronization mutex
+         , available()         // Wait condition for the availability of a node
+         , ready    ()         // The nodes ready for execution
+         , remaining( nodes )  // The number of nodes not yet executed
+         , error    ()         // The first exception thrown by any node
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Mutex mutex;                //!< Synchronization mutex.
+      Condition available;        //!< Wait condition for the availability of a node.
+      std::vector<size_t> ready;  //!< The nodes ready for execution.
+      size_t remaining;           //!< The number of nodes not yet executed.
+      std::exception_ptr error;   //!< The first exception thrown by any node.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Worker************************************************************************
+   /*!\brief Worker task for the execution of the nodes of a dependency graph.
+   //
+   // Each worker repeatedly picks a node whose dependencies have been resolved, executes it and
+   // releases all succeeding nodes. A worker returns as soon as all nodes have been executed.
+   */
+   struct Worker
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Worker class.
+      //
+      // \param batch The assignment batch to be executed.
+      // \param groups The groups of the dependency graph.
+      // \param nodes The nodes of the dependency graph.
+      // \param scheduler The shared scheduler state.
+      */
+      explicit inline Worker( const AssignmentBatch& batch, const Groups& groups,
+                              Nodes& nodes, Scheduler& scheduler )
+         : batch_    ( &batch     )  // The assignment batch to be executed
+         , groups_   ( &groups    )  // The groups of the dependency graph
+         , nodes_    ( &nodes     )  // The nodes of the dependency graph
+         , scheduler_( &scheduler )  // The shared scheduler state
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes nodes until the entire dependency graph has been executed.
+      //
+      // \return void
+      */
+      void operator()() const
+      {
+         Scheduler& s( *scheduler_ );
+         Lock lock( s.mutex );
+
+         while( s.remaining > 0UL )
+         {
+            if( s.ready.empty() ) {
+               s.available.wait( lock );
+               continue;
+            }
+
+            const size_t index( s.ready.back() );
+            s.ready.pop_back();
+            lock.unlock();
+
+            const Node& node( (*nodes_)[index] );
+
+            try {
+               batch_->executeNode( *groups_, node );
+            }
+            catch( ... ) {
+               lock.lock();
+               if( !s.error ) s.error = std::current_exception();
+               lock.unlock();
+            }
+
+            lock.lock();
+            for( size_t i=0UL; i<node.successors.size(); ++i ) {
+               if( --(*nodes_)[node.successors[i]].dependencies == 0UL )
+                  s.ready.push_back( node.successors[i] );
+            }
+            --s.remaining;
+            s.available.notify_all();
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const AssignmentBatch* batch_;  //!< The assignment batch to be executed.
+      const Groups* groups_;          //!< The groups of the dependency graph.
+      Nodes* nodes_;                  //!< The nodes of the dependency graph.
+      Scheduler* scheduler_;          //!< The shared scheduler state.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+#endif
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline AssignmentBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   inline void assign( DenseVector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size () const;
+   inline void   clear();
+   inline void   run  ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Graph functions*****************************************************************************
+   /*!\name Graph functions */
+   //@{
+   inline void buildGraph ( size_t tiles, Groups& groups, Nodes& nodes ) const;
+   inline int  dependency ( const Group& group, const Group& previous ) const;
+   inline void executeNode( const Groups& groups, const Node& node ) const;
+   inline void execute    ( const Groups& groups, Nodes& nodes ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Statements statements_;  //!< The recorded statements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for AssignmentBatch.
+*/
+inline AssignmentBatch::AssignmentBatch()
+   : statements_()  // The recorded statements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the assignment of the given right-hand side vector (or vector
+// expression) to the given left-hand side dense vector. The assignment is executed during the
+// next call to the run() function. The target vector is resized immediately. In case the target
+// vector cannot be resized to the size of the right-hand side vector, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void AssignmentBatch::assign( DenseVector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      resize( ~lhs, (~rhs).size(), false );
+   }
+
+   statements_.push_back( Statement( new BatchAssigner<VT1,VT2>( ~lhs, ~rhs ) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded assignments.
+//
+// \return The number of recorded assignments.
+*/
+inline size_t AssignmentBatch::size() const
+{
+   return statements_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all recorded assignments without executing them.
+//
+// \return void
+*/
+inline void AssignmentBatch::clear()
+{
+   statements_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes all recorded assignments.
+//
+// \return void
+//
+// This function executes all recorded assignments and removes them from the batch. In case the
+// batch is executed sequentially (i.e. in case no parallelization is active or only a single
+// thread is available), an exception thrown during any of the assignments is propagated
+// immediately and the remaining assignments are discarded. In case the batch is executed in
+// parallel, the remaining assignments are executed nevertheless and the first exception is
+// rethrown afterwards.
+*/
+inline void AssignmentBatch::run()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   const size_t threads( TheThreadBackend::size() );
+#elif BLAZE_OPENMP_PARALLEL_MODE
+   const size_t threads( omp_get_max_threads() );
+#else
+   const size_t threads( 1UL );
+#endif
+
+   Statements statements;
+   statements.swap( statements_ );
+
+   if( threads < 2UL || statements.empty() ) {
+      for( Statements::const_iterator it=statements.begin(); it!=statements.end(); ++it ) {
+         (*it)->execute();
+      }
+      return;
+   }
+
+   statements_.swap( statements );
+
+   Groups groups;
+   Nodes  nodes;
+
+   try {
+      buildGraph( 4UL*threads, groups, nodes );
+      execute( groups, nodes );
+   }
+   catch( ... ) {
+      statements_.clear();
+      throw;
+   }
+
+   statements_.clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GRAPH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Builds the dependency graph of the recorded statements.
+//
+// \param tiles The number of tiles per group.
+// \param groups The resulting groups of fused statements.
+// \param nodes The resulting nodes of the dependency graph.
+// \return void
+//
+// Consecutive element-wise statements of the same size are fused into a single group. Each
+// group is split into the given number of tiles, except for groups consisting of a single
+// statement that is not element-wise and reads its own target vector (as for instance
+// \c x = A*x), which are executed as a whole.
+*/
+inline void AssignmentBatch::buildGraph( size_t tiles, Groups& groups, Nodes& nodes ) const
+{
+   // Fusing consecutive element-wise statements
+   for( size_t i=0UL; i<statements_.size(); ++i )
+   {
+      const BatchStatement& statement( *statements_[i] );
+
+      if( !groups.empty() && statement.isElementwise() &&
+          statements_[groups.back().first]->isElementwise() &&
+          groups.back().size == statement.size() ) {
+         groups.back().last = i+1UL;
+         continue;
+      }
+
+      Group group;
+      group.first = i;
+      group.last  = i+1UL;
+      group.size  = statement.size();
+      group.tiled = statement.isElementwise() || !statement.reads( statement.target() );
+      groups.push_back( group );
+   }
+
+   // Creating the nodes of all groups
+   std::vector<size_t> bounds;
+
+   for( size_t g=0UL; g<groups.size(); ++g )
+   {
+      Group& group( groups[g] );
+
+      if( group.tiled ) {
+         partitionEvenly( group.size, tiles, 16UL, bounds );
+      }
+      else {
+         bounds.resize( 2UL );
+         bounds[0] = 0UL;
+         bounds[1] = group.size;
+      }
+
+      for( size_t k=0UL; k+1UL<bounds.size(); ++k ) {
+         Node node;
+         node.group        = g;
+         node.index        = bounds[k];
+         node.size         = bounds[k+1UL] - bounds[k];
+         node.dependencies = 0UL;
+         group.nodes.push_back( nodes.size() );
+         nodes.push_back( node );
+      }
+   }
+
+   // Adding the dependencies between the groups
+   for( size_t g=1UL; g<groups.size(); ++g )
+   {
+      const Group& group( groups[g] );
+
+      for( size_t h=0UL; h<g; ++h )
+      {
+         const Group& previous( groups[h] );
+         const int type( dependency( group, previous ) );
+
+         if( type == 0 ) continue;
+
+         for( size_t k=0UL; k<group.nodes.size(); ++k )
+         {
+            Node& node( nodes[group.nodes[k]] );
+
+            if( type == 1 ) {
+               nodes[previous.nodes[k]].successors.push_back( group.nodes[k] );
+               ++node.dependencies;
+            }
+            else for( size_t j=0UL; j<previous.nodes.size(); ++j ) {
+               nodes[previous.nodes[j]].successors.push_back( group.nodes[k] );
+               ++node.dependencies;
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the type of dependency between two groups of statements.
+//
+// \param group The later group of statements.
+// \param previous The earlier group of statements.
+// \return 0 for independent groups, 1 for tile-wise dependencies, 2 for full dependencies.
+//
+// Two statements conflict in case they write the same vector or in case one of them reads the
+// target vector of the other. A conflict results in a tile-wise dependency in case both groups
+// use the same tiling and the reading statement is element-wise. Otherwise each tile of the
+// later group depends on all tiles of the earlier group.
+*/
+inline int AssignmentBatch::dependency( const Group& group, const Group& previous ) const
+{
+   const bool tileWise( group.tiled && previous.tiled && group.size == previous.size );
+
+   int type( 0 );
+
+   for( size_t i=group.first; i<group.last; ++i )
+   {
+      const BatchStatement& statement( *statements_[i] );
+
+      for( size_t j=previous.first; j<previous.last; ++j )
+      {
+         const BatchStatement& other( *statements_[j] );
+
+         if( statement.target() == other.target() ) {
+            type = max( type, tileWise ? 1 : 2 );
+         }
+         if( statement.reads( other.target() ) ) {
+            type = max( type, ( tileWise && statement.isElementwise() ) ? 1 : 2 );
+         }
+         if( other.reads( statement.target() ) ) {
+            type = max( type, ( tileWise && other.isElementwise() ) ? 1 : 2 );
+         }
+      }
+   }
+
+   return type;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes a single node of the dependency graph.
+//
+// \param groups The groups of the dependency graph.
+// \param node The node to be executed.
+// \return void
+*/
+inline void AssignmentBatch::executeNode( const Groups& groups, const Node& node ) const
+{
+   const Group& group( groups[node.group] );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=group.first; i<group.last; ++i ) {
+         if( !group.tiled )
+            statements_[i]->execute();
+         else if( node.size > 0UL )
+            statements_[i]->execute( node.index, node.size );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the dependency graph.
+//
+// \param groups The groups of the dependency graph.
+// \param nodes The nodes of the dependency graph.
+// \return void
+//
+// In case the C++11 or Boost threads are used, all nodes are executed by a fixed number of
+// worker tasks, which continuously pick the next node whose dependencies have been resolved.
+// In case OpenMP is used, the dependency graph is executed level by level, i.e. all nodes of a
+// level (whose dependencies are all part of preceding levels) are executed concurrently.
+// Otherwise all nodes are executed sequentially in the order of the recorded statements and
+// any exception is propagated immediately.
+*/
+inline void AssignmentBatch::execute( const Groups& groups, Nodes& nodes ) const
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   Scheduler scheduler( nodes.size() );
+
+   for( size_t i=0UL; i<nodes.size(); ++i ) {
+      if( nodes[i].dependencies == 0UL )
+         scheduler.ready.push_back( i );
+   }
+
+   const size_t threads( min( TheThreadBackend::size(), nodes.size() ) );
+
+   for( size_t i=0UL; i<threads; ++i ) {
+      TheThreadBackend::scheduleTask( Worker( *this, groups, nodes, scheduler ) );
+   }
+
+   TheThreadBackend::wait();
+
+   if( scheduler.error ) std::rethrow_exception( scheduler.error );
+
+#elif BLAZE_OPENMP_PARALLEL_MODE
+
+   std::exception_ptr error;
+   std::vector<size_t> level, next;
+
+   for( size_t i=0UL; i<nodes.size(); ++i ) {
+      if( nodes[i].dependencies == 0UL )
+         level.push_back( i );
+   }
+
+   while( !level.empty() )
+   {
+      const int n( static_cast<int>( level.size() ) );
+
+#pragma omp parallel for schedule(dynamic,1) shared( groups, nodes, level, error )
+      for( int i=0; i<n; ++i ) {
+         try {
+            executeNode( groups, nodes[level[i]] );
+         }
+         catch( ... ) {
+#pragma omp critical (BlazeAssignmentBatch)
+            {
+               if( !error ) error = std::current_exception();
+            }
+         }
+      }
+
+      next.clear();
+      for( size_t i=0UL; i<level.size(); ++i ) {
+         const Node& node( nodes[level[i]] );
+         for( size_t j=0UL; j<node.successors.size(); ++j ) {
+            if( --nodes[node.successors[j]].dependencies == 0UL )
+               next.push_back( node.successors[j] );
+         }
+      }
+      level.swap( next );
+   }
+
+   if( error ) std::rethrow_exception( error );
+
+#else
+
+   for( size_t i=0UL; i<nodes.size(); ++i ) {
+      executeNode( groups, nodes[i] );
+   }
+
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
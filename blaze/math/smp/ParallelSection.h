@@ -40,9 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/ThreadLocal.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/Suffix.h>
-#include <atomic>
 
 
 namespace blaze {
@@ -59,7 +59,11 @@ namespace blaze {
 //
 // The ParallelSection class is an auxiliary helper class for the \a BLAZE_PARALLEL_SECTION macro.
 // It provides the functionality to detected whether a parallel section has been started and with
-// that serves as a utility for debugging the shared-memory parallelization.
+// that serves as a utility for debugging the shared-memory parallelization. Parallel sections
+// are counted per thread, i.e. the parallel sections of independent threads (as for instance
+// the request threads of a server) don't affect each other. For that reason the SMP backends
+// open a parallel section on each of their executing threads, i.e. within every OpenMP parallel
+// region and within every task executed by the C++11/Boost thread pool.
 */
 template< typename T >
 class ParallelSection
@@ -87,13 +91,19 @@ class ParallelSection
    //**********************************************************************************************
 
  private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline int& counts();
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static std::atomic_int counts_;  //!< Counts for the active parallel section.
-                                    /*!< In case a parallel section is active (i.e. the currently
-                                         executed code is inside a parallel section), the counts is
-                                         increased, otherwise it is decreased. */
+   bool active_;  //!< Activity flag for the parallel section.
+                  /*!< In case the section is active, it is counted as an active parallel
+                       section of the calling thread for its entire lifetime. */
    //@}
    //**********************************************************************************************
 
@@ -114,22 +124,6 @@ class ParallelSection
 
 
 
-//=================================================================================================
-//
-//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-template< typename T >
-std::atomic_int ParallelSection<T>::counts_(0);
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
 //=================================================================================================
 //
 //  CONSTRUCTOR
@@ -140,12 +134,16 @@ std::atomic_int ParallelSection<T>::counts_(0);
 /*!\brief Constructor for the ParallelSection class.
 //
 // \param activate Activation flag for the parallel section.
-// \exception std::runtime_error Nested parallel sections detected.
+//
+// In case the section is activated, the number of active parallel sections of the calling
+// thread is increased until the section is destroyed.
 */
 template< typename T >
 inline ParallelSection<T>::ParallelSection( bool activate )
+   : active_( activate )  // Activity flag for the parallel section
 {
-  ++counts_;
+   if( active_ )
+      ++counts();
 }
 //*************************************************************************************************
 
@@ -164,7 +162,8 @@ inline ParallelSection<T>::ParallelSection( bool activate )
 template< typename T >
 inline ParallelSection<T>::~ParallelSection()
 {
-  --counts_;
+   if( active_ )
+      --counts();
 }
 //*************************************************************************************************
 
@@ -186,7 +185,29 @@ inline ParallelSection<T>::~ParallelSection()
 template< typename T >
 inline ParallelSection<T>::operator bool() const
 {
-   return counts_.load() > 0;
+   return counts() > 0;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of active parallel sections of the calling thread.
+//
+// \return Reference to the thread-local number of active parallel sections.
+*/
+template< typename T >
+inline int& ParallelSection<T>::counts()
+{
+   static BLAZE_THREAD_LOCAL int counts = 0;
+   return counts;
 }
 //*************************************************************************************************
 
@@ -215,7 +236,7 @@ inline bool isParallelSectionActive();
 */
 inline bool isParallelSectionActive()
 {
-   return ParallelSection<int>::counts_.load() > 0;
+   return ParallelSection<int>::counts() > 0;
 }
 //*************************************************************************************************
 
@@ -232,10 +253,14 @@ inline bool isParallelSectionNested();
 // \ingroup smp
 //
 // \return \a true if a parallel section is nested, \a false if not.
+//
+// This function returns whether the calling thread has entered a parallel section from within
+// another parallel section, as for instance in case an SMP assignment is triggered during the
+// execution of an SMP assignment. In that case the nested assignment is executed serially.
 */
 inline bool isParallelSectionNested()
 {
-   return ParallelSection<int>::counts_.load() > 1;
+   return ParallelSection<int>::counts() > 1;
 }
 //*************************************************************************************************
 
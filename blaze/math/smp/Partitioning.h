@@ -0,0 +1,713 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Partitioning.h
+//  \brief Header file for the workload partitioning of SMP assignments
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_PARTITIONING_H_
+#define _BLAZE_MATH_SMP_PARTITIONING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BASIC PARTITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the index range \f$ [0..n) \f$ into equally sized parts.
+// \ingroup smp
+//
+// \param n The size of the index range.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes (for instance the SIMD vector width).
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// This function partitions the given index range into \a parts parts of equal size. The size
+// of the parts is rounded up to a multiple of the given \a granularity. Part \a i is given by
+// the index range \f$ [bounds[i]..bounds[i+1]) \f$, which may be empty for trailing parts.
+*/
+inline void partitionEvenly( size_t n, size_t parts, size_t granularity,
+                             std::vector<size_t>& bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts       > 0UL, "Invalid number of parts" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid granularity"     );
+
+   const size_t addon      ( ( ( n % parts ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( n / parts + addon );
+   const size_t rest       ( equalShare % granularity );
+   const size_t sizePerPart( ( rest )?( equalShare - rest + granularity ):( equalShare ) );
+
+   bounds.resize( parts + 1UL );
+
+   for( size_t i=0UL; i<=parts; ++i ) {
+      bounds[i] = min( i*sizePerPart, n );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows/columns of a sparse matrix into parts of equal workload.
+// \ingroup smp
+//
+// \param sm The sparse matrix whose rows (row-major) or columns (column-major) are partitioned.
+// \param parts The number of parts.
+// \param granularity The granularity of the part bounds (for instance the SIMD vector width).
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// This function partitions the rows of a row-major sparse matrix (or the columns of a
+// column-major sparse matrix) such that all parts contain approximately the same workload,
+// where the workload of a row is given by its number of non-zero elements plus one for the
+// row itself. In contrast to an equal number of rows per part this keeps the parts balanced
+// for matrices with a very irregular distribution of non-zero elements (as for instance
+// power-law graphs). The bounds are determined by a merge-path search along the combined
+// sequence of rows and non-zero elements: a row is assigned to the part that contains the
+// midpoint of its workload. Rows are never split, i.e. a single row with more non-zero
+// elements than an equal share of the total workload forms a part on its own. All bounds
+// except the last one are rounded to a multiple of the given \a granularity.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline void partitionByNonZeros( const SparseMatrix<MT,SO>& sm,
+                                 size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts       > 0UL, "Invalid number of parts" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid granularity"     );
+
+   const size_t n( ( SO )?( (~sm).columns() ):( (~sm).rows() ) );
+
+   size_t total( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      total += (~sm).nonZeros( i );
+   }
+
+   bounds.resize( parts + 1UL );
+   bounds[0UL]   = 0UL;
+   bounds[parts] = n;
+
+   size_t index( 0UL );
+   size_t work ( 0UL );
+
+   for( size_t i=1UL; i<parts; ++i )
+   {
+      const size_t diagonal( ( total * i ) / parts );
+
+      while( index < n ) {
+         const size_t rowWork( 1UL + (~sm).nonZeros( index ) );
+         if( work + rowWork/2UL >= diagonal ) break;
+         work += rowWork;
+         ++index;
+      }
+
+      const size_t bound( ( ( index + granularity/2UL ) / granularity ) * granularity );
+      bounds[i] = max( bounds[i-1UL], min( bound, n ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  VECTOR PARTITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the elements of the given vector for an SMP assignment.
+// \ingroup smp
+//
+// \param rhs The right-hand side vector of the SMP assignment.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// This is the default partitioning of the elements of a vector, which assigns each thread
+// an equal number of elements.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag of the vector
+inline void partitionElements( const Vector<VT,TF>& rhs,
+                               size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionEvenly( (~rhs).size(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the elements of a sparse matrix/dense vector multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/dense vector multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since element \a i of the result is computed from row \a i of the row-major sparse matrix,
+// the elements are partitioned according to the non-zero elements of the sparse matrix.
+*/
+template< typename MT    // Type of the left-hand side sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void partitionElements( const SMatDVecMultExpr<MT,VT>& rhs,
+                               size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the elements of a sparse matrix/sparse vector multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/sparse vector multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since element \a i of the result is computed from row \a i of the row-major sparse matrix,
+// the elements are partitioned according to the non-zero elements of the sparse matrix.
+*/
+template< typename MT    // Type of the left-hand side sparse matrix
+        , typename VT >  // Type of the right-hand side sparse vector
+inline void partitionElements( const SMatSVecMultExpr<MT,VT>& rhs,
+                               size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the elements of a transpose dense vector/sparse matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The transpose dense vector/sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since element \a j of the result is computed from column \a j of the column-major sparse
+// matrix, the elements are partitioned according to the non-zero elements of the sparse matrix.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename MT >  // Type of the right-hand side sparse matrix
+inline void partitionElements( const TDVecTSMatMultExpr<VT,MT>& rhs,
+                               size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.rightOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the elements of a transpose sparse vector/sparse matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The transpose sparse vector/sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since element \a j of the result is computed from column \a j of the column-major sparse
+// matrix, the elements are partitioned according to the non-zero elements of the sparse matrix.
+*/
+template< typename VT    // Type of the left-hand side sparse vector
+        , typename MT >  // Type of the right-hand side sparse matrix
+inline void partitionElements( const TSVecTSMatMultExpr<VT,MT>& rhs,
+                               size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.rightOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the elements of a dense vector/scalar multiplication.
+// \ingroup smp
+//
+// \param rhs The dense vector/scalar multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// The scaling does not change the workload distribution, therefore the partitioning of the
+// scaled vector is used.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , typename ST  // Type of the right-hand side scalar value
+        , bool TF >    // Transpose flag
+inline void partitionElements( const DVecScalarMultExpr<VT,ST,TF>& rhs,
+                               size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionElements( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the elements of a sparse vector/scalar multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse vector/scalar multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// The scaling does not change the workload distribution, therefore the partitioning of the
+// scaled vector is used.
+*/
+template< typename VT  // Type of the left-hand side sparse vector
+        , typename ST  // Type of the right-hand side scalar value
+        , bool TF >    // Transpose flag
+inline void partitionElements( const SVecScalarMultExpr<VT,ST,TF>& rhs,
+                               size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionElements( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX PARTITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of the given matrix for an SMP assignment.
+// \ingroup smp
+//
+// \param rhs The right-hand side matrix of the SMP assignment.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// This is the default partitioning of the rows of a matrix, which assigns each thread an
+// equal number of rows.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline void partitionRows( const Matrix<MT,SO>& rhs,
+                           size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionEvenly( (~rhs).rows(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of the given matrix for an SMP assignment.
+// \ingroup smp
+//
+// \param rhs The right-hand side matrix of the SMP assignment.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// This is the default partitioning of the columns of a matrix, which assigns each thread an
+// equal number of columns.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline void partitionColumns( const Matrix<MT,SO>& rhs,
+                              size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionEvenly( (~rhs).columns(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a sparse matrix/dense matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/dense matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since row \a i of the result is computed from row \a i of the row-major left-hand side
+// sparse matrix, the rows are partitioned according to its non-zero elements.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void partitionRows( const SMatDMatMultExpr<MT1,MT2>& rhs,
+                           size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a sparse matrix/transpose dense matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/transpose dense matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since row \a i of the result is computed from row \a i of the row-major left-hand side
+// sparse matrix, the rows are partitioned according to its non-zero elements.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+inline void partitionRows( const SMatTDMatMultExpr<MT1,MT2>& rhs,
+                           size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a sparse matrix/sparse matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since row \a i of the result is computed from row \a i of the row-major left-hand side
+// sparse matrix, the rows are partitioned according to its non-zero elements.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void partitionRows( const SMatSMatMultExpr<MT1,MT2>& rhs,
+                           size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a sparse matrix/transpose sparse matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/transpose sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since row \a i of the result is computed from row \a i of the row-major left-hand side
+// sparse matrix, the rows are partitioned according to its non-zero elements.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void partitionRows( const SMatTSMatMultExpr<MT1,MT2>& rhs,
+                           size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a dense matrix/transpose sparse matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The dense matrix/transpose sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since column \a j of the result is computed from column \a j of the column-major
+// right-hand side sparse matrix, the columns are partitioned according to its non-zero
+// elements.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void partitionColumns( const DMatTSMatMultExpr<MT1,MT2>& rhs,
+                              size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.rightOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a transpose dense matrix/transpose sparse matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The transpose dense matrix/transpose sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since column \a j of the result is computed from column \a j of the column-major
+// right-hand side sparse matrix, the columns are partitioned according to its non-zero
+// elements.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void partitionColumns( const TDMatTSMatMultExpr<MT1,MT2>& rhs,
+                              size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.rightOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a sparse matrix/transpose sparse matrix multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/transpose sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since column \a j of the result is computed from column \a j of the column-major
+// right-hand side sparse matrix, the columns are partitioned according to its non-zero
+// elements.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void partitionColumns( const SMatTSMatMultExpr<MT1,MT2>& rhs,
+                              size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.rightOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a transpose sparse matrix/transpose sparse matrix
+//        multiplication.
+// \ingroup smp
+//
+// \param rhs The transpose sparse matrix/transpose sparse matrix multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// Since column \a j of the result is computed from column \a j of the column-major
+// right-hand side sparse matrix, the columns are partitioned according to its non-zero
+// elements.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void partitionColumns( const TSMatTSMatMultExpr<MT1,MT2>& rhs,
+                              size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionByNonZeros( rhs.rightOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a dense matrix/scalar multiplication.
+// \ingroup smp
+//
+// \param rhs The dense matrix/scalar multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// The scaling does not change the workload distribution, therefore the partitioning of the
+// scaled matrix is used.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline void partitionRows( const DMatScalarMultExpr<MT,ST,SO>& rhs,
+                           size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionRows( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a sparse matrix/scalar multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/scalar multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// The scaling does not change the workload distribution, therefore the partitioning of the
+// scaled matrix is used.
+*/
+template< typename MT  // Type of the left-hand side sparse matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline void partitionRows( const SMatScalarMultExpr<MT,ST,SO>& rhs,
+                           size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionRows( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a dense matrix/scalar multiplication.
+// \ingroup smp
+//
+// \param rhs The dense matrix/scalar multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// The scaling does not change the workload distribution, therefore the partitioning of the
+// scaled matrix is used.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline void partitionColumns( const DMatScalarMultExpr<MT,ST,SO>& rhs,
+                              size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionColumns( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a sparse matrix/scalar multiplication.
+// \ingroup smp
+//
+// \param rhs The sparse matrix/scalar multiplication expression.
+// \param parts The number of parts.
+// \param granularity The granularity of the part sizes.
+// \param bounds The resulting \a parts+1 bounds of the parts.
+// \return void
+//
+// The scaling does not change the workload distribution, therefore the partitioning of the
+// scaled matrix is used.
+*/
+template< typename MT  // Type of the left-hand side sparse matrix
+        , typename ST  // Type of the right-hand side scalar value
+        , bool SO >    // Storage order
+inline void partitionColumns( const SMatScalarMultExpr<MT,ST,SO>& rhs,
+                              size_t parts, size_t granularity, std::vector<size_t>& bounds )
+{
+   partitionColumns( rhs.leftOperand(), parts, granularity, bounds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,240 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadMapping.h
+//  \brief Header file for the partitioning of SMP matrix operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADMAPPING_H_
+#define _BLAZE_MATH_SMP_THREADMAPPING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Two-dimensional mapping of threads onto a matrix.
+// \ingroup smp
+//
+// The first value specifies the number of thread rows, the second value the number of thread
+// columns of the grid of threads that is mapped onto the target matrix of an SMP assignment.
+*/
+typedef std::pair<size_t,size_t>  ThreadMapping;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the IsSMPReducible type trait.
+// \ingroup smp
+*/
+template< typename MT, bool = IsMatMatMultExpr<MT>::value >
+struct IsSMPReducibleHelper
+{
+   enum { value = 0 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsSMPReducibleHelper class template for matrix/matrix products.
+// \ingroup smp
+*/
+template< typename MT >
+struct IsSMPReducibleHelper<MT,true>
+{
+   enum { value = IsDenseMatrix< typename RemoveReference<typename MT::LeftOperand>::Type  >::value &&
+                  IsDenseMatrix< typename RemoveReference<typename MT::RightOperand>::Type >::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for matrix expressions that can be split along the inner dimension.
+// \ingroup smp
+//
+// This type trait tests whether the given matrix type is a dense matrix/dense matrix
+// multiplication expression, which can be evaluated in parallel by splitting the inner
+// dimension of the product and by reducing the resulting partial products. In case the type
+// is such a product, the \a value member enumeration is set to 1, otherwise it is set to 0.
+*/
+template< typename MT >
+struct IsSMPReducible
+{
+   enum { value = IsSMPReducibleHelper<MT>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD MAPPING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 2D thread mapping for an \f$ M \times N \f$ target matrix.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped onto the matrix.
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \return The resulting 2D thread mapping.
+//
+// This function arranges the given number of threads in a grid of \f$ P \times Q \f$ threads
+// (\f$ P \cdot Q = threads \f$) such that the total size of the operand panels each thread has
+// to read is minimized. For a matrix product with inner dimension \f$ K \f$ each thread reads
+// \f$ K \cdot (M/P + N/Q) \f$ elements, and all threads of a grid column share the same column
+// panel of the right-hand side operand. Therefore tall target matrices result in horizontal
+// strips, wide target matrices in vertical strips, and square matrices in square blocks. If
+// possible, the grid is chosen such that no thread remains without work.
+*/
+inline ThreadMapping createThreadMapping( size_t threads, size_t m, size_t n )
+{
+   ThreadMapping mapping( threads, 1UL );
+   size_t minCost( 0UL );
+   bool   minFits( false );
+
+   for( size_t p=1UL; p<=threads; ++p )
+   {
+      if( threads % p != 0UL )
+         continue;
+
+      const size_t q   ( threads / p );
+      const size_t cost( q*m + p*n );
+      const bool   fits( p <= m && q <= n );
+
+      if( p == 1UL || ( fits && !minFits ) || ( fits == minFits && cost < minCost ) ) {
+         mapping = ThreadMapping( p, q );
+         minCost = cost;
+         minFits = fits;
+      }
+   }
+
+   return mapping;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 2D thread mapping for the given target matrix.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped onto the matrix.
+// \param A The target matrix.
+// \return The resulting 2D thread mapping.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
+{
+   return createThreadMapping( threads, (~A).rows(), (~A).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether splitting the inner dimension of a matrix product is beneficial.
+// \ingroup smp
+//
+// \param threads The total number of threads.
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param k The inner dimension of the matrix product.
+// \return \a true in case the inner dimension should be split, \a false if not.
+//
+// This function decides whether an \f$ M \times N \f$ matrix product with inner dimension
+// \f$ K \f$ should be evaluated by splitting \f$ K \f$ among the threads (2.5D partitioning)
+// instead of the 2D partitioning of the target matrix. Each thread then computes a full
+// \f$ M \times N \f$ partial product, which have to be reduced afterwards. This pays off for
+// small target matrices in combination with a large inner dimension, where the 2D partitioning
+// leaves too little work per block and forces every thread to read entire operand panels.
+*/
+inline bool isReductionBeneficial( size_t threads, size_t m, size_t n, size_t k )
+{
+   if( threads < 2UL || k < 2UL*threads )
+      return false;
+
+   const ThreadMapping mapping( createThreadMapping( threads, m, n ) );
+
+   const size_t mt( ( m + mapping.first  - 1UL ) / mapping.first  );
+   const size_t nt( ( n + mapping.second - 1UL ) / mapping.second );
+   const size_t kt( ( k + threads - 1UL ) / threads );
+
+   const size_t gridCost     ( k*( mt + nt ) + mt*nt );
+   const size_t reductionCost( kt*( m + n ) + threads*m*n );
+
+   return reductionCost < gridCost;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,211 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/AsyncAssign.h
+//  \brief Header file for the default asynchronous assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_DEFAULT_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCHANDLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle to an asynchronous assignment.
+// \ingroup smp
+//
+// The AsyncHandle class represents the result of an asynchronous assignment (see the
+// asyncAssign() functions). Note that in case no thread-based parallelization is active, all
+// assignments are executed immediately and therefore all handles are ready. Any exception
+// thrown during an assignment is propagated directly by the asyncAssign() function.
+*/
+class AsyncHandle
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline AsyncHandle();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait() const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for AsyncHandle.
+*/
+inline AsyncHandle::AsyncHandle()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the assignment has been completed.
+//
+// \return \a true since the assignment has always been completed.
+*/
+inline bool AsyncHandle::isReady() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of the assignment.
+//
+// \return void
+//
+// Since the assignment has always been completed, this function returns immediately.
+*/
+inline void AsyncHandle::wait() const
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+inline AsyncHandle asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline AsyncHandle asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+inline void waitAll( const std::vector<AsyncHandle>& handles );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return Handle to the asynchronous assignment.
+//
+// Note that in case no thread-based parallelization is active, the assignment is executed
+// immediately. Any exception thrown during the assignment is propagated to the caller.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline AsyncHandle asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   ~lhs = ~rhs;
+   return AsyncHandle();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return Handle to the asynchronous assignment.
+//
+// Note that in case no thread-based parallelization is active, the assignment is executed
+// immediately. Any exception thrown during the assignment is propagated to the caller.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline AsyncHandle asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   ~lhs = ~rhs;
+   return AsyncHandle();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of all given asynchronous assignments.
+// \ingroup smp
+//
+// \param handles The handles to the asynchronous assignments.
+// \return void
+//
+// Since all assignments have been completed by the asyncAssign() functions, this function
+// returns immediately.
+*/
+inline void waitAll( const std::vector<AsyncHandle>& handles )
+{
+   UNUSED_PARAMETER( handles );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
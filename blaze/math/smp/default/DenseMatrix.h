@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -72,6 +73,18 @@ inline typename EnableIf< IsDenseMatrix<MT1> >::Type
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline typename EnableIf< IsDenseMatrix<MT1> >::Type
    smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO, typename Type >
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const Type& value );
+
+template< typename MT, bool SO >
+inline void smpTranspose( DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline void smpCTranspose( DenseMatrix<MT,SO>& dm );
+
+template< bool Conj, typename Type >
+inline void smpTransposeContiguous( ContiguousTransposition<Conj,Type>& kernel );
 //@}
 //*************************************************************************************************
 
@@ -171,6 +184,126 @@ inline typename EnableIf< IsDenseMatrix<MT1> >::Type
 
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP homogeneous initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The initial value for all elements of the dense matrix.
+// \return void
+//
+// This function implements the default SMP homogeneous initialization of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename MT      // Type of the left-hand side dense matrix
+        , bool SO          // Storage order of the left-hand side dense matrix
+        , typename Type >  // Type of the initial value
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) = value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP in-place transposition of a square dense matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function implements the default SMP in-place transposition of a square dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c transpose() member function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void smpTranspose( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() == (~dm).columns(), "Non-square matrix detected" );
+
+   transposeSquare<false>( (~dm).data(), (~dm).rows(), (~dm).spacing(), 0UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP in-place conjugate transposition of a square dense
+//        matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function implements the default SMP in-place conjugate transposition of a square dense
+// matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c ctranspose() member function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void smpCTranspose( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() == (~dm).columns(), "Non-square matrix detected" );
+
+   transposeSquare<true>( (~dm).data(), (~dm).rows(), (~dm).spacing(), 0UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP in-place (conjugate) transposition of a contiguous
+//        non-square matrix.
+// \ingroup smp
+//
+// \param kernel The transposition kernel of the contiguous matrix.
+// \return void
+//
+// This function implements the default SMP in-place (conjugate) transposition of a contiguous
+// non-square matrix by serially performing all passes of the given transposition kernel.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c transpose() or \c ctranspose() member function.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+inline void smpTransposeContiguous( ContiguousTransposition<Conj,Type>& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t pass=0UL; pass<kernel.passes(); ++pass ) {
+      kernel.select( pass );
+      for( size_t k=0UL; k<kernel.blocks(); ++k )
+         kernel( k );
+   }
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
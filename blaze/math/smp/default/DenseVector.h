@@ -76,6 +76,9 @@ inline typename EnableIf< IsDenseVector<VT1> >::Type
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline typename EnableIf< IsDenseVector<VT1> >::Type
    smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF, typename Type >
+inline void smpFill( DenseVector<VT,TF>& lhs, const Type& value );
 //@}
 //*************************************************************************************************
 
@@ -198,6 +201,34 @@ inline typename EnableIf< IsDenseVector<VT1> >::Type
 
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP homogeneous initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The initial value for all elements of the dense vector.
+// \return void
+//
+// This function implements the default SMP homogeneous initialization of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename VT      // Type of the left-hand side dense vector
+        , bool TF          // Transpose flag of the left-hand side dense vector
+        , typename Type >  // Type of the initial value
+inline void smpFill( DenseVector<VT,TF>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) = value;
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
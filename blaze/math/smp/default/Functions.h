@@ -132,6 +132,40 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 
 
 
+//=================================================================================================
+//
+//  SMP LOOP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of a parallel loop.
+// \ingroup smp
+//
+// \param n The total number of loop iterations.
+// \param op The loop body to be executed.
+// \return void
+//
+// This function executes the loop body \a op for all iterations \f$ [0..n-1] \f$, i.e. it calls
+// \c op(k) for each index \a k. The iterations are required to be independent of each other.
+// Since no parallelization is active, all iterations are executed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// processing of independent blocks of work. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename OP >  // Type of the loop body
+inline void smpFor( size_t n, OP& op )
+{
+   for( size_t k=0UL; k<n; ++k )
+      op( k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -0,0 +1,212 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/ThreadContext.h
+//  \brief Header file for the default thread contexts
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_THREADCONTEXT_H_
+#define _BLAZE_MATH_SMP_DEFAULT_THREADCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS THREADCONTEXT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Independent team of threads for the parallel operations of a single thread.
+// \ingroup smp
+//
+// The ThreadContext class represents a team of threads, which can be bound to a thread by means
+// of a ThreadContextScope. Note that in case no parallelization is active, the context has no
+// effect and all operations are executed serially.
+*/
+class ThreadContext : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ThreadContext( size_t n );
+   explicit inline ThreadContext( size_t n, const std::vector<size_t>& cpus );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXT CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a context with \a n threads.
+//
+// \param n The number of threads of the context \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+inline ThreadContext::ThreadContext( size_t n )
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a context with \a n threads pinned to the given CPUs.
+//
+// \param n The number of threads of the context \f$[1..\infty)\f$.
+// \param cpus The list of CPUs the threads are pinned to (no effect).
+// \exception std::invalid_argument Invalid number of threads.
+// \exception std::invalid_argument Invalid list of CPUs.
+*/
+inline ThreadContext::ThreadContext( size_t n, const std::vector<size_t>& cpus )
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   if( cpus.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid list of CPUs" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXT UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the context.
+//
+// \return The number of threads of the context.
+//
+// Note that in case no parallelization is active the function will always return 1.
+*/
+inline size_t ThreadContext::size() const
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS THREADCONTEXTSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope for the binding of a thread context to the calling thread.
+// \ingroup smp
+//
+// The ThreadContextScope class binds the given ThreadContext to the calling thread for the
+// lifetime of the scope object. Note that in case no parallelization is active, the scope has
+// no effect.
+*/
+class ThreadContextScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ThreadContextScope( ThreadContext& context );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXTSCOPE CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the given context to the calling thread.
+//
+// \param context The context to be bound to the calling thread.
+*/
+inline ThreadContextScope::ThreadContextScope( ThreadContext& context )
+{
+   UNUSED_PARAMETER( context );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
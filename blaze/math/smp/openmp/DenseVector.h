@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <omp.h>
+#include <vector>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/DenseSubvector.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -48,6 +49,7 @@
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partitioning.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/SparseSubvector.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
@@ -55,6 +57,7 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
@@ -109,22 +112,20 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          assign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -177,19 +178,19 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       assign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -271,12 +272,14 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
       }
       else {
 #pragma omp parallel shared( lhs, rhs )
-         smpAssign_backend( ~lhs, ~rhs );
+         BLAZE_PARALLEL_SECTION {
+            smpAssign_backend( ~lhs, ~rhs );
+         }
       }
    }
 }
@@ -328,22 +331,20 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          addAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -396,19 +397,19 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       addAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -490,12 +491,14 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
       }
       else {
 #pragma omp parallel shared( lhs, rhs )
-         smpAddAssign_backend( ~lhs, ~rhs );
+         BLAZE_PARALLEL_SECTION {
+            smpAddAssign_backend( ~lhs, ~rhs );
+         }
       }
    }
 }
@@ -547,22 +550,20 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          subAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -615,19 +616,19 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -709,12 +710,14 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
       }
       else {
 #pragma omp parallel shared( lhs, rhs )
-         smpSubAssign_backend( ~lhs, ~rhs );
+         BLAZE_PARALLEL_SECTION {
+            smpSubAssign_backend( ~lhs, ~rhs );
+         }
       }
    }
 }
@@ -767,22 +770,20 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          multAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -836,19 +837,19 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int threads( omp_get_num_threads() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -930,12 +931,163 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          multAssign( ~lhs, ~rhs );
       }
       else {
 #pragma omp parallel shared( lhs, rhs )
-         smpMultAssign_backend( ~lhs, ~rhs );
+         BLAZE_PARALLEL_SECTION {
+            smpMultAssign_backend( ~lhs, ~rhs );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HOMOGENEOUS INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP homogeneous initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The initial value for all elements of the dense vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP homogeneous
+// initialization of a dense vector. The vector is partitioned in the same way as by the SMP
+// assignment. In contrast to the SMP assignment the partitions are statically mapped to the
+// threads of the OpenMP team in order to achieve a deterministic first touch of the according
+// memory pages.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename VT      // Type of the left-hand side dense vector
+        , bool TF          // Transpose flag of the left-hand side dense vector
+        , typename Type >  // Type of the initial value
+void smpFill_backend( DenseVector<VT,TF>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename VT::ElementType>         IT;
+   typedef typename SubvectorExprTrait<VT,aligned>::Type    AlignedTarget;
+   typedef typename SubvectorExprTrait<VT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( VT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+#pragma omp for schedule(static) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      if( vectorizable && lhsAligned ) {
+         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
+         target = value;
+      }
+      else {
+         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+         target = value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP homogeneous initialization of a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The initial value for all elements of the dense vector.
+// \return void
+//
+// This function implements the default OpenMP-based SMP homogeneous initialization of a dense
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename VT      // Type of the left-hand side dense vector
+        , bool TF          // Transpose flag of the left-hand side dense vector
+        , typename Type >  // Type of the initial value
+inline typename DisableIf< IsSMPAssignable<VT> >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP homogeneous initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The initial value for all elements of the dense vector.
+// \return void
+//
+// This function performs the OpenMP-based SMP homogeneous initialization of a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case the dense vector is SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename VT      // Type of the left-hand side dense vector
+        , bool TF          // Transpose flag of the left-hand side dense vector
+        , typename Type >  // Type of the initial value
+inline typename EnableIf< IsSMPAssignable<VT> >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT::ElementType );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+         (~lhs) = value;
+      }
+      else {
+         #pragma omp parallel shared( lhs, value )
+         BLAZE_PARALLEL_SECTION {
+            smpFill_backend( ~lhs, value );
+         }
       }
    }
 }
@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <omp.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Exception.h>
@@ -88,7 +90,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
@@ -133,6 +135,55 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 
 
 
+//=================================================================================================
+//
+//  SMP LOOP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based implementation of a parallel loop.
+// \ingroup smp
+//
+// \param n The total number of loop iterations.
+// \param op The loop body to be executed.
+// \return void
+//
+// This function executes the loop body \a op for all iterations \f$ [0..n-1] \f$, i.e. it calls
+// \c op(k) for each index \a k. The iterations are required to be independent of each other.
+// The iterations are dynamically distributed among the OpenMP threads.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// processing of independent blocks of work. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename OP >  // Type of the loop body
+inline void smpFor( size_t n, OP& op )
+{
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isParallelSectionNested() || isSerialSectionActive() || n < 2UL ) {
+         for( size_t k=0UL; k<n; ++k )
+            op( k );
+      }
+      else {
+         const int iterations( static_cast<int>( n ) );
+#pragma omp parallel shared( op )
+         BLAZE_PARALLEL_SECTION
+         {
+#pragma omp for schedule(dynamic,1)
+            for( int k=0; k<iterations; ++k )
+               op( static_cast<size_t>( k ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -0,0 +1,288 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/ThreadContext.h
+//  \brief Header file for the OpenMP-based thread contexts
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_THREADCONTEXT_H_
+#define _BLAZE_MATH_SMP_OPENMP_THREADCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <omp.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS THREADCONTEXT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Independent team of threads for the OpenMP parallel operations of a single thread.
+// \ingroup smp
+//
+// The ThreadContext class represents a team of \a n threads, which can be bound to a thread by
+// means of a ThreadContextScope. All operations issued by this thread within the scope use at
+// most \a n threads:
+
+   \code
+   // Setup of a context with four threads for each request thread
+   blaze::ThreadContext context( 4UL );
+
+   // Processing a request
+   {
+      blaze::ThreadContextScope scope( context );
+      C = A * B;  // Executed by four OpenMP threads
+   }
+   \endcode
+
+// Since the OpenMP runtime maintains an independent team of threads for every thread that
+// encounters a parallel region, the operations of different threads don't interfere with each
+// other. Note that in the OpenMP parallelization the pinning of the threads is controlled by
+// the \c OMP_PLACES and \c OMP_PROC_BIND environment variables. Therefore the given list of
+// CPUs has no effect.
+*/
+class ThreadContext : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ThreadContext( size_t n );
+   explicit inline ThreadContext( size_t n, const std::vector<size_t>& cpus );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;  //!< The number of threads of the context.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXT CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a context with \a n threads.
+//
+// \param n The number of threads of the context \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+inline ThreadContext::ThreadContext( size_t n )
+   : size_( n )  // The number of threads of the context
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a context with \a n threads pinned to the given CPUs.
+//
+// \param n The number of threads of the context \f$[1..\infty)\f$.
+// \param cpus The list of CPUs the threads are pinned to (no effect).
+// \exception std::invalid_argument Invalid number of threads.
+// \exception std::invalid_argument Invalid list of CPUs.
+*/
+inline ThreadContext::ThreadContext( size_t n, const std::vector<size_t>& cpus )
+   : size_( n )  // The number of threads of the context
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   if( cpus.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid list of CPUs" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXT UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the context.
+//
+// \return The number of threads of the context.
+*/
+inline size_t ThreadContext::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS THREADCONTEXTSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope for the binding of a thread context to the calling thread.
+// \ingroup smp
+//
+// The ThreadContextScope class binds the given ThreadContext to the calling thread for the
+// lifetime of the scope object by adapting the number of OpenMP threads of the calling thread.
+// Scopes can be nested, in which case the innermost scope is active.
+*/
+class ThreadContextScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ThreadContextScope( ThreadContext& context );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ThreadContextScope();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   int previous_;  //!< The number of threads of the calling thread before the scope.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXTSCOPE CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the given context to the calling thread.
+//
+// \param context The context to be bound to the calling thread.
+*/
+inline ThreadContextScope::ThreadContextScope( ThreadContext& context )
+   : previous_( omp_get_max_threads() )  // The previous number of threads
+{
+   omp_set_num_threads( static_cast<int>( context.size() ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXTSCOPE DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Restores the previous number of threads of the calling thread.
+*/
+inline ThreadContextScope::~ThreadContextScope()
+{
+   omp_set_num_threads( previous_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,887 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/AsyncAssign.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <condition_variable>
+#  include <mutex>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/thread/condition.hpp>
+#  include <boost/thread/mutex.hpp>
+#endif
+
+#include <exception>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/SparseSubvector.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class for all asynchronous assignments.
+// \ingroup smp
+//
+// The AsyncAssignment class represents an assignment in flight, i.e. an assignment that has
+// been scheduled for execution but may not have been completed yet. It provides the means to
+// wait for the completion of the assignment and keeps track of all assignments in flight in
+// order to detect read/write conflicts between them.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+class AsyncAssignment : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   typedef std::mutex                          Mutex;      //!< Type of the mutex.
+   typedef std::unique_lock<std::mutex>        Lock;       //!< Type of a locking object.
+   typedef std::condition_variable             Condition;  //!< Condition variable type.
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+   typedef boost::mutex                        Mutex;      //!< Type of the mutex.
+   typedef boost::unique_lock<boost::mutex>    Lock;       //!< Type of a locking object.
+   typedef boost::condition_variable           Condition;  //!< Condition variable type.
+#endif
+
+   typedef boost::shared_ptr<AsyncAssignment>  Pointer;    //!< Handle to an assignment.
+   typedef std::vector<Pointer>                Pointers;   //!< List of assignments.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline AsyncAssignment( const void* target );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   virtual inline ~AsyncAssignment();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait() const;
+   inline void run();
+
+   static inline void schedule( const Pointer& assignment );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class Executor**********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of an asynchronous assignment.
+   */
+   struct Executor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Executor class.
+      //
+      // \param assignment The assignment to be executed.
+      */
+      explicit inline Executor( const Pointer& assignment )
+         : assignment_( assignment )  // The assignment to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the assignment.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         assignment_->run();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Pointer assignment_;  //!< The assignment to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Assignment functions************************************************************************
+   /*!\name Assignment functions */
+   //@{
+   virtual void prepare() = 0;
+   virtual void execute() = 0;
+   virtual bool reads( const void* container ) const = 0;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool conflicts( const AsyncAssignment& other ) const;
+   inline void complete() const;
+
+   static inline Mutex&    registryMutex();
+   static inline Pointers& registry();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const void* target_;           //!< The target container of the assignment.
+   bool done_;                    //!< Completion flag of the assignment.
+   std::exception_ptr error_;     //!< The exception thrown during the assignment (if any).
+   mutable Mutex mutex_;          //!< Synchronization mutex.
+   mutable Condition completed_;  //!< Wait condition for the completion of the assignment.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the AsyncAssignment class.
+//
+// \param target The target container of the assignment.
+*/
+inline AsyncAssignment::AsyncAssignment( const void* target )
+   : target_( target )  // The target container of the assignment
+   , done_  ( false  )  // Completion flag of the assignment
+   , error_ ()          // The exception thrown during the assignment
+   , mutex_ ()          // Synchronization mutex
+   , completed_()       // Wait condition for the completion of the assignment
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Destructor for the AsyncAssignment class.
+*/
+inline AsyncAssignment::~AsyncAssignment()
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the assignment has been completed.
+//
+// \return \a true if the assignment has been completed, \a false if not.
+*/
+inline bool AsyncAssignment::isReady() const
+{
+   Lock lock( mutex_ );
+   return done_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waits for the completion of the assignment.
+//
+// \return void
+//
+// This function blocks until the assignment has been completed. In case an exception has been
+// thrown during the assignment, the exception is rethrown.
+*/
+inline void AsyncAssignment::wait() const
+{
+   complete();
+
+   if( error_ ) {
+      std::rethrow_exception( error_ );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the assignment.
+//
+// \return void
+//
+// This function executes the assignment, removes it from the list of assignments in flight and
+// signals its completion. Any exception thrown during the assignment is stored and rethrown by
+// the wait() function. In case the preparation of the assignment has already failed, the
+// assignment is not executed.
+*/
+inline void AsyncAssignment::run()
+{
+   if( !error_ ) {
+      try {
+         execute();
+      }
+      catch( ... ) {
+         error_ = std::current_exception();
+      }
+   }
+
+   {
+      Lock lock( registryMutex() );
+      Pointers& assignments( registry() );
+
+      for( Pointers::iterator it=assignments.begin(); it!=assignments.end(); ++it ) {
+         if( it->get() == this ) {
+            assignments.erase( it );
+            break;
+         }
+      }
+   }
+
+   Lock lock( mutex_ );
+   done_ = true;
+   completed_.notify_all();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schedules the given assignment for execution.
+//
+// \param assignment The assignment to be scheduled.
+// \return void
+//
+// This function schedules the given assignment for execution on the thread backend. In case
+// the assignment conflicts with any assignment in flight (i.e. in case both assignments write
+// to the same container or one assignment reads the target container of the other), the
+// function blocks until all conflicting assignments have been completed. Therefore the result
+// of a sequence of asynchronous assignments is the same as for a sequence of synchronous
+// assignments. Afterwards the assignment is prepared by the calling thread, i.e. its target
+// container is resized before the function returns. Any exception thrown during the preparation
+// is stored and rethrown by the wait() function. Note that in case the persistent thread team
+// is selected (see the BLAZE_USE_THREAD_TEAM switch) the assignment is executed immediately.
+*/
+inline void AsyncAssignment::schedule( const Pointer& assignment )
+{
+   Pointers conflicting;
+
+   {
+      Lock lock( registryMutex() );
+      Pointers& assignments( registry() );
+
+      for( Pointers::const_iterator it=assignments.begin(); it!=assignments.end(); ++it ) {
+         if( assignment->conflicts( **it ) )
+            conflicting.push_back( *it );
+      }
+
+      assignments.push_back( assignment );
+   }
+
+   for( Pointers::const_iterator it=conflicting.begin(); it!=conflicting.end(); ++it ) {
+      (*it)->complete();
+   }
+
+   try {
+      assignment->prepare();
+   }
+   catch( ... ) {
+      assignment->error_ = std::current_exception();
+   }
+
+#if BLAZE_THREAD_TEAM_MODE
+   assignment->run();
+#else
+   TheThreadBackend::scheduleTask( Executor( assignment ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the assignment conflicts with the given assignment.
+//
+// \param other The other assignment.
+// \return \a true in case the assignments conflict, \a false if not.
+*/
+inline bool AsyncAssignment::conflicts( const AsyncAssignment& other ) const
+{
+   return ( target_ == other.target_ ) || reads( other.target_ ) || other.reads( target_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocks until the assignment has been completed.
+//
+// \return void
+*/
+inline void AsyncAssignment::complete() const
+{
+   Lock lock( mutex_ );
+
+   while( !done_ ) {
+      completed_.wait( lock );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the mutex protecting the list of assignments in flight.
+//
+// \return Reference to the mutex.
+*/
+inline AsyncAssignment::Mutex& AsyncAssignment::registryMutex()
+{
+   static Mutex mutex;
+   return mutex;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the list of assignments in flight.
+//
+// \return Reference to the list of assignments in flight.
+*/
+inline AsyncAssignment::Pointers& AsyncAssignment::registry()
+{
+   static Pointers assignments;
+   return assignments;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE ASYNCASSIGNER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Asynchronous assignment of an expression to a vector or matrix.
+// \ingroup smp
+//
+// The AsyncAssigner class template represents the asynchronous assignment of the source
+// operand of type \a Source to the target container of type \a Target. Expressions are stored
+// by value, all other operands are stored by reference. The target container is resized by
+// the scheduling thread, the executing thread only assigns the elements via a view on the
+// entire target container.
+*/
+template< typename Target    // Type of the target container
+        , typename Source >  // Type of the source operand
+class AsyncAssigner : public AsyncAssignment
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Storage type of the source operand.
+   typedef typename If< IsExpression<Source>, const Source, const Source& >::Type  Operand;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssigner class template.
+   //
+   // \param target The target container to be assigned to.
+   // \param source The source operand to be assigned to the target.
+   */
+   explicit inline AsyncAssigner( Target& target, const Source& source )
+      : AsyncAssignment( &target )  // Initialization of the base class
+      , target_  ( target )         // The target container
+      , source_  ( source )         // The source operand
+      , assigned_( false  )         // Flag for an assignment performed during the preparation
+   {}
+   //**********************************************************************************************
+
+ private:
+   //**Assignment functions************************************************************************
+   /*!\brief Resizes the target container to the size of the source operand.
+   //
+   // \return void
+   // \exception std::invalid_argument Invalid size of the target container.
+   //
+   // In case the size of the target container changes and the source operand might alias the
+   // target, the assignment is performed immediately since the resize operation would destroy
+   // the values of the source operand.
+   */
+   virtual void prepare() {
+      if( !hasSize( target_, source_ ) && source_.canAlias( &target_ ) ) {
+         target_   = source_;
+         assigned_ = true;
+      }
+      else {
+         resizeTo( target_, source_ );
+      }
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Performs the assignment.
+   //
+   // \return void
+   */
+   virtual void execute() {
+      if( !assigned_ ) {
+         assignTo( target_, source_ );
+      }
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the source operand reads the given container.
+   //
+   // \param container The container to be checked.
+   // \return \a true in case the container is read by the assignment, \a false if not.
+   */
+   virtual bool reads( const void* container ) const {
+      return source_.isAliased( container );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns whether the target vector has the size of the source operand.
+   //
+   // \param target The target vector.
+   // \param source The source operand.
+   // \return \a true in case the sizes match, \a false if not.
+   */
+   template< typename VT  // Type of the target vector
+           , bool TF >    // Transpose flag of the target vector
+   static inline bool hasSize( const Vector<VT,TF>& target, const Operand& source ) {
+      return (~target).size() == source.size();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the target matrix has the size of the source operand.
+   //
+   // \param target The target matrix.
+   // \param source The source operand.
+   // \return \a true in case the sizes match, \a false if not.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   static inline bool hasSize( const Matrix<MT,SO>& target, const Operand& source ) {
+      return (~target).rows() == source.rows() && (~target).columns() == source.columns();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Resizes the target vector to the size of the source operand.
+   //
+   // \param target The target vector.
+   // \param source The source operand.
+   // \return void
+   // \exception std::invalid_argument Vector cannot be resized.
+   */
+   template< typename VT  // Type of the target vector
+           , bool TF >    // Transpose flag of the target vector
+   static inline void resizeTo( Vector<VT,TF>& target, const Operand& source ) {
+      resize( ~target, source.size(), false );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Resizes the target matrix to the size of the source operand.
+   //
+   // \param target The target matrix.
+   // \param source The source operand.
+   // \return void
+   // \exception std::invalid_argument Matrix cannot be resized.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   static inline void resizeTo( Matrix<MT,SO>& target, const Operand& source ) {
+      resize( ~target, source.rows(), source.columns(), false );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Assigns the source operand to a view on the entire target vector.
+   //
+   // \param target The target vector.
+   // \param source The source operand.
+   // \return void
+   //
+   // In contrast to the assignment to the target vector itself, the assignment to the view
+   // doesn't modify the size of the target vector.
+   */
+   template< typename VT  // Type of the target vector
+           , bool TF >    // Transpose flag of the target vector
+   static inline void assignTo( Vector<VT,TF>& target, const Operand& source ) {
+      typename SubvectorExprTrait<VT,unaligned>::Type view(
+         subvector<unaligned>( ~target, 0UL, (~target).size() ) );
+      view = source;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Assigns the source operand to a view on the entire target matrix.
+   //
+   // \param target The target matrix.
+   // \param source The source operand.
+   // \return void
+   //
+   // In contrast to the assignment to the target matrix itself, the assignment to the view
+   // doesn't modify the size of the target matrix.
+   */
+   template< typename MT  // Type of the target matrix
+           , bool SO >    // Storage order of the target matrix
+   static inline void assignTo( Matrix<MT,SO>& target, const Operand& source ) {
+      typename SubmatrixExprTrait<MT,unaligned>::Type view(
+         submatrix<unaligned>( ~target, 0UL, 0UL, (~target).rows(), (~target).columns() ) );
+      view = source;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Target& target_;  //!< The target container.
+   Operand source_;  //!< The source operand.
+   bool assigned_;   //!< Flag for an assignment performed during the preparation.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( Target );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCHANDLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle to an asynchronous assignment.
+// \ingroup smp
+//
+// The AsyncHandle class represents the result of an asynchronous assignment (see the
+// asyncAssign() functions). It provides the functionality to query whether the assignment has
+// been completed and to wait for its completion. Handles can be copied freely; all copies refer
+// to the same assignment. A default constructed handle doesn't refer to any assignment and is
+// always ready.
+*/
+class AsyncHandle
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline AsyncHandle();
+   explicit inline AsyncHandle( const boost::shared_ptr<AsyncAssignment>& assignment );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   boost::shared_ptr<AsyncAssignment> assignment_;  //!< The referenced assignment.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for AsyncHandle.
+*/
+inline AsyncHandle::AsyncHandle()
+   : assignment_()  // The referenced assignment
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a handle to the given assignment.
+//
+// \param assignment The referenced assignment.
+*/
+inline AsyncHandle::AsyncHandle( const boost::shared_ptr<AsyncAssignment>& assignment )
+   : assignment_( assignment )  // The referenced assignment
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the assignment has been completed.
+//
+// \return \a true if the assignment has been completed, \a false if not.
+*/
+inline bool AsyncHandle::isReady() const
+{
+   return !assignment_ || assignment_->isReady();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of the assignment.
+//
+// \return void
+//
+// This function blocks until the assignment has been completed. In case an exception has been
+// thrown during the assignment, the exception is rethrown.
+*/
+inline void AsyncHandle::wait() const
+{
+   if( assignment_ )
+      assignment_->wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+inline AsyncHandle asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline AsyncHandle asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+inline void waitAll( const std::vector<AsyncHandle>& handles );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return Handle to the asynchronous assignment.
+//
+// This function schedules the assignment of the given right-hand side vector (or vector
+// expression) to the given left-hand side vector for execution on the thread backend and
+// returns immediately. Several independent assignments can be in flight at the same time;
+// each one of them is executed by a single thread of the backend:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y, z, w;
+   // ... Initialization
+
+   std::vector<blaze::AsyncHandle> handles;
+   handles.push_back( blaze::asyncAssign( y, A * x ) );
+   handles.push_back( blaze::asyncAssign( z, B * x ) );
+   // ... Work overlapping with the two assignments
+
+   blaze::waitAll( handles );
+   w = y + z;
+   \endcode
+
+// Assignments in flight are checked for read/write conflicts: In case the new assignment writes
+// to a vector or matrix that is read or written by an assignment in flight or in case it reads
+// the target of an assignment in flight, the function blocks until the conflicting assignments
+// have been completed. Afterwards the target vector is resized to the size of the right-hand
+// side vector before the function returns, i.e. only the values of the target vector are
+// assigned asynchronously. Therefore the sizes of all targets of assignments in flight are
+// final and expressions involving these targets (as for instance \c y + \c z) can be created
+// and used as operands of further asynchronous assignments. In case the target vector cannot
+// be resized, the according \a std::invalid_argument exception is rethrown by the wait() and
+// waitAll() functions. In case the size of the target vector changes and the
+// right-hand side vector might alias the target, the assignment is executed immediately. Note
+// that plain (synchronous) operations are not checked. Until the assignment has been completed,
+// the values of the target vector must not be accessed and none of the operands of the
+// expression must be modified or destroyed. Also note that in case the persistent thread team
+// is selected (see the BLAZE_USE_THREAD_TEAM switch) the assignment is executed immediately.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline AsyncHandle asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   const boost::shared_ptr<AsyncAssignment> assignment(
+      new AsyncAssigner<VT1,VT2>( ~lhs, ~rhs ) );
+
+   AsyncAssignment::schedule( assignment );
+
+   return AsyncHandle( assignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return Handle to the asynchronous assignment.
+//
+// This function schedules the assignment of the given right-hand side matrix (or matrix
+// expression) to the given left-hand side matrix for execution on the thread backend and
+// returns immediately. For more details see the asyncAssign() function for vectors.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline AsyncHandle asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   const boost::shared_ptr<AsyncAssignment> assignment(
+      new AsyncAssigner<MT1,MT2>( ~lhs, ~rhs ) );
+
+   AsyncAssignment::schedule( assignment );
+
+   return AsyncHandle( assignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of all given asynchronous assignments.
+// \ingroup smp
+//
+// \param handles The handles to the asynchronous assignments.
+// \return void
+//
+// This function blocks until all given assignments have been completed. In case an exception
+// has been thrown during any of the assignments, the first such exception is rethrown after
+// all assignments have been completed.
+*/
+inline void waitAll( const std::vector<AsyncHandle>& handles )
+{
+   std::exception_ptr error;
+
+   for( std::vector<AsyncHandle>::const_iterator it=handles.begin(); it!=handles.end(); ++it ) {
+      try {
+         it->wait();
+      }
+      catch( ... ) {
+         if( !error ) error = std::current_exception();
+      }
+   }
+
+   if( error ) {
+      std::rethrow_exception( error );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
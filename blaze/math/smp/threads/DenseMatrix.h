@@ -40,22 +40,29 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/DenseSubmatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partitioning.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsRestricted.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
@@ -64,6 +71,7 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -76,74 +84,113 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a row-major dense matrix to a
-//        dense matrix.
+/*!\brief Default backend of the C++11/Boost thread-based SMP reduction assignment of a dense matrix to
+//        a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be assigned.
-// \return void
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return \a false to indicate that no assignment has been performed.
 //
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a row-major dense matrix to a dense matrix.\n
+// This function is selected for all dense matrices that cannot be split along the inner
+// dimension of a matrix/matrix multiplication. It performs no assignment and returns \a false.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
 template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline typename DisableIf< IsSMPReducible<MT2>, bool >::Type
+   smpReduceAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction assignment of a dense matrix/dense
+//        matrix multiplication to a dense matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return \a true in case the assignment has been performed, \a false if not.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// dense matrix/dense matrix multiplication \f$ C = A \cdot B \f$ by means of a split of the
+// inner dimension (2.5D partitioning): each thread computes the partial product
+// \f$ A(:,k_t) \cdot B(k_t,:) \f$ for its share \f$ k_t \f$ of the inner dimension, and the
+// partial products are afterwards reduced into the target matrix. This is only done in case
+// isReductionBeneficial() reports a benefit in comparison to the 2D partitioning of the
+// target matrix, i.e. for small target matrices and large inner dimensions. Otherwise the
+// function returns \a false without performing the assignment.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline typename EnableIf< IsSMPReducible<MT2>, bool >::Type
+   smpReduceAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   typedef typename MT2::ElementType                               ET;
+   typedef DynamicMatrix<ET,SO1>                                   PartialType;
+   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type        Target;
+   typedef typename SubmatrixExprTrait<PartialType,aligned>::Type  PartialTarget;
 
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
+   if( IsRestricted<MT1>::value )
+      return false;
 
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   const size_t threads( TheThreadBackend::size() );
+   const size_t m( (~rhs).rows() );
+   const size_t n( (~rhs).columns() );
+   const size_t k( (~rhs).leftOperand().columns() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   if( !isReductionBeneficial( threads, m, n, k ) )
+      return false;
 
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
+   const size_t addon     ( ( ( k % threads ) != 0UL )? 1UL : 0UL );
+   const size_t kPerThread( k / threads + addon );
+   const size_t slices    ( ( k + kPerThread - 1UL ) / kPerThread );
 
-      if( row >= (~lhs).rows() )
-         continue;
+   std::vector<PartialType> partials( slices - 1UL );
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+   Target target( submatrix<unaligned>( ~lhs, 0UL, 0UL, m, n ) );
+   TheThreadBackend::scheduleAssign( target, submatrix( (~rhs).leftOperand(), 0UL, 0UL, m, kPerThread ) *
+                                             submatrix( (~rhs).rightOperand(), 0UL, 0UL, kPerThread, n ) );
 
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
+   for( size_t i=1UL; i<slices; ++i )
+   {
+      const size_t index( i*kPerThread );
+      const size_t kk( min( kPerThread, k - index ) );
+
+      partials[i-1UL].resize( m, n, false );
+
+      PartialTarget partial( submatrix<aligned>( partials[i-1UL], 0UL, 0UL, m, n ) );
+      TheThreadBackend::scheduleAssign( partial, submatrix( (~rhs).leftOperand(), 0UL, index, m, kk ) *
+                                                 submatrix( (~rhs).rightOperand(), index, 0UL, kk, n ) );
    }
 
    TheThreadBackend::wait();
+
+   for( size_t i=0UL; i<partials.size(); ++i ) {
+      addAssign( ~lhs, partials[i] );
+   }
+
+   return true;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -151,30 +198,40 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a column-major dense matrix
-//        to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a dense matrix to a dense
+//        matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be assigned.
+// \param rhs The right-hand side dense matrix to be assigned.
 // \return void
 //
-// This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a column-major dense matrix to a dense matrix.\n
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of
+// a dense matrix to a dense matrix. The target matrix is partitioned into a 2D grid of blocks,
+// whose shape is chosen by createThreadMapping() with respect to the size of the target matrix,
+// and each thread is assigned a single block. The bounds of the blocks are determined by
+// partitionRows() and partitionColumns(), which balance the non-zero elements of sparse
+// operands. In case of a matrix/matrix multiplication with a small target matrix and a large
+// inner dimension, the inner dimension is split among the threads instead (see
+// smpReduceAssign_backend()).\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
 template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   if( smpReduceAssign_backend( ~lhs, ~rhs ) )
+      return;
+
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
    typedef IntrinsicTrait<typename MT1::ElementType>         IT;
@@ -185,36 +242,45 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   std::vector<size_t> rowBounds;
+   std::vector<size_t> colBounds;
+   partitionRows   ( ~rhs, threads.first , ( vectorizable )?( IT::size ):( 1UL ), rowBounds );
+   partitionColumns( ~rhs, threads.second, ( vectorizable )?( IT::size ):( 1UL ), colBounds );
+
+   for( size_t i=0UL; i<threads.first; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( rowBounds[i] );
+      const size_t m  ( rowBounds[i+1UL] - row );
 
-      if( column >= (~lhs).columns() )
+      if( m == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( colBounds[j] );
+         const size_t n     ( colBounds[j+1UL] - column );
+
+         if( n == 0UL )
+            continue;
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
@@ -254,18 +320,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionRows( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( bounds[i] );
+      const size_t m  ( bounds[i+1UL] - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -306,18 +372,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionColumns( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( bounds[i] );
+      const size_t n     ( bounds[i+1UL] - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -403,7 +469,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
       }
       else {
@@ -425,25 +491,30 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a row-major dense
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a dense matrix to a
+//        dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be added.
+// \param rhs The right-hand side dense matrix to be added.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a row-major dense matrix to a dense matrix.\n
+// assignment of a dense matrix to a dense matrix. The target matrix is partitioned into a 2D
+// grid of blocks, whose shape is chosen by createThreadMapping() with respect to the size of
+// the target matrix, and each thread is assigned a single block. The bounds of the blocks are
+// determined by partitionRows() and partitionColumns(), which balance the non-zero elements of
+// sparse operands.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
 template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -459,111 +530,45 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP addition assignment of a column-major dense
-//        matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be added.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP addition
-// assignment of a column-major dense matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs ) );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   std::vector<size_t> rowBounds;
+   std::vector<size_t> colBounds;
+   partitionRows   ( ~rhs, threads.first , ( vectorizable )?( IT::size ):( 1UL ), rowBounds );
+   partitionColumns( ~rhs, threads.second, ( vectorizable )?( IT::size ):( 1UL ), colBounds );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<threads.first; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( rowBounds[i] );
+      const size_t m  ( rowBounds[i+1UL] - row );
 
-      if( column >= (~lhs).columns() )
+      if( m == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( colBounds[j] );
+         const size_t n     ( colBounds[j+1UL] - column );
+
+         if( n == 0UL )
+            continue;
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
@@ -603,18 +608,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionRows( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( bounds[i] );
+      const size_t m  ( bounds[i+1UL] - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -655,18 +660,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionColumns( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( bounds[i] );
+      const size_t n     ( bounds[i+1UL] - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -753,7 +758,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
       }
       else {
@@ -775,25 +780,30 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major dense
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a dense matrix
+//        to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major dense matrix to be subtracted.
+// \param rhs The right-hand side dense matrix to be subtracted.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a row-major dense matrix to a dense matrix.\n
+// assignment of a dense matrix to a dense matrix. The target matrix is partitioned into a 2D
+// grid of blocks, whose shape is chosen by createThreadMapping() with respect to the size of
+// the target matrix, and each thread is assigned a single block. The bounds of the blocks are
+// determined by partitionRows() and partitionColumns(), which balance the non-zero elements of
+// sparse operands.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
 template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor>& rhs )
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -809,36 +819,45 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   std::vector<size_t> rowBounds;
+   std::vector<size_t> colBounds;
+   partitionRows   ( ~rhs, threads.first , ( vectorizable )?( IT::size ):( 1UL ), rowBounds );
+   partitionColumns( ~rhs, threads.second, ( vectorizable )?( IT::size ):( 1UL ), colBounds );
+
+   for( size_t i=0UL; i<threads.first; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( rowBounds[i] );
+      const size_t m  ( rowBounds[i+1UL] - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( colBounds[j] );
+         const size_t n     ( colBounds[j+1UL] - column );
+
+         if( n == 0UL )
+            continue;
+
+         if( vectorizable && lhsAligned && rhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && lhsAligned ) {
+            AlignedTarget target( submatrix<aligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
+         else if( vectorizable && rhsAligned ) {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+         }
+         else {
+            UnalignedTarget target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         }
       }
    }
 
@@ -850,16 +869,16 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
-//        dense matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major sparse
+//        matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major dense matrix to be subtracted.
+// \param rhs The right-hand side row-major sparse matrix to be subtracted.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a column-major dense matrix to a dense matrix.\n
+// assignment of a row-major sparse matrix to a dense matrix.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -867,8 +886,8 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 */
 template< typename MT1    // Type of the left-hand side dense matrix
         , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side dense matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMajor>& rhs )
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -876,45 +895,22 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
-   typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
-   const bool lhsAligned  ( (~lhs).isAligned() );
-   const bool rhsAligned  ( (~rhs).isAligned() );
+   const size_t threads( TheThreadBackend::size() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   std::vector<size_t> bounds;
+   partitionRows( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t row( bounds[i] );
+      const size_t m  ( bounds[i+1UL] - row );
 
-      if( column >= (~lhs).columns() )
+      if( m == 0UL )
          continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-      if( vectorizable && lhsAligned && rhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && lhsAligned ) {
-         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else if( vectorizable && rhsAligned ) {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
-      else {
-         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
-      }
+      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
+      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
 
    TheThreadBackend::wait();
@@ -925,64 +921,12 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a row-major sparse
-//        matrix to a dense matrix.
+/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
+//        sparse matrix to a dense matrix.
 // \ingroup math
 //
 // \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side row-major sparse matrix to be subtracted.
-// \return void
-//
-// This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
-// assignment of a row-major sparse matrix to a dense matrix.\n
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
-*/
-template< typename MT1    // Type of the left-hand side dense matrix
-        , bool SO         // Storage order of the left-hand side dense matrix
-        , typename MT2 >  // Type of the right-hand side sparse matrix
-void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajor>& rhs )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
-
-   typedef typename MT1::ElementType                         ET1;
-   typedef typename MT2::ElementType                         ET2;
-   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
-
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
-
-   for( size_t i=0UL; i<threads; ++i )
-   {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-      UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
-      TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
-   }
-
-   TheThreadBackend::wait();
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Backend of the C++11/Boost thread-based SMP subtraction assignment of a column-major
-//        sparse matrix to a dense matrix.
-// \ingroup math
-//
-// \param lhs The target left-hand side dense matrix.
-// \param rhs The right-hand side column-major sparse matrix to be subtracted.
+// \param rhs The right-hand side column-major sparse matrix to be subtracted.
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP subtraction
@@ -1005,18 +949,18 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionColumns( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( bounds[i] );
+      const size_t n     ( bounds[i+1UL] - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -1104,7 +1048,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
       }
       else {
@@ -1161,6 +1105,462 @@ inline typename EnableIf< IsDenseMatrix<MT1> >::Type
 
 
 
+//=================================================================================================
+//
+//  HOMOGENEOUS INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP homogeneous initialization of a row-major dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The initial value for all elements of the dense matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP homogeneous
+// initialization of a row-major dense matrix. The matrix is partitioned into blocks of rows in
+// the same way as by the SMP assignment. Therefore each memory page is first touched by the
+// thread that will work on the according elements in subsequent parallel operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename MT      // Type of the left-hand side dense matrix
+        , typename Type >  // Type of the initial value
+void smpFill_backend( DenseMatrix<MT,rowMajor>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename MT::ElementType>         IT;
+   typedef typename SubmatrixExprTrait<MT,aligned>::Type    AlignedTarget;
+   typedef typename SubmatrixExprTrait<MT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( MT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).rows() / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t row( i*rowsPerThread );
+
+      if( row >= (~lhs).rows() )
+         continue;
+
+      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+
+      if( vectorizable && lhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP homogeneous initialization of a column-major dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The initial value for all elements of the dense matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP homogeneous
+// initialization of a column-major dense matrix. The matrix is partitioned into blocks of columns
+// in the same way as by the SMP assignment. Therefore each memory page is first touched by the
+// thread that will work on the according elements in subsequent parallel operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename MT      // Type of the left-hand side dense matrix
+        , typename Type >  // Type of the initial value
+void smpFill_backend( DenseMatrix<MT,columnMajor>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename MT::ElementType>         IT;
+   typedef typename SubmatrixExprTrait<MT,aligned>::Type    AlignedTarget;
+   typedef typename SubmatrixExprTrait<MT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( MT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).columns() / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t column( i*colsPerThread );
+
+      if( column >= (~lhs).columns() )
+         continue;
+
+      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+      if( vectorizable && lhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP homogeneous initialization of a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The initial value for all elements of the dense matrix.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP homogeneous initialization of a dense
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename MT      // Type of the left-hand side dense matrix
+        , bool SO          // Storage order of the left-hand side dense matrix
+        , typename Type >  // Type of the initial value
+inline typename DisableIf< IsSMPAssignable<MT> >::Type
+   smpFill( DenseMatrix<MT,SO>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP homogeneous initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param value The initial value for all elements of the dense matrix.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP homogeneous initialization of a dense matrix.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case the dense matrix is SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename MT      // Type of the left-hand side dense matrix
+        , bool SO          // Storage order of the left-hand side dense matrix
+        , typename Type >  // Type of the initial value
+inline typename EnableIf< IsSMPAssignable<MT> >::Type
+   smpFill( DenseMatrix<MT,SO>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT::ElementType );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+         (~lhs) = value;
+      }
+      else {
+         smpFill_backend( ~lhs, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP in-place (conjugate) transposition of a
+//        square dense matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP in-place
+// (conjugate) transposition of a square dense matrix. The tile rows/columns of the matrix are
+// distributed cyclically among the threads, which evenly balances the decreasing amount of
+// work per tile row/column.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c transpose() or \c ctranspose() member function.
+*/
+template< bool Conj     // Conjugation flag
+        , typename MT   // Type of the dense matrix
+        , bool SO >     // Storage order of the dense matrix
+void smpTranspose_backend( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename MT::ElementType  ET;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   SquareTransposition<Conj,ET> kernel( (~dm).data(), (~dm).rows(), (~dm).spacing(), threads );
+
+   for( size_t i=0UL; i<threads; ++i ) {
+      TheThreadBackend::scheduleLoop( kernel, threads, i, threads );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP in-place transposition of a square dense
+//        matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP in-place transposition of a square
+// dense matrix. Due to the explicit application of the SFINAE principle, this function can only
+// be selected by the compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c transpose() member function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline typename DisableIf< IsSMPAssignable<MT> >::Type
+   smpTranspose( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   transposeSquare<false>( (~dm).data(), (~dm).rows(), (~dm).spacing(), 0UL, 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP in-place transposition of a square dense matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP in-place transposition of a square dense
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the dense matrix is SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c transpose() member function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline typename EnableIf< IsSMPAssignable<MT> >::Type
+   smpTranspose( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() == (~dm).columns(), "Non-square matrix detected" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~dm).canSMPAssign() ) {
+         transposeSquare<false>( (~dm).data(), (~dm).rows(), (~dm).spacing(), 0UL, 1UL );
+      }
+      else {
+         smpTranspose_backend<false>( ~dm );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP in-place conjugate transposition of a square dense
+//        matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP in-place conjugate transposition of a square
+// dense matrix. Due to the explicit application of the SFINAE principle, this function can only
+// be selected by the compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c ctranspose() member function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline typename DisableIf< IsSMPAssignable<MT> >::Type
+   smpCTranspose( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   transposeSquare<true>( (~dm).data(), (~dm).rows(), (~dm).spacing(), 0UL, 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP in-place conjugate transposition of a square dense matrix.
+// \ingroup smp
+//
+// \param dm The square dense matrix to be transposed.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP in-place conjugate transposition of a square dense
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the dense matrix is SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c ctranspose() member function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline typename EnableIf< IsSMPAssignable<MT> >::Type
+   smpCTranspose( DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() == (~dm).columns(), "Non-square matrix detected" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~dm).canSMPAssign() ) {
+         transposeSquare<true>( (~dm).data(), (~dm).rows(), (~dm).spacing(), 0UL, 1UL );
+      }
+      else {
+         smpTranspose_backend<true>( ~dm );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP in-place (conjugate) transposition of
+//        a contiguous non-square matrix.
+// \ingroup smp
+//
+// \param kernel The transposition kernel of the contiguous matrix.
+// \return void
+//
+// This function performs the passes of the given in-place transposition kernel one after
+// another. The independent blocks of each pass are distributed cyclically among the threads,
+// which are synchronized between two passes.\n
+// This function must \b NOT be called explicitly! It is used internally for the in-place
+// transposition of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// \c transpose() or \c ctranspose() member function.
+*/
+template< bool Conj        // Conjugation flag
+        , typename Type >  // Data type of the matrix elements
+void smpTransposeContiguous( ContiguousTransposition<Conj,Type>& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      const bool serial( isParallelSectionNested() || isSerialSectionActive() || !kernel.canSMPAssign() );
+      const size_t threads( TheThreadBackend::size() );
+
+      for( size_t pass=0UL; pass<kernel.passes(); ++pass )
+      {
+         kernel.select( pass );
+
+         const size_t blocks( kernel.blocks() );
+
+         if( serial || blocks < 2UL ) {
+            for( size_t k=0UL; k<blocks; ++k )
+               kernel( k );
+         }
+         else {
+            for( size_t i=0UL; i<threads && i<blocks; ++i ) {
+               TheThreadBackend::scheduleLoop( kernel, blocks, i, threads );
+            }
+
+            TheThreadBackend::wait();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
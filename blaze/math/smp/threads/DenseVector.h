@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/DenseSubvector.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -47,6 +48,7 @@
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partitioning.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/SparseSubvector.h>
@@ -55,6 +57,7 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
@@ -109,21 +112,19 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -179,18 +180,18 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -274,7 +275,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
       }
       else {
@@ -331,21 +332,19 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -401,18 +400,18 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -497,7 +496,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
       }
       else {
@@ -554,21 +553,19 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -624,18 +621,18 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -721,7 +718,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
       }
       else {
@@ -778,21 +775,19 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, ( vectorizable )?( IT::size ):( 1UL ), bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
          TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
@@ -848,18 +843,18 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t threads( TheThreadBackend::size() );
+
+   std::vector<size_t> bounds;
+   partitionElements( ~rhs, threads, 1UL, bounds );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( bounds[i] );
+      const size_t size ( bounds[i+1UL] - index );
 
-      if( index >= (~lhs).size() )
+      if( size == 0UL )
          continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -945,7 +940,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
    BLAZE_PARALLEL_SECTION
    {
-      if( !isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
          multAssign( ~lhs, ~rhs );
       }
       else {
@@ -959,6 +954,152 @@ inline typename EnableIf< And< IsDenseVector<VT1>
 
 
 
+//=================================================================================================
+//
+//  HOMOGENEOUS INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP homogeneous initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The initial value for all elements of the dense vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP homogeneous
+// initialization of a dense vector. The vector is partitioned in the same way as by the SMP
+// assignment. Therefore each memory page is first touched by the thread that will work on the
+// according elements in subsequent parallel operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename VT      // Type of the left-hand side dense vector
+        , bool TF          // Transpose flag of the left-hand side dense vector
+        , typename Type >  // Type of the initial value
+void smpFill_backend( DenseVector<VT,TF>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename VT::ElementType>         IT;
+   typedef typename SubvectorExprTrait<VT,aligned>::Type    AlignedTarget;
+   typedef typename SubvectorExprTrait<VT,unaligned>::Type  UnalignedTarget;
+
+   const bool vectorizable( VT::vectorizable );
+   const bool lhsAligned  ( (~lhs).isAligned() );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      if( vectorizable && lhsAligned ) {
+         AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+      else {
+         UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
+         TheThreadBackend::scheduleFill( target, value );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP homogeneous initialization of a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The initial value for all elements of the dense vector.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP homogeneous initialization of a dense
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename VT      // Type of the left-hand side dense vector
+        , bool TF          // Transpose flag of the left-hand side dense vector
+        , typename Type >  // Type of the initial value
+inline typename DisableIf< IsSMPAssignable<VT> >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   (~lhs) = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP homogeneous initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param value The initial value for all elements of the dense vector.
+// \return void
+//
+// This function performs the C++11/Boost thread-based SMP homogeneous initialization of a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case the dense vector is SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense vectors and matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// constructor or the homogeneous assignment operator.
+*/
+template< typename VT      // Type of the left-hand side dense vector
+        , bool TF          // Transpose flag of the left-hand side dense vector
+        , typename Type >  // Type of the initial value
+inline typename EnableIf< IsSMPAssignable<VT> >::Type
+   smpFill( DenseVector<VT,TF>& lhs, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT::ElementType );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isParallelSectionNested() || isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+         (~lhs) = value;
+      }
+      else {
+         smpFill_backend( ~lhs, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
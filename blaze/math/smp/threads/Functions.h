@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
@@ -86,7 +88,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..\infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
@@ -135,6 +137,54 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 
 
 
+//=================================================================================================
+//
+//  SMP LOOP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based implementation of a parallel loop.
+// \ingroup smp
+//
+// \param n The total number of loop iterations.
+// \param op The loop body to be executed.
+// \return void
+//
+// This function executes the loop body \a op for all iterations \f$ [0..n-1] \f$, i.e. it calls
+// \c op(k) for each index \a k. The iterations are required to be independent of each other.
+// The iterations are distributed cyclically among the threads of the thread backend.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// processing of independent blocks of work. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename OP >  // Type of the loop body
+inline void smpFor( size_t n, OP& op )
+{
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isParallelSectionNested() || isSerialSectionActive() || n < 2UL ) {
+         for( size_t k=0UL; k<n; ++k )
+            op( k );
+      }
+      else {
+         const size_t threads( TheThreadBackend::size() );
+
+         for( size_t i=0UL; i<threads; ++i ) {
+            TheThreadBackend::scheduleLoop( op, n, i, threads );
+         }
+
+         TheThreadBackend::wait();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -53,12 +53,18 @@
 #include <cstdlib>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/ThreadLocal.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
 
+#if BLAZE_THREAD_TEAM_MODE
+#  include <blaze/util/ThreadTeam.h>
+#endif
+
 
 namespace blaze {
 
@@ -75,7 +81,14 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. In case the persistent
+// thread team is selected (see the BLAZE_USE_THREAD_TEAM switch), the threads are managed by
+// a ThreadTeam instead of a ThreadPool and the scheduled tasks are executed during wait().
+// By default all operations are executed by the global pool of the backend system. However,
+// via the bind() function an independent pool can be bound to the calling thread (see the
+// ThreadContext and ThreadContextScope classes), which is then used for all operations issued
+// by this thread. All scheduled tasks are executed within a parallel section, i.e. SMP
+// assignments triggered by a task are executed serially by the executing thread.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -85,6 +98,15 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 class ThreadBackend
 {
+ public:
+   //**Type definitions****************************************************************************
+#if BLAZE_THREAD_TEAM_MODE
+   typedef ThreadTeam<TT,MT,LT,CT>  Pool;  //!< Type of the thread pool of the backend system.
+#else
+   typedef ThreadPool<TT,MT,LT,CT>  Pool;  //!< Type of the thread pool of the backend system.
+#endif
+   //**********************************************************************************************
+
  public:
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
@@ -95,6 +117,13 @@ class ThreadBackend
    //@}
    //**********************************************************************************************
 
+   //**Binding functions***************************************************************************
+   /*!\name Binding functions */
+   //@{
+   static inline Pool* bind( Pool* pool );
+   //@}
+   //**********************************************************************************************
+
    //**Thread execution functions******************************************************************
    /*!\name Thread execution functions */
    //@{
@@ -109,6 +138,15 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Target, typename Value >
+   static inline void scheduleFill( Target& target, const Value& value );
+
+   template< typename OP >
+   static inline void scheduleLoop( OP& op, size_t n, size_t first, size_t increment );
+
+   template< typename OP >
+   static inline void scheduleTask( const OP& op );
    //@}
    //**********************************************************************************************
 
@@ -138,7 +176,9 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         assign( target_, source_ );
+         BLAZE_PARALLEL_SECTION {
+            assign( target_, source_ );
+         }
       }
       //*******************************************************************************************
 
@@ -179,7 +219,9 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         addAssign( target_, source_ );
+         BLAZE_PARALLEL_SECTION {
+            addAssign( target_, source_ );
+         }
       }
       //*******************************************************************************************
 
@@ -220,7 +262,9 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         subAssign( target_, source_ );
+         BLAZE_PARALLEL_SECTION {
+            subAssign( target_, source_ );
+         }
       }
       //*******************************************************************************************
 
@@ -261,7 +305,9 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         multAssign( target_, source_ );
+         BLAZE_PARALLEL_SECTION {
+            multAssign( target_, source_ );
+         }
       }
       //*******************************************************************************************
 
@@ -277,6 +323,126 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Filler************************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a homogeneous initialization.
+   */
+   template< typename Target   // Type of the target operand
+           , typename Value >  // Type of the initial value
+   struct Filler
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Filler class template.
+      //
+      // \param target The target operand to be initialized.
+      // \param value The initial value for all elements of the target.
+      */
+      explicit inline Filler( Target& target, const Value& value )
+         : target_( target )  // The target operand
+         , value_ ( value  )  // The initial value
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Assigns the initial value to all elements of the target operand.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         BLAZE_PARALLEL_SECTION {
+            target_ = value_;
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target      target_;  //!< The target operand.
+      const Value value_;   //!< The initial value.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class LoopExecutor******************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of the iterations of a parallel loop.
+   */
+   template< typename OP >  // Type of the loop body
+   struct LoopExecutor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the LoopExecutor class template.
+      //
+      // \param op The loop body to be executed.
+      // \param n The total number of loop iterations.
+      // \param first The index of the first iteration to be executed.
+      // \param increment The increment between two executed iterations.
+      */
+      explicit inline LoopExecutor( OP& op, size_t n, size_t first, size_t increment )
+         : op_       ( &op       )  // The loop body to be executed
+         , n_        ( n         )  // The total number of loop iterations
+         , first_    ( first     )  // The index of the first iteration
+         , increment_( increment )  // The increment between two iterations
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the assigned iterations of the loop.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         BLAZE_PARALLEL_SECTION {
+            for( size_t k=first_; k<n_; k+=increment_ )
+               (*op_)( k );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      OP*    op_;         //!< The loop body to be executed.
+      size_t n_;          //!< The total number of loop iterations.
+      size_t first_;      //!< The index of the first iteration to be executed.
+      size_t increment_;  //!< The increment between two executed iterations.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class TaskExecutor******************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of an arbitrary task.
+   */
+   template< typename OP >  // Type of the task
+   struct TaskExecutor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the TaskExecutor class template.
+      //
+      // \param op The task to be executed.
+      */
+      explicit inline TaskExecutor( const OP& op )
+         : op_( op )  // The task to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         BLAZE_PARALLEL_SECTION {
+            op_();
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      OP op_;  //!< The task to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
@@ -284,15 +450,22 @@ class ThreadBackend
    //@}
    //**********************************************************************************************
 
+   //**Pool access functions***********************************************************************
+   /*!\name Pool access functions */
+   //@{
+   static inline Pool*& boundPool();
+   static inline Pool&  pool();
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified via
+                                  the environment variable \c BLAZE_NUM_THREADS. However, it
+                                  can be explicitly resized to arbitrary numbers of threads. It
+                                  is used by all threads without a bound pool. */
    //@}
    //**********************************************************************************************
 };
@@ -310,8 +483,14 @@ class ThreadBackend
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_THREAD_TEAM_MODE
+template< typename TT, typename MT, typename LT, typename CT >
+typename ThreadBackend<TT,MT,LT,CT>::Pool
+   ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), threadTeamSpinCount );
+#else
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+typename ThreadBackend<TT,MT,LT,CT>::Pool ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -329,6 +508,8 @@ ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 /*!\brief Returns the total number of threads managed by the thread backend system.
 //
 // \return The total number of threads of the thread backend system.
+//
+// In case a pool is bound to the calling thread, the function returns the size of this pool.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -336,7 +517,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 {
-   return threadpool_.size();
+   return pool().size();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -356,7 +537,8 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // removed from the backend system, otherwise new threads are added to the backend system. In
 // case an invalid number of threads is specified, an \a std::invalid_argument exception is
 // thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// number of threads is available. In case a pool is bound to the calling thread, this pool
+// is resized instead of the global pool.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -364,7 +546,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 {
-   return threadpool_.resize( n, block );
+   pool().resize( n, block );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -384,7 +566,40 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   pool().wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BINDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Binds the given pool to the calling thread.
+//
+// \param pool The pool to be bound to the calling thread (\c NULL for the global pool).
+// \return The pool previously bound to the calling thread (\c NULL for the global pool).
+//
+// This function binds the given pool to the calling thread, i.e. all subsequent operations
+// issued by the calling thread are executed by this pool instead of the global pool of the
+// backend system. Note that a pool must not be bound to several threads at the same time.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pool* ThreadBackend<TT,MT,LT,CT>::bind( Pool* pool )
+{
+   Pool* previous( boundPool() );
+   boundPool() = pool;
+   return previous;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -417,7 +632,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   pool().schedule( Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -442,7 +657,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   pool().schedule( AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -467,7 +682,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   pool().schedule( SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -492,7 +707,82 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   pool().schedule( MultAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a homogeneous initialization of the given operand for execution.
+//
+// \param target The target operand to be initialized.
+// \param value The initial value for all elements of the target.
+// \return void
+//
+// This function schedules the assignment of the given value to all elements of the given
+// target operand for execution.
+*/
+template< typename TT       // Type of the encapsulated thread
+        , typename MT       // Type of the synchronization mutex
+        , typename LT       // Type of the mutex lock
+        , typename CT >     // Type of the condition variable
+template< typename Target   // Type of the target operand
+        , typename Value >  // Type of the initial value
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleFill( Target& target, const Value& value )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   pool().schedule( Filler<Target,Value>( target, value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the iterations of a parallel loop for execution.
+//
+// \param op The loop body to be executed.
+// \param n The total number of loop iterations.
+// \param first The index of the first iteration to be executed.
+// \param increment The increment between two executed iterations.
+// \return void
+//
+// This function schedules the iterations \a first, \a first + \a increment, ... of a loop with
+// \a n iterations for execution. Note that the loop body is referenced and not copied.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the loop body
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleLoop( OP& op, size_t n, size_t first, size_t increment )
+{
+   pool().schedule( LoopExecutor<OP>( op, n, first, increment ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an arbitrary task for execution.
+//
+// \param op The task to be executed.
+// \return void
+//
+// This function schedules the given task for execution. The task is copied and executed within
+// a parallel section, i.e. all SMP assignments triggered by the task are executed serially.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleTask( const OP& op )
+{
+   pool().schedule( TaskExecutor<OP>( op ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -541,6 +831,52 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 
 
 
+//=================================================================================================
+//
+//  POOL ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pool bound to the calling thread.
+//
+// \return Reference to the thread-local pointer to the bound pool (\c NULL if none is bound).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pool*& ThreadBackend<TT,MT,LT,CT>::boundPool()
+{
+   static BLAZE_THREAD_LOCAL Pool* pool = NULL;
+   return pool;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pool used for the operations issued by the calling thread.
+//
+// \return Reference to the bound pool or, in case no pool is bound, to the global pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Pool& ThreadBackend<TT,MT,LT,CT>::pool()
+{
+   Pool* const pool( boundPool() );
+   return ( pool != NULL )?( *pool ):( threadpool_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  TYPE DEFINITIONS
@@ -0,0 +1,431 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ThreadContext.h
+//  \brief Header file for the C++11/Boost thread-based thread contexts
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_THREADCONTEXT_H_
+#define _BLAZE_MATH_SMP_THREADS_THREADCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+#include <atomic>
+#include <vector>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS THREADCONTEXT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Independent team of threads for the thread parallel operations of a single thread.
+// \ingroup smp
+//
+// By default all thread parallel operations are executed by the global pool of the thread
+// backend, whose size is specified via the \c BLAZE_NUM_THREADS environment variable or the
+// setNumThreads() function. In case several threads issue Blaze operations concurrently (as
+// for instance the request threads of a server), they compete for this global pool. The
+// ThreadContext class represents an independent team of \a n threads, which can be bound to a
+// thread by means of a ThreadContextScope. All operations issued by this thread within the
+// scope are executed by the threads of the context, i.e. they use at most \a n threads and
+// don't interfere with the operations of other threads:
+
+   \code
+   // Setup of a context with four threads for each request thread
+   blaze::ThreadContext context( 4UL );
+
+   // Processing a request
+   {
+      blaze::ThreadContextScope scope( context );
+      C = A * B;  // Executed by the four threads of the context
+   }
+   \endcode
+
+// Optionally, the threads of a context can be pinned to a given list of CPUs (e.g. to the cores
+// of a single socket). The threads are assigned to the CPUs in round-robin fashion. Note that
+// pinning is only supported on Linux and has no effect on all other platforms:
+
+   \code
+   std::vector<size_t> cpus( 4UL );
+   cpus[0] = 8UL; cpus[1] = 9UL; cpus[2] = 10UL; cpus[3] = 11UL;
+
+   blaze::ThreadContext context( 4UL, cpus );
+   \endcode
+
+// Note that a context must not be bound to several threads at the same time.
+*/
+class ThreadContext : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TheThreadBackend::Pool  Pool;  //!< Type of the thread pool of the context.
+   //**********************************************************************************************
+
+   //**Private class Pinner************************************************************************
+   /*!\brief Auxiliary functor for the pinning of the threads of a context.
+   //
+   // Each Pinner pins the executing thread to the next CPU of the given list and blocks until
+   // all members of the pool are executing a Pinner. This guarantees that each member of the
+   // pool executes exactly one Pinner. The thread that owns the pool (i.e. the calling thread
+   // in case of a ThreadTeam) is not pinned.
+   */
+   struct Pinner
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Pinner class.
+      //
+      // \param cpus The list of CPUs.
+      // \param members The total number of members of the pool.
+      // \param next The index of the next CPU to be assigned.
+      // \param arrived The number of members that are executing a Pinner.
+      */
+      explicit inline Pinner( const std::vector<size_t>& cpus, size_t members,
+                              std::atomic<size_t>& next, std::atomic<size_t>& arrived )
+         : cpus_   ( &cpus    )  // The list of CPUs
+         , members_( members  )  // The total number of members of the pool
+         , next_   ( &next    )  // The index of the next CPU to be assigned
+         , arrived_( &arrived )  // The number of members executing a Pinner
+#if defined(__linux__)
+         , owner_  ( pthread_self() )  // The thread owning the pool
+#endif
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Pins the executing thread to the next CPU.
+      //
+      // \return void
+      */
+      inline void operator()() {
+#if defined(__linux__)
+         if( !pthread_equal( pthread_self(), owner_ ) ) {
+            const size_t cpu( (*cpus_)[ next_->fetch_add( 1UL ) % cpus_->size() ] );
+            cpu_set_t set;
+            CPU_ZERO( &set );
+            CPU_SET( cpu, &set );
+            pthread_setaffinity_np( pthread_self(), sizeof( cpu_set_t ), &set );
+         }
+         ++(*arrived_);
+         while( arrived_->load() < members_ ) {
+            sched_yield();
+         }
+#endif
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const std::vector<size_t>* cpus_;  //!< The list of CPUs.
+      size_t members_;                    //!< The total number of members of the pool.
+      std::atomic<size_t>* next_;         //!< The index of the next CPU to be assigned.
+      std::atomic<size_t>* arrived_;      //!< The number of members executing a Pinner.
+#if defined(__linux__)
+      pthread_t owner_;                   //!< The thread owning the pool.
+#endif
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ThreadContext( size_t n );
+   explicit inline ThreadContext( size_t n, const std::vector<size_t>& cpus );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Pinning functions***************************************************************************
+   /*!\name Pinning functions */
+   //@{
+   inline void pin( const std::vector<size_t>& cpus );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Pool pool_;  //!< The threads of the context.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class ThreadContextScope;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXT CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a context with \a n threads.
+//
+// \param n The number of threads of the context \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+inline ThreadContext::ThreadContext( size_t n )
+#if BLAZE_THREAD_TEAM_MODE
+   : pool_( n, threadTeamSpinCount )  // The threads of the context
+#else
+   : pool_( n )  // The threads of the context
+#endif
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a context with \a n threads pinned to the given CPUs.
+//
+// \param n The number of threads of the context \f$[1..\infty)\f$.
+// \param cpus The list of CPUs the threads are pinned to.
+// \exception std::invalid_argument Invalid number of threads.
+// \exception std::invalid_argument Invalid list of CPUs.
+//
+// The threads of the context are pinned to the given CPUs in round-robin fashion. In case the
+// given list of CPUs is empty or contains an invalid CPU, a \a std::invalid_argument exception
+// is thrown. Note that pinning is only supported on Linux and has no effect on all other
+// platforms.
+*/
+inline ThreadContext::ThreadContext( size_t n, const std::vector<size_t>& cpus )
+#if BLAZE_THREAD_TEAM_MODE
+   : pool_( n, threadTeamSpinCount )  // The threads of the context
+#else
+   : pool_( n )  // The threads of the context
+#endif
+{
+   pin( cpus );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXT UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the context.
+//
+// \return The number of threads of the context.
+*/
+inline size_t ThreadContext::size() const
+{
+   return pool_.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXT PINNING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pins the threads of the context to the given CPUs.
+//
+// \param cpus The list of CPUs the threads are pinned to.
+// \return void
+// \exception std::invalid_argument Invalid list of CPUs.
+*/
+inline void ThreadContext::pin( const std::vector<size_t>& cpus )
+{
+   if( cpus.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid list of CPUs" );
+   }
+
+#if defined(__linux__)
+   for( size_t i=0UL; i<cpus.size(); ++i ) {
+      if( cpus[i] >= static_cast<size_t>( CPU_SETSIZE ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid list of CPUs" );
+      }
+   }
+
+   std::atomic<size_t> next   ( 0UL );
+   std::atomic<size_t> arrived( 0UL );
+
+   for( size_t i=0UL; i<pool_.size(); ++i ) {
+      pool_.schedule( Pinner( cpus, pool_.size(), next, arrived ) );
+   }
+
+   pool_.wait();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS THREADCONTEXTSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope for the binding of a thread context to the calling thread.
+// \ingroup smp
+//
+// The ThreadContextScope class binds the given ThreadContext to the calling thread for the
+// lifetime of the scope object. All thread parallel operations issued by the calling thread
+// within the scope are executed by the threads of the context (see the ThreadContext class
+// for an example). Scopes can be nested, in which case the innermost scope is active.
+*/
+class ThreadContextScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ThreadContextScope( ThreadContext& context );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ThreadContextScope();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ThreadContext::Pool* previous_;  //!< The pool bound to the thread before the scope.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXTSCOPE CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the given context to the calling thread.
+//
+// \param context The context to be bound to the calling thread.
+*/
+inline ThreadContextScope::ThreadContextScope( ThreadContext& context )
+   : previous_( TheThreadBackend::bind( &context.pool_ ) )  // The previously bound pool
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREADCONTEXTSCOPE DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Restores the previous binding of the calling thread.
+*/
+inline ThreadContextScope::~ThreadContextScope()
+{
+   TheThreadBackend::bind( previous_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1955 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a block compressed sparse row matrix with small dense blocks
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/views/DenseSubmatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a block compressed sparse row (BCSR) matrix.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template represents a row-major sparse matrix whose non-zero
+// elements are grouped into small dense blocks of \f$ M \times N \f$ elements. Whereas the
+// CompressedMatrix stores a column index per non-zero element, the BlockCompressedMatrix only
+// stores a single column index per block, which reduces the index overhead of matrices with
+// natural block structure (as for instance the 3x3 or 6x6 blocks of finite element matrices)
+// by a factor of \f$ M \cdot N \f$:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - M   : specifies the number of rows of the blocks.
+//  - N   : specifies the number of columns of the blocks. The default value is \a M.
+//
+// The number of rows of the matrix must be a multiple of \a M and the number of columns must
+// be a multiple of \a N. The blocks are stored as StaticMatrix instances, which are directly
+// used by the intrinsic multiplication kernels. The block structure can either be setup by the
+// conversion from any other matrix or assembled block row by block row via the reserve(),
+// append() and finalize() functions:
+
+   \code
+   using blaze::BlockCompressedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::StaticMatrix;
+
+   BlockCompressedMatrix<double,3UL> A( 9UL, 9UL );  // 3x3 block rows and columns
+
+   StaticMatrix<double,3UL,3UL> K;
+   // ... Initialization of the element matrix
+
+   A.reserve( 4UL );
+   A.append( 0UL, 0UL, K );  // Appending the block at block position (0,0)
+   A.append( 0UL, 2UL, K );  // Appending the block at block position (0,2)
+   A.finalize( 0UL );
+   A.append( 1UL, 1UL, K );
+   A.finalize( 1UL );
+   A.append( 2UL, 2UL, K );
+   A.finalize( 2UL );
+
+   A.findBlock( 1UL, 1UL )->value() += K;  // Accumulating into an existing block
+
+   DynamicVector<double> x( 9UL ), y;
+   y = A * x;  // Block sparse matrix/dense vector multiplication
+
+   CompressedMatrix<double> B( A );      // Conversion into an element-wise sparse matrix
+   BlockCompressedMatrix<double,3UL> C( B );  // Conversion into a block sparse matrix
+   \endcode
+
+// The BlockCompressedMatrix is a sparse matrix and can be used in all sparse matrix operations.
+// All element access via the function call operator and the element iterators is restricted to
+// read access; the iteration over a row visits all elements of the according blocks, including
+// the explicit zeros within the blocks. The multiplications with dense vectors and dense matrices
+// don't create expression templates, but are immediately evaluated by block kernels, which are
+// executed in parallel if the thread parallelization of Blaze is active and the matrix is
+// sufficiently large.
+*/
+template< typename Type       // Data type of the matrix
+        , size_t M            // Number of rows of the blocks
+        , size_t N = M >      // Number of columns of the blocks
+class BlockCompressedMatrix : public SparseMatrix< BlockCompressedMatrix<Type,M,N>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,M,N>   This;           //!< Type of this BlockCompressedMatrix instance.
+   typedef CompressedMatrix<Type,rowMajor>     ResultType;     //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;    //!< Type of the matrix elements.
+   typedef const Type&                         ReturnType;     //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;  //!< Data type for composite expression templates.
+
+   typedef const Type&  Reference;       //!< Reference to a matrix value (read access only).
+   typedef const Type&  ConstReference;  //!< Reference to a constant matrix value.
+
+   typedef StaticMatrix<Type,M,N,rowMajor>  BlockType;  //!< Type of the dense blocks.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BlockCompressedMatrix<ET,M,N>  Other;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a row of the block compressed matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef ValueIndexPair<Type>  Element;  //!< Element type of the block compressed matrix.
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : block_ ( NULL )  // Pointer to the current block
+         , index_ ( NULL )  // Pointer to the block column index of the current block
+         , row_   ( 0UL  )  // Row within the blocks
+         , column_( 0UL  )  // Current column within the current block
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param block Pointer to the current block.
+      // \param index Pointer to the block column index of the current block.
+      // \param row The row within the blocks.
+      // \param column The initial column within the current block.
+      */
+      inline ConstIterator( const BlockType* block, const size_t* index, size_t row, size_t column )
+         : block_ ( block  )  // Pointer to the current block
+         , index_ ( index  )  // Pointer to the block column index of the current block
+         , row_   ( row    )  // Row within the blocks
+         , column_( column )  // Current column within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         if( ++column_ == N ) {
+            column_ = 0UL;
+            ++block_;
+            ++index_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++( *this );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( value(), index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const {
+         return (*block_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return (*index_)*N + column_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return ( block_ == rhs.block_ ) && ( column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( block_ - rhs.block_ ) * DifferenceType( N ) +
+                ( DifferenceType( column_ ) - DifferenceType( rhs.column_ ) );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const BlockType* block_;   //!< Pointer to the current block.
+      const size_t*    index_;   //!< Pointer to the block column index of the current block.
+      size_t           row_;     //!< Row within the blocks.
+      size_t           column_;  //!< Current column within the current block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**BlockIteratorBase class definition**********************************************************
+   /*!\brief Iterator over the blocks of a block row of the block compressed matrix.
+   */
+   template< typename BT >  // Type of the blocks
+   class BlockIteratorBase
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef BT                         ValueType;         //!< Type of the underlying blocks.
+      typedef BT*                        PointerType;       //!< Pointer return type.
+      typedef BT&                        ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying blocks.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the BlockIteratorBase class.
+      */
+      inline BlockIteratorBase()
+         : block_( NULL )  // Pointer to the current block
+         , index_( NULL )  // Pointer to the block column index of the current block
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor for the BlockIteratorBase class.
+      //
+      // \param block Pointer to the current block.
+      // \param index Pointer to the block column index of the current block.
+      */
+      inline BlockIteratorBase( BT* block, const size_t* index )
+         : block_( block )  // Pointer to the current block
+         , index_( index )  // Pointer to the block column index of the current block
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Conversion constructor from different BlockIteratorBase instances.
+      //
+      // \param it The block iterator to be copied.
+      */
+      template< typename BT2 >  // Type of the blocks of the foreign iterator
+      inline BlockIteratorBase( const BlockIteratorBase<BT2>& it )
+         : block_( it.block_ )  // Pointer to the current block
+         , index_( it.index_ )  // Pointer to the block column index of the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline BlockIteratorBase& operator++() {
+         ++block_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current block.
+      //
+      // \return Reference to the current block.
+      */
+      inline ReferenceType operator*() const {
+         return *block_;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current block.
+      //
+      // \return Pointer to the iterator, which provides the value() and index() functions.
+      */
+      inline const BlockIteratorBase* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current block.
+      //
+      // \return Reference to the current block.
+      */
+      inline ReferenceType value() const {
+         return *block_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the block column index of the current block.
+      //
+      // \return The block column index of the current block.
+      */
+      inline size_t index() const {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two BlockIteratorBase objects.
+      //
+      // \param rhs The right-hand side block iterator.
+      // \return \a true if the iterators refer to the same block, \a false if not.
+      */
+      template< typename BT2 >  // Type of the blocks of the right-hand side iterator
+      inline bool operator==( const BlockIteratorBase<BT2>& rhs ) const {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two BlockIteratorBase objects.
+      //
+      // \param rhs The right-hand side block iterator.
+      // \return \a true if the iterators don't refer to the same block, \a false if they do.
+      */
+      template< typename BT2 >  // Type of the blocks of the right-hand side iterator
+      inline bool operator!=( const BlockIteratorBase<BT2>& rhs ) const {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of blocks between two block iterators.
+      //
+      // \param rhs The right-hand side block iterator.
+      // \return The number of blocks between the two block iterators.
+      */
+      template< typename BT2 >  // Type of the blocks of the right-hand side iterator
+      inline DifferenceType operator-( const BlockIteratorBase<BT2>& rhs ) const {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      BT*           block_;  //!< Pointer to the current block.
+      const size_t* index_;  //!< Pointer to the block column index of the current block.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename BT2 > friend class BlockIteratorBase;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BlockIteratorBase<BlockType>        BlockIterator;       //!< Iterator over the blocks of a block row.
+   typedef BlockIteratorBase<const BlockType>  ConstBlockIterator;  //!< Iterator over the constant blocks of a block row.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the block compressed matrix cannot be partitioned into submatrices,
+       the \a smpAssignable compilation flag is set to \a false. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix();
+   explicit inline BlockCompressedMatrix( size_t m, size_t n );
+   explicit inline BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros );
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix( const Matrix<MT,SO>& m );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference     operator()( size_t i, size_t j ) const;
+   inline ConstIterator      begin ( size_t i ) const;
+   inline ConstIterator      cbegin( size_t i ) const;
+   inline ConstIterator      end   ( size_t i ) const;
+   inline ConstIterator      cend  ( size_t i ) const;
+   inline BlockIterator      beginBlocks( size_t i );
+   inline ConstBlockIterator beginBlocks( size_t i ) const;
+   inline BlockIterator      endBlocks  ( size_t i );
+   inline ConstBlockIterator endBlocks  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t blockRows() const;
+   inline size_t blockColumns() const;
+   inline size_t capacity() const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t nonZeroBlocks() const;
+   inline size_t nonZeroBlocks( size_t i ) const;
+   inline void   reset();
+   inline void   clear();
+   inline void   reserve( size_t nonzeros );
+   inline void   swap( BlockCompressedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator      find      ( size_t i, size_t j ) const;
+   inline ConstIterator      lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator      upperBound( size_t i, size_t j ) const;
+   inline BlockIterator      findBlock ( size_t i, size_t j );
+   inline ConstBlockIterator findBlock ( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const BlockType& block );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t search( size_t i, size_t j ) const;
+
+   template< typename MT, bool SO >
+   static inline void extract( const Matrix<MT,SO>& m, BlockCompressedMatrix& result );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector< BlockType, AlignedAllocator<BlockType> >  Blocks;  //!< Storage type of the blocks.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t              m_;       //!< The current number of rows of the matrix.
+   size_t              n_;       //!< The current number of columns of the matrix.
+   std::vector<size_t> begin_;   //!< The offsets of the first block of each block row.
+   std::vector<size_t> index_;   //!< The block column indices of the blocks.
+   Blocks              blocks_;  //!< The dense blocks of the matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t M, size_t N >
+const Type BlockCompressedMatrix<Type,M,N>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix()
+   : m_     ( 0UL )       // The current number of rows of the matrix
+   , n_     ( 0UL )       // The current number of columns of the matrix
+   , begin_ ( 1UL, 0UL )  // The offsets of the first block of each block row
+   , index_ ()            // The block column indices of the blocks
+   , blocks_()            // The dense blocks of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix (a multiple of \a M).
+// \param n The number of columns of the matrix (a multiple of \a N).
+// \exception std::invalid_argument Invalid matrix size for block matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix( size_t m, size_t n )
+   : m_     ( m )                // The current number of rows of the matrix
+   , n_     ( n )                // The current number of columns of the matrix
+   , begin_ ( m/M + 1UL, 0UL )  // The offsets of the first block of each block row
+   , index_ ()                   // The block column indices of the blocks
+   , blocks_()                   // The dense blocks of the matrix
+{
+   if( m % M != 0UL || n % N != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size for block matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix (a multiple of \a M).
+// \param n The number of columns of the matrix (a multiple of \a N).
+// \param nonzeros The number of expected non-zero blocks.
+// \exception std::invalid_argument Invalid matrix size for block matrix.
+//
+// The matrix is initialized to the zero matrix and has a capacity of \a nonzeros blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_     ( m )                // The current number of rows of the matrix
+   , n_     ( n )                // The current number of columns of the matrix
+   , begin_ ( m/M + 1UL, 0UL )  // The offsets of the first block of each block row
+   , index_ ()                   // The block column indices of the blocks
+   , blocks_()                   // The dense blocks of the matrix
+{
+   if( m % M != 0UL || n % N != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size for block matrix" );
+   }
+
+   reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid matrix size for block matrix.
+//
+// The block structure of the resulting matrix consists of all blocks that contain at least a
+// single non-zero element of the given matrix. In case the number of rows of the given matrix
+// is not a multiple of \a M or the number of columns is not a multiple of \a N, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of rows of the blocks
+        , size_t N >        // Number of columns of the blocks
+template< typename MT       // Type of the foreign matrix
+        , bool SO >         // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,M,N>::BlockCompressedMatrix( const Matrix<MT,SO>& m )
+   : m_     ( 0UL )       // The current number of rows of the matrix
+   , n_     ( 0UL )       // The current number of columns of the matrix
+   , begin_ ( 1UL, 0UL )  // The offsets of the first block of each block row
+   , index_ ()            // The block column indices of the blocks
+   , blocks_()            // The dense blocks of the matrix
+{
+   extract( ~m, *this );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..rows()-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..columns()-1]\f$.
+// \return Reference to the accessed value.
+//
+// The function performs a binary search over the blocks of the according block row. Elements
+// outside of the stored blocks are read as 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstReference
+   BlockCompressedMatrix<Type,M,N>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t pos( search( i/M, j/N ) );
+
+   if( pos == begin_[i/M+1UL] || index_[pos] != j/N )
+      return zero_;
+   else
+      return blocks_[pos](i%M,j%N);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( begin_[i/M] );
+   return ConstIterator( blocks_.data()+pos, index_.data()+pos, i%M, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( begin_[i/M+1UL] );
+   return ConstIterator( blocks_.data()+pos, index_.data()+pos, i%M, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator to the first block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::BlockIterator
+   BlockCompressedMatrix<Type,M,N>::beginBlocks( size_t i )
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return BlockIterator( blocks_.data()+begin_[i], index_.data()+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator to the first block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstBlockIterator
+   BlockCompressedMatrix<Type,M,N>::beginBlocks( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return ConstBlockIterator( blocks_.data()+begin_[i], index_.data()+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator just past the last block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::BlockIterator
+   BlockCompressedMatrix<Type,M,N>::endBlocks( size_t i )
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return BlockIterator( blocks_.data()+begin_[i+1UL], index_.data()+begin_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator just past the last block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstBlockIterator
+   BlockCompressedMatrix<Type,M,N>::endBlocks( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return ConstBlockIterator( blocks_.data()+begin_[i+1UL], index_.data()+begin_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid matrix size for block matrix.
+//
+// The matrix is resized according to the given matrix and its block structure is rebuilt from
+// the non-zero elements of the given matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of rows of the blocks
+        , size_t N >        // Number of columns of the blocks
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,M,N>&
+   BlockCompressedMatrix<Type,M,N>::operator=( const Matrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp;
+   extract( ~rhs, tmp );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block rows of the matrix.
+//
+// \return The number of block rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::blockRows() const
+{
+   return m_ / M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block columns of the matrix.
+//
+// \return The number of block columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::blockColumns() const
+{
+   return n_ / N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of blocks of the matrix.
+//
+// \return The capacity of the matrix in blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::capacity() const
+{
+   return blocks_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+//
+// All elements of the stored blocks are counted as non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::nonZeros() const
+{
+   return blocks_.size() * M * N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return nonZeroBlocks( i/M ) * N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the matrix.
+//
+// \return The number of non-zero blocks in the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::nonZeroBlocks() const
+{
+   return blocks_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the specified block row.
+//
+// \param i The index of the block row.
+// \return The number of non-zero blocks of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::nonZeroBlocks( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all blocks from the matrix. The size and the capacity of the matrix
+// are not changed.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void BlockCompressedMatrix<Type,M,N>::reset()
+{
+   std::fill( begin_.begin(), begin_.end(), 0UL );
+   index_.clear();
+   blocks_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void BlockCompressedMatrix<Type,M,N>::clear()
+{
+   m_ = 0UL;
+   n_ = 0UL;
+   begin_.assign( 1UL, 0UL );
+   index_.clear();
+   blocks_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param nonzeros The new minimum capacity of the matrix in blocks.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void BlockCompressedMatrix<Type,M,N>::reserve( size_t nonzeros )
+{
+   index_.reserve( nonzeros );
+   blocks_.reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void BlockCompressedMatrix<Type,M,N>::swap( BlockCompressedMatrix& m ) /* throw() */
+{
+   std::swap( m_, m.m_ );
+   std::swap( n_, m.n_ );
+   begin_.swap( m.begin_ );
+   index_.swap( m.index_ );
+   blocks_.swap( m.blocks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searching the position of a block within a block row.
+//
+// \param i The block row index.
+// \param j The block column index.
+// \return The position of the first block with a block column index not less than \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline size_t BlockCompressedMatrix<Type,M,N>::search( size_t i, size_t j ) const
+{
+   const size_t* first( index_.data() + begin_[i] );
+   const size_t* last ( index_.data() + begin_[i+1UL] );
+
+   return std::lower_bound( first, last, j ) - index_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extraction of the block structure of the given matrix.
+//
+// \param m The given matrix.
+// \param result The resulting block compressed matrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size for block matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of rows of the blocks
+        , size_t N >        // Number of columns of the blocks
+template< typename MT       // Type of the given matrix
+        , bool SO >         // Storage order of the given matrix
+inline void BlockCompressedMatrix<Type,M,N>::extract( const Matrix<MT,SO>& m, BlockCompressedMatrix& result )
+{
+   typedef typename CompressedMatrix<Type,rowMajor>::ConstIterator  ConstIterator;
+
+   if( (~m).rows() % M != 0UL || (~m).columns() % N != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size for block matrix" );
+   }
+
+   const CompressedMatrix<Type,rowMajor> tmp( ~m );
+
+   const size_t mb( tmp.rows() / M );
+   const size_t nb( tmp.columns() / N );
+   const size_t invalid( size_t(-1) );
+
+   BlockCompressedMatrix A( tmp.rows(), tmp.columns() );
+   std::vector<size_t> position( nb, invalid );
+   std::vector<size_t> indices;
+
+   for( size_t bi=0UL; bi<mb; ++bi )
+   {
+      indices.clear();
+
+      for( size_t i=bi*M; i<(bi+1UL)*M; ++i ) {
+         const ConstIterator end( tmp.end(i) );
+         for( ConstIterator element=tmp.begin(i); element!=end; ++element ) {
+            const size_t bj( element->index() / N );
+            if( position[bj] == invalid ) {
+               position[bj] = 0UL;
+               indices.push_back( bj );
+            }
+         }
+      }
+
+      std::sort( indices.begin(), indices.end() );
+
+      for( size_t k=0UL; k<indices.size(); ++k ) {
+         position[indices[k]] = A.blocks_.size();
+         A.append( bi, indices[k], BlockType() );
+      }
+
+      for( size_t i=bi*M; i<(bi+1UL)*M; ++i ) {
+         const ConstIterator end( tmp.end(i) );
+         for( ConstIterator element=tmp.begin(i); element!=end; ++element ) {
+            A.blocks_[position[element->index()/N]](i%M,element->index()%N) = element->value();
+         }
+      }
+
+      A.finalize( bi );
+
+      for( size_t k=0UL; k<indices.size(); ++k ) {
+         position[indices[k]] = invalid;
+      }
+   }
+
+   result.swap( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..rows()-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..columns()-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// All elements of the stored blocks are found, including the explicit zeros within the blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::find( size_t i, size_t j ) const
+{
+   const size_t pos( search( i/M, j/N ) );
+
+   if( pos == begin_[i/M+1UL] || index_[pos] != j/N )
+      return end( i );
+   else
+      return ConstIterator( blocks_.data()+pos, index_.data()+pos, i%M, j%N );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..rows()-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..columns()-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t pos( search( i/M, j/N ) );
+
+   if( pos == begin_[i/M+1UL] || index_[pos] != j/N )
+      return ConstIterator( blocks_.data()+pos, index_.data()+pos, i%M, 0UL );
+   else
+      return ConstIterator( blocks_.data()+pos, index_.data()+pos, i%M, j%N );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..rows()-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..columns()-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstIterator
+   BlockCompressedMatrix<Type,M,N>::upperBound( size_t i, size_t j ) const
+{
+   ConstIterator it( lowerBound( i, j ) );
+
+   if( it != end( i ) && it->index() == j )
+      ++it;
+
+   return it;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific block.
+//
+// \param i The block row index of the search block.
+// \param j The block column index of the search block.
+// \return Iterator to the block in case it is found, endBlocks() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::BlockIterator
+   BlockCompressedMatrix<Type,M,N>::findBlock( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < blockColumns(), "Invalid block column access index" );
+
+   const size_t pos( search( i, j ) );
+
+   if( pos == begin_[i+1UL] || index_[pos] != j )
+      return endBlocks( i );
+   else
+      return BlockIterator( blocks_.data()+pos, index_.data()+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific block.
+//
+// \param i The block row index of the search block.
+// \param j The block column index of the search block.
+// \return Iterator to the block in case it is found, endBlocks() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline typename BlockCompressedMatrix<Type,M,N>::ConstBlockIterator
+   BlockCompressedMatrix<Type,M,N>::findBlock( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < blockColumns(), "Invalid block column access index" );
+
+   const size_t pos( search( i, j ) );
+
+   if( pos == begin_[i+1UL] || index_[pos] != j )
+      return endBlocks( i );
+   else
+      return ConstBlockIterator( blocks_.data()+pos, index_.data()+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending a block to the specified block row of the matrix.
+//
+// \param i The block row index of the new block. The index has to be in the range \f$[0..blockRows()-1]\f$.
+// \param j The block column index of the new block.
+// \param block The block to be appended.
+// \return void
+//
+// In the same way as the append() function of the CompressedMatrix, this function provides
+// the most efficient way to fill a block compressed matrix with blocks: the blocks have to be
+// appended block row by block row in ascending order of their block column indices, and every
+// block row has to be completed via the finalize() function.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void BlockCompressedMatrix<Type,M,N>::append( size_t i, size_t j, const BlockType& block )
+{
+   BLAZE_USER_ASSERT( i < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < blockColumns(), "Invalid block column access index" );
+   BLAZE_USER_ASSERT( begin_[i] == index_.size() || index_.back() < j, "Index is not strictly increasing" );
+
+   UNUSED_PARAMETER( i );
+
+   index_.push_back( j );
+   blocks_.push_back( block );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the block insertion of a block row.
+//
+// \param i The index of the block row to be finalized.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void BlockCompressedMatrix<Type,M,N>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+
+   begin_[i+1UL] = index_.size();
+
+   if( i+2UL < begin_.size() )
+      begin_[i+2UL] = begin_[i+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of rows of the blocks
+        , size_t N >        // Number of columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,M,N>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t M          // Number of rows of the blocks
+        , size_t N >        // Number of columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,M,N>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false, since the matrix cannot be partitioned into submatrices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline bool BlockCompressedMatrix<Type,M,N>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the block sparse matrix/dense vector multiplication.
+// \ingroup block_compressed_matrix
+//
+// The kernel computes the target elements of a contiguous range of block rows. For every block
+// the according part of the right-hand side vector is loaded into a StaticVector and multiplied
+// by the block via the intrinsic StaticMatrix/StaticVector kernel. Since the ranges of block
+// rows are disjoint, several ranges can be computed in parallel.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , typename VT2 > // Type of the right-hand side dense vector
+class BlockMatDVecMultKernel
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,M,N>        MT;             //!< Type of the block matrix.
+   typedef typename MT::ConstBlockIterator        ConstIterator;  //!< Iterator over the blocks.
+   typedef typename VT1::ElementType              ET1;            //!< Element type of the target vector.
+   typedef typename VT2::ElementType              ET2;            //!< Element type of the right-hand side vector.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockMatDVecMultKernel class template.
+   //
+   // \param y The target dense vector.
+   // \param A The block compressed matrix.
+   // \param x The right-hand side dense vector.
+   // \param blocks The number of ranges of block rows.
+   */
+   inline BlockMatDVecMultKernel( VT1& y, const MT& A, const VT2& x, size_t blocks )
+      : y_     ( y )       // The target dense vector
+      , A_     ( A )       // The block compressed matrix
+      , x_     ( x )       // The right-hand side dense vector
+      , blocks_( blocks )  // The number of ranges of block rows
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computation of the given range of block rows.
+   //
+   // \param b The index of the range of block rows.
+   // \return void
+   */
+   inline void operator()( size_t b ) {
+      const size_t ibegin( ( A_.blockRows() *   b       ) / blocks_ );
+      const size_t iend  ( ( A_.blockRows() * ( b+1UL ) ) / blocks_ );
+
+      StaticVector<ET2,N,columnVector> x;
+
+      for( size_t bi=ibegin; bi<iend; ++bi )
+      {
+         StaticVector<ET1,M,columnVector> y;
+
+         const ConstIterator end( A_.endBlocks( bi ) );
+         for( ConstIterator block=A_.beginBlocks( bi ); block!=end; ++block ) {
+            const size_t jj( block->index() * N );
+            for( size_t j=0UL; j<N; ++j )
+               x[j] = x_[jj+j];
+            y += block->value() * x;
+         }
+
+         for( size_t i=0UL; i<M; ++i )
+            y_[bi*M+i] = y[i];
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&       y_;       //!< The target dense vector.
+   const MT&  A_;       //!< The block compressed matrix.
+   const VT2& x_;       //!< The right-hand side dense vector.
+   size_t     blocks_;  //!< The number of ranges of block rows.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the block sparse matrix/dense matrix multiplication.
+// \ingroup block_compressed_matrix
+//
+// The kernel accumulates the products of the blocks of a contiguous range of block rows with
+// the according rows of the right-hand side dense matrix into the rows of the zero-initialized
+// target matrix. Since the ranges of block rows are disjoint, several ranges can be computed in
+// parallel.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , typename MT2 > // Type of the right-hand side dense matrix
+class BlockMatDMatMultKernel
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,M,N>  MT;             //!< Type of the block matrix.
+   typedef typename MT::ConstBlockIterator  ConstIterator;  //!< Iterator over the blocks.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockMatDMatMultKernel class template.
+   //
+   // \param C The zero-initialized target dense matrix.
+   // \param A The block compressed matrix.
+   // \param B The right-hand side dense matrix.
+   // \param blocks The number of ranges of block rows.
+   */
+   inline BlockMatDMatMultKernel( MT1& C, const MT& A, const MT2& B, size_t blocks )
+      : C_     ( C )       // The target dense matrix
+      , A_     ( A )       // The block compressed matrix
+      , B_     ( B )       // The right-hand side dense matrix
+      , blocks_( blocks )  // The number of ranges of block rows
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computation of the given range of block rows.
+   //
+   // \param b The index of the range of block rows.
+   // \return void
+   */
+   inline void operator()( size_t b ) {
+      const size_t ibegin( ( A_.blockRows() *   b       ) / blocks_ );
+      const size_t iend  ( ( A_.blockRows() * ( b+1UL ) ) / blocks_ );
+      const size_t n     ( B_.columns() );
+
+      for( size_t bi=ibegin; bi<iend; ++bi ) {
+         const ConstIterator end( A_.endBlocks( bi ) );
+         for( ConstIterator block=A_.beginBlocks( bi ); block!=end; ++block ) {
+            submatrix( C_, bi*M, 0UL, M, n ) += block->value() * submatrix( B_, block->index()*N, 0UL, N, n );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MT1&       C_;       //!< The target dense matrix.
+   const MT&  A_;       //!< The block compressed matrix.
+   const MT2& B_;       //!< The right-hand side dense matrix.
+   size_t     blocks_;  //!< The number of ranges of block rows.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( BlockCompressedMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline void clear( BlockCompressedMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline bool isDefault( const BlockCompressedMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline bool isIntact( const BlockCompressedMatrix<Type,M,N>& m );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( BlockCompressedMatrix<Type,M,N>& a, BlockCompressedMatrix<Type,M,N>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void reset( BlockCompressedMatrix<Type,M,N>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void clear( BlockCompressedMatrix<Type,M,N>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given block compressed matrix is in default state.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix has a size of 0, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline bool isDefault( const BlockCompressedMatrix<Type,M,N>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given block compressed matrix are intact.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline bool isIntact( const BlockCompressedMatrix<Type,M,N>& m )
+{
+   return ( m.nonZeroBlocks() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N >     // Number of columns of the blocks
+inline void swap( BlockCompressedMatrix<Type,M,N>& a, BlockCompressedMatrix<Type,M,N>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block compressed matrix and a
+//        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param lhs The left-hand side block compressed matrix for the multiplication.
+// \param rhs The right-hand side dense vector for the multiplication.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// The multiplication is immediately evaluated block by block. In case the thread parallelization
+// of Blaze is active and the matrix is sufficiently large, the block rows are distributed among
+// the available threads.
+*/
+template< typename T1    // Data type of the left-hand side block matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , typename VT >  // Type of the right-hand side dense vector
+inline const DynamicVector< typename MultTrait<T1,typename VT::ElementType>::Type, columnVector >
+   operator*( const BlockCompressedMatrix<T1,M,N>& lhs, const DenseVector<VT,columnVector>& rhs )
+{
+   typedef DynamicVector< typename MultTrait<T1,typename VT::ElementType>::Type, columnVector >  ResultType;
+   typedef typename RemoveReference<typename VT::CompositeType>::Type  XT;
+   typedef BlockMatDVecMultKernel<ResultType,T1,M,N,XT>  Kernel;
+
+   if( lhs.columns() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   typename VT::CompositeType x( ~rhs );  // Evaluation of the right-hand side dense vector
+
+   ResultType y( lhs.rows() );
+
+   const size_t blocks( ( lhs.rows() > SMP_SMATDVECMULT_THRESHOLD && !isSerialSectionActive() )
+                        ?( min( getNumThreads(), lhs.blockRows() ) ):( 1UL ) );
+
+   Kernel kernel( y, lhs, x, blocks );
+
+   if( blocks < 2UL )
+      kernel( 0UL );
+   else
+      smpFor( blocks, kernel );
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block compressed matrix and a
+//        dense matrix (\f$ C=A*B \f$).
+// \ingroup block_compressed_matrix
+//
+// \param lhs The left-hand side block compressed matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is immediately evaluated block by block, where every block is multiplied
+// with the according rows of the dense matrix via the intrinsic dense matrix multiplication
+// kernels. In case the thread parallelization of Blaze is active and the matrix is sufficiently
+// large, the block rows are distributed among the available threads.
+*/
+template< typename T1    // Data type of the left-hand side block matrix
+        , size_t M       // Number of rows of the blocks
+        , size_t N       // Number of columns of the blocks
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline const DynamicMatrix< typename MultTrait<T1,typename MT::ElementType>::Type, SO >
+   operator*( const BlockCompressedMatrix<T1,M,N>& lhs, const DenseMatrix<MT,SO>& rhs )
+{
+   typedef typename MultTrait<T1,typename MT::ElementType>::Type       ET;
+   typedef DynamicMatrix<ET,SO>                                         ResultType;
+   typedef typename RemoveReference<typename MT::CompositeType>::Type  BT;
+   typedef BlockMatDMatMultKernel<ResultType,T1,M,N,BT>                 Kernel;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   typename MT::CompositeType B( ~rhs );  // Evaluation of the right-hand side dense matrix
+
+   ResultType C( lhs.rows(), B.columns(), ET() );
+
+   const size_t blocks( ( lhs.rows() > SMP_SMATDMATMULT_THRESHOLD && !isSerialSectionActive() )
+                        ?( min( getNumThreads(), lhs.blockRows() ) ):( 1UL ) );
+
+   Kernel kernel( C, lhs, B, blocks );
+
+   if( blocks < 2UL )
+      kernel( 0UL );
+   else
+      smpFor( blocks, kernel );
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t M, size_t N, typename T2 >
+struct MultTrait< BlockCompressedMatrix<T1,M,N>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, typename T2, bool SO >
+struct MultTrait< BlockCompressedMatrix<T1,M,N>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1338 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactSymmetricMatrix.h
+//  \brief Header file for the implementation of a symmetric sparse matrix with half storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTSYMMETRICMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPACTSYMMETRICMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/views/DenseSubvector.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_symmetric_matrix CompactSymmetricMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a symmetric or Hermitian sparse matrix with half storage.
+// \ingroup compact_symmetric_matrix
+//
+// The CompactSymmetricMatrix class template is the storage efficient counterpart of a
+// SymmetricMatrix (or HermitianMatrix) adapting a CompressedMatrix. Whereas the adaptors store
+// both triangles of the adapted sparse matrix, the CompactSymmetricMatrix only stores a single
+// triangle including the diagonal, which roughly halves both the memory requirements and the
+// memory traffic of matrix/vector multiplications:
+
+   \code
+   template< typename Type, bool SO, bool HF >
+   class CompactSymmetricMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompactSymmetricMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix. In
+//          case of a row-major matrix the upper triangle is stored row-wise, in case of a
+//          column-major matrix the lower triangle is stored column-wise. The default value is
+//          blaze::rowMajor.
+//  - HF  : specifies whether the matrix is symmetric (\a false) or Hermitian (\a true). In case
+//          of a Hermitian matrix the elements of the non-stored triangle correspond to the
+//          complex conjugates of the stored elements. The default value is \a false.
+//
+// The stored triangle can either be setup from an existing symmetric/Hermitian matrix or it
+// can be assembled row-by-row (or column-by-column) via the reserve(), append() and finalize()
+// functions, in the same way as a CompressedMatrix:
+
+   \code
+   using blaze::CompactSymmetricMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompactSymmetricMatrix<double> A( 3UL );  // Row-major, upper triangle is stored
+
+   A.reserve( 4UL );
+   A.append( 0UL, 0UL, 2.0 );
+   A.append( 0UL, 2UL, 1.0 );  // Also sets the element (2,0)
+   A.finalize( 0UL );
+   A.append( 1UL, 1UL, 3.0 );
+   A.finalize( 1UL );
+   A.append( 2UL, 2UL, 4.0 );
+   A.finalize( 2UL );
+
+   DynamicVector<double> x( 3UL, 1.0 ), y( 3UL );
+
+   y = A * x;       // Symmetric sparse matrix/dense vector multiplication
+   symv( y, A, x );  // Equivalent multiplication into an existing vector
+
+   CompressedMatrix<double> B( expand( A ) );  // Conversion into a general sparse matrix
+   \endcode
+
+// The multiplication kernels (see the symv() and symm() functions) apply every stored element
+// twice, once for the stored position and once for the mirrored position. In case the thread
+// parallelization of Blaze is active and the matrix is sufficiently large, the multiplications
+// are executed in parallel without write conflicts: the symmetric matrix/vector multiplication
+// accumulates the mirrored contributions beyond the rows of a thread in thread-private buffers,
+// which are reduced in a second parallel pass, whereas the symmetric matrix/matrix
+// multiplication assigns disjoint sets of columns to the threads.
+*/
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder     // Storage order
+        , bool HF = false >                 // Hermitian flag
+class CompactSymmetricMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompactSymmetricMatrix<Type,SO,HF>  This;          //!< Type of this CompactSymmetricMatrix instance.
+   typedef Type                                ElementType;   //!< Type of the matrix elements.
+   typedef CompressedMatrix<Type,SO>           TriangleType;  //!< Type of the stored triangle.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompactSymmetricMatrix();
+   explicit inline CompactSymmetricMatrix( size_t n );
+   explicit inline CompactSymmetricMatrix( size_t n, size_t nonzeros );
+
+   template< typename MT, bool SO2 >
+   explicit inline CompactSymmetricMatrix( const Matrix<MT,SO2>& m );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ElementType         operator()( size_t i, size_t j ) const;
+   inline void                set( size_t i, size_t j, const ElementType& value );
+   inline const TriangleType& triangle() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   template< typename MT, bool SO2 > inline CompactSymmetricMatrix& operator=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t nonZeros() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+   inline void   swap( CompactSymmetricMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const ElementType& value, bool check=false );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Mirroring functions*************************************************************************
+   /*!\name Mirroring functions */
+   //@{
+   static inline bool        isStored( size_t i, size_t j );
+   static inline ElementType mirror  ( const ElementType& value );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO2 >
+   static inline void extract( const Matrix<MT,SO2>& m, TriangleType& triangle, const char* message );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   TriangleType triangle_;  //!< The stored triangle of the matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactSymmetricMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline CompactSymmetricMatrix<Type,SO,HF>::CompactSymmetricMatrix()
+   : triangle_()  // The stored triangle of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a symmetric matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline CompactSymmetricMatrix<Type,SO,HF>::CompactSymmetricMatrix( size_t n )
+   : triangle_( n, n )  // The stored triangle of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a symmetric matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+// \param nonzeros The number of expected non-zero elements in the stored triangle.
+//
+// The matrix is initialized to the zero matrix and has a capacity of \a nonzeros elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline CompactSymmetricMatrix<Type,SO,HF>::CompactSymmetricMatrix( size_t n, size_t nonzeros )
+   : triangle_( n, n, nonzeros )  // The stored triangle of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Symmetric (or Hermitian) matrix to be copied.
+// \exception std::invalid_argument Invalid setup of symmetric matrix.
+// \exception std::invalid_argument Invalid setup of Hermitian matrix.
+//
+// This constructor initializes the matrix with the according triangle of the given matrix. In
+// case the given matrix is not symmetric (or not Hermitian in case of a Hermitian matrix), a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , bool HF >         // Hermitian flag
+template< typename MT       // Type of the foreign matrix
+        , bool SO2 >        // Storage order of the foreign matrix
+inline CompactSymmetricMatrix<Type,SO,HF>::CompactSymmetricMatrix( const Matrix<MT,SO2>& m )
+   : triangle_()  // The stored triangle of the matrix
+{
+   extract( ~m, triangle_, HF ? "Invalid setup of Hermitian matrix"
+                              : "Invalid setup of symmetric matrix" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// Elements of the non-stored triangle are reconstructed from the according stored element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline typename CompactSymmetricMatrix<Type,SO,HF>::ElementType
+   CompactSymmetricMatrix<Type,SO,HF>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return triangle_(i,j);
+   else
+      return mirror( triangle_(j,i) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of an element and its mirrored element.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element at position \f$ (i,j) \f$.
+// \return void
+//
+// This function sets the element \f$ (i,j) \f$ and implicitly the element \f$ (j,i) \f$. In
+// case the according element is not yet contained in the stored triangle it is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::set( size_t i, size_t j, const ElementType& value )
+{
+   BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      triangle_(i,j) = value;
+   else
+      triangle_(j,i) = mirror( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the stored triangle of the matrix.
+//
+// \return Reference to the stored triangle.
+//
+// In case of a row-major matrix the returned sparse matrix contains the upper triangle of the
+// matrix, in case of a column-major matrix it contains the lower triangle.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline const typename CompactSymmetricMatrix<Type,SO,HF>::TriangleType&
+   CompactSymmetricMatrix<Type,SO,HF>::triangle() const
+{
+   return triangle_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Symmetric (or Hermitian) matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+// \exception std::invalid_argument Invalid assignment to Hermitian matrix.
+//
+// The matrix is resized according to the given matrix and initialized with the according
+// triangle of the given matrix. In case the given matrix is not symmetric (or not Hermitian in
+// case of a Hermitian matrix), a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , bool HF >         // Hermitian flag
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline CompactSymmetricMatrix<Type,SO,HF>&
+   CompactSymmetricMatrix<Type,SO,HF>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   TriangleType tmp;
+   extract( ~rhs, tmp, HF ? "Invalid assignment to Hermitian matrix"
+                          : "Invalid assignment to symmetric matrix" );
+   triangle_.swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline size_t CompactSymmetricMatrix<Type,SO,HF>::rows() const
+{
+   return triangle_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline size_t CompactSymmetricMatrix<Type,SO,HF>::columns() const
+{
+   return triangle_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the complete matrix.
+//
+// \return The number of non-zero elements of the matrix.
+//
+// This function returns the number of non-zero elements of the complete matrix, i.e. every
+// stored off-diagonal element is counted twice. The number of actually stored elements is
+// given by \c triangle().nonZeros().
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline size_t CompactSymmetricMatrix<Type,SO,HF>::nonZeros() const
+{
+   typedef typename TriangleType::ConstIterator  ConstIterator;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<triangle_.rows(); ++i ) {
+      const ConstIterator end( triangle_.end(i) );
+      for( ConstIterator element=triangle_.begin(i); element!=end; ++element ) {
+         nonzeros += ( element->index() == i )?( 1UL ):( 2UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::reset()
+{
+   triangle_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::clear()
+{
+   triangle_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::resize( size_t n, bool preserve )
+{
+   triangle_.resize( n, n, preserve );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the stored triangle.
+//
+// \param nonzeros The new minimum capacity of the stored triangle.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::reserve( size_t nonzeros )
+{
+   triangle_.reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::swap( CompactSymmetricMatrix& m ) /* throw() */
+{
+   triangle_.swap( m.triangle_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extraction of the stored triangle of the given matrix.
+//
+// \param m The given symmetric (or Hermitian) matrix.
+// \param triangle The resulting stored triangle.
+// \param message The error message in case the given matrix is not symmetric (or Hermitian).
+// \return void
+// \exception std::invalid_argument The given matrix is not symmetric (or Hermitian).
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , bool HF >         // Hermitian flag
+template< typename MT       // Type of the given matrix
+        , bool SO2 >        // Storage order of the given matrix
+inline void CompactSymmetricMatrix<Type,SO,HF>::extract( const Matrix<MT,SO2>& m,
+                                                         TriangleType& triangle,
+                                                         const char* message )
+{
+   typedef typename TriangleType::ConstIterator  ConstIterator;
+
+   const TriangleType tmp( ~m );
+
+   if( HF ? !isHermitian( tmp ) : !isSymmetric( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( message );
+   }
+
+   const size_t n( tmp.rows() );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros += tmp.end(i) - tmp.lowerBound(i,i);
+   }
+
+   TriangleType result( n, n, nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const ConstIterator end( tmp.end(i) );
+      for( ConstIterator element=tmp.lowerBound(i,i); element!=end; ++element ) {
+         if( SO == rowMajor )
+            result.append( i, element->index(), element->value() );
+         else
+            result.append( element->index(), i, element->value() );
+      }
+      result.finalize( i );
+   }
+
+   triangle.swap( result );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the stored triangle.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function appends the element \f$ (i,j) \f$ to the stored triangle, which implicitly
+// also sets the element \f$ (j,i) \f$. The element has to be part of the stored triangle, i.e.
+// \f$ i \le j \f$ for a row-major matrix and \f$ i \ge j \f$ for a column-major matrix. Apart
+// from that the same restrictions as for the append() function of the CompressedMatrix apply.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::append( size_t i, size_t j, const ElementType& value, bool check )
+{
+   BLAZE_USER_ASSERT( isStored( i, j ), "Invalid element outside the stored triangle" );
+
+   triangle_.append( i, j, value, check );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column of the stored triangle.
+//
+// \param i The index of the row/column to be finalized \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void CompactSymmetricMatrix<Type,SO,HF>::finalize( size_t i )
+{
+   triangle_.finalize( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MIRRORING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given element is part of the stored triangle.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is part of the stored triangle, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline bool CompactSymmetricMatrix<Type,SO,HF>::isStored( size_t i, size_t j )
+{
+   return ( SO == rowMajor )?( i <= j ):( i >= j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the value of the mirrored element.
+//
+// \param value The value of the original element.
+// \return The value of the mirrored element.
+//
+// In case of a Hermitian matrix the function returns the complex conjugate of the given value,
+// in case of a symmetric matrix it returns the given value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline typename CompactSymmetricMatrix<Type,SO,HF>::ElementType
+   CompactSymmetricMatrix<Type,SO,HF>::mirror( const ElementType& value )
+{
+   return HF ? ElementType( conj( value ) ) : value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRIC MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the symmetric sparse matrix/dense vector multiplication.
+// \ingroup compact_symmetric_matrix
+//
+// The rows (or columns) of the stored triangle are partitioned into blocks of roughly the same
+// number of non-zero elements. Each block resets and computes the according range of the target
+// vector. All mirrored contributions to elements beyond the range of the block are accumulated
+// in a block-private spill buffer (first pass) and afterwards added to the target vector by the
+// block owning the according range (second pass). Thus the blocks of both passes can be
+// executed in parallel without write conflicts.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename MT   // Type of the stored triangle
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool HF >     // Hermitian flag
+class SymvKernel
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename VT1::ElementType    ET;             //!< Element type of the target vector.
+   typedef typename MT::ElementType     MET;            //!< Element type of the stored triangle.
+   typedef typename MT::ConstIterator   ConstIterator;  //!< Iterator over the stored elements.
+   typedef DynamicVector<ET>            SpillType;      //!< Type of the spill buffers.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SymvKernel class template.
+   //
+   // \param y The target dense vector.
+   // \param A The stored triangle of the symmetric matrix.
+   // \param x The right-hand side dense vector.
+   // \param blocks The number of blocks.
+   */
+   inline SymvKernel( VT1& y, const MT& A, const VT2& x, size_t blocks )
+      : y_      ( y )             // The target dense vector
+      , A_      ( A )             // The stored triangle of the symmetric matrix
+      , x_      ( x )             // The right-hand side dense vector
+      , bounds_ ( blocks+1UL )    // The boundaries of the blocks
+      , spills_ ( blocks )        // The spill buffers of the blocks
+      , reduce_ ( false )         // Flag for the reduction pass
+   {
+      const size_t n( A.rows() );
+      const size_t nonzeros( A.nonZeros() );
+
+      size_t i( 0UL ), sum( 0UL );
+
+      bounds_[0UL] = 0UL;
+
+      for( size_t b=1UL; b<blocks; ++b ) {
+         const size_t target( ( nonzeros * b ) / blocks );
+         while( i < n && sum < target ) {
+            sum += A.nonZeros( i );
+            ++i;
+         }
+         bounds_[b] = i;
+      }
+
+      bounds_[blocks] = n;
+
+      for( size_t b=0UL; b<blocks; ++b ) {
+         spills_[b].resize( n - bounds_[b+1UL], false );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Execution of the given block of the current pass.
+   //
+   // \param b The index of the block.
+   // \return void
+   */
+   inline void operator()( size_t b ) {
+      if( reduce_ ) reduce( b );
+      else compute( b );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of blocks.
+   //
+   // \return The number of blocks.
+   */
+   inline size_t blocks() const {
+      return spills_.size();
+   }
+
+   /*!\brief Switches the kernel to the reduction pass.
+   //
+   // \return void
+   */
+   inline void startReduction() {
+      reduce_ = true;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Computation functions***********************************************************************
+   /*!\brief Computation of the given block (first pass).
+   //
+   // \param b The index of the block.
+   // \return void
+   */
+   inline void compute( size_t b ) {
+      const size_t begin( bounds_[b] );
+      const size_t end  ( bounds_[b+1UL] );
+
+      SpillType& spill( spills_[b] );
+      reset( spill );
+
+      for( size_t i=begin; i<end; ++i )
+         reset( y_[i] );
+
+      for( size_t i=begin; i<end; ++i )
+      {
+         ConstIterator element( A_.begin(i) );
+         const ConstIterator last( A_.end(i) );
+
+         if( element == last ) continue;
+
+         const ET xi( x_[i] );
+         ET sum = ET();
+
+         if( element->index() == i ) {
+            sum += element->value() * xi;
+            ++element;
+         }
+
+         for( ; element!=last && element->index()<end; ++element ) {
+            const size_t j( element->index() );
+            sum   += direct( element->value() ) * x_[j];
+            y_[j] += mirror( element->value() ) * xi;
+         }
+
+         for( ; element!=last; ++element ) {
+            const size_t j( element->index() );
+            sum           += direct( element->value() ) * x_[j];
+            spill[j-end]  += mirror( element->value() ) * xi;
+         }
+
+         y_[i] += sum;
+      }
+   }
+
+   /*!\brief Reduction of the spill buffers into the given block (second pass).
+   //
+   // \param b The index of the block.
+   // \return void
+   */
+   inline void reduce( size_t b ) {
+      const size_t begin( bounds_[b] );
+      const size_t size ( bounds_[b+1UL] - begin );
+
+      if( size == 0UL ) return;
+
+      for( size_t c=0UL; c<b; ++c ) {
+         subvector( y_, begin, size ) += subvector( spills_[c], begin - bounds_[c+1UL], size );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Mirroring functions*************************************************************************
+   /*!\brief Returns the value of the element at the stored position of a row-major triangle.
+   //
+   // The stored element \f$ (i,j) \f$ of the iteration corresponds to the element \f$ (j,i) \f$
+   // of a column-major triangle.
+   */
+   static inline MET direct( const MET& value ) {
+      return ( !HF || IsRowMajorMatrix<MT>::value )?( value ):( MET( conj( value ) ) );
+   }
+
+   /*!\brief Returns the value of the element at the mirrored position of a row-major triangle.
+   */
+   static inline MET mirror( const MET& value ) {
+      return ( !HF || !IsRowMajorMatrix<MT>::value )?( value ):( MET( conj( value ) ) );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1&                     y_;       //!< The target dense vector.
+   const MT&                A_;       //!< The stored triangle of the symmetric matrix.
+   const VT2&               x_;       //!< The right-hand side dense vector.
+   std::vector<size_t>      bounds_;  //!< The boundaries of the blocks.
+   std::vector<SpillType>   spills_;  //!< The spill buffers of the blocks.
+   bool                     reduce_;  //!< Flag for the reduction pass.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the symmetric sparse matrix/dense matrix multiplication.
+// \ingroup compact_symmetric_matrix
+//
+// The columns of the right-hand side and the target matrix are partitioned into blocks of
+// consecutive columns. Since every block only writes to its own columns of the target matrix,
+// the blocks can be executed in parallel without write conflicts.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT   // Type of the stored triangle
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool HF >     // Hermitian flag
+class SymmKernel
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ElementType    ET;             //!< Element type of the target matrix.
+   typedef typename MT::ElementType     MET;            //!< Element type of the stored triangle.
+   typedef typename MT::ConstIterator   ConstIterator;  //!< Iterator over the stored elements.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SymmKernel class template.
+   //
+   // \param C The target dense matrix.
+   // \param A The stored triangle of the symmetric matrix.
+   // \param B The right-hand side dense matrix.
+   // \param blocks The number of column blocks.
+   */
+   inline SymmKernel( MT1& C, const MT& A, const MT2& B, size_t blocks )
+      : C_     ( C )       // The target dense matrix
+      , A_     ( A )       // The stored triangle of the symmetric matrix
+      , B_     ( B )       // The right-hand side dense matrix
+      , blocks_( blocks )  // The number of column blocks
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computation of the given column block.
+   //
+   // \param b The index of the column block.
+   // \return void
+   */
+   inline void operator()( size_t b ) {
+      const size_t n     ( A_.rows() );
+      const size_t jbegin( ( B_.columns() *   b       ) / blocks_ );
+      const size_t jend  ( ( B_.columns() * ( b+1UL ) ) / blocks_ );
+
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=jbegin; j<jend; ++j )
+            reset( C_(i,j) );
+
+      if( IsRowMajorMatrix<MT1>::value )
+      {
+         for( size_t i=0UL; i<n; ++i ) {
+            const ConstIterator end( A_.end(i) );
+            for( ConstIterator element=A_.begin(i); element!=end; ++element )
+            {
+               const size_t k( element->index() );
+
+               if( k == i ) {
+                  for( size_t j=jbegin; j<jend; ++j )
+                     C_(i,j) += element->value() * B_(i,j);
+               }
+               else {
+                  const MET d( direct( element->value() ) );
+                  const MET m( mirror( element->value() ) );
+                  for( size_t j=jbegin; j<jend; ++j ) {
+                     C_(i,j) += d * B_(k,j);
+                     C_(k,j) += m * B_(i,j);
+                  }
+               }
+            }
+         }
+      }
+      else
+      {
+         for( size_t j=jbegin; j<jend; ++j ) {
+            for( size_t i=0UL; i<n; ++i )
+            {
+               ConstIterator element( A_.begin(i) );
+               const ConstIterator end( A_.end(i) );
+
+               if( element == end ) continue;
+
+               const ET bij( B_(i,j) );
+               ET sum = ET();
+
+               if( element->index() == i ) {
+                  sum += element->value() * bij;
+                  ++element;
+               }
+
+               for( ; element!=end; ++element ) {
+                  const size_t k( element->index() );
+                  sum     += direct( element->value() ) * B_(k,j);
+                  C_(k,j) += mirror( element->value() ) * bij;
+               }
+
+               C_(i,j) += sum;
+            }
+         }
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Mirroring functions*************************************************************************
+   /*!\brief Returns the value of the element at the stored position of a row-major triangle.
+   */
+   static inline MET direct( const MET& value ) {
+      return ( !HF || IsRowMajorMatrix<MT>::value )?( value ):( MET( conj( value ) ) );
+   }
+
+   /*!\brief Returns the value of the element at the mirrored position of a row-major triangle.
+   */
+   static inline MET mirror( const MET& value ) {
+      return ( !HF || !IsRowMajorMatrix<MT>::value )?( value ):( MET( conj( value ) ) );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT1&       C_;       //!< The target dense matrix.
+   const MT&  A_;       //!< The stored triangle of the symmetric matrix.
+   const MT2& B_;       //!< The right-hand side dense matrix.
+   size_t     blocks_;  //!< The number of column blocks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTSYMMETRICMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactSymmetricMatrix operators */
+//@{
+template< typename Type, bool SO, bool HF >
+inline void swap( CompactSymmetricMatrix<Type,SO,HF>& a, CompactSymmetricMatrix<Type,SO,HF>& b ) /* throw() */;
+
+template< typename Type, bool SO, bool HF >
+inline const CompressedMatrix<Type,SO> expand( const CompactSymmetricMatrix<Type,SO,HF>& A );
+
+template< typename VT1, typename Type, bool SO, bool HF, typename VT2 >
+inline void symv( DenseVector<VT1,columnVector>& y, const CompactSymmetricMatrix<Type,SO,HF>& A,
+                  const DenseVector<VT2,columnVector>& x );
+
+template< typename MT1, bool SO1, typename Type, bool SO, bool HF, typename MT2, bool SO2 >
+inline void symm( DenseMatrix<MT1,SO1>& C, const CompactSymmetricMatrix<Type,SO,HF>& A,
+                  const DenseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compact symmetric matrices.
+// \ingroup compact_symmetric_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline void swap( CompactSymmetricMatrix<Type,SO,HF>& a, CompactSymmetricMatrix<Type,SO,HF>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a compact symmetric matrix into a general sparse matrix.
+// \ingroup compact_symmetric_matrix
+//
+// \param A The compact symmetric matrix to be converted.
+// \return The sparse matrix containing both triangles of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF >      // Hermitian flag
+inline const CompressedMatrix<Type,SO> expand( const CompactSymmetricMatrix<Type,SO,HF>& A )
+{
+   typedef typename CompressedMatrix<Type,SO>::ConstIterator  ConstIterator;
+
+   const CompressedMatrix<Type,SO>& T( A.triangle() );
+   const size_t n( T.rows() );
+
+   // Due to the opposite storage order the mirrored triangle has the same structure as the
+   // stored triangle and can be setup in a single pass
+   CompressedMatrix<Type,!SO> M( n, n, T.nonZeros() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const ConstIterator end( T.end(i) );
+      for( ConstIterator element=T.begin(i); element!=end; ++element ) {
+         if( element->index() == i ) continue;
+         if( SO == rowMajor )
+            M.append( element->index(), i, A.mirror( element->value() ) );
+         else
+            M.append( i, element->index(), A.mirror( element->value() ) );
+      }
+      M.finalize( i );
+   }
+
+   return CompressedMatrix<Type,SO>( T + M );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric sparse matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup compact_symmetric_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side compact symmetric matrix.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid size of target vector.
+//
+// This function computes the product of a symmetric (or Hermitian) sparse matrix and a dense
+// vector by a single pass over the stored triangle, which applies every stored element to both
+// its stored and its mirrored position. The target vector must already have the according size.
+// In case the thread parallelization of Blaze is active and the matrix is sufficiently large,
+// the multiplication is executed in parallel, where all mirrored contributions that cross the
+// boundaries of the threads are accumulated in thread-private buffers.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF        // Hermitian flag
+        , typename VT2 > // Type of the right-hand side dense vector
+inline void symv( DenseVector<VT1,columnVector>& y, const CompactSymmetricMatrix<Type,SO,HF>& A,
+                  const DenseVector<VT2,columnVector>& x )
+{
+   typedef typename VT2::ResultType                                   XT;
+   typedef typename RemoveReference<typename VT2::CompositeType>::Type  XCT;
+   typedef SymvKernel< VT1, CompressedMatrix<Type,SO>, XCT, HF >      Kernel;
+
+   if( A.columns() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( A.rows() != (~y).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of target vector" );
+   }
+
+   if( (~x).canAlias( &~y ) ) {
+      const XT tmp( ~x );
+      symv( ~y, A, tmp );
+      return;
+   }
+
+   typename VT2::CompositeType xc( ~x );  // Evaluation of the right-hand side dense vector
+
+   const size_t blocks( ( A.rows() > SMP_SMATDVECMULT_THRESHOLD && !isSerialSectionActive() )
+                        ?( min( getNumThreads(), A.rows() ) ):( 1UL ) );
+
+   Kernel kernel( ~y, A.triangle(), xc, blocks );
+
+   if( blocks < 2UL ) {
+      kernel( 0UL );
+   }
+   else {
+      smpFor( blocks, kernel );
+      kernel.startReduction();
+      smpFor( blocks, kernel );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric sparse matrix/dense matrix multiplication (\f$ C=A*B \f$).
+// \ingroup compact_symmetric_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side compact symmetric matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid size of target matrix.
+//
+// This function computes the product of a symmetric (or Hermitian) sparse matrix and a dense
+// matrix by a single pass over the stored triangle per block of columns. The target matrix
+// must already have the according size. In case the thread parallelization of Blaze is active
+// and the matrix is sufficiently large, the column blocks are computed in parallel.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF        // Hermitian flag
+        , typename MT2   // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void symm( DenseMatrix<MT1,SO1>& C, const CompactSymmetricMatrix<Type,SO,HF>& A,
+                  const DenseMatrix<MT2,SO2>& B )
+{
+   typedef typename MT2::ResultType                                   BT;
+   typedef typename RemoveReference<typename MT2::CompositeType>::Type  BCT;
+   typedef SymmKernel< MT1, CompressedMatrix<Type,SO>, BCT, HF >      Kernel;
+
+   if( A.columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( A.rows() != (~C).rows() || (~B).columns() != (~C).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size of target matrix" );
+   }
+
+   if( (~B).canAlias( &~C ) ) {
+      const BT tmp( ~B );
+      symm( ~C, A, tmp );
+      return;
+   }
+
+   typename MT2::CompositeType Bc( ~B );  // Evaluation of the right-hand side dense matrix
+
+   const size_t blocks( ( A.rows() > SMP_SMATDMATMULT_THRESHOLD && !isSerialSectionActive() )
+                        ?( min( getNumThreads(), (~B).columns() ) ):( 1UL ) );
+
+   if( blocks < 2UL ) {
+      Kernel kernel( ~C, A.triangle(), Bc, 1UL );
+      kernel( 0UL );
+   }
+   else {
+      Kernel kernel( ~C, A.triangle(), Bc, blocks );
+      smpFor( blocks, kernel );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact symmetric matrix and a
+//        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup compact_symmetric_matrix
+//
+// \param A The left-hand side compact symmetric matrix for the multiplication.
+// \param x The right-hand side dense vector for the multiplication.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// The multiplication is immediately evaluated by means of the symv() function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , bool HF        // Hermitian flag
+        , typename VT >  // Type of the right-hand side dense vector
+inline const DynamicVector< typename MultTrait<Type,typename VT::ElementType>::Type, columnVector >
+   operator*( const CompactSymmetricMatrix<Type,SO,HF>& A, const DenseVector<VT,columnVector>& x )
+{
+   typedef DynamicVector< typename MultTrait<Type,typename VT::ElementType>::Type, columnVector >  ResultType;
+
+   ResultType y( A.rows() );
+   symv( y, A, ~x );
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact symmetric matrix and a
+//        dense matrix (\f$ C=A*B \f$).
+// \ingroup compact_symmetric_matrix
+//
+// \param A The left-hand side compact symmetric matrix for the multiplication.
+// \param B The right-hand side dense matrix for the multiplication.
+// \return The resulting dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is immediately evaluated by means of the symm() function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO1       // Storage order of the compact symmetric matrix
+        , bool HF        // Hermitian flag
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline const DynamicMatrix< typename MultTrait<Type,typename MT::ElementType>::Type, SO2 >
+   operator*( const CompactSymmetricMatrix<Type,SO1,HF>& A, const DenseMatrix<MT,SO2>& B )
+{
+   typedef DynamicMatrix< typename MultTrait<Type,typename MT::ElementType>::Type, SO2 >  ResultType;
+
+   ResultType C( A.rows(), (~B).columns() );
+   symm( C, A, ~B );
+
+   return C;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -50,6 +50,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/Triplet.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -386,6 +387,17 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //@}
    //**********************************************************************************************
 
+   //**Bulk construction functions*****************************************************************
+   /*!\name Bulk construction functions */
+   //@{
+   template< typename TripletIterator >
+   inline void setFromTriplets( TripletIterator first, TripletIterator last );
+
+   template< typename TripletIterator, typename Combine >
+   void setFromTriplets( TripletIterator first, TripletIterator last, Combine combine );
+   //@}
+   //**********************************************************************************************
+
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
    //@{
@@ -466,11 +478,11 @@ const Type CompressedMatrix<Type,SO>::zero_ = Type();
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix()
-   : m_       ( 0UL )           // The current number of rows of the sparse matrix
-   , n_       ( 0UL )           // The current number of columns of the sparse matrix
-   , capacity_( 0UL )           // The current capacity of the pointer array
-   , begin_( new Iterator[2] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+1 )         // Pointers one past the last non-zero element of each row
+   : m_       ( 0UL )                     // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                     // The current number of columns of the sparse matrix
+   , capacity_( 0UL )                     // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+1 )                   // Pointers one past the last non-zero element of each row
 {
    begin_[0] = end_[0] = NULL;
 }
@@ -488,11 +500,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                             // The current number of rows of the sparse matrix
+   , n_       ( n )                             // The current number of columns of the sparse matrix
+   , capacity_( m )                             // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                   // Pointers one past the last non-zero element of each row
 {
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = NULL;
@@ -512,11 +524,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                             // The current number of rows of the sparse matrix
+   , n_       ( n )                             // The current number of columns of the sparse matrix
+   , capacity_( m )                             // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                   // Pointers one past the last non-zero element of each row
 {
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
@@ -540,11 +552,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
-   , capacity_( m )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                              // The current number of rows of the sparse matrix
+   , n_       ( n )                              // The current number of columns of the sparse matrix
+   , capacity_( m )                              // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m_+1UL) )                   // Pointers one past the last non-zero element of each row
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
@@ -568,11 +580,11 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
-   : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
-   , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
-   , capacity_( sm.m_ )                     // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( sm.m_ )                             // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                             // The current number of columns of the sparse matrix
+   , capacity_( sm.m_ )                             // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                   // Pointers one past the last non-zero element of each row
 {
    const size_t nonzeros( sm.nonZeros() );
 
@@ -594,11 +606,11 @@ template< typename Type  // Data type of the sparse matrix
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( (~dm).rows() )                      // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )                   // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                   // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
@@ -620,11 +632,11 @@ template< typename Type  // Data type of the sparse matrix
 template< typename MT    // Type of the foreign sparse matrix
         , bool SO2 >     // Storage order of the foreign sparse matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( (~sm).rows() )                      // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )                   // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                   // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
@@ -656,7 +668,7 @@ template< typename Type  // Data type of the sparse matrix
 inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 {
    deallocate( begin_[0UL] );
-   delete [] begin_;
+   deallocate( begin_ );
 }
 //*************************************************************************************************
 
@@ -874,7 +886,7 @@ inline CompressedMatrix<Type,SO>&
 
    if( rhs.m_ > capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.m_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*rhs.m_+2UL ) );
       Iterator* newEnd  ( newBegin+(rhs.m_+1UL) );
 
       newBegin[0UL] = allocate<Element>( nonzeros );
@@ -886,7 +898,7 @@ inline CompressedMatrix<Type,SO>&
       std::swap( begin_, newBegin );
       end_ = newEnd;
       deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( newBegin );
       capacity_ = rhs.m_;
    }
    else {
@@ -1387,7 +1399,7 @@ typename CompressedMatrix<Type,SO>::Iterator
    else {
       size_t newCapacity( extendCapacity() );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL );
       Iterator* newEnd   = newBegin+capacity_+1UL;
 
       newBegin[0UL] = allocate<Element>( newCapacity );
@@ -1417,7 +1429,7 @@ typename CompressedMatrix<Type,SO>::Iterator
       std::swap( newBegin, begin_ );
       end_ = newEnd;
       deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( newBegin );
 
       return tmp;
    }
@@ -1531,7 +1543,7 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( m > capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*m+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*m+2UL ) );
       Iterator* newEnd  ( newBegin+m+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -1554,7 +1566,7 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       newEnd[m] = end_[m_];
 
       std::swap( newBegin, begin_ );
-      delete [] newBegin;
+      deallocate( newBegin );
 
       end_ = newEnd;
       capacity_ = m;
@@ -1648,7 +1660,7 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
       const size_t newCapacity( begin_[m_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*m_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*m_+2UL ) );
       Iterator* newEnd  ( newBegin+m_+1UL );
 
       newBegin[0UL] = allocate<Element>( newCapacity );
@@ -1669,7 +1681,7 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 
       std::swap( newBegin, begin_ );
       deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( newBegin );
       end_ = newEnd;
       capacity_ = m_;
    }
@@ -1860,7 +1872,7 @@ template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 {
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+   Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL );
    Iterator* newEnd   = newBegin+capacity_+1UL;
 
    newBegin[0UL] = allocate<Element>( nonzeros );
@@ -1875,7 +1887,7 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 
    std::swap( newBegin, begin_ );
    deallocate( newBegin[0UL] );
-   delete [] newBegin;
+   deallocate( newBegin );
    end_ = newEnd;
 }
 //*************************************************************************************************
@@ -2143,6 +2155,142 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 
 
 
+//=================================================================================================
+//
+//  BULK CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting the elements of the compressed matrix from a sequence of triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces all elements of the compressed matrix by the elements given by the
+// triplets in the range \f$ [first,last) \f$. The triplets can be given in arbitrary order.
+// Duplicate elements are combined by addition. For more details see the setFromTriplets()
+// function with explicitly specified combination operation.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename TripletIterator >  // Type of the triplet iterator
+inline void CompressedMatrix<Type,SO>::setFromTriplets( TripletIterator first, TripletIterator last )
+{
+   setFromTriplets( first, last, std::plus<Type>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the elements of the compressed matrix from a sequence of triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \param combine The binary operation for the combination of duplicate elements.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces all elements of the compressed matrix by the elements given by the
+// triplets in the range \f$ [first,last) \f$. Each triplet has to provide the row(), column(),
+// and value() member functions (see for instance the Triplet class template). In contrast to
+// the insert() and the append() functions, the triplets can be given in arbitrary order and
+// may contain duplicate elements. Duplicates are combined in order of their appearance via
+// \a combine, i.e. the value of an element is computed as \c combine(combine(v1,v2),v3).
+
+   \code
+   std::vector< blaze::Triplet<double> > triplets;
+   // ... Filling the triplets in arbitrary order
+
+   blaze::CompressedMatrix<double,rowMajor> A( 1000, 1000 );
+   A.setFromTriplets( triplets.begin(), triplets.end() );  // Summing up duplicates
+   A.setFromTriplets( triplets.begin(), triplets.end(), std::multiplies<double>() );  // Multiplying duplicates
+   \endcode
+
+// The triplets are ordered by means of a stable two-pass counting sort (first by column index,
+// then by row index) in \f$ O(N_{nz}+M+N) \f$ time and the compressed matrix is filled via a
+// single allocation of exactly the required capacity. In case any triplet refers to an element
+// outside the matrix, a \a std::invalid_argument exception is thrown and the matrix remains
+// unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename TripletIterator  // Type of the triplet iterator
+        , typename Combine >        // Type of the combination operation
+void CompressedMatrix<Type,SO>::setFromTriplets( TripletIterator first, TripletIterator last, Combine combine )
+{
+   std::vector<size_t> rows;
+   std::vector<size_t> columns;
+   std::vector<Type>   values;
+
+   std::vector<size_t> rowOffsets   ( m_+1UL, 0UL );
+   std::vector<size_t> columnOffsets( n_+1UL, 0UL );
+
+   for( ; first!=last; ++first )
+   {
+      if( first->row() >= m_ || first->column() >= n_ ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid triplet index" );
+      }
+
+      rows.push_back   ( first->row()    );
+      columns.push_back( first->column() );
+      values.push_back ( first->value()  );
+
+      ++rowOffsets   [first->row()   +1UL];
+      ++columnOffsets[first->column()+1UL];
+   }
+
+   const size_t total( values.size() );
+
+   for( size_t j=0UL; j<n_; ++j )
+      columnOffsets[j+1UL] += columnOffsets[j];
+   for( size_t i=0UL; i<m_; ++i )
+      rowOffsets[i+1UL] += rowOffsets[i];
+
+   std::vector<size_t> byColumn( total );
+   std::vector<size_t> byRow   ( total );
+
+   for( size_t k=0UL; k<total; ++k )
+      byColumn[columnOffsets[columns[k]]++] = k;
+   for( size_t k=0UL; k<total; ++k )
+      byRow[rowOffsets[rows[byColumn[k]]]++] = byColumn[k];
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<total; ++k ) {
+      if( k == 0UL || rows[byRow[k]] != rows[byRow[k-1UL]] || columns[byRow[k]] != columns[byRow[k-1UL]] )
+         ++nonzeros;
+   }
+
+   reset();
+   reserve( nonzeros );
+
+   for( size_t i=0UL, k=0UL; i<m_; ++i )
+   {
+      // After the counting sort rowOffsets[i] is one past the last triplet of row i
+      for( ; k<rowOffsets[i]; ++k )
+      {
+         const size_t j( columns[byRow[k]] );
+         Type value( values[byRow[k]] );
+
+         while( k+1UL < rowOffsets[i] && columns[byRow[k+1UL]] == j ) {
+            ++k;
+            value = combine( value, values[byRow[k]] );
+         }
+
+         append( i, j, value );
+      }
+
+      finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
@@ -2651,6 +2799,17 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    //@}
    //**********************************************************************************************
 
+   //**Bulk construction functions*****************************************************************
+   /*!\name Bulk construction functions */
+   //@{
+   template< typename TripletIterator >
+   inline void setFromTriplets( TripletIterator first, TripletIterator last );
+
+   template< typename TripletIterator, typename Combine >
+   void setFromTriplets( TripletIterator first, TripletIterator last, Combine combine );
+   //@}
+   //**********************************************************************************************
+
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
    //@{
@@ -2732,11 +2891,11 @@ const Type CompressedMatrix<Type,true>::zero_ = Type();
 */
 template< typename Type >  // Data type of the sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix()
-   : m_       ( 0UL )             // The current number of rows of the sparse matrix
-   , n_       ( 0UL )             // The current number of columns of the sparse matrix
-   , capacity_( 0UL )             // The current capacity of the pointer array
-   , begin_( new Iterator[2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+1UL )         // Pointers one past the last non-zero element of each column
+   : m_       ( 0UL )                     // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                     // The current number of columns of the sparse matrix
+   , capacity_( 0UL )                     // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+1UL )                 // Pointers one past the last non-zero element of each column
 {
    begin_[0UL] = end_[0UL] = NULL;
 }
@@ -2755,11 +2914,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 */
 template< typename Type >  // Data type of the sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( m )                             // The current number of rows of the sparse matrix
+   , n_       ( n )                             // The current number of columns of the sparse matrix
+   , capacity_( n )                             // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*n+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                   // Pointers one past the last non-zero element of each column
 {
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = NULL;
@@ -2780,11 +2939,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( m )                             // The current number of rows of the sparse matrix
+   , n_       ( n )                             // The current number of columns of the sparse matrix
+   , capacity_( n )                             // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*n+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                   // Pointers one past the last non-zero element of each column
 {
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
@@ -2808,11 +2967,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 */
 template< typename Type >  // Data type of the sparse matrix
 CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
-   , capacity_( n )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( m )                              // The current number of rows of the sparse matrix
+   , n_       ( n )                              // The current number of columns of the sparse matrix
+   , capacity_( n )                              // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n_+1UL) )                   // Pointers one past the last non-zero element of each column
 {
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
 
@@ -2837,11 +2996,11 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 */
 template< typename Type >  // Data type of the sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
-   : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
-   , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
-   , capacity_( sm.n_ )                     // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( sm.m_ )                             // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                             // The current number of columns of the sparse matrix
+   , capacity_( sm.n_ )                             // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                   // Pointers one past the last non-zero element of each column
 {
    const size_t nonzeros( sm.nonZeros() );
 
@@ -2864,11 +3023,11 @@ template< typename Type >  // Data type of the sparse matrix
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( (~dm).rows() )                      // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )                   // The current number of columns of the sparse matrix
+   , capacity_( n_ )                                // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                   // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
@@ -2891,11 +3050,11 @@ template< typename Type >  // Data type of the sparse matrix
 template< typename MT      // Type of the foreign sparse matrix
         , bool SO >        // Storage order of the foreign sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( (~sm).rows() )                      // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )                   // The current number of columns of the sparse matrix
+   , capacity_( n_ )                                // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                   // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
@@ -2928,7 +3087,7 @@ template< typename Type >  // Data type of the sparse matrix
 inline CompressedMatrix<Type,true>::~CompressedMatrix()
 {
    deallocate( begin_[0UL] );
-   delete [] begin_;
+   deallocate( begin_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3125,7 +3284,7 @@ inline CompressedMatrix<Type,true>&
 
    if( rhs.n_ > capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.n_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*rhs.n_+2UL ) );
       Iterator* newEnd  ( newBegin+(rhs.n_+1UL) );
 
       newBegin[0UL] = allocate<Element>( nonzeros );
@@ -3137,7 +3296,7 @@ inline CompressedMatrix<Type,true>&
       std::swap( begin_, newBegin );
       end_ = newEnd;
       deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( newBegin );
       capacity_ = rhs.n_;
    }
    else {
@@ -3644,7 +3803,7 @@ typename CompressedMatrix<Type,true>::Iterator
    else {
       size_t newCapacity( extendCapacity() );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL );
       Iterator* newEnd   = newBegin+capacity_+1UL;
 
       newBegin[0UL] = allocate<Element>( newCapacity );
@@ -3674,7 +3833,7 @@ typename CompressedMatrix<Type,true>::Iterator
       std::swap( newBegin, begin_ );
       end_ = newEnd;
       deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( newBegin );
 
       return tmp;
    }
@@ -3788,7 +3947,7 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    if( n > capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*n+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*n+2UL ) );
       Iterator* newEnd  ( newBegin+n+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -3811,7 +3970,7 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       newEnd[n] = end_[n_];
 
       std::swap( newBegin, begin_ );
-      delete [] newBegin;
+      deallocate( newBegin );
 
       end_ = newEnd;
       capacity_ = n;
@@ -3904,7 +4063,7 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
       const size_t newCapacity( begin_[n_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*n_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*n_+2UL ) );
       Iterator* newEnd  ( newBegin+n_+1UL );
 
       newBegin[0UL] = allocate<Element>( newCapacity );
@@ -3925,7 +4084,7 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 
       std::swap( newBegin, begin_ );
       deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( newBegin );
       end_ = newEnd;
       capacity_ = n_;
    }
@@ -4123,7 +4282,7 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const
 template< typename Type >  // Data type of the sparse matrix
 void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 {
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+   Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL );
    Iterator* newEnd   = newBegin+capacity_+1UL;
 
    newBegin[0UL] = allocate<Element>( nonzeros );
@@ -4138,7 +4297,7 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 
    std::swap( newBegin, begin_ );
    deallocate( newBegin[0UL] );
-   delete [] newBegin;
+   deallocate( newBegin );
    end_ = newEnd;
 }
 /*! \endcond */
@@ -4402,6 +4561,144 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 
 
 
+//=================================================================================================
+//
+//  BULK CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the elements of the compressed matrix from a sequence of triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces all elements of the compressed matrix by the elements given by the
+// triplets in the range \f$ [first,last) \f$. The triplets can be given in arbitrary order.
+// Duplicate elements are combined by addition. For more details see the setFromTriplets()
+// function with explicitly specified combination operation.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename TripletIterator >  // Type of the triplet iterator
+inline void CompressedMatrix<Type,true>::setFromTriplets( TripletIterator first, TripletIterator last )
+{
+   setFromTriplets( first, last, std::plus<Type>() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the elements of the compressed matrix from a sequence of triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \param combine The binary operation for the combination of duplicate elements.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces all elements of the compressed matrix by the elements given by the
+// triplets in the range \f$ [first,last) \f$. Each triplet has to provide the row(), column(),
+// and value() member functions (see for instance the Triplet class template). In contrast to
+// the insert() and the append() functions, the triplets can be given in arbitrary order and
+// may contain duplicate elements. Duplicates are combined in order of their appearance via
+// \a combine, i.e. the value of an element is computed as \c combine(combine(v1,v2),v3).
+
+   \code
+   std::vector< blaze::Triplet<double> > triplets;
+   // ... Filling the triplets in arbitrary order
+
+   blaze::CompressedMatrix<double,columnMajor> A( 1000, 1000 );
+   A.setFromTriplets( triplets.begin(), triplets.end() );  // Summing up duplicates
+   A.setFromTriplets( triplets.begin(), triplets.end(), std::multiplies<double>() );  // Multiplying duplicates
+   \endcode
+
+// The triplets are ordered by means of a stable two-pass counting sort (first by row index, then
+// by column index) in \f$ O(N_{nz}+M+N) \f$ time and the compressed matrix is filled via a
+// single allocation of exactly the required capacity. In case any triplet refers to an element
+// outside the matrix, a \a std::invalid_argument exception is thrown and the matrix remains
+// unchanged.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename TripletIterator  // Type of the triplet iterator
+        , typename Combine >        // Type of the combination operation
+void CompressedMatrix<Type,true>::setFromTriplets( TripletIterator first, TripletIterator last, Combine combine )
+{
+   std::vector<size_t> rows;
+   std::vector<size_t> columns;
+   std::vector<Type>   values;
+
+   std::vector<size_t> rowOffsets   ( m_+1UL, 0UL );
+   std::vector<size_t> columnOffsets( n_+1UL, 0UL );
+
+   for( ; first!=last; ++first )
+   {
+      if( first->row() >= m_ || first->column() >= n_ ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid triplet index" );
+      }
+
+      rows.push_back   ( first->row()    );
+      columns.push_back( first->column() );
+      values.push_back ( first->value()  );
+
+      ++rowOffsets   [first->row()   +1UL];
+      ++columnOffsets[first->column()+1UL];
+   }
+
+   const size_t total( values.size() );
+
+   for( size_t j=0UL; j<n_; ++j )
+      columnOffsets[j+1UL] += columnOffsets[j];
+   for( size_t i=0UL; i<m_; ++i )
+      rowOffsets[i+1UL] += rowOffsets[i];
+
+   std::vector<size_t> byColumn( total );
+   std::vector<size_t> byRow   ( total );
+
+   for( size_t k=0UL; k<total; ++k )
+      byRow[rowOffsets[rows[k]]++] = k;
+   for( size_t k=0UL; k<total; ++k )
+      byColumn[columnOffsets[columns[byRow[k]]]++] = byRow[k];
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<total; ++k ) {
+      if( k == 0UL || columns[byColumn[k]] != columns[byColumn[k-1UL]] || rows[byColumn[k]] != rows[byColumn[k-1UL]] )
+         ++nonzeros;
+   }
+
+   reset();
+   reserve( nonzeros );
+
+   for( size_t j=0UL, k=0UL; j<n_; ++j )
+   {
+      // After the counting sort columnOffsets[j] is one past the last triplet of column j
+      for( ; k<columnOffsets[j]; ++k )
+      {
+         const size_t i( rows[byColumn[k]] );
+         Type value( values[byColumn[k]] );
+
+         while( k+1UL < columnOffsets[j] && rows[byColumn[k+1UL]] == i ) {
+            ++k;
+            value = combine( value, values[byColumn[k]] );
+         }
+
+         append( i, j, value );
+      }
+
+      finalize( j );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
@@ -0,0 +1,1531 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/GappedCompressedMatrix.h
+//  \brief Implementation of a row-major sparse matrix with per-row gaps for fast insertion
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_GAPPEDCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_GAPPEDCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/SameSize.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup gapped_compressed_matrix GappedCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Row-major sparse matrix with per-row gaps for high-rate incremental updates.
+// \ingroup gapped_compressed_matrix
+//
+// The GappedCompressedMatrix class template stores the non-zero elements of all rows in a
+// single element array in the same way as the row-major CompressedMatrix. In contrast to the
+// CompressedMatrix, which only keeps free capacity at the end of the element array and therefore
+// has to move all following rows in case an element is inserted into a full row, the free
+// capacity is spread over the rows of the matrix in the style of a packed memory array:
+
+   \code
+   template< typename Type >
+   class GappedCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. GappedCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//
+// In case an element is inserted into a row without free capacity, the matrix searches for the
+// smallest aligned window of \f$ 2^l \f$ rows around the row whose density is below the density
+// threshold of the window (starting at 1 for single rows and decreasing to 0.75 for the entire
+// matrix) and spreads the free capacity of the window evenly over its rows. Only if the entire
+// matrix exceeds its threshold, the element array is reallocated with twice the number of
+// non-zero elements (but at least one free element per row). This results in amortized \f$ O(\log^2 m) \f$ element moves per insertion, in
+// addition to the moves within the row. Erasing elements never moves elements of other rows.
+//
+// The matrix is primarily designed as target for element-wise updates via the function call
+// operator or the set(), insert(), and erase() functions. It can be used as operand in all
+// sparse matrix expressions, but for repeated read-only kernels it should be converted into a
+// CompressedMatrix via the compact() function:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::GappedCompressedMatrix;
+
+   GappedCompressedMatrix<double> G( 1000000UL, 1000000UL );
+
+   // Incremental insertion of edges in arbitrary order
+   G.set( 42UL, 7UL, 1.0 );
+   G(7UL,42UL) = 1.0;
+   // ...
+
+   // Conversion into a compressed matrix for fast read-only kernels
+   const CompressedMatrix<double> A( G.compact() );
+
+   DynamicVector<double> x( 1000000UL, 1.0 ), y;
+   y = A * x;
+   \endcode
+*/
+template< typename Type >  // Data type of the sparse matrix
+class GappedCompressedMatrix : public SparseMatrix< GappedCompressedMatrix<Type>, rowMajor >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   //**********************************************************************************************
+
+   //**Private class Element***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Value-index-pair for the GappedCompressedMatrix class.
+   */
+   struct Element : public ElementBase
+   {
+      // This operator is required due to a bug in all versions of the the MSVC compiler.
+      // A simple 'using ElementBase::operator=;' statement results in ambiguity problems.
+      template< typename Other >
+      inline Element& operator=( const Other& rhs )
+      {
+         ElementBase::operator=( rhs );
+         return *this;
+      }
+
+      friend class GappedCompressedMatrix;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() function.
+   */
+   struct FindIndex : public std::binary_function<Element,size_t,bool>
+   {
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+      inline bool operator()( const Element& element1, const Element& element2 ) const {
+         return element1.index() < element2.index();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef GappedCompressedMatrix<Type>        This;            //!< Type of this GappedCompressedMatrix instance.
+   typedef CompressedMatrix<Type,rowMajor>     ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,columnMajor>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                         ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>             Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef Element*                            Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                      ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a GappedCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef GappedCompressedMatrix<ET>  Other;  //!< The type of the other GappedCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the gapped compressed matrix is not used as target of expression
+       template assignments, the \a smpAssignable compilation flag is set to \a false. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline GappedCompressedMatrix();
+   explicit inline GappedCompressedMatrix( size_t m, size_t n );
+   explicit inline GappedCompressedMatrix( size_t m, size_t n, size_t nonzeros );
+            inline GappedCompressedMatrix( const GappedCompressedMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline GappedCompressedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~GappedCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline GappedCompressedMatrix& operator=( const GappedCompressedMatrix& rhs );
+
+   template< typename MT, bool SO > inline GappedCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   rows() const;
+   inline size_t   columns() const;
+   inline size_t   capacity() const;
+   inline size_t   capacity( size_t i ) const;
+   inline size_t   nonZeros() const;
+   inline size_t   nonZeros( size_t i ) const;
+   inline void     reset();
+   inline void     reset( size_t i );
+   inline void     clear();
+   inline Iterator set    ( size_t i, size_t j, const Type& value );
+   inline Iterator insert ( size_t i, size_t j, const Type& value );
+   inline void     erase  ( size_t i, size_t j );
+   inline Iterator erase  ( size_t i, Iterator pos );
+   inline Iterator erase  ( size_t i, Iterator first, Iterator last );
+   inline void     reserve( size_t nonzeros );
+   inline void     swap( GappedCompressedMatrix& sm ) /* throw() */;
+
+   inline const CompressedMatrix<Type,rowMajor> compact() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+          Iterator insert    ( Iterator pos, size_t i, size_t j, const Type& value );
+          void     rebalance ( size_t i );
+          void     spread    ( size_t first, size_t last, size_t i, size_t nonzeros );
+          void     relocate  ( size_t capacity, size_t i );
+   inline size_t   gap       ( size_t k, size_t first, size_t last, size_t i, size_t gaps ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;          //!< The current number of rows of the sparse matrix.
+   size_t n_;          //!< The current number of columns of the sparse matrix.
+   size_t nonzeros_;   //!< The current number of non-zero elements of the sparse matrix.
+   Iterator* begin_;   //!< Pointers to the first non-zero element of each row.
+   Iterator* end_;     //!< Pointers one past the last non-zero element of each row.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_HAVE_SAME_SIZE       ( ElementBase, Element );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type >
+const Type GappedCompressedMatrix<Type>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for GappedCompressedMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline GappedCompressedMatrix<Type>::GappedCompressedMatrix()
+   : m_       ( 0UL )                     // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                     // The current number of columns of the sparse matrix
+   , nonzeros_( 0UL )                     // The current number of non-zero elements
+   , begin_( allocate<Iterator>( 2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+1 )                   // Pointers one past the last non-zero element of each row
+{
+   begin_[0UL] = end_[0UL] = NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline GappedCompressedMatrix<Type>::GappedCompressedMatrix( size_t m, size_t n )
+   : m_       ( m )                             // The current number of rows of the sparse matrix
+   , n_       ( n )                             // The current number of columns of the sparse matrix
+   , nonzeros_( 0UL )                           // The current number of non-zero elements
+   , begin_( allocate<Iterator>( 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                   // Pointers one past the last non-zero element of each row
+{
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+//
+// The matrix is initialized to the zero matrix. The capacity for \a nonzeros elements is
+// spread evenly over all rows of the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline GappedCompressedMatrix<Type>::GappedCompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( m )                             // The current number of rows of the sparse matrix
+   , n_       ( n )                             // The current number of columns of the sparse matrix
+   , nonzeros_( 0UL )                           // The current number of non-zero elements
+   , begin_( allocate<Iterator>( 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                   // Pointers one past the last non-zero element of each row
+{
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = NULL;
+
+   reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for GappedCompressedMatrix.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The copy preserves the distribution of the free capacity over the rows of the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline GappedCompressedMatrix<Type>::GappedCompressedMatrix( const GappedCompressedMatrix& sm )
+   : m_       ( sm.m_ )                          // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                          // The current number of columns of the sparse matrix
+   , nonzeros_( sm.nonzeros_ )                   // The current number of non-zero elements
+   , begin_( allocate<Iterator>( 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m_+1UL) )                   // Pointers one past the last non-zero element of each row
+{
+   const size_t capacity( sm.capacity() );
+
+   begin_[0UL] = ( capacity > 0UL )?( allocate<Element>( capacity ) ):( NULL );
+   end_[m_] = begin_[0UL] + capacity;
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = begin_[i] + sm.capacity( i );
+      end_[i] = std::copy( sm.begin_[i], sm.end_[i], begin_[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// The non-zero elements of the given matrix are copied into an element array of twice the
+// number of non-zero elements (but at least one free element per row), whose free capacity
+// is spread evenly over the rows.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline GappedCompressedMatrix<Type>::GappedCompressedMatrix( const Matrix<MT,SO>& m )
+   : m_       ( (~m).rows() )                    // The current number of rows of the sparse matrix
+   , n_       ( (~m).columns() )                 // The current number of columns of the sparse matrix
+   , nonzeros_( 0UL )                            // The current number of non-zero elements
+   , begin_( allocate<Iterator>( 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m_+1UL) )                   // Pointers one past the last non-zero element of each row
+{
+   typedef typename CompressedMatrix<Type,rowMajor>::ConstIterator  RhsIterator;
+
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = NULL;
+
+   const CompressedMatrix<Type,rowMajor> tmp( ~m );
+   const size_t nonzeros( tmp.nonZeros() );
+
+   if( nonzeros == 0UL )
+      return;
+
+   const size_t capacity( max( 2UL*nonzeros, nonzeros + m_ ) );
+
+   begin_[0UL] = allocate<Element>( capacity );
+   end_[m_] = begin_[0UL] + capacity;
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = begin_[i];
+      for( RhsIterator element=tmp.begin(i); element!=tmp.end(i); ++element, ++end_[i] ) {
+         end_[i]->value_ = element->value();
+         end_[i]->index_ = element->index();
+      }
+      begin_[i+1UL] = end_[i] + gap( i, 0UL, m_, 0UL, capacity - nonzeros );
+   }
+
+   nonzeros_ = nonzeros;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for GappedCompressedMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline GappedCompressedMatrix<Type>::~GappedCompressedMatrix()
+{
+   deallocate( begin_[0UL] );
+   deallocate( begin_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a proxy to the accessed element. In case the element is written, it
+// is inserted into the matrix. Note that this insertion may redistribute the elements of the
+// neighboring rows and therefore invalidates all iterators into the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Reference
+   GappedCompressedMatrix<Type>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstReference
+   GappedCompressedMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end_[i] || pos->index_ != j )
+      return zero_;
+   else
+      return pos->value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstIterator
+   GappedCompressedMatrix<Type>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstIterator
+   GappedCompressedMatrix<Type>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstIterator
+   GappedCompressedMatrix<Type>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstIterator
+   GappedCompressedMatrix<Type>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for GappedCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline GappedCompressedMatrix<Type>&
+   GappedCompressedMatrix<Type>::operator=( const GappedCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   GappedCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The matrix is resized according to the given matrix and initialized as a copy of this matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline GappedCompressedMatrix<Type>&
+   GappedCompressedMatrix<Type>::operator=( const Matrix<MT,SO>& rhs )
+{
+   GappedCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t GappedCompressedMatrix<Type>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t GappedCompressedMatrix<Type>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t GappedCompressedMatrix<Type>::capacity() const
+{
+   return end_[m_] - begin_[0UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t GappedCompressedMatrix<Type>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t GappedCompressedMatrix<Type>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t GappedCompressedMatrix<Type>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero elements. The capacity of the rows remains unchanged.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void GappedCompressedMatrix<Type>::reset()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      end_[i] = begin_[i];
+
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row.
+// \return void
+//
+// This function removes all non-zero elements of row \a i. The capacity of the row remains
+// unchanged.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void GappedCompressedMatrix<Type>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   nonzeros_ -= end_[i] - begin_[i];
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void GappedCompressedMatrix<Type>::clear()
+{
+   GappedCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the sparse matrix. In case the sparse matrix
+// already contains an element with row index \a i and column index \a j its value is modified,
+// else a new element with the given \a value is inserted.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[i] && pos->index_ == j ) {
+       pos->value() = value;
+       return pos;
+   }
+   else return insert( pos, i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts a new element into the sparse matrix. However, duplicate elements are
+// not allowed. In case the sparse matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[i] && pos->index_ == j ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param pos The position of the new element.
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+//
+// In case row \a i has no free capacity, the free capacity of the surrounding rows is
+// redistributed first, which guarantees at least one free element in row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+{
+   if( end_[i] == begin_[i+1UL] ) {
+      const size_t offset( pos - begin_[i] );
+      rebalance( i );
+      pos = begin_[i] + offset;
+   }
+
+   BLAZE_INTERNAL_ASSERT( end_[i] != begin_[i+1UL], "No free capacity in row detected" );
+
+   std::copy_backward( pos, end_[i], end_[i]+1 );
+   pos->value_ = value;
+   pos->index_ = j;
+   ++end_[i];
+   ++nonzeros_;
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the sparse matrix. The capacity of row \a i remains
+// unchanged.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void GappedCompressedMatrix<Type>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( find( i, j ) );
+   if( pos != end_[i] ) {
+      end_[i] = std::copy( pos+1, end_[i], pos );
+      --nonzeros_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid sparse matrix iterator" );
+
+   if( pos != end_[i] ) {
+      end_[i] = std::copy( pos+1, end_[i], pos );
+      --nonzeros_;
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
+   BLAZE_USER_ASSERT( first >= begin_[i] && first <= end_[i], "Invalid sparse matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin_[i] && last  <= end_[i], "Invalid sparse matrix iterator" );
+
+   if( first != last ) {
+      end_[i] = std::copy( last, end_[i], first );
+      nonzeros_ -= last - first;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// The additional capacity is spread evenly over all rows of the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void GappedCompressedMatrix<Type>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() && m_ > 0UL )
+      relocate( nonzeros, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void GappedCompressedMatrix<Type>::swap( GappedCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( nonzeros_, sm.nonzeros_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_, sm.end_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of the sparse matrix into a compressed matrix without free capacity.
+//
+// \return The compressed matrix containing the non-zero elements of the sparse matrix.
+//
+// This function copies all non-zero elements into a row-major CompressedMatrix, which stores
+// the rows without gaps and is therefore better suited for repeated read-only kernels.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const CompressedMatrix<Type,rowMajor> GappedCompressedMatrix<Type>::compact() const
+{
+   CompressedMatrix<Type,rowMajor> tmp( m_, n_, nonzeros_ );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( ConstIterator element=begin_[i]; element!=end_[i]; ++element )
+         tmp.append( i, element->index_, element->value_ );
+      tmp.finalize( i );
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Providing free capacity for row \a i by redistributing the surrounding rows.
+//
+// \param i The index of the full row.
+// \return void
+//
+// This function considers windows of \f$ 2^l \f$ rows aligned to multiples of \f$ 2^l \f$ that
+// contain row \a i. The free capacity of the smallest window whose density after the insertion
+// is below \f$ 1 - 0.25 \cdot l / h \f$ (with \f$ h \f$ being the level of the window spanning
+// all rows) is spread evenly over the rows of the window. In case no such window exists, the
+// element array is reallocated with twice the number of non-zero elements, but at least one
+// free element per row. Without the latter, a matrix with fewer non-zero elements than rows
+// would have to spread the entire matrix for almost every insertion.
+*/
+template< typename Type >  // Data type of the sparse matrix
+void GappedCompressedMatrix<Type>::rebalance( size_t i )
+{
+   size_t height( 0UL );
+   while( ( 1UL << height ) < m_ )
+      ++height;
+
+   for( size_t level=1UL; level<=height; ++level )
+   {
+      const size_t first( ( i >> level ) << level );
+      const size_t last ( min( first + ( 1UL << level ), m_ ) );
+
+      size_t nonzeros( 0UL );
+      for( size_t k=first; k<last; ++k )
+         nonzeros += end_[k] - begin_[k];
+
+      const size_t capacity( begin_[last] - begin_[first] );
+      const double threshold( 1.0 - ( 0.25 * level ) / height );
+
+      if( double( nonzeros + 1UL ) <= threshold * double( capacity ) ) {
+         spread( first, last, i, nonzeros );
+         return;
+      }
+   }
+
+   relocate( max( 2UL*( nonzeros_ + 1UL ), nonzeros_ + 1UL + m_ ), i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Even redistribution of the free capacity of a window of rows.
+//
+// \param first The index of the first row of the window.
+// \param last The index one past the last row of the window.
+// \param i The row receiving the remainder of the free capacity first.
+// \param nonzeros The total number of non-zero elements of the window.
+// \return void
+//
+// The rows moving towards the front of the window are moved in ascending order, the rows moving
+// towards the end of the window in descending order, which guarantees that no row overwrites the
+// elements of a row that has not been moved yet.
+*/
+template< typename Type >  // Data type of the sparse matrix
+void GappedCompressedMatrix<Type>::spread( size_t first, size_t last, size_t i, size_t nonzeros )
+{
+   const size_t gaps( begin_[last] - begin_[first] - nonzeros );
+
+   std::vector<Iterator> target( last - first + 1UL );
+   target[0UL] = begin_[first];
+
+   for( size_t k=first; k<last; ++k ) {
+      target[k-first+1UL] = target[k-first] + ( end_[k] - begin_[k] ) + gap( k, first, last, i, gaps );
+   }
+
+   for( size_t k=first; k<last; ++k ) {
+      if( target[k-first] < begin_[k] ) {
+         end_[k] = std::copy( begin_[k], end_[k], target[k-first] );
+         begin_[k] = target[k-first];
+      }
+   }
+
+   for( size_t k=last; k>first; --k ) {
+      if( target[k-first-1UL] > begin_[k-1UL] ) {
+         const size_t count( end_[k-1UL] - begin_[k-1UL] );
+         std::copy_backward( begin_[k-1UL], end_[k-1UL], target[k-first-1UL]+count );
+         begin_[k-1UL] = target[k-first-1UL];
+         end_[k-1UL] = begin_[k-1UL] + count;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reallocation of the element array with even distribution of the free capacity.
+//
+// \param capacity The new capacity of the sparse matrix.
+// \param i The row receiving the remainder of the free capacity first.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+void GappedCompressedMatrix<Type>::relocate( size_t capacity, size_t i )
+{
+   BLAZE_INTERNAL_ASSERT( capacity > nonzeros_, "Invalid capacity detected" );
+
+   const Iterator elements( begin_[0UL] );
+   Iterator position( allocate<Element>( capacity ) );
+
+   for( size_t k=0UL; k<m_; ++k ) {
+      const Iterator next( std::copy( begin_[k], end_[k], position ) );
+      begin_[k] = position;
+      end_[k] = next;
+      position = next + gap( k, 0UL, m_, i, capacity - nonzeros_ );
+   }
+
+   begin_[m_] = end_[m_] = position;
+
+   deallocate( elements );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the share of row \a k of the free capacity of a window of rows.
+//
+// \param k The index of the row.
+// \param first The index of the first row of the window.
+// \param last The index one past the last row of the window.
+// \param i The row receiving the remainder of the free capacity first.
+// \param gaps The total free capacity of the window.
+// \return The free capacity of row \a k.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t GappedCompressedMatrix<Type>::gap( size_t k, size_t first, size_t last, size_t i, size_t gaps ) const
+{
+   const size_t rows( last - first );
+   return gaps / rows + ( ( k + rows - i ) % rows < gaps % rows ? 1UL : 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// Note that the returned iterator is subject to invalidation due to inserting operations via
+// the function call operator or the set() and insert() functions!
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::find( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// Note that the returned iterator is subject to invalidation due to inserting operations via
+// the function call operator or the set() and insert() functions!
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstIterator
+   GappedCompressedMatrix<Type>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end_[i] && pos->index_ == j )
+      return pos;
+   else return end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::lowerBound( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstIterator
+   GappedCompressedMatrix<Type>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::Iterator
+   GappedCompressedMatrix<Type>::upperBound( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename GappedCompressedMatrix<Type>::ConstIterator
+   GappedCompressedMatrix<Type>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return std::upper_bound( begin_[i], end_[i], j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool GappedCompressedMatrix<Type>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool GappedCompressedMatrix<Type>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false, since the matrix is not used as target of SMP assignments.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline bool GappedCompressedMatrix<Type>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GAPPEDCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name GappedCompressedMatrix operators */
+//@{
+template< typename Type >
+inline void reset( GappedCompressedMatrix<Type>& m );
+
+template< typename Type >
+inline void reset( GappedCompressedMatrix<Type>& m, size_t i );
+
+template< typename Type >
+inline void clear( GappedCompressedMatrix<Type>& m );
+
+template< typename Type >
+inline bool isDefault( const GappedCompressedMatrix<Type>& m );
+
+template< typename Type >
+inline bool isIntact( const GappedCompressedMatrix<Type>& m );
+
+template< typename Type >
+inline void swap( GappedCompressedMatrix<Type>& a, GappedCompressedMatrix<Type>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given gapped compressed matrix.
+// \ingroup gapped_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void reset( GappedCompressedMatrix<Type>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the specified row of the given gapped compressed matrix.
+// \ingroup gapped_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void reset( GappedCompressedMatrix<Type>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given gapped compressed matrix.
+// \ingroup gapped_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void clear( GappedCompressedMatrix<Type>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given gapped compressed matrix is in default state.
+// \ingroup gapped_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix has a size of 0, \a false otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline bool isDefault( const GappedCompressedMatrix<Type>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given gapped compressed matrix are intact.
+// \ingroup gapped_compressed_matrix
+//
+// \param m The matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline bool isIntact( const GappedCompressedMatrix<Type>& m )
+{
+   size_t nonzeros( 0UL );
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<m.rows(); ++i ) {
+      nonzeros += m.nonZeros( i );
+      capacity += m.capacity( i );
+      if( m.nonZeros( i ) > m.capacity( i ) )
+         return false;
+   }
+
+   return ( nonzeros == m.nonZeros() && capacity == m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two gapped compressed matrices.
+// \ingroup gapped_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void swap( GappedCompressedMatrix<Type>& a, GappedCompressedMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,236 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Triplet.h
+//  \brief Header file for the Triplet class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLET_H_
+#define _BLAZE_MATH_SPARSE_TRIPLET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Row-column-value triplet for the bulk construction of sparse matrices.
+// \ingroup math
+//
+// The Triplet class represents a single matrix element given by its row index, its column index
+// and its value. Sequences of triplets are the input of the setFromTriplets() function of the
+// CompressedMatrix class template:
+
+   \code
+   std::vector< blaze::Triplet<double> > triplets;
+   triplets.push_back( blaze::Triplet<double>( 2, 1, 4.0 ) );
+   triplets.push_back( blaze::Triplet<double>( 0, 3, 1.0 ) );
+   triplets.push_back( blaze::Triplet<double>( 2, 1, 2.0 ) );
+
+   blaze::CompressedMatrix<double> A( 3, 4 );
+   A.setFromTriplets( triplets.begin(), triplets.end() );  // A(2,1) == 6.0, A(0,3) == 1.0
+   \endcode
+
+// Note that setFromTriplets() accepts any triplet type that provides the row(), column(), and
+// value() member functions.
+*/
+template< typename Type >  // Type of the value element
+class Triplet
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type         ValueType;       //!< The value type of the triplet.
+   typedef size_t       IndexType;       //!< The index type of the triplet.
+   typedef Type&        Reference;       //!< Reference return type.
+   typedef const Type&  ConstReference;  //!< Reference-to-const return type.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   inline Triplet();
+   inline Triplet( size_t i, size_t j, const Type& v );
+   // No explicitly declared copy constructor.
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   //@}
+   //**********************************************************************************************
+
+   //**Acess functions*****************************************************************************
+   /*!\name Access functions */
+   //@{
+   inline IndexType      row() const;
+   inline IndexType      column() const;
+   inline Reference      value();
+   inline ConstReference value() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t row_;     //!< Row index of the triplet.
+   size_t column_;  //!< Column index of the triplet.
+   Type   value_;   //!< Value of the triplet.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for triplets.
+*/
+template< typename Type >  // Type of the value element
+inline Triplet<Type>::Triplet()
+   : row_   ()  // Row index of the triplet
+   , column_()  // Column index of the triplet
+   , value_ ()  // Value of the triplet
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a direct initialization of triplets.
+//
+// \param i The row index of the triplet.
+// \param j The column index of the triplet.
+// \param v The value of the triplet.
+*/
+template< typename Type >  // Type of the value element
+inline Triplet<Type>::Triplet( size_t i, size_t j, const Type& v )
+   : row_   ( i )  // Row index of the triplet
+   , column_( j )  // Column index of the triplet
+   , value_ ( v )  // Value of the triplet
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the row index of the triplet.
+//
+// \return The row index of the triplet.
+*/
+template< typename Type >  // Type of the value element
+inline typename Triplet<Type>::IndexType Triplet<Type>::row() const
+{
+   return row_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the column index of the triplet.
+//
+// \return The column index of the triplet.
+*/
+template< typename Type >  // Type of the value element
+inline typename Triplet<Type>::IndexType Triplet<Type>::column() const
+{
+   return column_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the value of the triplet.
+//
+// \return Reference to the value of the triplet.
+*/
+template< typename Type >  // Type of the value element
+inline typename Triplet<Type>::Reference Triplet<Type>::value()
+{
+   return value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the value of the triplet.
+//
+// \return Reference-to-const to the value of the triplet.
+*/
+template< typename Type >  // Type of the value element
+inline typename Triplet<Type>::ConstReference Triplet<Type>::value() const
+{
+   return value_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -53,6 +53,7 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TransExpr.h>
 #include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Submatrix.h>
 #include <blaze/math/Functions.h>
@@ -986,6 +987,19 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::transposition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -1022,7 +1036,14 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    inline typename EnableIf< VectorizedAssign<MT2> >::Type
       assign( const DenseMatrix<MT2,SO>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,!SO>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,!SO>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,!SO>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,SO>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,!SO>& rhs );
 
@@ -1034,7 +1055,14 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    inline typename EnableIf< VectorizedAddAssign<MT2> >::Type
       addAssign( const DenseMatrix<MT2,SO>& rhs );
 
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,!SO>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,!SO>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,!SO>& rhs );
+
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,SO>&  rhs );
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,!SO>& rhs );
 
@@ -1046,7 +1074,14 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    inline typename EnableIf< VectorizedSubAssign<MT2> >::Type
       subAssign( const DenseMatrix<MT2,SO>& rhs );
 
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,!SO>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,!SO>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,!SO>& rhs );
+
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,SO>&  rhs );
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,!SO>& rhs );
    //@}
@@ -2805,7 +2840,8 @@ template< typename MT     // Type of the dense matrix
         , bool AF         // Alignment flag
         , bool SO >       // Storage order
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,AF,SO>::assign( const DenseMatrix<MT2,!SO>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,AF,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,AF,SO>::assign( const DenseMatrix<MT2,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -2829,6 +2865,34 @@ inline void DenseSubmatrix<MT,AF,SO>::assign( const DenseMatrix<MT2,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool AF         // Alignment flag
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,AF,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,AF,SO>::assign( const DenseMatrix<MT2,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -2993,7 +3057,8 @@ template< typename MT     // Type of the dense matrix
         , bool AF         // Alignment flag
         , bool SO >       // Storage order
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,AF,SO>::addAssign( const DenseMatrix<MT2,!SO>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,AF,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,AF,SO>::addAssign( const DenseMatrix<MT2,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -3017,6 +3082,34 @@ inline void DenseSubmatrix<MT,AF,SO>::addAssign( const DenseMatrix<MT2,!SO>& rhs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool AF         // Alignment flag
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,AF,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,AF,SO>::addAssign( const DenseMatrix<MT2,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
 //
@@ -3181,7 +3274,8 @@ template< typename MT     // Type of the dense matrix
         , bool AF         // Alignment flag
         , bool SO >       // Storage order
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,AF,SO>::subAssign( const DenseMatrix<MT2,!SO>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,AF,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,AF,SO>::subAssign( const DenseMatrix<MT2,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -3205,6 +3299,34 @@ inline void DenseSubmatrix<MT,AF,SO>::subAssign( const DenseMatrix<MT2,!SO>& rhs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool AF         // Alignment flag
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,AF,SO>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,AF,SO>::subAssign( const DenseMatrix<MT2,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
 //
@@ -3787,6 +3909,17 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::transposition };
+   };
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -3823,7 +3956,14 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    inline typename EnableIf< VectorizedAssign<MT2> >::Type
       assign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -3835,7 +3975,14 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    inline typename EnableIf< VectorizedAddAssign<MT2> >::Type
       addAssign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,false>& rhs );
 
@@ -3847,7 +3994,14 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    inline typename EnableIf< VectorizedSubAssign<MT2> >::Type
       subAssign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,false>& rhs );
    //@}
@@ -5559,7 +5713,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMP
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,unaligned,true>::assign( const DenseMatrix<MT2,false>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,unaligned,true>::assign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -5747,7 +5902,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMP
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,unaligned,true>::addAssign( const DenseMatrix<MT2,false>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,unaligned,true>::addAssign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -5935,7 +6091,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMP
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,unaligned,true>::subAssign( const DenseMatrix<MT2,false>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,unaligned,true>::subAssign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -6209,6 +6366,17 @@ class DenseSubmatrix<MT,aligned,false> : public DenseMatrix< DenseSubmatrix<MT,a
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::transposition };
+   };
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -6245,7 +6413,14 @@ class DenseSubmatrix<MT,aligned,false> : public DenseMatrix< DenseSubmatrix<MT,a
    inline typename EnableIf< VectorizedAssign<MT2> >::Type
       assign( const DenseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,true>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>& rhs );
 
@@ -6257,7 +6432,14 @@ class DenseSubmatrix<MT,aligned,false> : public DenseMatrix< DenseSubmatrix<MT,a
    inline typename EnableIf< VectorizedAddAssign<MT2> >::Type
       addAssign( const DenseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,true>& rhs );
+
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,true>& rhs );
 
@@ -6269,7 +6451,14 @@ class DenseSubmatrix<MT,aligned,false> : public DenseMatrix< DenseSubmatrix<MT,a
    inline typename EnableIf< VectorizedSubAssign<MT2> >::Type
       subAssign( const DenseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,true>& rhs );
+
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,true>& rhs );
    //@}
@@ -8025,7 +8214,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPL
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,aligned,false>::assign( const DenseMatrix<MT2,true>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,false>::assign( const DenseMatrix<MT2,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -8213,7 +8403,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPL
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,aligned,false>::addAssign( const DenseMatrix<MT2,true>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,false>::addAssign( const DenseMatrix<MT2,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -8401,7 +8592,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPL
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,aligned,false>::subAssign( const DenseMatrix<MT2,true>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,false>::subAssign( const DenseMatrix<MT2,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -8675,6 +8867,17 @@ class DenseSubmatrix<MT,aligned,true> : public DenseMatrix< DenseSubmatrix<MT,al
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedTransposeAssign {
+      enum { value = useOptimizedKernels &&
+                     vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::transposition };
+   };
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -8711,7 +8914,14 @@ class DenseSubmatrix<MT,aligned,true> : public DenseMatrix< DenseSubmatrix<MT,al
    inline typename EnableIf< VectorizedAssign<MT2> >::Type
       assign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -8723,7 +8933,14 @@ class DenseSubmatrix<MT,aligned,true> : public DenseMatrix< DenseSubmatrix<MT,al
    inline typename EnableIf< VectorizedAddAssign<MT2> >::Type
       addAssign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,false>& rhs );
 
@@ -8735,7 +8952,14 @@ class DenseSubmatrix<MT,aligned,true> : public DenseMatrix< DenseSubmatrix<MT,al
    inline typename EnableIf< VectorizedSubAssign<MT2> >::Type
       subAssign( const DenseMatrix<MT2,true>& rhs );
 
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedTransposeAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,false>& rhs );
+
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,false>& rhs );
    //@}
@@ -10437,7 +10661,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLA
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,aligned,true>::assign( const DenseMatrix<MT2,false>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,true>::assign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -10625,7 +10850,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLA
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,aligned,true>::addAssign( const DenseMatrix<MT2,false>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,true>::addAssign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -10813,7 +11039,8 @@ inline typename EnableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLA
 */
 template< typename MT >   // Type of the dense matrix
 template< typename MT2 >  // Type of the right-hand side dense matrix
-inline void DenseSubmatrix<MT,aligned,true>::subAssign( const DenseMatrix<MT2,false>& rhs )
+inline typename DisableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,true>::subAssign( const DenseMatrix<MT2,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -10977,6 +11204,249 @@ inline void reset( DenseSubmatrix<MT,AF,SO>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,true>::subAssign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,true>::addAssign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,aligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,true>::assign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,false>::subAssign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,false>::addAssign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,aligned,false>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,aligned,false>::assign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,unaligned,true>::subAssign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileSubAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,unaligned,true>::addAssign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAddAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseSubmatrix<MT,unaligned,true>::BLAZE_TEMPLATE VectorizedTransposeAssign<MT2> >::Type
+   DenseSubmatrix<MT,unaligned,true>::assign( const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   tiledTransposeAssign<TileAssign>( *this, ~rhs );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reset the specified row/column of the given dense submatrix.
 // \ingroup dense_submatrix
@@ -60,10 +60,16 @@ const size_t DEFAULT_BLOCK_SIZE = 16UL;
 const size_t DMATDMATMULT_DEFAULT_IBLOCK_SIZE =  64UL;
 const size_t DMATDMATMULT_DEFAULT_JBLOCK_SIZE = 128UL;
 const size_t DMATDMATMULT_DEFAULT_KBLOCK_SIZE = 128UL;
+const size_t DMATDMATMULT_DEFAULT_PANEL_SIZE  = 131072UL;
 
 const size_t TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE = 128UL;
 const size_t TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE =  64UL;
 const size_t TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE = 128UL;
+
+const size_t TRANSPOSE_DEFAULT_BLOCK_SIZE = 64UL;
+
+const size_t QGEMM_DEFAULT_IBLOCK_SIZE =     32UL;
+const size_t QGEMM_DEFAULT_PANEL_SIZE  = 262144UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -75,10 +81,16 @@ const size_t DEBUG_BLOCK_SIZE = 8UL;
 const size_t DMATDMATMULT_DEBUG_IBLOCK_SIZE =  8UL;
 const size_t DMATDMATMULT_DEBUG_JBLOCK_SIZE = 64UL;
 const size_t DMATDMATMULT_DEBUG_KBLOCK_SIZE =  8UL;
+const size_t DMATDMATMULT_DEBUG_PANEL_SIZE  = 64UL;
 
 const size_t TDMATTDMATMULT_DEBUG_IBLOCK_SIZE = 64UL;
 const size_t TDMATTDMATMULT_DEBUG_JBLOCK_SIZE =  8UL;
 const size_t TDMATTDMATMULT_DEBUG_KBLOCK_SIZE =  8UL;
+
+const size_t TRANSPOSE_DEBUG_BLOCK_SIZE = 16UL;
+
+const size_t QGEMM_DEBUG_IBLOCK_SIZE =  4UL;
+const size_t QGEMM_DEBUG_PANEL_SIZE  = 64UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -90,10 +102,16 @@ const size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BLOCK_
 const size_t DMATDMATMULT_JBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_JBLOCK_SIZE : DMATDMATMULT_DEFAULT_JBLOCK_SIZE );
 const size_t DMATDMATMULT_IBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_IBLOCK_SIZE : DMATDMATMULT_DEFAULT_IBLOCK_SIZE );
 const size_t DMATDMATMULT_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_KBLOCK_SIZE : DMATDMATMULT_DEFAULT_KBLOCK_SIZE );
+const size_t DMATDMATMULT_PANEL_SIZE  = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_PANEL_SIZE  : DMATDMATMULT_DEFAULT_PANEL_SIZE  );
 
 const size_t TDMATTDMATMULT_IBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_IBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_IBLOCK_SIZE );
 const size_t TDMATTDMATMULT_JBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_JBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_JBLOCK_SIZE );
 const size_t TDMATTDMATMULT_KBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_KBLOCK_SIZE : TDMATTDMATMULT_DEFAULT_KBLOCK_SIZE );
+
+const size_t TRANSPOSE_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TRANSPOSE_DEBUG_BLOCK_SIZE : TRANSPOSE_DEFAULT_BLOCK_SIZE );
+
+const size_t QGEMM_IBLOCK_SIZE = ( BLAZE_DEBUG_MODE ? QGEMM_DEBUG_IBLOCK_SIZE : QGEMM_DEFAULT_IBLOCK_SIZE );
+const size_t QGEMM_PANEL_SIZE  = ( BLAZE_DEBUG_MODE ? QGEMM_DEBUG_PANEL_SIZE  : QGEMM_DEFAULT_PANEL_SIZE  );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -122,6 +140,10 @@ BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_IBLOCK_SIZE >= 64UL && blaze::TDMATTD
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_JBLOCK_SIZE >=  4UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_KBLOCK_SIZE >=  4UL );
 
+BLAZE_STATIC_ASSERT( blaze::TRANSPOSE_BLOCK_SIZE >= 16UL && blaze::TRANSPOSE_BLOCK_SIZE % 16UL == 0UL );
+
+BLAZE_STATIC_ASSERT( blaze::QGEMM_IBLOCK_SIZE >= 1UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,102 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/NUMA.h
+//  \brief System settings for the NUMA-aware memory allocation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_NUMA_H_
+#define _BLAZE_SYSTEM_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/NUMAPolicy.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+
+
+//=================================================================================================
+//
+//  NUMA SETTINGS
+//
+//=================================================================================================
+
+#include <blaze/config/NUMA.h>
+
+
+
+
+//=================================================================================================
+//
+//  HUGE PAGE SIZE
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The size of a transparent huge page in bytes.
+// \ingroup system
+*/
+const size_t hugePageSize = 2097152UL;
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::numaPolicy == blaze::numaFirstTouch ||
+                     blaze::numaPolicy == blaze::numaInterleave ||
+                     blaze::numaPolicy == blaze::numaBind );
+BLAZE_STATIC_ASSERT( blaze::largeAllocationThreshold >= blaze::hugePageSize );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
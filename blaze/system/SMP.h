@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/Types.h>
 #include <blaze/config/SMP.h>
 
 
@@ -123,4 +124,28 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  THREAD TEAM MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the persistent thread team of the thread-based parallelization.
+// \ingroup system
+//
+// This compilation switch is set to 1 in case either the C++11 or the Boost thread-based
+// parallelization is active and the use of the persistent thread team has been requested via
+// the BLAZE_USE_THREAD_TEAM switch (see <blaze/config/SMP.h>). Otherwise it is set to 0.
+*/
+#if ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) && BLAZE_USE_THREAD_TEAM
+#define BLAZE_THREAD_TEAM_MODE 1
+#else
+#define BLAZE_THREAD_TEAM_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
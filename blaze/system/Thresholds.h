@@ -40,9 +40,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdlib>
+#include <string>
 #include <blaze/system/Debugging.h>
+#include <blaze/util/Exception.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 
@@ -246,24 +250,6 @@ const size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-const size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : DMATDVECMULT_USER_THRESHOLD   );
-const size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : TDMATDVECMULT_USER_THRESHOLD  );
-const size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : TDVECDMATMULT_USER_THRESHOLD  );
-const size_t TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : TDVECTDMATMULT_USER_THRESHOLD );
-const size_t DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : DMATDMATMULT_USER_THRESHOLD   );
-const size_t DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : DMATTDMATMULT_USER_THRESHOLD  );
-const size_t TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : TDMATDMATMULT_USER_THRESHOLD  );
-const size_t TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : TDMATTDMATMULT_USER_THRESHOLD );
-const size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : DMATSMATMULT_USER_THRESHOLD   );
-const size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : TDMATSMATMULT_USER_THRESHOLD  );
-const size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : TSMATDMATMULT_USER_THRESHOLD  );
-const size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : TSMATTDMATMULT_USER_THRESHOLD );
-/*! \endcond */
-//*************************************************************************************************
-
-
 
 
 //=================================================================================================
@@ -894,8 +880,441 @@ const size_t SMP_DVECTDVECMULT_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Indices of the runtime thresholds.
+// \ingroup config
+*/
+enum ThresholdIndex
+{
+   DMATDVECMULT_INDEX       = 0,
+   TDMATDVECMULT_INDEX,
+   TDVECDMATMULT_INDEX,
+   TDVECTDMATMULT_INDEX,
+   DMATDMATMULT_INDEX,
+   DMATTDMATMULT_INDEX,
+   TDMATDMATMULT_INDEX,
+   TDMATTDMATMULT_INDEX,
+   DMATSMATMULT_INDEX,
+   TDMATSMATMULT_INDEX,
+   TSMATDMATMULT_INDEX,
+   TSMATTDMATMULT_INDEX,
+   SMP_DVECASSIGN_INDEX,
+   SMP_DVECDVECADD_INDEX,
+   SMP_DVECDVECSUB_INDEX,
+   SMP_DVECDVECMULT_INDEX,
+   SMP_DVECSCALARMULT_INDEX,
+   SMP_DMATDVECMULT_INDEX,
+   SMP_TDMATDVECMULT_INDEX,
+   SMP_TDVECDMATMULT_INDEX,
+   SMP_TDVECTDMATMULT_INDEX,
+   SMP_DMATSVECMULT_INDEX,
+   SMP_TDMATSVECMULT_INDEX,
+   SMP_TSVECDMATMULT_INDEX,
+   SMP_TSVECTDMATMULT_INDEX,
+   SMP_SMATDVECMULT_INDEX,
+   SMP_TSMATDVECMULT_INDEX,
+   SMP_TDVECSMATMULT_INDEX,
+   SMP_TDVECTSMATMULT_INDEX,
+   SMP_SMATSVECMULT_INDEX,
+   SMP_TSMATSVECMULT_INDEX,
+   SMP_TSVECSMATMULT_INDEX,
+   SMP_TSVECTSMATMULT_INDEX,
+   SMP_DMATASSIGN_INDEX,
+   SMP_DMATDMATADD_INDEX,
+   SMP_DMATTDMATADD_INDEX,
+   SMP_DMATDMATSUB_INDEX,
+   SMP_DMATTDMATSUB_INDEX,
+   SMP_DMATSCALARMULT_INDEX,
+   SMP_DMATDMATMULT_INDEX,
+   SMP_DMATTDMATMULT_INDEX,
+   SMP_TDMATDMATMULT_INDEX,
+   SMP_TDMATTDMATMULT_INDEX,
+   SMP_DMATSMATMULT_INDEX,
+   SMP_DMATTSMATMULT_INDEX,
+   SMP_TDMATSMATMULT_INDEX,
+   SMP_TDMATTSMATMULT_INDEX,
+   SMP_SMATDMATMULT_INDEX,
+   SMP_SMATTDMATMULT_INDEX,
+   SMP_TSMATDMATMULT_INDEX,
+   SMP_TSMATTDMATMULT_INDEX,
+   SMP_SMATSMATMULT_INDEX,
+   SMP_SMATTSMATMULT_INDEX,
+   SMP_TSMATSMATMULT_INDEX,
+   SMP_TSMATTSMATMULT_INDEX,
+   SMP_DVECTDVECMULT_INDEX,
+   THRESHOLD_COUNT
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting of a single runtime threshold.
+// \ingroup config
+*/
+struct ThresholdSetting
+{
+   const char* name;  //!< The name of the threshold.
+   size_t defaults;   //!< The compile time default of the threshold.
+   size_t value;      //!< The current value of the threshold.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the runtime thresholds.
+// \ingroup config
+//
+// \param settings The array of threshold settings.
+// \return \a true after the initialization.
+//
+// This function initializes all thresholds with their compile time defaults and afterwards
+// applies the overrides given via environment variables. The environment variable for a
+// particular threshold is formed by prepending "BLAZE_" to the name of the threshold (as for
+// instance \c BLAZE_SMP_DVECASSIGN_THRESHOLD). Values that cannot be completely converted to
+// an unsigned integral value are ignored.
+*/
+inline bool initThresholds( ThresholdSetting* settings )
+{
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i )
+   {
+      settings[i].value = settings[i].defaults;
+
+      const std::string variable( std::string( "BLAZE_" ) + settings[i].name );
+      const char* const env( std::getenv( variable.c_str() ) );
+
+      if( env == NULL || *env == '\0' )
+         continue;
+
+      char* end( NULL );
+      const unsigned long value( std::strtoul( env, &end, 10 ) );
+
+      if( *end == '\0' )
+         settings[i].value = static_cast<size_t>( value );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the settings of all runtime thresholds.
+// \ingroup config
+//
+// \return Pointer to the first element of the array of threshold settings.
+//
+// The settings are initialized on the first call of this function (see initThresholds()).
+*/
+inline ThresholdSetting* getThresholdSettings()
+{
+   static ThresholdSetting settings[THRESHOLD_COUNT] = {
+      { "DMATDVECMULT_THRESHOLD",       ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD       : DMATDVECMULT_USER_THRESHOLD       ), 0UL },
+      { "TDMATDVECMULT_THRESHOLD",      ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD      : TDMATDVECMULT_USER_THRESHOLD      ), 0UL },
+      { "TDVECDMATMULT_THRESHOLD",      ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD      : TDVECDMATMULT_USER_THRESHOLD      ), 0UL },
+      { "TDVECTDMATMULT_THRESHOLD",     ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD     : TDVECTDMATMULT_USER_THRESHOLD     ), 0UL },
+      { "DMATDMATMULT_THRESHOLD",       ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD       : DMATDMATMULT_USER_THRESHOLD       ), 0UL },
+      { "DMATTDMATMULT_THRESHOLD",      ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD      : DMATTDMATMULT_USER_THRESHOLD      ), 0UL },
+      { "TDMATDMATMULT_THRESHOLD",      ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD      : TDMATDMATMULT_USER_THRESHOLD      ), 0UL },
+      { "TDMATTDMATMULT_THRESHOLD",     ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD     : TDMATTDMATMULT_USER_THRESHOLD     ), 0UL },
+      { "DMATSMATMULT_THRESHOLD",       ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD       : DMATSMATMULT_USER_THRESHOLD       ), 0UL },
+      { "TDMATSMATMULT_THRESHOLD",      ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD      : TDMATSMATMULT_USER_THRESHOLD      ), 0UL },
+      { "TSMATDMATMULT_THRESHOLD",      ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD      : TSMATDMATMULT_USER_THRESHOLD      ), 0UL },
+      { "TSMATTDMATMULT_THRESHOLD",     ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD     : TSMATTDMATMULT_USER_THRESHOLD     ), 0UL },
+      { "SMP_DVECASSIGN_THRESHOLD",     ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : SMP_DVECASSIGN_USER_THRESHOLD     ), 0UL },
+      { "SMP_DVECDVECADD_THRESHOLD",    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : SMP_DVECDVECADD_USER_THRESHOLD    ), 0UL },
+      { "SMP_DVECDVECSUB_THRESHOLD",    ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : SMP_DVECDVECSUB_USER_THRESHOLD    ), 0UL },
+      { "SMP_DVECDVECMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : SMP_DVECDVECMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_DVECSCALARMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : SMP_DVECSCALARMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_DMATDVECMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : SMP_DMATDVECMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_TDMATDVECMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : SMP_TDMATDVECMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDVECDMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : SMP_TDVECDMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDVECTDMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : SMP_TDVECTDMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_DMATSVECMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : SMP_DMATSVECMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_TDMATSVECMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : SMP_TDMATSVECMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSVECDMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : SMP_TSVECDMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSVECTDMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : SMP_TSVECTDMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_SMATDVECMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : SMP_SMATDVECMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_TSMATDVECMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : SMP_TSMATDVECMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDVECSMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : SMP_TDVECSMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDVECTSMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : SMP_TDVECTSMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_SMATSVECMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : SMP_SMATSVECMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_TSMATSVECMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : SMP_TSMATSVECMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSVECSMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : SMP_TSVECSMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSVECTSMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : SMP_TSVECTSMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_DMATASSIGN_THRESHOLD",     ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : SMP_DMATASSIGN_USER_THRESHOLD     ), 0UL },
+      { "SMP_DMATDMATADD_THRESHOLD",    ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : SMP_DMATDMATADD_USER_THRESHOLD    ), 0UL },
+      { "SMP_DMATTDMATADD_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : SMP_DMATTDMATADD_USER_THRESHOLD   ), 0UL },
+      { "SMP_DMATDMATSUB_THRESHOLD",    ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : SMP_DMATDMATSUB_USER_THRESHOLD    ), 0UL },
+      { "SMP_DMATTDMATSUB_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : SMP_DMATTDMATSUB_USER_THRESHOLD   ), 0UL },
+      { "SMP_DMATSCALARMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : SMP_DMATSCALARMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_DMATDMATMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : SMP_DMATDMATMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_DMATTDMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : SMP_DMATTDMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDMATDMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : SMP_TDMATDMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDMATTDMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : SMP_TDMATTDMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_DMATSMATMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : SMP_DMATSMATMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_DMATTSMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : SMP_DMATTSMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDMATSMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : SMP_TDMATSMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TDMATTSMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : SMP_TDMATTSMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_SMATDMATMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : SMP_SMATDMATMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_SMATTDMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : SMP_SMATTDMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSMATDMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : SMP_TSMATDMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSMATTDMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : SMP_TSMATTDMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_SMATSMATMULT_THRESHOLD",   ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : SMP_SMATSMATMULT_USER_THRESHOLD   ), 0UL },
+      { "SMP_SMATTSMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : SMP_SMATTSMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSMATSMATMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : SMP_TSMATSMATMULT_USER_THRESHOLD  ), 0UL },
+      { "SMP_TSMATTSMATMULT_THRESHOLD", ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : SMP_TSMATTSMATMULT_USER_THRESHOLD ), 0UL },
+      { "SMP_DVECTDVECMULT_THRESHOLD",  ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMULT_DEBUG_THRESHOLD  : SMP_DVECTDVECMULT_USER_THRESHOLD  ), 0UL }
+   };
+
+   static const bool initialized( initThresholds( settings ) );
+   UNUSED_PARAMETER( initialized );
+
+   return settings;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches the setting of the threshold with the given name.
+// \ingroup config
+//
+// \param name The name of the threshold.
+// \return Pointer to the threshold setting.
+// \exception std::invalid_argument Unknown threshold.
+*/
+inline ThresholdSetting* findThresholdSetting( const std::string& name )
+{
+   ThresholdSetting* const settings( getThresholdSettings() );
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      if( name == settings[i].name )
+         return settings+i;
+   }
+
+   BLAZE_THROW_INVALID_ARGUMENT( "Unknown threshold" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Representation of a threshold that can be changed at runtime.
+// \ingroup config
+//
+// The RuntimeThreshold class represents a single threshold whose value is stored in the
+// runtime threshold settings. Due to the implicit conversion to \c size_t it can be used
+// in place of the compile time threshold constants.
+*/
+class RuntimeThreshold
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the RuntimeThreshold class.
+   //
+   // \param index The index of the threshold.
+   */
+   explicit inline RuntimeThreshold( ThresholdIndex index )
+      : index_( index )  // The index of the threshold
+   {}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline operator size_t() const {
+      return getThresholdSettings()[index_].value;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ThresholdIndex index_;  //!< The index of the threshold.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Unknown threshold.
+//
+// This function returns the current value of the threshold with the given name. In case no
+// threshold with the given name exists, a \a std::invalid_argument exception is thrown.
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   return findThresholdSetting( name )->value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Unknown threshold.
+//
+// This function changes the value of the threshold with the given name. In contrast to the
+// settings in <tt>./blaze/config/Thresholds.h</tt> this allows to tune a deployed executable
+// to the given machine without recompilation:
+
+   \code
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 20000UL );
+   blaze::setThreshold( "DMATDMATMULT_THRESHOLD", 40000UL );
+   \endcode
+
+// Alternatively, all thresholds can be set via environment variables, which are evaluated on
+// the first use of any threshold:
+
+   \code
+   export BLAZE_SMP_DVECASSIGN_THRESHOLD=20000
+   \endcode
+
+// In case no threshold with the given name exists, a \a std::invalid_argument exception is
+// thrown. Note that the thresholds are read without any synchronization by all threads that
+// evaluate expressions, including the worker threads of the SMP backends. Therefore this
+// function must only be called while no computation is running on any thread, for instance
+// during the initialization of the application. Changing a threshold concurrently to any
+// computation results in undefined behavior!
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   findThresholdSetting( name )->value = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all thresholds to their compile time defaults.
+// \ingroup config
+//
+// \return void
+//
+// This function resets all thresholds to their compile time defaults. Note that this also
+// discards the values given via environment variables. As the setThreshold() function, this
+// function must only be called while no computation is running on any thread.
+*/
+inline void resetThresholds()
+{
+   ThresholdSetting* const settings( getThresholdSettings() );
+
+   for( size_t i=0UL; i<THRESHOLD_COUNT; ++i ) {
+      settings[i].value = settings[i].defaults;
+   }
+}
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  EFFECTIVE THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+const RuntimeThreshold DMATDVECMULT_THRESHOLD      ( DMATDVECMULT_INDEX       );
+const RuntimeThreshold TDMATDVECMULT_THRESHOLD     ( TDMATDVECMULT_INDEX      );
+const RuntimeThreshold TDVECDMATMULT_THRESHOLD     ( TDVECDMATMULT_INDEX      );
+const RuntimeThreshold TDVECTDMATMULT_THRESHOLD    ( TDVECTDMATMULT_INDEX     );
+const RuntimeThreshold DMATDMATMULT_THRESHOLD      ( DMATDMATMULT_INDEX       );
+const RuntimeThreshold DMATTDMATMULT_THRESHOLD     ( DMATTDMATMULT_INDEX      );
+const RuntimeThreshold TDMATDMATMULT_THRESHOLD     ( TDMATDMATMULT_INDEX      );
+const RuntimeThreshold TDMATTDMATMULT_THRESHOLD    ( TDMATTDMATMULT_INDEX     );
+const RuntimeThreshold DMATSMATMULT_THRESHOLD      ( DMATSMATMULT_INDEX       );
+const RuntimeThreshold TDMATSMATMULT_THRESHOLD     ( TDMATSMATMULT_INDEX      );
+const RuntimeThreshold TSMATDMATMULT_THRESHOLD     ( TSMATDMATMULT_INDEX      );
+const RuntimeThreshold TSMATTDMATMULT_THRESHOLD    ( TSMATTDMATMULT_INDEX     );
+const RuntimeThreshold SMP_DVECASSIGN_THRESHOLD    ( SMP_DVECASSIGN_INDEX     );
+const RuntimeThreshold SMP_DVECDVECADD_THRESHOLD   ( SMP_DVECDVECADD_INDEX    );
+const RuntimeThreshold SMP_DVECDVECSUB_THRESHOLD   ( SMP_DVECDVECSUB_INDEX    );
+const RuntimeThreshold SMP_DVECDVECMULT_THRESHOLD  ( SMP_DVECDVECMULT_INDEX   );
+const RuntimeThreshold SMP_DVECSCALARMULT_THRESHOLD( SMP_DVECSCALARMULT_INDEX );
+const RuntimeThreshold SMP_DMATDVECMULT_THRESHOLD  ( SMP_DMATDVECMULT_INDEX   );
+const RuntimeThreshold SMP_TDMATDVECMULT_THRESHOLD ( SMP_TDMATDVECMULT_INDEX  );
+const RuntimeThreshold SMP_TDVECDMATMULT_THRESHOLD ( SMP_TDVECDMATMULT_INDEX  );
+const RuntimeThreshold SMP_TDVECTDMATMULT_THRESHOLD( SMP_TDVECTDMATMULT_INDEX );
+const RuntimeThreshold SMP_DMATSVECMULT_THRESHOLD  ( SMP_DMATSVECMULT_INDEX   );
+const RuntimeThreshold SMP_TDMATSVECMULT_THRESHOLD ( SMP_TDMATSVECMULT_INDEX  );
+const RuntimeThreshold SMP_TSVECDMATMULT_THRESHOLD ( SMP_TSVECDMATMULT_INDEX  );
+const RuntimeThreshold SMP_TSVECTDMATMULT_THRESHOLD( SMP_TSVECTDMATMULT_INDEX );
+const RuntimeThreshold SMP_SMATDVECMULT_THRESHOLD  ( SMP_SMATDVECMULT_INDEX   );
+const RuntimeThreshold SMP_TSMATDVECMULT_THRESHOLD ( SMP_TSMATDVECMULT_INDEX  );
+const RuntimeThreshold SMP_TDVECSMATMULT_THRESHOLD ( SMP_TDVECSMATMULT_INDEX  );
+const RuntimeThreshold SMP_TDVECTSMATMULT_THRESHOLD( SMP_TDVECTSMATMULT_INDEX );
+const RuntimeThreshold SMP_SMATSVECMULT_THRESHOLD  ( SMP_SMATSVECMULT_INDEX   );
+const RuntimeThreshold SMP_TSMATSVECMULT_THRESHOLD ( SMP_TSMATSVECMULT_INDEX  );
+const RuntimeThreshold SMP_TSVECSMATMULT_THRESHOLD ( SMP_TSVECSMATMULT_INDEX  );
+const RuntimeThreshold SMP_TSVECTSMATMULT_THRESHOLD( SMP_TSVECTSMATMULT_INDEX );
+const RuntimeThreshold SMP_DMATASSIGN_THRESHOLD    ( SMP_DMATASSIGN_INDEX     );
+const RuntimeThreshold SMP_DMATDMATADD_THRESHOLD   ( SMP_DMATDMATADD_INDEX    );
+const RuntimeThreshold SMP_DMATTDMATADD_THRESHOLD  ( SMP_DMATTDMATADD_INDEX   );
+const RuntimeThreshold SMP_DMATDMATSUB_THRESHOLD   ( SMP_DMATDMATSUB_INDEX    );
+const RuntimeThreshold SMP_DMATTDMATSUB_THRESHOLD  ( SMP_DMATTDMATSUB_INDEX   );
+const RuntimeThreshold SMP_DMATSCALARMULT_THRESHOLD( SMP_DMATSCALARMULT_INDEX );
+const RuntimeThreshold SMP_DMATDMATMULT_THRESHOLD  ( SMP_DMATDMATMULT_INDEX   );
+const RuntimeThreshold SMP_DMATTDMATMULT_THRESHOLD ( SMP_DMATTDMATMULT_INDEX  );
+const RuntimeThreshold SMP_TDMATDMATMULT_THRESHOLD ( SMP_TDMATDMATMULT_INDEX  );
+const RuntimeThreshold SMP_TDMATTDMATMULT_THRESHOLD( SMP_TDMATTDMATMULT_INDEX );
+const RuntimeThreshold SMP_DMATSMATMULT_THRESHOLD  ( SMP_DMATSMATMULT_INDEX   );
+const RuntimeThreshold SMP_DMATTSMATMULT_THRESHOLD ( SMP_DMATTSMATMULT_INDEX  );
+const RuntimeThreshold SMP_TDMATSMATMULT_THRESHOLD ( SMP_TDMATSMATMULT_INDEX  );
+const RuntimeThreshold SMP_TDMATTSMATMULT_THRESHOLD( SMP_TDMATTSMATMULT_INDEX );
+const RuntimeThreshold SMP_SMATDMATMULT_THRESHOLD  ( SMP_SMATDMATMULT_INDEX   );
+const RuntimeThreshold SMP_SMATTDMATMULT_THRESHOLD ( SMP_SMATTDMATMULT_INDEX  );
+const RuntimeThreshold SMP_TSMATDMATMULT_THRESHOLD ( SMP_TSMATDMATMULT_INDEX  );
+const RuntimeThreshold SMP_TSMATTDMATMULT_THRESHOLD( SMP_TSMATTDMATMULT_INDEX );
+const RuntimeThreshold SMP_SMATSMATMULT_THRESHOLD  ( SMP_SMATSMATMULT_INDEX   );
+const RuntimeThreshold SMP_SMATTSMATMULT_THRESHOLD ( SMP_SMATTSMATMULT_INDEX  );
+const RuntimeThreshold SMP_TSMATSMATMULT_THRESHOLD ( SMP_TSMATSMATMULT_INDEX  );
+const RuntimeThreshold SMP_TSMATTSMATMULT_THRESHOLD( SMP_TSMATTSMATMULT_INDEX );
+const RuntimeThreshold SMP_DVECTDVECMULT_THRESHOLD ( SMP_DVECTDVECMULT_INDEX  );
+#else
+const size_t DMATDVECMULT_THRESHOLD       = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD       : DMATDVECMULT_USER_THRESHOLD       );
+const size_t TDMATDVECMULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD      : TDMATDVECMULT_USER_THRESHOLD      );
+const size_t TDVECDMATMULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD      : TDVECDMATMULT_USER_THRESHOLD      );
+const size_t TDVECTDMATMULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD     : TDVECTDMATMULT_USER_THRESHOLD     );
+const size_t DMATDMATMULT_THRESHOLD       = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD       : DMATDMATMULT_USER_THRESHOLD       );
+const size_t DMATTDMATMULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD      : DMATTDMATMULT_USER_THRESHOLD      );
+const size_t TDMATDMATMULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD      : TDMATDMATMULT_USER_THRESHOLD      );
+const size_t TDMATTDMATMULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD     : TDMATTDMATMULT_USER_THRESHOLD     );
+const size_t DMATSMATMULT_THRESHOLD       = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD       : DMATSMATMULT_USER_THRESHOLD       );
+const size_t TDMATSMATMULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD      : TDMATSMATMULT_USER_THRESHOLD      );
+const size_t TSMATDMATMULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD      : TSMATDMATMULT_USER_THRESHOLD      );
+const size_t TSMATTDMATMULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD     : TSMATTDMATMULT_USER_THRESHOLD     );
 const size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : SMP_DVECASSIGN_USER_THRESHOLD     );
 const size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : SMP_DVECDVECADD_USER_THRESHOLD    );
 const size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : SMP_DVECDVECSUB_USER_THRESHOLD    );
@@ -940,6 +1359,7 @@ const size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMU
 const size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : SMP_TSMATSMATMULT_USER_THRESHOLD  );
 const size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : SMP_TSMATTSMATMULT_USER_THRESHOLD );
 const size_t SMP_DVECTDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMULT_DEBUG_THRESHOLD  : SMP_DVECTDVECMULT_USER_THRESHOLD  );
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -958,59 +1378,59 @@ const size_t SMP_DVECTDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECTDVECMU
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
-
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_USER_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_USER_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_USER_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_USER_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_USER_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_USER_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_USER_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_USER_THRESHOLD > 0UL );
+
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_USER_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_USER_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_USER_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_USER_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_USER_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_USER_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_USER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_USER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_USER_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_USER_THRESHOLD  >= 0UL );
 
 }
 /*! \endcond */
@@ -233,6 +233,23 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the F16C mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the F16C mode. In case the F16C mode is enabled
+// (i.e. in case the half precision conversion instructions are available) the Blaze library
+// converts between half and single precision values by F16C intrinsics. In case the F16C mode
+// is disabled, the Blaze library chooses default, non-vectorized conversions.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__F16C__)
+#  define BLAZE_F16C_MODE 1
+#else
+#  define BLAZE_F16C_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -250,6 +267,27 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case the runtime dispatch is requested via the
+// BLAZE_USE_RUNTIME_DISPATCH switch and the compiler supports functions compiled for specific
+// instruction sets on the target platform) the Blaze library selects the kernels for the
+// instruction set of the executing CPU at runtime. In case the runtime dispatch mode is
+// disabled, the Blaze library exclusively uses the vectorization selected at compile time.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_RUNTIME_DISPATCH && !BLAZE_MIC_MODE && \
+    ( defined(__x86_64__) || defined(__i386__) ) && !defined(__INTEL_COMPILER) && \
+    ( defined(__clang__) || ( defined(__GNUC__) && ( __GNUC__ > 4 || ( __GNUC__ == 4 && __GNUC_MINOR__ >= 9 ) ) ) )
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -268,6 +306,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_F16C_MODE  || BLAZE_AVX_MODE   );
 
 }
 /*! \endcond */
@@ -282,7 +321,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE || BLAZE_F16C_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
@@ -278,7 +278,7 @@ inline void AlignedAllocator<Type>::deallocate( Pointer ptr, size_t numObjects )
    const size_t alignment( AlignmentOf<Type>::value );
 
    if( alignment >= 8UL ) {
-      deallocate_backend( ptr );
+      deallocate_backend( ptr, alignment );
    }
    else {
       operator delete[]( ptr );
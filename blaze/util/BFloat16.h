@@ -0,0 +1,336 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/BFloat16.h
+//  \brief Header file for the bfloat16 storage type
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_BFLOAT16_H_
+#define _BLAZE_UTIL_BFLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Brain floating point storage type.
+// \ingroup util
+//
+// The bfloat16 class stores a single precision floating point value in the 16-bit brain floating
+// point format, i.e. the upper half of an IEEE 754 single precision value (1 sign bit, 8 exponent
+// bits, 7 mantissa bits). In contrast to float16 it covers the full single precision range at
+// the cost of precision. All arithmetic is performed in single precision by means of the
+// implicit conversion to \c float, whereas the conversion from \c float rounds to the nearest
+// representable value (ties to even).
+
+   \code
+   blaze::DynamicMatrix<blaze::bfloat16> A( 1000UL, 1000UL );
+   blaze::DynamicVector<float> x( 1000UL ), y;
+   // ... Initialization
+   y = A * x;  // Computation in single precision
+   \endcode
+*/
+class bfloat16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline bfloat16();
+   inline bfloat16( float value );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline bfloat16& operator+=( float rhs );
+   inline bfloat16& operator-=( float rhs );
+   inline bfloat16& operator*=( float rhs );
+   inline bfloat16& operator/=( float rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator float() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\name Access functions */
+   //@{
+   inline uint16_t bits() const;
+
+   static inline bfloat16 fromBits( uint16_t bits );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   static inline uint16_t toBFloat( float    value );
+   static inline float    toFloat( uint16_t bits  );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The bfloat16 bit pattern of the value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for bfloat16.
+//
+// The value is initialized to positive zero.
+*/
+inline bfloat16::bfloat16()
+   : bits_( 0U )  // The bfloat16 bit pattern of the value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be converted.
+//
+// The given value is rounded to the nearest representable bfloat16 value.
+*/
+inline bfloat16::bfloat16( float value )
+   : bits_( toBFloat( value ) )  // The bfloat16 bit pattern of the value
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator+=( float rhs )
+{
+   bits_ = toBFloat( toFloat( bits_ ) + rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator-=( float rhs )
+{
+   bits_ = toBFloat( toFloat( bits_ ) - rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication with a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator*=( float rhs )
+{
+   bits_ = toBFloat( toFloat( bits_ ) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division by a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator/=( float rhs )
+{
+   bits_ = toBFloat( toFloat( bits_ ) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to single precision.
+//
+// \return The single precision representation of the value.
+//
+// The conversion is exact, i.e. every bfloat16 value is representable in single precision.
+*/
+inline bfloat16::operator float() const
+{
+   return toFloat( bits_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the bfloat16 bit pattern of the value.
+//
+// \return The bfloat16 bit pattern of the value.
+*/
+inline uint16_t bfloat16::bits() const
+{
+   return bits_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a bfloat16 value from the given bit pattern.
+//
+// \param bits The bfloat16 bit pattern of the value.
+// \return The according bfloat16 value.
+*/
+inline bfloat16 bfloat16::fromBits( uint16_t bits )
+{
+   bfloat16 tmp;
+   tmp.bits_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of a single precision value to the bfloat16 format.
+//
+// \param value The single precision value to be converted.
+// \return The bfloat16 bit pattern of the rounded value.
+*/
+inline uint16_t bfloat16::toBFloat( float value )
+{
+   uint32_t f;
+   std::memcpy( &f, &value, sizeof( f ) );
+
+   // NaN (the payload is truncated, but kept quiet and non-zero)
+   if( ( f & 0x7FFFFFFFU ) > 0x7F800000U ) {
+      return static_cast<uint16_t>( ( f >> 16 ) | 0x40U );
+   }
+
+   // Rounding to nearest, ties to even (a carry correctly increments the exponent)
+   f += 0x7FFFU + ( ( f >> 16 ) & 1U );
+   return static_cast<uint16_t>( f >> 16 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a bfloat16 value to single precision.
+//
+// \param bits The bfloat16 bit pattern of the value.
+// \return The according single precision value.
+*/
+inline float bfloat16::toFloat( uint16_t bits )
+{
+   const uint32_t f( static_cast<uint32_t>( bits ) << 16 );
+   float value;
+   std::memcpy( &value, &f, sizeof( value ) );
+   return value;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
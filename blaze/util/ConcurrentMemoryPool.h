@@ -0,0 +1,961 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ConcurrentMemoryPool.h
+//  \brief Header file for the concurrent memory pool class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_CONCURRENTMEMORYPOOL_H_
+#define _BLAZE_UTIL_CONCURRENTMEMORYPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <atomic>
+#else
+#  include <boost/atomic.hpp>
+#  include <boost/thread/tss.hpp>
+#endif
+
+#include <algorithm>
+#include <new>
+#include <vector>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/NonCreatable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-safe memory pool for small objects of different sizes.
+// \ingroup util
+//
+// The ConcurrentMemoryPool class template is the thread-safe counterpart of the MemoryPool class
+// template. It manages small objects in \a Classes size classes, where the i-th size class serves
+// all requests of up to \f$ (i+1) \cdot Granularity \f$ bytes. Each thread owns a private cache
+// of free objects per size class, which serves all allocations and deallocations without any
+// synchronization. Only in case a cache runs empty or overflows, objects are exchanged with a
+// global depot in batches of \a Batchsize objects. Batches are pushed to the depot lock-free,
+// whereas the removal of a batch is guarded by a short spin lock per size class. Requests that exceed the largest
+// size class are forwarded to the global operator new.
+
+   \code
+   typedef blaze::ConcurrentMemoryPool<>  Pool;
+
+   void* node = Pool::malloc( sizeof( Node ) );
+   // ... Use of the memory, potentially on a different thread
+   Pool::free( node, sizeof( Node ) );
+
+   // ... Release of all objects
+
+   Pool::flush();  // Return the cached objects of the calling thread to the global depot
+   Pool::trim();   // Return all completely unused memory chunks to the system
+   \endcode
+
+// Since the pool is accessed via static functions only, each instantiation of the class template
+// represents a separate pool. Note that the size passed to the free() function must match the
+// size passed to the according malloc() function. On thread exit, the cache of the exiting
+// thread is returned to the depot. Memory chunks are kept for reuse by all threads until they
+// are explicitly returned to the system via the trim() function. Tracking the number of live
+// objects per chunk during every allocation and deallocation would require synchronization
+// between the thread caches, which is why unused chunks are not released automatically.\n
+// The pool uses C++11 atomics and thread-local storage in case the C++11 thread parallelization
+// is active (see the BLAZE_USE_CPP_THREADS switch) and Boost atomics and thread-specific storage
+// otherwise.
+*/
+template< size_t Granularity = 16UL    // Size difference between two size classes in bytes
+        , size_t Classes     = 16UL    // Number of size classes
+        , size_t Batchsize   = 32UL >  // Number of objects exchanged with the global depot
+class ConcurrentMemoryPool : private NonCreatable
+{
+ private:
+   //**struct FreeObject***************************************************************************
+   /*!\brief A single free object of the memory pool.
+   //
+   // The first object of each batch in the global depot additionally links to the next batch.
+   */
+   struct FreeObject {
+      FreeObject* next_;       //!< Pointer to the next free object within the same batch.
+      FreeObject* nextBatch_;  //!< Pointer to the first object of the next batch.
+   };
+   //**********************************************************************************************
+
+   //**struct Chunk********************************************************************************
+   /*!\brief Header of a memory chunk of the pool.
+   //
+   // The header is stored at the beginning of each chunk, followed by the objects of the chunk.
+   */
+   struct Chunk {
+      Chunk* next_;   //!< Pointer to the next chunk of the same size class.
+      size_t size_;   //!< Total size of the chunk in bytes.
+      size_t count_;  //!< Number of objects of the chunk.
+   };
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( Granularity >= sizeof(FreeObject) );
+   BLAZE_STATIC_ASSERT( Granularity % sizeof(FreeObject*) == 0UL );
+   BLAZE_STATIC_ASSERT( Classes > 0UL && Batchsize > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**struct ThreadCache**************************************************************************
+   /*!\brief Thread-local cache of free objects.
+   */
+   struct ThreadCache
+   {
+      inline ThreadCache();
+      inline ~ThreadCache();
+
+      FreeObject* heads_[Classes];   //!< Heads of the free lists of all size classes.
+      size_t      counts_[Classes];  //!< Number of cached objects of all size classes.
+      size_t      allocations_;      //!< Number of allocations performed by the thread.
+      size_t      deallocations_;    //!< Number of deallocations performed by the thread.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   typedef std::atomic<FreeObject*>    AtomicObject;   //!< Atomic pointer to a free object.
+   typedef std::atomic<Chunk*>         AtomicChunk;    //!< Atomic pointer to a memory chunk.
+   typedef std::atomic<size_t>         AtomicCounter;  //!< Atomic statistics counter.
+   typedef std::atomic<bool>           AtomicFlag;     //!< Atomic lock flag.
+#else
+   typedef boost::atomic<FreeObject*>  AtomicObject;   //!< Atomic pointer to a free object.
+   typedef boost::atomic<Chunk*>       AtomicChunk;    //!< Atomic pointer to a memory chunk.
+   typedef boost::atomic<size_t>       AtomicCounter;  //!< Atomic statistics counter.
+   typedef boost::atomic<bool>         AtomicFlag;     //!< Atomic lock flag.
+#endif
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Size of the chunk header, rounded up to a multiple of the granularity.
+   enum { headersize = ( sizeof(Chunk) + Granularity - 1UL ) / Granularity * Granularity };
+   //**********************************************************************************************
+
+ public:
+   //**struct Statistics***************************************************************************
+   /*!\brief Statistics of the memory pool.
+   //
+   // The number of allocations and deallocations comprises all operations of the calling thread
+   // and all operations of threads that have flushed their cache (see the flush() function).
+   */
+   struct Statistics
+   {
+      size_t allocations;    //!< Number of allocations.
+      size_t deallocations;  //!< Number of deallocations.
+      size_t chunks;         //!< Number of memory chunks currently allocated from the system.
+      size_t reserved;       //!< Total size of all current memory chunks in bytes.
+      size_t acquired;       //!< Number of batches acquired from the global depot.
+      size_t returned;       //!< Number of batches returned to the global depot.
+   };
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   static inline void* malloc( size_t size );
+   static inline void  free( void* rawMemory, size_t size );
+   static inline void  flush();
+   static inline void  trim();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline Statistics statistics();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline ThreadCache& threadCache();
+   static inline void         refill( ThreadCache& cache, size_t index );
+   static inline void         pushBatch( size_t index, FreeObject* batch );
+   static inline FreeObject*  popBatch( size_t index );
+   static inline FreeObject*  popDepot( size_t index );
+   static inline void         lockDepot( size_t index );
+   static inline void         unlockDepot( size_t index );
+   static inline void         returnBatch( ThreadCache& cache, size_t index, size_t count );
+   static inline void         pushChunk( size_t index, Chunk* chunk );
+   static inline void         trim( size_t index );
+   static inline size_t       findChunk( const std::vector<Chunk*>& chunks, const FreeObject* ptr );
+
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE
+   static inline ThreadCache*& cachePointer();
+   static inline void          destroyCache( ThreadCache* cache );
+#endif
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static AtomicObject  depots_[Classes];      //!< Global depots of all size classes.
+   static AtomicFlag    depotLocks_[Classes];  //!< Removal locks of the global depots.
+   static AtomicChunk   chunkLists_[Classes];  //!< Memory chunks of all size classes.
+   static AtomicCounter allocations_;          //!< Number of flushed allocations.
+   static AtomicCounter deallocations_;        //!< Number of flushed deallocations.
+   static AtomicCounter chunks_;               //!< Number of allocated chunks.
+   static AtomicCounter reserved_;             //!< Total size of all chunks in bytes.
+   static AtomicCounter acquired_;             //!< Number of acquired batches.
+   static AtomicCounter returned_;             //!< Number of returned batches.
+
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE
+   static boost::thread_specific_ptr<ThreadCache> caches_;  //!< Owner of the thread caches.
+#endif
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicObject
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::depots_[Classes];
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicFlag
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::depotLocks_[Classes];
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicChunk
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::chunkLists_[Classes];
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicCounter
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::allocations_( 0UL );
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicCounter
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::deallocations_( 0UL );
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicCounter
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::chunks_( 0UL );
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicCounter
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::reserved_( 0UL );
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicCounter
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::acquired_( 0UL );
+
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::AtomicCounter
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::returned_( 0UL );
+
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+boost::thread_specific_ptr<typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::ThreadCache>
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::caches_(
+      &ConcurrentMemoryPool<Granularity,Classes,Batchsize>::destroyCache );
+#endif
+/*! \endcond */
+
+
+
+
+//=================================================================================================
+//
+//  CLASS CONCURRENTMEMORYPOOL::THREADCACHE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor of the thread-local cache.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline ConcurrentMemoryPool<Granularity,Classes,Batchsize>::ThreadCache::ThreadCache()
+   : allocations_  ( 0UL )  // Number of allocations performed by the thread
+   , deallocations_( 0UL )  // Number of deallocations performed by the thread
+{
+   for( size_t i=0UL; i<Classes; ++i ) {
+      heads_[i]  = NULL;
+      counts_[i] = 0UL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor of the thread-local cache.
+//
+// The destructor returns all cached objects to the global depot.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline ConcurrentMemoryPool<Granularity,Classes,Batchsize>::ThreadCache::~ThreadCache()
+{
+   for( size_t i=0UL; i<Classes; ++i ) {
+      while( counts_[i] > 0UL )
+         returnBatch( *this, i, ( counts_[i] < Batchsize )?( counts_[i] ):( Batchsize ) );
+   }
+
+   ConcurrentMemoryPool::allocations_   += allocations_;
+   ConcurrentMemoryPool::deallocations_ += deallocations_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of raw memory for an object of the given size.
+//
+// \param size The size of the object in bytes.
+// \return Pointer to the raw memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function returns raw memory for an object of the given size. Objects of up to
+// \f$ Classes \cdot Granularity \f$ bytes are drawn from the pool, larger objects are allocated
+// via the global operator new. The returned memory is at least aligned to the smaller of
+// \a Granularity and the alignment guaranteed by the global operator new.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void* ConcurrentMemoryPool<Granularity,Classes,Batchsize>::malloc( size_t size )
+{
+   if( size > Classes*Granularity )
+      return ::operator new( size );
+
+   const size_t index( ( size == 0UL )?( 0UL ):( ( size - 1UL ) / Granularity ) );
+
+   ThreadCache& cache( threadCache() );
+
+   if( cache.heads_[index] == NULL )
+      refill( cache, index );
+
+   FreeObject* const ptr( cache.heads_[index] );
+   cache.heads_[index] = ptr->next_;
+   --cache.counts_[index];
+   ++cache.allocations_;
+
+   return ptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of raw memory for an object of the given size.
+//
+// \param rawMemory Pointer to the raw memory.
+// \param size The size of the object in bytes (must match the size passed to malloc()).
+// \return void
+//
+// This function returns the given memory to the cache of the calling thread. The memory may
+// have been allocated on a different thread. In case the cache holds more than two batches of
+// objects, one batch is returned to the global depot.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::free( void* rawMemory, size_t size )
+{
+   if( rawMemory == NULL )
+      return;
+
+   if( size > Classes*Granularity ) {
+      ::operator delete( rawMemory );
+      return;
+   }
+
+   const size_t index( ( size == 0UL )?( 0UL ):( ( size - 1UL ) / Granularity ) );
+
+   ThreadCache& cache( threadCache() );
+
+   FreeObject* const ptr( reinterpret_cast<FreeObject*>( rawMemory ) );
+   ptr->next_ = cache.heads_[index];
+   cache.heads_[index] = ptr;
+   ++cache.counts_[index];
+   ++cache.deallocations_;
+
+   if( cache.counts_[index] >= 2UL*Batchsize )
+      returnBatch( cache, index, Batchsize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns all objects cached by the calling thread to the global depot.
+//
+// \return void
+//
+// This function returns all free objects of the calling thread to the global depot, where they
+// can be acquired by other threads. Additionally, the allocation and deallocation counters of
+// the calling thread are added to the global statistics.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::flush()
+{
+   ThreadCache& cache( threadCache() );
+
+   for( size_t i=0UL; i<Classes; ++i ) {
+      while( cache.counts_[i] > 0UL )
+         returnBatch( cache, i, ( cache.counts_[i] < Batchsize )?( cache.counts_[i] ):( Batchsize ) );
+   }
+
+   allocations_   += cache.allocations_;
+   deallocations_ += cache.deallocations_;
+   cache.allocations_   = 0UL;
+   cache.deallocations_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns all completely unused memory chunks to the system.
+//
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function flushes the cache of the calling thread (see the flush() function) and returns
+// all memory chunks to the system whose objects are all contained in the global depot. Chunks
+// with objects that are either in use or cached by another thread are kept. Therefore other
+// threads should flush their caches before the pool is trimmed. The function can be called
+// concurrently to allocations and deallocations of other threads. In case the function throws
+// an exception, the state of the pool remains unchanged.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::trim()
+{
+   flush();
+
+   for( size_t i=0UL; i<Classes; ++i ) {
+      trim( i );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current statistics of the memory pool.
+//
+// \return The statistics of the memory pool.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::Statistics
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::statistics()
+{
+   const ThreadCache& cache( threadCache() );
+
+   Statistics stats;
+   stats.allocations   = allocations_.load()   + cache.allocations_;
+   stats.deallocations = deallocations_.load() + cache.deallocations_;
+   stats.chunks        = chunks_.load();
+   stats.reserved      = reserved_.load();
+   stats.acquired      = acquired_.load();
+   stats.returned      = returned_.load();
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the cache of the calling thread.
+//
+// \return Reference to the thread-local cache.
+//
+// In case the C++11 thread parallelization is active, the cache is a thread-local object. Else
+// it is created on first use and owned by thread-specific storage, which destroys the cache on
+// thread exit.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::ThreadCache&
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::threadCache()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   static thread_local ThreadCache cache;
+   return cache;
+#else
+   ThreadCache*& cache( cachePointer() );
+
+   if( cache == NULL ) {
+      ThreadCache* const tmp( new ThreadCache() );
+      caches_.reset( tmp );
+      cache = tmp;
+   }
+
+   return *cache;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the pointer to the cache of the calling thread.
+//
+// \return Reference to the thread-local pointer to the cache.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::ThreadCache*&
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::cachePointer()
+{
+   static BLAZE_THREAD_LOCAL ThreadCache* cache = NULL;
+   return cache;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Destruction of the cache of an exiting thread.
+//
+// \param cache The cache of the exiting thread.
+// \return void
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::destroyCache( ThreadCache* cache )
+{
+   cachePointer() = NULL;
+   delete cache;
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Refills the empty cache of the given size class.
+//
+// \param cache The cache of the calling thread.
+// \param index The index of the size class.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function first tries to acquire a batch of free objects from the global depot. In case
+// the depot is empty, a new memory chunk is allocated and split into batches of free objects.
+// The first batch is used to refill the cache, all remaining batches are stored in the depot.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::refill( ThreadCache& cache,
+                                                                         size_t index )
+{
+   BLAZE_INTERNAL_ASSERT( cache.heads_[index] == NULL, "Refill of non-empty cache detected" );
+
+   FreeObject* batch( popBatch( index ) );
+
+   if( batch != NULL ) {
+      size_t count( 0UL );
+      for( FreeObject* ptr=batch; ptr!=NULL; ptr=ptr->next_ )
+         ++count;
+      cache.heads_[index]  = batch;
+      cache.counts_[index] = count;
+      ++acquired_;
+      return;
+   }
+
+   const size_t objsize  ( ( index + 1UL ) * Granularity );
+   const size_t minsize  ( headersize + objsize*Batchsize );
+   const size_t chunksize( ( minsize < 65536UL )?( 65536UL ):( minsize ) );
+   const size_t count    ( ( chunksize - headersize ) / objsize );
+
+   byte* const raw( reinterpret_cast<byte*>( ::operator new( chunksize ) ) );
+   byte* const objects( raw + headersize );
+
+   for( size_t i=0UL; i<count; i+=Batchsize )
+   {
+      const size_t end( ( i+Batchsize < count )?( i+Batchsize ):( count ) );
+
+      for( size_t j=i; j<end; ++j ) {
+         reinterpret_cast<FreeObject*>( objects + j*objsize )->next_ =
+            ( j+1UL < end )?( reinterpret_cast<FreeObject*>( objects + (j+1UL)*objsize ) ):( NULL );
+      }
+
+      if( i > 0UL )
+         pushBatch( index, reinterpret_cast<FreeObject*>( objects + i*objsize ) );
+   }
+
+   cache.heads_[index]  = reinterpret_cast<FreeObject*>( objects );
+   cache.counts_[index] = ( Batchsize < count )?( Batchsize ):( count );
+
+   Chunk* const chunk( reinterpret_cast<Chunk*>( raw ) );
+   chunk->size_  = chunksize;
+   chunk->count_ = count;
+   pushChunk( index, chunk );
+
+   ++chunks_;
+   reserved_ += chunksize;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moves a batch of objects from the given thread cache to the global depot.
+//
+// \param cache The cache of the calling thread.
+// \param index The index of the size class.
+// \param count The number of objects to be returned.
+// \return void
+//
+// This function returns the \a count least recently released objects of the given size class.
+// The most recently released objects are kept in the cache since they are most likely still
+// resident in the cache of the processor.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::returnBatch( ThreadCache& cache,
+                                                                              size_t index,
+                                                                              size_t count )
+{
+   BLAZE_INTERNAL_ASSERT( count > 0UL && count <= cache.counts_[index], "Invalid batch size detected" );
+
+   const size_t keep( cache.counts_[index] - count );
+   FreeObject* batch( cache.heads_[index] );
+
+   if( keep > 0UL ) {
+      FreeObject* last( batch );
+      for( size_t i=1UL; i<keep; ++i )
+         last = last->next_;
+      batch = last->next_;
+      last->next_ = NULL;
+   }
+   else {
+      cache.heads_[index] = NULL;
+   }
+
+   cache.counts_[index] = keep;
+
+   pushBatch( index, batch );
+   ++returned_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lock-free insertion of a batch into the global depot.
+//
+// \param index The index of the size class.
+// \param batch The first object of the batch.
+// \return void
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::pushBatch( size_t index,
+                                                                            FreeObject* batch )
+{
+   FreeObject* head( depots_[index].load() );
+
+   do {
+      batch->nextBatch_ = head;
+   }
+   while( !depots_[index].compare_exchange_weak( head, batch ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removal of a batch from the global depot.
+//
+// \param index The index of the size class.
+// \return The first object of the removed batch, \a NULL in case the depot is empty.
+//
+// This function removes the first batch of the depot via a compare-and-swap operation. In order
+// to avoid the ABA problem, removals are serialized by the lock of the depot: Since no other
+// thread can remove (and reinsert) the first batch in the meantime, the compare-and-swap only
+// fails due to concurrent insertions, which don't have to be serialized.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::FreeObject*
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::popBatch( size_t index )
+{
+   if( depots_[index].load() == NULL )
+      return NULL;
+
+   lockDepot( index );
+
+   FreeObject* batch( depots_[index].load() );
+
+   while( batch != NULL && !depots_[index].compare_exchange_weak( batch, batch->nextBatch_ ) ) {}
+
+   unlockDepot( index );
+
+   return batch;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removal of all batches from the global depot.
+//
+// \param index The index of the size class.
+// \return The first object of the first removed batch, \a NULL in case the depot is empty.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline typename ConcurrentMemoryPool<Granularity,Classes,Batchsize>::FreeObject*
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::popDepot( size_t index )
+{
+   lockDepot( index );
+   FreeObject* const depot( depots_[index].exchange( NULL ) );
+   unlockDepot( index );
+
+   return depot;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Acquires the removal lock of the global depot.
+//
+// \param index The index of the size class.
+// \return void
+//
+// Since the lock is only held for the removal of a single batch, the calling thread spins until
+// the lock is acquired.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::lockDepot( size_t index )
+{
+   while( depotLocks_[index].exchange( true ) ) {
+      while( depotLocks_[index].load() ) {}
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Releases the removal lock of the global depot.
+//
+// \param index The index of the size class.
+// \return void
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::unlockDepot( size_t index )
+{
+   depotLocks_[index].store( false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lock-free insertion of a memory chunk into the list of chunks of a size class.
+//
+// \param index The index of the size class.
+// \param chunk The memory chunk to be inserted.
+// \return void
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::pushChunk( size_t index,
+                                                                            Chunk* chunk )
+{
+   Chunk* head( chunkLists_[index].load() );
+
+   do {
+      chunk->next_ = head;
+   }
+   while( !chunkLists_[index].compare_exchange_weak( head, chunk ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns all completely unused memory chunks of the given size class to the system.
+//
+// \param index The index of the size class.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function detaches both the list of chunks and the depot of the given size class and
+// counts the free objects of each chunk. Chunks whose objects are all free are deallocated, all
+// remaining chunks and free objects are reinserted. Since a chunk is only released if all of its
+// objects are owned by the calling thread, concurrent allocations and deallocations of other
+// threads are not affected. Free objects of chunks that have been added concurrently to the
+// detachment of the list of chunks are reinserted unchanged.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline void ConcurrentMemoryPool<Granularity,Classes,Batchsize>::trim( size_t index )
+{
+   if( chunkLists_[index].load() == NULL || depots_[index].load() == NULL )
+      return;
+
+   std::vector<Chunk*> chunks;
+   std::vector<size_t> counts;
+
+   Chunk* const chunkList( chunkLists_[index].exchange( NULL ) );
+   FreeObject* const depot( popDepot( index ) );
+
+   try {
+      for( Chunk* chunk=chunkList; chunk!=NULL; chunk=chunk->next_ )
+         chunks.push_back( chunk );
+      counts.resize( chunks.size(), 0UL );
+   }
+   catch( ... ) {
+      for( Chunk* chunk=chunkList; chunk!=NULL; ) {
+         Chunk* const next( chunk->next_ );
+         pushChunk( index, chunk );
+         chunk = next;
+      }
+      for( FreeObject* batch=depot; batch!=NULL; ) {
+         FreeObject* const next( batch->nextBatch_ );
+         pushBatch( index, batch );
+         batch = next;
+      }
+      throw;
+   }
+
+   std::sort( chunks.begin(), chunks.end() );
+
+   for( FreeObject* batch=depot; batch!=NULL; batch=batch->nextBatch_ ) {
+      for( FreeObject* ptr=batch; ptr!=NULL; ptr=ptr->next_ ) {
+         const size_t pos( findChunk( chunks, ptr ) );
+         if( pos < chunks.size() )
+            ++counts[pos];
+      }
+   }
+
+   FreeObject* head( NULL );
+   size_t count( 0UL );
+
+   for( FreeObject* batch=depot; batch!=NULL; ) {
+      FreeObject* const nextBatch( batch->nextBatch_ );
+      for( FreeObject* ptr=batch; ptr!=NULL; ) {
+         FreeObject* const next( ptr->next_ );
+         const size_t pos( findChunk( chunks, ptr ) );
+         if( pos == chunks.size() || counts[pos] != chunks[pos]->count_ ) {
+            ptr->next_ = head;
+            head = ptr;
+            if( ++count == Batchsize ) {
+               pushBatch( index, head );
+               head  = NULL;
+               count = 0UL;
+            }
+         }
+         ptr = next;
+      }
+      batch = nextBatch;
+   }
+
+   if( head != NULL )
+      pushBatch( index, head );
+
+   for( size_t i=0UL; i<chunks.size(); ++i ) {
+      if( counts[i] == chunks[i]->count_ ) {
+         chunks_   -= 1UL;
+         reserved_ -= chunks[i]->size_;
+         ::operator delete( chunks[i] );
+      }
+      else pushChunk( index, chunks[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches the memory chunk containing the given free object.
+//
+// \param chunks The sorted addresses of the memory chunks.
+// \param ptr The free object.
+// \return The index of the chunk containing the object, \a chunks.size() if no chunk contains it.
+*/
+template< size_t Granularity, size_t Classes, size_t Batchsize >
+inline size_t
+   ConcurrentMemoryPool<Granularity,Classes,Batchsize>::findChunk( const std::vector<Chunk*>& chunks,
+                                                                   const FreeObject* ptr )
+{
+   Chunk* const address( reinterpret_cast<Chunk*>( const_cast<FreeObject*>( ptr ) ) );
+
+   const size_t pos( std::upper_bound( chunks.begin(), chunks.end(), address ) - chunks.begin() );
+
+   if( pos == 0UL ||
+       reinterpret_cast<const byte*>( ptr ) >=
+       reinterpret_cast<const byte*>( chunks[pos-1UL] ) + chunks[pos-1UL]->size_ )
+      return chunks.size();
+
+   return pos-1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
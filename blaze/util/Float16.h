@@ -0,0 +1,400 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Float16.h
+//  \brief Header file for the float16 storage type
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_FLOAT16_H_
+#define _BLAZE_UTIL_FLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief IEEE 754 half precision storage type.
+// \ingroup util
+//
+// The float16 class stores a single precision floating point value in the 16-bit IEEE 754
+// binary16 format (1 sign bit, 5 exponent bits, 10 mantissa bits). It is meant as a storage
+// type for large data sets that don't require full single precision: all arithmetic is
+// performed in single precision by means of the implicit conversion to \c float, whereas the
+// conversion from \c float rounds to the nearest representable value (ties to even).
+
+   \code
+   blaze::DynamicMatrix<blaze::float16> A( 1000UL, 1000UL );
+   blaze::DynamicVector<float> x( 1000UL ), y;
+   // ... Initialization
+   y = A * x;  // Computation in single precision
+   \endcode
+
+// In case the F16C instruction set is available (i.e. in case BLAZE_F16C_MODE is enabled),
+// the conversions are performed by the according hardware instructions.
+*/
+class float16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline float16();
+   inline float16( float value );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline float16& operator+=( float rhs );
+   inline float16& operator-=( float rhs );
+   inline float16& operator*=( float rhs );
+   inline float16& operator/=( float rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator float() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\name Access functions */
+   //@{
+   inline uint16_t bits() const;
+
+   static inline float16 fromBits( uint16_t bits );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   static inline uint16_t toHalf ( float    value );
+   static inline float    toFloat( uint16_t bits  );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The binary16 representation of the value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for float16.
+//
+// The value is initialized to positive zero.
+*/
+inline float16::float16()
+   : bits_( 0U )  // The binary16 representation of the value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be converted.
+//
+// The given value is rounded to the nearest representable half precision value. Values
+// beyond the half precision range are converted to infinity.
+*/
+inline float16::float16( float value )
+   : bits_( toHalf( value ) )  // The binary16 representation of the value
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator+=( float rhs )
+{
+   bits_ = toHalf( toFloat( bits_ ) + rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator-=( float rhs )
+{
+   bits_ = toHalf( toFloat( bits_ ) - rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication with a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator*=( float rhs )
+{
+   bits_ = toHalf( toFloat( bits_ ) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division by a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the float16 value.
+*/
+inline float16& float16::operator/=( float rhs )
+{
+   bits_ = toHalf( toFloat( bits_ ) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to single precision.
+//
+// \return The single precision representation of the value.
+//
+// The conversion is exact, i.e. every half precision value is representable in single precision.
+*/
+inline float16::operator float() const
+{
+   return toFloat( bits_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the binary16 representation of the value.
+//
+// \return The binary16 representation of the value.
+*/
+inline uint16_t float16::bits() const
+{
+   return bits_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a float16 value from the given binary16 representation.
+//
+// \param bits The binary16 representation of the value.
+// \return The according float16 value.
+*/
+inline float16 float16::fromBits( uint16_t bits )
+{
+   float16 tmp;
+   tmp.bits_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of a single precision value to the binary16 format.
+//
+// \param value The single precision value to be converted.
+// \return The binary16 representation of the rounded value.
+*/
+inline uint16_t float16::toHalf( float value )
+{
+#if BLAZE_F16C_MODE
+   return static_cast<uint16_t>( _cvtss_sh( value, 0 ) );
+#else
+   uint32_t f;
+   std::memcpy( &f, &value, sizeof( f ) );
+
+   const uint32_t sign( ( f >> 16 ) & 0x8000U );
+   const uint32_t exp ( ( f >> 23 ) & 0xFFU );
+   uint32_t mant( f & 0x7FFFFFU );
+
+   // Infinity and NaN (the NaN payload is truncated, but kept quiet and non-zero)
+   if( exp == 0xFFU ) {
+      return static_cast<uint16_t>( sign | 0x7C00U | ( mant ? ( 0x200U | ( mant >> 13 ) ) : 0U ) );
+   }
+
+   const int e( static_cast<int>( exp ) - 127 + 15 );
+
+   // Overflow to infinity
+   if( e >= 0x1F ) {
+      return static_cast<uint16_t>( sign | 0x7C00U );
+   }
+
+   // Subnormal results and underflow to zero
+   if( e <= 0 ) {
+      if( e < -10 )
+         return static_cast<uint16_t>( sign );
+      mant |= 0x800000U;
+      const uint32_t shift( static_cast<uint32_t>( 14 - e ) );
+      const uint32_t rem  ( mant & ( ( 1U << shift ) - 1U ) );
+      const uint32_t half ( 1U << ( shift - 1U ) );
+      uint32_t h( mant >> shift );
+      if( rem > half || ( rem == half && ( h & 1U ) ) )
+         ++h;
+      return static_cast<uint16_t>( sign | h );
+   }
+
+   // Normal results (a carry out of the mantissa correctly increments the exponent)
+   uint32_t h( ( static_cast<uint32_t>( e ) << 10 ) | ( mant >> 13 ) );
+   const uint32_t rem( mant & 0x1FFFU );
+   if( rem > 0x1000U || ( rem == 0x1000U && ( h & 1U ) ) )
+      ++h;
+   return static_cast<uint16_t>( sign | h );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a binary16 value to single precision.
+//
+// \param bits The binary16 representation of the value.
+// \return The according single precision value.
+*/
+inline float float16::toFloat( uint16_t bits )
+{
+#if BLAZE_F16C_MODE
+   return _cvtsh_ss( bits );
+#else
+   const uint32_t sign( static_cast<uint32_t>( bits & 0x8000U ) << 16 );
+   uint32_t exp ( ( bits >> 10 ) & 0x1FU );
+   uint32_t mant( bits & 0x3FFU );
+   uint32_t f;
+
+   if( exp == 0U ) {
+      if( mant == 0U ) {
+         f = sign;
+      }
+      else {
+         exp = 113U;
+         while( !( mant & 0x400U ) ) {
+            mant <<= 1;
+            --exp;
+         }
+         f = sign | ( exp << 23 ) | ( ( mant & 0x3FFU ) << 13 );
+      }
+   }
+   else if( exp == 0x1FU ) {
+      f = sign | 0x7F800000U | ( mant << 13 );
+   }
+   else {
+      f = sign | ( ( exp + 112U ) << 23 ) | ( mant << 13 );
+   }
+
+   float value;
+   std::memcpy( &value, &f, sizeof( value ) );
+   return value;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,259 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/InstructionSet.h
+//  \brief Header file for the runtime detection of the supported instruction set
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_INSTRUCTIONSET_H_
+#define _BLAZE_UTIL_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SETS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Instruction sets for the runtime dispatch of vectorized kernels.
+// \ingroup util
+//
+// The InstructionSet enumeration lists the x86 instruction sets the Blaze library is able to
+// select at runtime (see the BLAZE_USE_RUNTIME_DISPATCH switch). The instruction sets are
+// ordered, i.e. each instruction set includes all preceding instruction sets.
+*/
+enum InstructionSet
+{
+   defaultInstructionSet = 0,  //!< No vectorization.
+   sse2InstructionSet    = 1,  //!< SSE2 (128-bit vectorization).
+   avxInstructionSet     = 2,  //!< AVX (256-bit vectorization).
+   avx2InstructionSet    = 3,  //!< AVX2 and FMA (256-bit vectorization with fused multiply-add).
+   avx512InstructionSet  = 4   //!< AVX-512F (512-bit vectorization).
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Instruction set functions */
+//@{
+inline InstructionSet compiledInstructionSet();
+inline InstructionSet supportedInstructionSet();
+inline InstructionSet instructionSet();
+inline void setInstructionSet( InstructionSet isa );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set the executable has been compiled for.
+// \ingroup util
+//
+// \return The instruction set selected at compile time.
+//
+// This function returns the instruction set used by the compile time vectorization of the
+// Blaze library (see the BLAZE_USE_VECTORIZATION switch and the according compiler flags).
+*/
+inline InstructionSet compiledInstructionSet()
+{
+#if BLAZE_AVX2_MODE
+   return avx2InstructionSet;
+#elif BLAZE_AVX_MODE
+   return avxInstructionSet;
+#elif BLAZE_SSE2_MODE
+   return sse2InstructionSet;
+#else
+   return defaultInstructionSet;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Detects the most powerful instruction set supported by the executing CPU.
+// \ingroup util
+//
+// \return The most powerful supported instruction set.
+//
+// The detection takes both the CPU (via the CPUID instruction) and the operating system (which
+// has to preserve the extended vector registers) into account. In case the runtime dispatch
+// mode is disabled, the function returns the compiled instruction set.
+*/
+inline InstructionSet detectInstructionSet()
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) )
+      return avx512InstructionSet;
+   if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return avx2InstructionSet;
+   if( __builtin_cpu_supports( "avx" ) )
+      return avxInstructionSet;
+   if( __builtin_cpu_supports( "sse2" ) )
+      return sse2InstructionSet;
+   return defaultInstructionSet;
+#else
+   return compiledInstructionSet();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the most powerful instruction set supported by the executing CPU.
+// \ingroup util
+//
+// \return The most powerful supported instruction set.
+//
+// The instruction set is detected once during the first call of the function. In case the
+// runtime dispatch mode is disabled, the function returns the compiled instruction set.
+*/
+inline InstructionSet supportedInstructionSet()
+{
+   static const InstructionSet isa( detectInstructionSet() );
+   return isa;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initially selected instruction set.
+// \ingroup util
+//
+// \return The initially selected instruction set.
+//
+// By default, the most powerful supported instruction set is selected. This selection can be
+// restricted via the \c BLAZE_INSTRUCTION_SET environment variable, which can be set to
+// \c default, \c sse2, \c avx, \c avx2, or \c avx512. Instruction sets that are not supported
+// by the executing CPU are never selected.
+*/
+inline InstructionSet initialInstructionSet()
+{
+   const InstructionSet supported( supportedInstructionSet() );
+   const char* const env( std::getenv( "BLAZE_INSTRUCTION_SET" ) );
+
+   if( env == NULL )
+      return supported;
+
+   static const char* const names[] = { "default", "sse2", "avx", "avx2", "avx512" };
+
+   for( int i=0; i<5; ++i ) {
+      if( std::strcmp( env, names[i] ) == 0 )
+         return ( i < supported )?( static_cast<InstructionSet>( i ) ):( supported );
+   }
+
+   return supported;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the currently selected instruction set.
+// \ingroup util
+//
+// \return Reference to the currently selected instruction set.
+*/
+inline InstructionSet& selectedInstructionSet()
+{
+   static InstructionSet isa( initialInstructionSet() );
+   return isa;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set currently selected for the runtime dispatch.
+// \ingroup util
+//
+// \return The currently selected instruction set.
+//
+// The runtime dispatched kernels of the Blaze library use the instruction set returned by this
+// function in case it is more powerful than the compiled instruction set (see the
+// compiledInstructionSet() function). By default, the most powerful instruction set supported
+// by the executing CPU is selected once during the first call of the function. The selection
+// can be restricted via the \c BLAZE_INSTRUCTION_SET environment variable or the
+// setInstructionSet() function.
+*/
+inline InstructionSet instructionSet()
+{
+   return selectedInstructionSet();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restricts the instruction set used by the runtime dispatched kernels.
+// \ingroup util
+//
+// \param isa The requested instruction set.
+// \return void
+//
+// This function selects the given instruction set for all subsequent calls of runtime dispatched
+// kernels. In case the given instruction set is not supported by the executing CPU, the most
+// powerful supported instruction set is selected instead. Note that this function must not be
+// called while any Blaze computation is in progress.
+*/
+inline void setInstructionSet( InstructionSet isa )
+{
+   const InstructionSet supported( supportedInstructionSet() );
+   selectedInstructionSet() = ( isa < supported )?( isa ):( supported );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
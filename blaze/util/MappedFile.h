@@ -0,0 +1,270 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MAPPEDFILE_H_
+#define _BLAZE_UTIL_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read-only memory mapping of a file.
+// \ingroup util
+//
+// The MappedFile class maps the complete content of a file read-only into the address space of
+// the process. In contrast to reading the file via a stream, the content is directly accessible
+// as a contiguous range of characters, which can for instance be processed concurrently by
+// several threads:
+
+   \code
+   blaze::MappedFile file( "matrix.mtx" );
+
+   const char* first( file.data() );
+   const char* last ( file.data() + file.size() );
+   \endcode
+
+// Note that the mapped content is not null-terminated. In case the file cannot be opened or
+// mapped, a \a std::runtime_error exception is thrown. The mapping is released on destruction.
+*/
+class MappedFile : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedFile( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const char* data() const;
+   inline size_t      size() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const char* data_;  //!< Pointer to the first character of the mapped file.
+   size_t      size_;  //!< The size of the mapped file in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedFile class.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error The file cannot be mapped.
+*/
+inline MappedFile::MappedFile( const std::string& filename )
+   : data_( NULL )  // Pointer to the first character of the mapped file
+   , size_( 0UL  )  // The size of the mapped file in bytes
+{
+#if defined(_WIN32)
+   HANDLE file = CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+
+   if( file == INVALID_HANDLE_VALUE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Cannot open file" );
+   }
+
+   LARGE_INTEGER bytes;
+   if( GetFileSizeEx( file, &bytes ) == 0 ) {
+      CloseHandle( file );
+      BLAZE_THROW_RUNTIME_ERROR( "Cannot determine file size" );
+   }
+
+   size_ = static_cast<size_t>( bytes.QuadPart );
+
+   if( size_ != 0UL )
+   {
+      HANDLE mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+      CloseHandle( file );
+
+      if( mapping == NULL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Cannot map file" );
+      }
+
+      data_ = static_cast<const char*>( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+      CloseHandle( mapping );
+
+      if( data_ == NULL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Cannot map file" );
+      }
+   }
+   else {
+      CloseHandle( file );
+   }
+#else
+   const int fd = ::open( filename.c_str(), O_RDONLY );
+
+   if( fd == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Cannot open file" );
+   }
+
+   struct stat status;
+   if( ::fstat( fd, &status ) == -1 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "Cannot determine file size" );
+   }
+
+   size_ = static_cast<size_t>( status.st_size );
+
+   if( size_ != 0UL )
+   {
+      void* ptr = ::mmap( NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0 );
+      ::close( fd );
+
+      if( ptr == MAP_FAILED ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Cannot map file" );
+      }
+
+      ::madvise( ptr, size_, MADV_SEQUENTIAL );
+      data_ = static_cast<const char*>( ptr );
+   }
+   else {
+      ::close( fd );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MappedFile class.
+*/
+inline MappedFile::~MappedFile()
+{
+   if( data_ == NULL ) return;
+
+#if defined(_WIN32)
+   UnmapViewOfFile( data_ );
+#else
+   ::munmap( const_cast<char*>( data_ ), size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first character of the mapped file.
+//
+// \return Pointer to the first character of the mapped file (\c NULL for an empty file).
+*/
+inline const char* MappedFile::data() const
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MappedFile::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
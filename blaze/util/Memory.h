@@ -43,17 +43,25 @@
 #if defined(_MSC_VER)
 #  include <malloc.h>
 #endif
+#if defined(__linux__)
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
 #include <cstdlib>
 #include <new>
+#include <blaze/system/NUMA.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/MemoryArena.h>
 #include <blaze/util/Null.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -64,22 +72,98 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the placement hints of large allocations.
+// \ingroup util
+//
+// \param address The address of the first byte of the large allocation.
+// \param size The number of allocated bytes.
+// \return void
+//
+// This function applies the configured transparent huge page hint and NUMA placement policy
+// (see the blaze::useHugePages and blaze::numaPolicy settings) to all pages that are completely
+// contained in the given memory range. Since both settings are pure performance hints, any
+// failure of the according system calls is ignored. Note that the hints have to be applied
+// before the memory is touched for the first time. On non-Linux systems this function has
+// no effect.
+*/
+inline void adviseLargeAllocation_backend( void* address, size_t size )
+{
+#if defined(__linux__)
+   const size_t pagesize( static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) );
+   const size_t first( ( reinterpret_cast<size_t>( address ) + pagesize - 1UL ) & ~( pagesize - 1UL ) );
+   const size_t last ( ( reinterpret_cast<size_t>( address ) + size ) & ~( pagesize - 1UL ) );
+
+   if( first >= last )
+      return;
+
+   void* const begin( reinterpret_cast<void*>( first ) );
+
+#  if defined(MADV_HUGEPAGE)
+   if( useHugePages ) {
+      madvise( begin, last - first, MADV_HUGEPAGE );
+   }
+#  endif
+
+#  if defined(SYS_mbind)
+   // Memory policy modes of the mbind() system call (see <linux/mempolicy.h>)
+   enum { mpolBind = 2, mpolInterleave = 3 };
+
+   if( numaPolicy != numaFirstTouch ) {
+      const unsigned long mask( numaNodeMask );
+      const int mode( ( numaPolicy == numaInterleave )?( mpolInterleave ):( mpolBind ) );
+      syscall( SYS_mbind, begin, last - first, mode, &mask, sizeof(unsigned long)*8UL+1UL, 0U );
+   }
+#  endif
+#else
+   UNUSED_PARAMETER( address, size );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Backend implementation for aligned array allocation.
 // \ingroup util
 //
 // \param size The number of bytes to be allocated.
-// \param alignment The required minimum alignment.
+// \param alignment The required minimum alignment (at least 8 bytes).
 // \return Byte pointer to the first element of the aligned array.
 // \exception std::bad_alloc Allocation failed.
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions. Allocations that are at least blaze::largeAllocationThreshold bytes large are
+// additionally aligned to huge page boundaries (in case blaze::useHugePages is active) and
+// are subject to the configured NUMA placement policy. All smaller allocations are drawn from
+// the active memory arena of the calling thread, if any (see the ArenaSection class).\n
+// In order to distinguish the two kinds of memory in deallocate_backend(), memory from the
+// system is aligned to twice the given alignment, whereas memory from an arena is placed at an
+// odd multiple of the given alignment (see the MemoryArena::allocateBlock() function).
 */
 inline byte* allocate_backend( size_t size, size_t alignment )
 {
+   BLAZE_INTERNAL_ASSERT( alignment >= 8UL, "Invalid alignment detected" );
+
+   const bool large( size >= largeAllocationThreshold );
+
+   if( !large ) {
+      MemoryArena* const arena( MemoryArena::active() );
+      if( arena != NULL ) {
+         return arena->allocateBlock( size, alignment );
+      }
+   }
+
+   alignment *= 2UL;
+
+#if defined(__linux__)
+   if( large && useHugePages && alignment < hugePageSize )
+      alignment = hugePageSize;
+#endif
+
    void* raw( NULL );
 
 #if defined(_MSC_VER)
@@ -91,6 +175,9 @@ inline byte* allocate_backend( size_t size, size_t alignment )
       BLAZE_THROW_BAD_ALLOC;
    }
 
+   if( large )
+      adviseLargeAllocation_backend( raw, size );
+
    return reinterpret_cast<byte*>( raw );
 }
 /*! \endcond */
@@ -103,13 +190,22 @@ inline byte* allocate_backend( size_t size, size_t alignment )
 // \ingroup util
 //
 // \param address The address of the first element of the array to be deallocated.
+// \param alignment The alignment that has been used for the allocation.
 // \return void
 //
 // This function deallocates the given memory that was previously allocated via the allocate()
 // function. For that purpose it uses the according system-specific memory deallocation functions.
+// Memory that has been drawn from a memory arena is not deallocated, but marked as deallocated
+// and released in bulk by the arena (see the MemoryArena class). Since arena memory is identified
+// by its address, the memory can be deallocated on any thread.
 */
-inline void deallocate_backend( const void* address )
+inline void deallocate_backend( const void* address, size_t alignment )
 {
+   if( MemoryArena::isArenaBlock( address, alignment ) ) {
+      MemoryArena::deallocateBlock( address );
+      return;
+   }
+
 #if defined(_MSC_VER)
    _aligned_free( const_cast<void*>( address ) );
 #else
@@ -202,7 +298,7 @@ typename DisableIf< IsBuiltin<T>, T* >::Type allocate( size_t size )
       catch( ... ) {
          while( i != 0UL )
             address[--i].~T();
-         deallocate_backend( raw );
+         deallocate_backend( raw, alignment );
          throw;
       }
 
@@ -232,7 +328,7 @@ typename EnableIf< IsBuiltin<T> >::Type deallocate( T* address )
    const size_t alignment( AlignmentOf<T>::value );
 
    if( alignment >= 8UL ) {
-      deallocate_backend( address );
+      deallocate_backend( address, alignment );
    }
    else delete[] address;
 }
@@ -269,7 +365,7 @@ typename DisableIf< IsBuiltin<T> >::Type deallocate( T* address )
       for( size_t i=0UL; i<size; ++i )
          address[i].~T();
 
-      deallocate_backend( raw );
+      deallocate_backend( raw, alignment );
    }
    else delete[] address;
 }
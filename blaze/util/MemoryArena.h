@@ -0,0 +1,653 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryArena.h
+//  \brief Header file for the MemoryArena and ArenaSection classes
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYARENA_H_
+#define _BLAZE_UTIL_MEMORYARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local bump allocator for dynamic containers and expression temporaries.
+// \ingroup util
+//
+// The MemoryArena class provides a simple and fast bump allocator for aligned memory. Memory is
+// drawn from a list of large chunks by simply advancing a pointer, individual deallocations are
+// ignored, and all memory is released in bulk by the release() function or by the destruction
+// of the arena. The arena is typically used in combination with the ArenaSection class: While
+// an ArenaSection is active on a thread, all aligned allocations performed via the allocate()
+// function on this thread (including the allocations of DynamicVector, DynamicMatrix, and
+// CompressedMatrix and all temporaries created during the evaluation of expressions) are drawn
+// from the arena:
+
+   \code
+   blaze::MemoryArena arena;
+
+   for( size_t i=0UL; i<requests; ++i )
+   {
+      blaze::ArenaSection section( arena );
+
+      blaze::DynamicMatrix<double> A( ... ), B( ... );
+      blaze::DynamicVector<double> x( ... );
+      // ... Computations without any call to the global allocator
+
+      // At the end of the section all vectors and matrices are destroyed
+   }
+
+   arena.release();  // Bulk release of the memory of all temporaries
+   \endcode
+
+// Allocations that exceed the large allocation threshold (see the blaze::largeAllocationThreshold
+// setting) and allocations of elements with an alignment of less than 8 bytes are not served by
+// the arena. Note that an arena is bound to the thread it has been created on: It can only be
+// activated, released, and destroyed on this thread. Objects drawing memory from an arena can be
+// destroyed on any thread (for instance after being moved to a different thread), but this must
+// happen before the arena is released or destroyed. Also note that the release() function must
+// not be called while an ArenaSection is active on the arena.
+//
+// \warning The arena serves \b all allocations of the thread during an ArenaSection, not only the
+// allocations of the objects created within the section. In particular, a container that has
+// been created before the section, but is resized, assigned to, or swapped with a temporary
+// within the section, afterwards refers to arena memory and becomes dangling as soon as the
+// arena is released:
+
+   \code
+   blaze::MemoryArena arena;
+   blaze::DynamicVector<double> y;
+
+   {
+      blaze::ArenaSection section( arena );
+      y = A * x;  // The resized vector y now refers to arena memory!
+   }
+
+   arena.release();  // y is dangling
+   \endcode
+
+// For that reason only objects with a lifetime limited to the section should be used within an
+// ArenaSection. The number of blocks that have been drawn from the arena via the allocate()
+// function and that have not been deallocated yet can be queried via the liveBlocks() function.
+// In case internal assertions are active (see the BLAZE_INTERNAL_ASSERTION switch), releasing
+// or destroying an arena with live blocks triggers an assertion.
+*/
+class MemoryArena : private NonCopyable
+{
+ private:
+   //**struct Chunk********************************************************************************
+   /*!\brief A single memory chunk of the arena.
+   */
+   struct Chunk
+   {
+      byte* begin_;  //!< The first byte of the chunk.
+      byte* end_;    //!< One past the last byte of the chunk.
+   };
+   //**********************************************************************************************
+
+   //**struct Block********************************************************************************
+   /*!\brief The header of a memory block drawn via the allocateBlock() function.
+   */
+   struct Block
+   {
+      Block* next_;  //!< The previously drawn memory block.
+      bool   live_;  //!< Flag for a memory block that has not been deallocated yet.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<Chunk>  Chunks;  //!< Vector of memory chunks.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MemoryArena( size_t chunksize = 1048576UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryArena();
+   //@}
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline byte*  allocate( size_t size, size_t alignment );
+   inline byte*  allocateBlock( size_t size, size_t alignment );
+   inline void   release();
+   inline bool   owns( const void* address ) const;
+   inline size_t liveBlocks() const;
+   inline size_t used() const;
+   inline size_t capacity() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline MemoryArena* active();
+   static inline bool         isArenaMemory( const void* address );
+   static inline bool         isArenaBlock( const void* address, size_t alignment );
+   static inline void         deallocateBlock( const void* address );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline MemoryArena*& activeArena();
+   static inline MemoryArena*& registeredArenas();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t chunksize_;   //!< The default size of newly allocated chunks.
+   Chunks chunks_;      //!< The memory chunks of the arena.
+   size_t current_;     //!< Index of the currently used chunk.
+   byte* top_;          //!< The first unused byte of the currently used chunk.
+   size_t used_;        //!< The number of bytes allocated since the last release.
+   Block* blocks_;      //!< The memory blocks drawn since the last release.
+   MemoryArena* next_;  //!< The next arena registered on the same thread.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class ArenaSection;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MemoryArena class.
+//
+// \param chunksize The default size of the memory chunks of the arena (in bytes).
+//
+// The constructor does not allocate any memory. The first chunk is allocated with the first
+// allocation from the arena.
+*/
+inline MemoryArena::MemoryArena( size_t chunksize )
+   : chunksize_( chunksize )           // The default size of newly allocated chunks
+   , chunks_   ()                      // The memory chunks of the arena
+   , current_  ( 0UL )                 // Index of the currently used chunk
+   , top_      ( NULL )                // The first unused byte of the currently used chunk
+   , used_     ( 0UL )                 // The number of bytes allocated since the last release
+   , blocks_   ( NULL )                // The memory blocks drawn since the last release
+   , next_     ( registeredArenas() )  // The next arena registered on the same thread
+{
+   registeredArenas() = this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the MemoryArena class.
+//
+// The destructor releases all memory chunks of the arena. Note that the arena must be destroyed
+// on the same thread it has been created on.
+*/
+inline MemoryArena::~MemoryArena()
+{
+   BLAZE_INTERNAL_ASSERT( activeArena() != this, "Destruction of an active memory arena" );
+   BLAZE_INTERNAL_ASSERT( liveBlocks() == 0UL  , "Destruction of a memory arena with live blocks" );
+
+   MemoryArena** arena( &registeredArenas() );
+   while( *arena != this ) {
+      BLAZE_INTERNAL_ASSERT( *arena != NULL, "Memory arena destroyed on foreign thread" );
+      arena = &(*arena)->next_;
+   }
+   *arena = next_;
+
+   for( Chunks::iterator chunk=chunks_.begin(); chunk!=chunks_.end(); ++chunk )
+      delete [] chunk->begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of aligned memory from the arena.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment (must be a power of two).
+// \return Byte pointer to the first byte of the aligned memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function draws the requested number of bytes from the currently used chunk of the arena.
+// In case the chunk is exhausted, the next chunk large enough to hold the requested memory is
+// used. In case no such chunk exists, a new chunk is allocated.
+*/
+inline byte* MemoryArena::allocate( size_t size, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( ( alignment & ( alignment - 1UL ) ) == 0UL, "Invalid alignment detected" );
+
+   while( current_ < chunks_.size() )
+   {
+      const size_t address( ( reinterpret_cast<size_t>( top_ ) + alignment - 1UL ) & ~( alignment - 1UL ) );
+      byte* const first( reinterpret_cast<byte*>( address ) );
+
+      if( first <= chunks_[current_].end_ && size <= size_t( chunks_[current_].end_ - first ) ) {
+         top_   = first + size;
+         used_ += size;
+         return first;
+      }
+
+      if( ++current_ < chunks_.size() )
+         top_ = chunks_[current_].begin_;
+   }
+
+   const size_t chunksize( ( size + alignment > chunksize_ )?( size + alignment ):( chunksize_ ) );
+
+   Chunk chunk;
+   chunk.begin_ = new byte[chunksize];
+   chunk.end_   = chunk.begin_ + chunksize;
+
+   try {
+      chunks_.push_back( chunk );
+   }
+   catch( ... ) {
+      delete [] chunk.begin_;
+      throw;
+   }
+
+   current_ = chunks_.size() - 1UL;
+   top_     = chunk.begin_;
+
+   return allocate( size, alignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of a memory block for the allocate() function.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment (must be a power of two).
+// \return Byte pointer to the first byte of the memory block.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function draws a memory block from the arena that is placed at an odd multiple of the
+// given alignment. Since all memory blocks acquired from the system by the allocate() function
+// are aligned to twice the alignment, this placement identifies the block as arena memory on
+// deallocation (see the isArenaBlock() function). The block is preceded by a header, which
+// records the block until it is deallocated (see the liveBlocks() function).
+*/
+inline byte* MemoryArena::allocateBlock( size_t size, size_t alignment )
+{
+   size_t offset( alignment );
+   while( offset < sizeof( Block ) )
+      offset += 2UL*alignment;
+
+   byte* const address( allocate( size+offset, 2UL*alignment ) + offset );
+
+   Block* const block( reinterpret_cast<Block*>( address ) - 1 );
+   block->next_ = blocks_;
+   block->live_ = true;
+   blocks_ = block;
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bulk release of all memory drawn from the arena.
+//
+// \return void
+//
+// This function makes all memory drawn from the arena available again. Note that the memory
+// chunks themselves are not deallocated but reused by subsequent allocations. Also note that
+// any object still using memory of the arena is invalidated by this function.
+*/
+inline void MemoryArena::release()
+{
+   BLAZE_INTERNAL_ASSERT( activeArena() != this, "Release of an active memory arena" );
+   BLAZE_INTERNAL_ASSERT( liveBlocks() == 0UL  , "Release of a memory arena with live blocks" );
+
+   current_ = 0UL;
+   top_     = ( chunks_.empty() )?( NULL ):( chunks_[0UL].begin_ );
+   used_    = 0UL;
+   blocks_  = NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given address belongs to the memory of the arena.
+//
+// \param address The address to be checked.
+// \return \a true if the address belongs to the arena, \a false if not.
+*/
+inline bool MemoryArena::owns( const void* address ) const
+{
+   const byte* const ptr( reinterpret_cast<const byte*>( address ) );
+
+   for( Chunks::const_iterator chunk=chunks_.begin(); chunk!=chunks_.end(); ++chunk ) {
+      if( ptr >= chunk->begin_ && ptr < chunk->end_ )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of memory blocks of the arena that have not been deallocated yet.
+//
+// \return The number of live memory blocks.
+//
+// This function counts the memory blocks that have been drawn from the arena via the allocate()
+// function since the last release and that have not been deallocated yet. Before the arena is
+// released or destroyed, this number should be zero. Otherwise some object still refers to the
+// memory of the arena.
+*/
+inline size_t MemoryArena::liveBlocks() const
+{
+   size_t blocks( 0UL );
+
+   for( const Block* block=blocks_; block!=NULL; block=block->next_ ) {
+      if( block->live_ )
+         ++blocks;
+   }
+
+   return blocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes drawn from the arena since the last release.
+//
+// \return The number of allocated bytes (excluding alignment padding).
+*/
+inline size_t MemoryArena::used() const
+{
+   return used_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total size of all memory chunks of the arena.
+//
+// \return The capacity of the arena in bytes.
+*/
+inline size_t MemoryArena::capacity() const
+{
+   size_t capacity( 0UL );
+
+   for( Chunks::const_iterator chunk=chunks_.begin(); chunk!=chunks_.end(); ++chunk )
+      capacity += size_t( chunk->end_ - chunk->begin_ );
+
+   return capacity;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the memory arena that is active on the calling thread.
+//
+// \return Pointer to the active arena, \a NULL in case no arena is active.
+*/
+inline MemoryArena* MemoryArena::active()
+{
+   return activeArena();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given address belongs to any arena of the calling thread.
+//
+// \param address The address to be checked.
+// \return \a true if the address belongs to an arena, \a false if not.
+//
+// This function checks all arenas that have been created on the calling thread, independent of
+// whether they are active or not.
+*/
+inline bool MemoryArena::isArenaMemory( const void* address )
+{
+   for( const MemoryArena* arena=registeredArenas(); arena!=NULL; arena=arena->next_ ) {
+      if( arena->owns( address ) )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given memory block has been drawn from a memory arena.
+//
+// \param address The address of the memory block returned by the allocate() function.
+// \param alignment The alignment that has been used for the allocation.
+// \return \a true if the block belongs to a memory arena, \a false if not.
+//
+// This function identifies memory blocks drawn via the allocateBlock() function of any arena by
+// their placement at an odd multiple of the alignment. In contrast to the isArenaMemory()
+// function it can be used on any thread.
+*/
+inline bool MemoryArena::isArenaBlock( const void* address, size_t alignment )
+{
+   return ( reinterpret_cast<size_t>( address ) & alignment ) != 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of a memory block drawn via the allocateBlock() function.
+//
+// \param address The address of the memory block.
+// \return void
+//
+// This function marks the given memory block as deallocated. The memory itself is not reused
+// before the arena is released. This function can be called on any thread.
+*/
+inline void MemoryArena::deallocateBlock( const void* address )
+{
+   Block* const block( const_cast<Block*>( reinterpret_cast<const Block*>( address ) ) - 1 );
+   block->live_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the active arena of the calling thread.
+//
+// \return Reference to the thread-local pointer to the active arena.
+*/
+inline MemoryArena*& MemoryArena::activeArena()
+{
+   static BLAZE_THREAD_LOCAL MemoryArena* arena = NULL;
+   return arena;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the list of arenas created on the calling thread.
+//
+// \return Reference to the thread-local head of the list of arenas.
+*/
+inline MemoryArena*& MemoryArena::registeredArenas()
+{
+   static BLAZE_THREAD_LOCAL MemoryArena* arenas = NULL;
+   return arenas;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ARENASECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scoped activation of a memory arena.
+// \ingroup util
+//
+// The ArenaSection class activates the given MemoryArena on the calling thread for the lifetime
+// of the section object. While the section is active, all aligned allocations performed via the
+// allocate() function on the calling thread are drawn from the arena. Sections can be nested;
+// at the end of a section the previously active arena (if any) is reactivated. Note that an
+// ArenaSection does not release the memory of the arena (see the MemoryArena::release()
+// function).
+//
+// \warning This includes the allocations of objects that outlive the section, for instance of a
+// container that is resized or assigned to within the section. Such objects are left dangling
+// by the release of the arena (see the MemoryArena class for details).
+*/
+class ArenaSection : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ArenaSection( MemoryArena& arena );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ArenaSection();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryArena* previous_;  //!< The previously active arena.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ArenaSection class.
+//
+// \param arena The memory arena to be activated.
+*/
+inline ArenaSection::ArenaSection( MemoryArena& arena )
+   : previous_( MemoryArena::activeArena() )  // The previously active arena
+{
+   MemoryArena::activeArena() = &arena;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor of the ArenaSection class.
+*/
+inline ArenaSection::~ArenaSection()
+{
+   MemoryArena::activeArena() = previous_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,73 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NUMAPolicy.h
+//  \brief Header file for the NUMA memory placement policies
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_NUMAPOLICY_H_
+#define _BLAZE_UTIL_NUMAPOLICY_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMA MEMORY PLACEMENT POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief NUMA memory placement policies.
+// \ingroup util
+//
+// The NUMAPolicy enumeration represents the placement policies that can be applied to large
+// memory allocations on systems with a non-uniform memory architecture (NUMA):
+//
+//  - \a numaFirstTouch: The pages of an allocation are placed on the NUMA node of the thread
+//    that first writes to them. This is the default policy of all common operating systems.
+//    In combination with the parallel first-touch initialization of dense vectors and matrices
+//    the pages are distributed among the NUMA nodes of all threads of the active SMP backend.
+//  - \a numaInterleave: The pages of an allocation are distributed round-robin among all NUMA
+//    nodes specified by the blaze::numaNodeMask setting.
+//  - \a numaBind: The pages of an allocation are restricted to the NUMA nodes specified by the
+//    blaze::numaNodeMask setting.
+*/
+enum NUMAPolicy
+{
+   numaFirstTouch = 0,  //!< Placement on the NUMA node of the first touching thread.
+   numaInterleave = 1,  //!< Round-robin placement among the selected NUMA nodes.
+   numaBind       = 2   //!< Placement restricted to the selected NUMA nodes.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
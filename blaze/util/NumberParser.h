@@ -0,0 +1,206 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NumberParser.h
+//  \brief Header file for the fast parsing of numbers from character ranges
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_NUMBERPARSER_H_
+#define _BLAZE_UTIL_NUMBERPARSER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <string>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMBER PARSING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Number parsing functions */
+//@{
+inline bool parseIndex ( const char*& pos, const char* end, size_t& value );
+inline bool parseNumber( const char*& pos, const char* end, double& value );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing an unsigned integral index from the given character range.
+// \ingroup util
+//
+// \param pos Reference to the current position within the character range.
+// \param end The end of the character range.
+// \param value Reference to the parsed index.
+// \return \a true in case an index was parsed, \a false if not.
+//
+// This function parses a sequence of decimal digits starting at \a pos. In case of success,
+// \a pos is advanced past the last digit. Otherwise \a pos and \a value remain unchanged.
+// Note that no leading whitespace is skipped.
+*/
+inline bool parseIndex( const char*& pos, const char* end, size_t& value )
+{
+   const char* p( pos );
+   size_t index( 0UL );
+
+   while( p != end && static_cast<unsigned>( *p - '0' ) < 10U ) {
+      index = index*10UL + static_cast<size_t>( *p - '0' );
+      ++p;
+   }
+
+   if( p == pos ) return false;
+
+   pos   = p;
+   value = index;
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing a floating point number from the given character range.
+// \ingroup util
+//
+// \param pos Reference to the current position within the character range.
+// \param end The end of the character range.
+// \param value Reference to the parsed number.
+// \return \a true in case a number was parsed, \a false if not.
+//
+// This function parses a decimal floating point number in the format accepted by \c strtod()
+// starting at \a pos. In case of success, \a pos is advanced past the number. Otherwise \a pos
+// and \a value remain unchanged. Note that no leading whitespace is skipped.\n
+// Since the character range is not required to be null-terminated, \c strtod() cannot be
+// applied directly. Instead the mantissa and the decimal exponent are accumulated in integral
+// form and all numbers with at most 15 significant digits and a decimal exponent within
+// \f$ [-22..22] \f$ are converted by a single, exactly rounded multiplication or division. Only
+// numbers outside this range, infinities and NaNs are converted via \c strtod() on a copy.
+*/
+inline bool parseNumber( const char*& pos, const char* end, double& value )
+{
+   static const double powers[] = {
+      1E0 , 1E1 , 1E2 , 1E3 , 1E4 , 1E5 , 1E6 , 1E7 , 1E8 , 1E9 , 1E10, 1E11,
+      1E12, 1E13, 1E14, 1E15, 1E16, 1E17, 1E18, 1E19, 1E20, 1E21, 1E22
+   };
+
+   const char* p( pos );
+
+   bool negative( false );
+   if( p != end && ( *p == '-' || *p == '+' ) ) {
+      negative = ( *p == '-' );
+      ++p;
+   }
+
+   uint64_t mantissa( 0U );
+   int digits  ( 0 );
+   int exponent( 0 );
+   bool valid( false );
+
+   for( ; p != end && static_cast<unsigned>( *p - '0' ) < 10U; ++p ) {
+      if( digits < 19 ) {
+         mantissa = mantissa*10U + static_cast<unsigned>( *p - '0' );
+         if( mantissa != 0U ) ++digits;
+      }
+      else ++exponent;
+      valid = true;
+   }
+
+   if( p != end && *p == '.' ) {
+      for( ++p; p != end && static_cast<unsigned>( *p - '0' ) < 10U; ++p ) {
+         if( digits < 19 ) {
+            mantissa = mantissa*10U + static_cast<unsigned>( *p - '0' );
+            if( mantissa != 0U ) ++digits;
+            --exponent;
+         }
+         valid = true;
+      }
+   }
+
+   if( valid && p != end && ( *p == 'e' || *p == 'E' ) )
+   {
+      const char* q( p+1 );
+      bool negativeExponent( false );
+
+      if( q != end && ( *q == '-' || *q == '+' ) ) {
+         negativeExponent = ( *q == '-' );
+         ++q;
+      }
+
+      if( q != end && static_cast<unsigned>( *q - '0' ) < 10U ) {
+         int e( 0 );
+         for( ; q != end && static_cast<unsigned>( *q - '0' ) < 10U; ++q ) {
+            if( e < 10000 ) e = e*10 + ( *q - '0' );
+         }
+         exponent += ( negativeExponent )?( -e ):( e );
+         p = q;
+      }
+   }
+
+   if( valid && digits <= 15 && exponent >= -22 && exponent <= 22 )
+   {
+      double result( static_cast<double>( mantissa ) );
+      if( exponent < 0 ) result /= powers[-exponent];
+      else result *= powers[exponent];
+      value = ( negative )?( -result ):( result );
+      pos = p;
+      return true;
+   }
+
+   // Fallback for long mantissas, large exponents, infinities, and NaNs
+   const char* last( pos );
+   while( last != end && last-pos < 64 && *last != ' ' && *last != '\t' && *last != ',' &&
+          *last != ';' && *last != '\n' && *last != '\r' ) {
+      ++last;
+   }
+
+   const std::string token( pos, last );
+   char* stop( NULL );
+   const double result( std::strtod( token.c_str(), &stop ) );
+
+   if( stop == token.c_str() ) return false;
+
+   value = result;
+   pos  += ( stop - token.c_str() );
+   return true;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
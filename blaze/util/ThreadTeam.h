@@ -0,0 +1,653 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ThreadTeam.h
+//  \brief Header file of the ThreadTeam class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADTEAM_H_
+#define _BLAZE_UTIL_THREADTEAM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <atomic>
+#else
+#  include <boost/atomic.hpp>
+#endif
+
+#include <vector>
+#include <boost/bind.hpp>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a persistent team of threads for low-latency fork-join parallelism.
+// \ingroup threads
+//
+// The ThreadTeam class template represents a persistent team of \f$ n \f$ members: the calling
+// thread and \f$ n-1 \f$ worker threads. In contrast to the ThreadPool class template, scheduled
+// tasks are not inserted into a shared task queue, but are statically assigned to the members
+// of the team in a round-robin fashion (i.e. the \f$ i \f$-th task scheduled since the last call
+// to wait() is assigned to the member \f$ i \bmod n \f$). The tasks are executed as soon as the
+// wait() function is called: The calling thread starts a new generation of work by incrementing
+// an atomic generation counter, executes its own tasks, and waits for the worker threads to
+// complete their tasks.
+//
+// Idle worker threads spin on the generation counter for a limited number of iterations (see
+// the \a spincount argument of the constructor) before parking on a condition variable. The
+// calling thread waits for the completion of the worker threads in the same way. Therefore
+// consecutive fork-join operations in quick succession do not involve any system calls.
+//
+// The ThreadTeam class template provides the same interface as the ThreadPool class template
+// and is parameterized in the same way:
+
+   \code
+   typedef blaze::ThreadTeam< std::thread
+                            , std::mutex
+                            , std::unique_lock<std::mutex>
+                            , std::condition_variable >  StdThreadTeam;
+
+   StdThreadTeam team( 4 );
+
+   team.schedule( Functor(), 0 );  // Executed by the calling thread
+   team.schedule( Functor(), 1 );  // Executed by the first worker thread
+   team.schedule( Functor(), 2 );  // Executed by the second worker thread
+   team.schedule( Functor(), 3 );  // Executed by the third worker thread
+
+   team.wait();  // Execution of all scheduled tasks
+   \endcode
+
+// Note that, in contrast to the ThreadPool class template, the tasks are not started before the
+// wait() function is called, and that the schedule() and wait() functions must only be called
+// by the thread that has created the team. The team uses C++11 atomics in case the C++11 thread
+// parallelization is active (see the BLAZE_USE_CPP_THREADS switch) and Boost atomics otherwise.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class ThreadTeam : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TT                             ThreadType;  //!< Type of the encapsulated thread.
+   typedef MT                             Mutex;       //!< Type of the mutex.
+   typedef LT                             Lock;        //!< Type of a locking object.
+   typedef CT                             Condition;   //!< Condition variable type.
+   typedef std::vector<threadpool::Task>  Tasks;       //!< Type of the task list of a member.
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   typedef std::atomic<size_t>    AtomicCounter;  //!< Type of the atomic counters.
+   typedef std::atomic<bool>      AtomicFlag;     //!< Type of the atomic flags.
+#else
+   typedef boost::atomic<size_t>  AtomicCounter;  //!< Type of the atomic counters.
+   typedef boost::atomic<bool>    AtomicFlag;     //!< Type of the atomic flags.
+#endif
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit ThreadTeam( size_t n, size_t spincount = 4000UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ThreadTeam();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   //@}
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   void schedule( Callable func );
+
+   template< typename Callable, typename A1 >
+   void schedule( Callable func, A1 a1 );
+
+   template< typename Callable, typename A1, typename A2 >
+   void schedule( Callable func, A1 a1, A2 a2 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n, bool block=false );
+   void wait();
+   void clear();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void        work( size_t member, size_t generation );
+   void        createThreads( size_t n );
+   void        destroyThreads();
+   static void execute( Tasks& tasks );
+   static void pause();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t                   spincount_;      //!< Number of spin iterations before parking.
+   size_t                   next_;           //!< The member the next task is assigned to.
+   std::vector<Tasks>       tasks_;          //!< The task lists of all members.
+   std::vector<ThreadType*> threads_;        //!< The worker threads of the team.
+   AtomicCounter            generation_;     //!< The current generation of work.
+   AtomicCounter            pending_;        //!< Number of worker threads still working.
+   AtomicCounter            sleepers_;       //!< Number of parked worker threads.
+   AtomicFlag               waiting_;        //!< Flag for a parked calling thread.
+   AtomicFlag               shutdown_;       //!< Termination flag for the worker threads.
+   mutable Mutex            mutex_;          //!< Synchronization mutex.
+   Condition                workAvailable_;  //!< Wake-up condition for parked worker threads.
+   Condition                workCompleted_;  //!< Wake-up condition for the parked calling thread.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadTeam class.
+//
+// \param n Initial number of members of the team \f$[1..\infty)\f$.
+// \param spincount Number of spin iterations before an idle thread is parked.
+// \exception std::invalid_argument Invalid number of team members.
+//
+// This constructor creates a thread team with \a n members, i.e. with the calling thread and
+// \f$ n-1 \f$ worker threads. In case \a n is 0, a \a std::invalid_argument is thrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+ThreadTeam<TT,MT,LT,CT>::ThreadTeam( size_t n, size_t spincount )
+   : spincount_    ( spincount )  // Number of spin iterations before parking
+   , next_         ( 0UL )        // The member the next scheduled task is assigned to
+   , tasks_        ()             // The task lists of all members
+   , threads_      ()             // The worker threads of the team
+   , generation_   ( 0UL )        // The current generation of work
+   , pending_      ( 0UL )        // Number of worker threads still working
+   , sleepers_     ( 0UL )        // Number of parked worker threads
+   , waiting_      ( false )      // Flag for a parked calling thread
+   , shutdown_     ( false )      // Termination flag for the worker threads
+   , mutex_        ()             // Synchronization mutex
+   , workAvailable_()             // Wake-up condition for the parked worker threads
+   , workCompleted_()             // Wake-up condition for the parked calling thread
+{
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the ThreadTeam class.
+//
+// The destructor discards all scheduled but not yet executed tasks and joins all worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+ThreadTeam<TT,MT,LT,CT>::~ThreadTeam()
+{
+   destroyThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case tasks are scheduled, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadTeam<TT,MT,LT,CT>::isEmpty() const
+{
+   for( size_t i=0UL; i<tasks_.size(); ++i ) {
+      if( !tasks_[i].empty() )
+         return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of members of the team.
+//
+// \return The number of members (including the calling thread).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadTeam<TT,MT,LT,CT>::size() const
+{
+   return tasks_.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given zero argument function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function assigns the given function/functor to the next member of the team. The given
+// function/functor must be copyable, must be callable without arguments and must return void.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+void ThreadTeam<TT,MT,LT,CT>::schedule( Callable func )
+{
+   tasks_[next_].push_back( func );
+   next_ = ( next_+1UL == tasks_.size() )?( 0UL ):( next_+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given unary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \return void
+//
+// This function assigns the given function/functor to the next member of the team. The given
+// function/functor must be copyable, must be callable with one argument and must return void.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable  // Type of the function/functor
+        , typename A1 >      // Type of the first argument
+void ThreadTeam<TT,MT,LT,CT>::schedule( Callable func, A1 a1 )
+{
+   schedule( boost::bind<void>( func, a1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given binary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \return void
+//
+// This function assigns the given function/functor to the next member of the team. The given
+// function/functor must be copyable, must be callable with two arguments and must return void.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2 >      // Type of the second argument
+void ThreadTeam<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2 )
+{
+   schedule( boost::bind<void>( func, a1, a2 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of members of the team.
+//
+// \param n The new number of members \f$[1..\infty)\f$.
+// \param block Unused; the function always blocks until the team has been resized.
+// \return void
+// \exception std::invalid_argument Invalid number of team members.
+//
+// This function changes the number of members of the team. All scheduled but not yet executed
+// tasks are discarded. In case \a n is 0, a \a std::invalid_argument is thrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   UNUSED_PARAMETER( block );
+
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   if( n == tasks_.size() )
+      return;
+
+   destroyThreads();
+   createThreads( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing all scheduled tasks and waiting for their completion.
+//
+// \return void
+//
+// This function starts a new generation of work, executes all tasks assigned to the calling
+// thread, and blocks until all worker threads have completed their tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::wait()
+{
+   next_ = 0UL;
+
+   if( threads_.empty() ) {
+      execute( tasks_[0UL] );
+      return;
+   }
+
+   pending_.store( threads_.size() );
+   generation_.fetch_add( 1UL );
+
+   if( sleepers_.load() > 0UL ) {
+      Lock lock( mutex_ );
+      workAvailable_.notify_all();
+   }
+
+   execute( tasks_[0UL] );
+
+   for( size_t i=0UL; i<spincount_ && pending_.load() != 0UL; ++i )
+      pause();
+
+   if( pending_.load() != 0UL ) {
+      Lock lock( mutex_ );
+      waiting_.store( true );
+      while( pending_.load() != 0UL )
+         workCompleted_.wait( lock );
+      waiting_.store( false );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all scheduled tasks from the team.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::clear()
+{
+   for( size_t i=0UL; i<tasks_.size(); ++i )
+      tasks_[i].clear();
+
+   next_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Main function of the worker threads.
+//
+// \param member The index of the team member.
+// \param generation The generation of work at the time of the creation of the thread.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::work( size_t member, size_t generation )
+{
+   while( true )
+   {
+      for( size_t i=0UL; i<spincount_; ++i ) {
+         if( generation_.load() != generation ) break;
+         pause();
+      }
+
+      if( generation_.load() == generation )
+      {
+         Lock lock( mutex_ );
+         ++sleepers_;
+         while( generation_.load() == generation && !shutdown_.load() )
+            workAvailable_.wait( lock );
+         --sleepers_;
+      }
+
+      if( shutdown_.load() )
+         return;
+
+      generation = generation_.load();
+
+      execute( tasks_[member] );
+
+      if( pending_.fetch_sub( 1UL ) == 1UL && waiting_.load() ) {
+         Lock lock( mutex_ );
+         workCompleted_.notify_one();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of the worker threads of a team with the given number of members.
+//
+// \param n The number of members of the team.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::createThreads( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( threads_.empty(), "Existing worker threads detected" );
+
+   tasks_.resize( n );
+   next_ = 0UL;
+   shutdown_.store( false );
+
+   const size_t generation( generation_.load() );
+
+   for( size_t i=1UL; i<n; ++i )
+      threads_.push_back( new ThreadType( boost::bind( &ThreadTeam::work, this, i, generation ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Termination of all worker threads of the team.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::destroyThreads()
+{
+   {
+      Lock lock( mutex_ );
+      shutdown_.store( true );
+      generation_.fetch_add( 1UL );
+      workAvailable_.notify_all();
+   }
+
+   for( size_t i=0UL; i<threads_.size(); ++i ) {
+      threads_[i]->join();
+      delete threads_[i];
+   }
+
+   threads_.clear();
+   tasks_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Execution and removal of the given list of tasks.
+//
+// \param tasks The list of tasks to be executed.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::execute( Tasks& tasks )
+{
+   for( typename Tasks::iterator task=tasks.begin(); task!=tasks.end(); ++task )
+      (*task)();
+
+   tasks.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Single iteration of a spin-wait loop.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadTeam<TT,MT,LT,CT>::pause()
+{
+#if BLAZE_SSE2_MODE
+   _mm_pause();
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,488 @@
+//=================================================================================================
+/*!
+//  \file src/main/Calibration.cpp
+//  \brief Source file for the Blaze threshold calibration
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Infinity.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Timing.h>
+#include <blaze/util/Unused.h>
+#include <blazemark/system/Config.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blaze::columnMajor;
+using blaze::columnVector;
+using blaze::rowMajor;
+using blaze::rowVector;
+using blazemark::element_t;
+
+
+
+
+//=================================================================================================
+//
+//  CALIBRATION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Dense vector assignment ( \f$ \vec{b} = \vec{a} \f$ ).
+*/
+struct DVecAssign
+{
+   explicit DVecAssign( size_t N ) : a_( N, element_t(1) ), b_( N ) {}
+   void operator()() { b_ = a_; }
+   blaze::DynamicVector<element_t,columnVector> a_, b_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector/dense vector addition ( \f$ \vec{c} = \vec{a} + \vec{b} \f$ ).
+*/
+struct DVecDVecAdd
+{
+   explicit DVecDVecAdd( size_t N ) : a_( N, element_t(1) ), b_( N, element_t(2) ), c_( N ) {}
+   void operator()() { c_ = a_ + b_; }
+   blaze::DynamicVector<element_t,columnVector> a_, b_, c_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector/dense vector subtraction ( \f$ \vec{c} = \vec{a} - \vec{b} \f$ ).
+*/
+struct DVecDVecSub
+{
+   explicit DVecDVecSub( size_t N ) : a_( N, element_t(1) ), b_( N, element_t(2) ), c_( N ) {}
+   void operator()() { c_ = a_ - b_; }
+   blaze::DynamicVector<element_t,columnVector> a_, b_, c_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector/dense vector multiplication ( \f$ \vec{c} = \vec{a} * \vec{b} \f$ ).
+*/
+struct DVecDVecMult
+{
+   explicit DVecDVecMult( size_t N ) : a_( N, element_t(1) ), b_( N, element_t(2) ), c_( N ) {}
+   void operator()() { c_ = a_ * b_; }
+   blaze::DynamicVector<element_t,columnVector> a_, b_, c_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense vector/scalar multiplication ( \f$ \vec{b} = \vec{a} * s \f$ ).
+*/
+struct DVecScalarMult
+{
+   explicit DVecScalarMult( size_t N ) : a_( N, element_t(1) ), b_( N ) {}
+   void operator()() { b_ = a_ * element_t(2); }
+   blaze::DynamicVector<element_t,columnVector> a_, b_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix/dense vector multiplication ( \f$ \vec{y} = A * \vec{x} \f$ ).
+*/
+template< bool SO >
+struct DMatDVecMult
+{
+   explicit DMatDVecMult( size_t N ) : A_( N, N, element_t(1) ), x_( N, element_t(1) ), y_( N ) {}
+   void operator()() { y_ = A_ * x_; }
+   blaze::DynamicMatrix<element_t,SO> A_;
+   blaze::DynamicVector<element_t,columnVector> x_, y_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transpose dense vector/dense matrix multiplication ( \f$ \vec{y}^T = \vec{x}^T * A \f$ ).
+*/
+template< bool SO >
+struct TDVecDMatMult
+{
+   explicit TDVecDMatMult( size_t N ) : A_( N, N, element_t(1) ), x_( N, element_t(1) ), y_( N ) {}
+   void operator()() { y_ = x_ * A_; }
+   blaze::DynamicMatrix<element_t,SO> A_;
+   blaze::DynamicVector<element_t,rowVector> x_, y_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix assignment ( \f$ B = A \f$ ).
+*/
+struct DMatAssign
+{
+   explicit DMatAssign( size_t N ) : A_( N, N, element_t(1) ), B_( N, N ) {}
+   void operator()() { B_ = A_; }
+   blaze::DynamicMatrix<element_t,rowMajor> A_, B_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix/dense matrix addition ( \f$ C = A + B \f$ ).
+*/
+template< bool SO >
+struct DMatDMatAdd
+{
+   explicit DMatDMatAdd( size_t N ) : A_( N, N, element_t(1) ), B_( N, N, element_t(2) ), C_( N, N ) {}
+   void operator()() { C_ = A_ + B_; }
+   blaze::DynamicMatrix<element_t,rowMajor> A_;
+   blaze::DynamicMatrix<element_t,SO> B_;
+   blaze::DynamicMatrix<element_t,rowMajor> C_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix/dense matrix subtraction ( \f$ C = A - B \f$ ).
+*/
+template< bool SO >
+struct DMatDMatSub
+{
+   explicit DMatDMatSub( size_t N ) : A_( N, N, element_t(1) ), B_( N, N, element_t(2) ), C_( N, N ) {}
+   void operator()() { C_ = A_ - B_; }
+   blaze::DynamicMatrix<element_t,rowMajor> A_;
+   blaze::DynamicMatrix<element_t,SO> B_;
+   blaze::DynamicMatrix<element_t,rowMajor> C_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix/scalar multiplication ( \f$ B = A * s \f$ ).
+*/
+struct DMatScalarMult
+{
+   explicit DMatScalarMult( size_t N ) : A_( N, N, element_t(1) ), B_( N, N ) {}
+   void operator()() { B_ = A_ * element_t(2); }
+   blaze::DynamicMatrix<element_t,rowMajor> A_, B_;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix/dense matrix multiplication ( \f$ C = A * B \f$ ).
+*/
+template< bool SO1, bool SO2 >
+struct DMatDMatMult
+{
+   explicit DMatDMatMult( size_t N ) : A_( N, N, element_t(1) ), B_( N, N, element_t(2) ), C_( N, N ) {}
+   void operator()() { C_ = A_ * B_; }
+   blaze::DynamicMatrix<element_t,SO1> A_;
+   blaze::DynamicMatrix<element_t,SO2> B_;
+   blaze::DynamicMatrix<element_t,SO1> C_;
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of a single execution of the given operation.
+//
+// \param N The size of the operands.
+// \return The minimum runtime of a single execution of the operation [s].
+//
+// This function first estimates the number of steps necessary for a measurable runtime and
+// afterwards returns the minimum runtime of several repetitions of these steps. All steps are
+// executed within a parallel section in order to enable the SMP kernels.
+*/
+template< typename OP >
+double measure( size_t N )
+{
+   OP op( N );
+   blaze::timing::WcTimer timer;
+   size_t steps( 1UL );
+   double minimum( 0.0 );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      while( true ) {
+         timer.start();
+         for( size_t step=0UL; step<steps; ++step ) {
+            op();
+         }
+         timer.end();
+         if( timer.last() >= 0.01 ) break;
+         steps *= 2UL;
+      }
+
+      minimum = timer.last() / steps;
+
+      for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+         timer.start();
+         for( size_t step=0UL; step<steps; ++step ) {
+            op();
+         }
+         timer.end();
+         minimum = blaze::min( minimum, timer.last() / steps );
+      }
+   }
+
+   return minimum;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover point between two kernels of the given operation.
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \param first The smallest operand size to be measured.
+// \param last The largest operand size to be measured.
+// \param smp \a true for an SMP threshold, \a false for a BLAS threshold.
+// \return void
+//
+// This function measures the runtime of the given operation for increasing operand sizes,
+// once with the first kernel (serial or custom Blaze kernel) and once with the second kernel
+// (parallel or BLAS kernel) enforced. The threshold is set to the size at which the second
+// kernel is faster (by more than the allowed deviation) for three consecutive sizes. SMP thresholds are specified in terms of the
+// number of rows/elements (the operation is executed in parallel for larger sizes), whereas
+// BLAS thresholds are specified in terms of the number of matrix elements (the BLAS kernel is
+// used for matrices of the same or larger size). In case no crossover point is detected, the
+// threshold is set to the given default value.
+*/
+template< typename OP >
+void calibrate( const std::string& name, size_t first, size_t last, bool smp )
+{
+   const size_t defaults( blaze::getThreshold( name ) );
+   const size_t second( smp ? 0UL : 1UL );
+
+   std::cout << "   " << name << "\n";
+
+   size_t wins( 0UL ), candidate( 0UL ), previous( first-1UL );
+
+   for( size_t N=first; N<=last && wins<3UL; N=blaze::max( N+1UL, (N*5UL)/4UL ) )
+   {
+      blaze::setThreshold( name, blaze::inf );
+      const double time1( measure<OP>( N ) );
+
+      blaze::setThreshold( name, second );
+      const double time2( measure<OP>( N ) );
+
+      std::cout << "     N=" << std::setw(8) << N
+                << "   " << ( smp ? "serial" : "Blaze " ) << ": " << std::setw(12) << time1 << "s"
+                << "   " << ( smp ? "SMP   " : "BLAS  " ) << ": " << std::setw(12) << time2 << "s\n";
+
+      if( time2 * ( 1.0 + blazemark::deviation / 100.0 ) < time1 ) {
+         if( wins++ == 0UL )
+            candidate = ( smp ? previous : N*N );
+      }
+      else wins = 0UL;
+
+      previous = N;
+   }
+
+   const size_t threshold( ( wins == 3UL )?( candidate ):( defaults ) );
+   blaze::setThreshold( name, threshold );
+
+   std::cout << "     => " << threshold
+             << ( wins == 3UL ? "" : " (no crossover detected, default kept)" ) << "\n" << std::endl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the current thresholds as configuration header.
+//
+// \param filename The name of the output file.
+// \return void
+//
+// This function writes all current thresholds in the format of <tt>blaze/config/Thresholds.h</tt>
+// to the given file. Additionally, the corresponding environment variables are printed to the
+// standard output.
+*/
+void write( const std::string& filename )
+{
+   const blaze::ThresholdSetting* const settings( blaze::getThresholdSettings() );
+
+   std::ofstream out( filename.c_str() );
+
+   out << "//=================================================================================================\n"
+       << "/*!\n"
+       << "//  \\file blaze/config/Thresholds.h\n"
+       << "//  \\brief Configuration of the thresholds (generated by the Blaze threshold calibration)\n"
+       << "*/\n"
+       << "//=================================================================================================\n"
+       << "\n"
+       << "#define BLAZE_USE_RUNTIME_THRESHOLDS " << BLAZE_USE_RUNTIME_THRESHOLDS << "\n"
+       << "\n"
+       << "namespace blaze {\n"
+       << "\n";
+
+   for( size_t i=0UL; i<blaze::THRESHOLD_COUNT; ++i )
+   {
+      std::string name( settings[i].name );
+      name.insert( name.size()-10UL, "_USER" );
+      out << "const size_t " << std::left << std::setw(34) << name << " = " << settings[i].value << "UL;\n";
+   }
+
+   out << "\n"
+       << "} // namespace blaze\n";
+
+   if( !out ) {
+      std::cerr << " Error writing '" << filename << "'!\n";
+      return;
+   }
+
+   std::cout << " Written the configuration header '" << filename << "'.\n"
+             << " Alternatively, the thresholds can be set via the following environment variables:\n\n";
+
+   for( size_t i=0UL; i<blaze::THRESHOLD_COUNT; ++i ) {
+      std::cout << "   export BLAZE_" << settings[i].name << "=" << settings[i].value << "\n";
+   }
+
+   std::cout << std::endl;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze threshold calibration.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The threshold calibration determines the crossover points between the serial and the
+// parallel kernels and between the custom Blaze kernels and the BLAS kernels on the current
+// machine and writes the according configuration header (default: "Thresholds.h"). It can
+// replace the file <tt>blaze/config/Thresholds.h</tt>. Thresholds that cannot be calibrated
+// (i.e. sparse thresholds, SMP thresholds for a single thread, or BLAS thresholds without
+// BLAS support) keep their current value.
+*/
+int main( int argc, char** argv )
+{
+   if( argc > 2 ) {
+      std::cerr << " Invalid use of program 'Calibration'!\n"
+                << "   Use: ./calibration [<output_file>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+#if !BLAZE_USE_RUNTIME_THRESHOLDS || BLAZE_DEBUG_MODE
+   UNUSED_PARAMETER( argv );
+   std::cerr << " The threshold calibration requires runtime thresholds and a non-debug build!\n" << std::endl;
+   return EXIT_FAILURE;
+#else
+   const std::string filename( ( argc == 2 )?( argv[1] ):( "Thresholds.h" ) );
+
+   std::cout << "\n Blaze threshold calibration\n" << std::endl;
+
+#if BLAZE_BLAS_MODE
+   std::cout << " BLAS thresholds:\n" << std::endl;
+   calibrate< DMatDVecMult<rowMajor>           >( "DMATDVECMULT_THRESHOLD"  , 10UL, 3000UL, false );
+   calibrate< DMatDVecMult<columnMajor>        >( "TDMATDVECMULT_THRESHOLD" , 10UL, 3000UL, false );
+   calibrate< TDVecDMatMult<rowMajor>          >( "TDVECDMATMULT_THRESHOLD" , 10UL, 3000UL, false );
+   calibrate< TDVecDMatMult<columnMajor>       >( "TDVECTDMATMULT_THRESHOLD", 10UL, 3000UL, false );
+   calibrate< DMatDMatMult<rowMajor,rowMajor>       >( "DMATDMATMULT_THRESHOLD"  , 4UL, 500UL, false );
+   calibrate< DMatDMatMult<rowMajor,columnMajor>    >( "DMATTDMATMULT_THRESHOLD" , 4UL, 500UL, false );
+   calibrate< DMatDMatMult<columnMajor,rowMajor>    >( "TDMATDMATMULT_THRESHOLD" , 4UL, 500UL, false );
+   calibrate< DMatDMatMult<columnMajor,columnMajor> >( "TDMATTDMATMULT_THRESHOLD", 4UL, 500UL, false );
+#else
+   std::cout << " BLAS mode inactive: BLAS thresholds are not calibrated.\n" << std::endl;
+#endif
+
+   if( blaze::getNumThreads() > 1UL ) {
+      std::cout << " SMP thresholds (" << blaze::getNumThreads() << " threads):\n" << std::endl;
+      calibrate< DVecAssign     >( "SMP_DVECASSIGN_THRESHOLD"    , 1000UL, 10000000UL, true );
+      calibrate< DVecDVecAdd    >( "SMP_DVECDVECADD_THRESHOLD"   , 1000UL, 10000000UL, true );
+      calibrate< DVecDVecSub    >( "SMP_DVECDVECSUB_THRESHOLD"   , 1000UL, 10000000UL, true );
+      calibrate< DVecDVecMult   >( "SMP_DVECDVECMULT_THRESHOLD"  , 1000UL, 10000000UL, true );
+      calibrate< DVecScalarMult >( "SMP_DVECSCALARMULT_THRESHOLD", 1000UL, 10000000UL, true );
+      calibrate< DMatDVecMult<rowMajor>     >( "SMP_DMATDVECMULT_THRESHOLD"  , 10UL, 3000UL, true );
+      calibrate< DMatDVecMult<columnMajor>  >( "SMP_TDMATDVECMULT_THRESHOLD" , 10UL, 3000UL, true );
+      calibrate< TDVecDMatMult<rowMajor>    >( "SMP_TDVECDMATMULT_THRESHOLD" , 10UL, 3000UL, true );
+      calibrate< TDVecDMatMult<columnMajor> >( "SMP_TDVECTDMATMULT_THRESHOLD", 10UL, 3000UL, true );
+      calibrate< DMatAssign                 >( "SMP_DMATASSIGN_THRESHOLD"    , 10UL, 3000UL, true );
+      calibrate< DMatDMatAdd<rowMajor>      >( "SMP_DMATDMATADD_THRESHOLD"   , 10UL, 3000UL, true );
+      calibrate< DMatDMatAdd<columnMajor>   >( "SMP_DMATTDMATADD_THRESHOLD"  , 10UL, 3000UL, true );
+      calibrate< DMatDMatSub<rowMajor>      >( "SMP_DMATDMATSUB_THRESHOLD"   , 10UL, 3000UL, true );
+      calibrate< DMatDMatSub<columnMajor>   >( "SMP_DMATTDMATSUB_THRESHOLD"  , 10UL, 3000UL, true );
+      calibrate< DMatScalarMult             >( "SMP_DMATSCALARMULT_THRESHOLD", 10UL, 3000UL, true );
+      calibrate< DMatDMatMult<rowMajor,rowMajor>       >( "SMP_DMATDMATMULT_THRESHOLD"  , 4UL, 500UL, true );
+      calibrate< DMatDMatMult<rowMajor,columnMajor>    >( "SMP_DMATTDMATMULT_THRESHOLD" , 4UL, 500UL, true );
+      calibrate< DMatDMatMult<columnMajor,rowMajor>    >( "SMP_TDMATDMATMULT_THRESHOLD" , 4UL, 500UL, true );
+      calibrate< DMatDMatMult<columnMajor,columnMajor> >( "SMP_TDMATTDMATMULT_THRESHOLD", 4UL, 500UL, true );
+   }
+   else {
+      std::cout << " Single thread configuration: SMP thresholds are not calibrated.\n" << std::endl;
+   }
+
+   write( filename );
+
+   return EXIT_SUCCESS;
+#endif
+}
+//*************************************************************************************************
@@ -0,0 +1,267 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/blockcompressedmatrix/ClassTest.h
+//  \brief Header file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BlockCompressedMatrix class template.
+//
+// This class represents a test suite for the blaze::BlockCompressedMatrix class template. It
+// compares the results of the block multiplication kernels with the results of the according
+// operations on the equivalent CompressedMatrix. All operands contain small integral values,
+// for which all results are exact.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAppend();
+   void testExpressions();
+
+   template< size_t M, size_t N >
+   void testVectorMult( size_t mb, size_t nb );
+
+   template< size_t M, size_t N, bool SO >
+   void testMatrixMult( size_t mb, size_t nb, size_t p );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   blaze::CompressedMatrix<int> setup( size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a block compressed matrix with a dense vector.
+//
+// \param mb The number of block rows of the block matrix.
+// \param nb The number of block columns of the block matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< size_t M    // Number of rows of the blocks
+        , size_t N >  // Number of columns of the blocks
+void ClassTest::testVectorMult( size_t mb, size_t nb )
+{
+   std::ostringstream oss;
+   oss << "BlockCompressedMatrix/DynamicVector multiplication (" << mb*M << "x" << nb*N
+       << ", " << M << "x" << N << " blocks)";
+   test_ = oss.str();
+
+   const blaze::CompressedMatrix<int> ref( setup( mb*M, nb*N ) );
+   const blaze::BlockCompressedMatrix<int,M,N> A( ref );
+
+   checkResult( A, ref );
+   checkResult( blaze::CompressedMatrix<int>( A ), ref );
+
+   blaze::DynamicVector<int> x( nb*N );
+   for( size_t j=0UL; j<x.size(); ++j )
+      x[j] = blaze::rand<int>( -10, 10 );
+
+   checkResult( blaze::DynamicVector<int>( A * x ), blaze::DynamicVector<int>( ref * x ) );
+   checkResult( blaze::DynamicVector<int>( A * ( x + x ) ), blaze::DynamicVector<int>( ref * ( x + x ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a block compressed matrix with a dense matrix.
+//
+// \param mb The number of block rows of the block matrix.
+// \param nb The number of block columns of the block matrix.
+// \param p The number of columns of the dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< size_t M    // Number of rows of the blocks
+        , size_t N    // Number of columns of the blocks
+        , bool SO >   // Storage order of the dense matrix
+void ClassTest::testMatrixMult( size_t mb, size_t nb, size_t p )
+{
+   std::ostringstream oss;
+   oss << "BlockCompressedMatrix/DynamicMatrix multiplication (" << mb*M << "x" << nb*N
+       << ", " << nb*N << "x" << p << ", " << M << "x" << N << " blocks)";
+   test_ = oss.str();
+
+   const blaze::CompressedMatrix<int> ref( setup( mb*M, nb*N ) );
+   const blaze::BlockCompressedMatrix<int,M,N> A( ref );
+
+   blaze::DynamicMatrix<int,SO> B( nb*N, p );
+   for( size_t i=0UL; i<B.rows(); ++i )
+      for( size_t j=0UL; j<p; ++j )
+         B(i,j) = blaze::rand<int>( -10, 10 );
+
+   checkResult( blaze::DynamicMatrix<int,SO>( A * B ),
+                blaze::DynamicMatrix<int,SO>( ref * B ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a block compressed matrix operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid block compressed matrix operation result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the BlockCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BlockCompressedMatrix class test.
+*/
+#define RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::blockcompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
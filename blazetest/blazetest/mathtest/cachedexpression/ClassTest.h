@@ -0,0 +1,309 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/cachedexpression/ClassTest.h
+//  \brief Header file for the CachedExpression class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_CACHEDEXPRESSION_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_CACHEDEXPRESSION_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CachedExpression.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace cachedexpression {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CachedExpression class template.
+//
+// This class represents a test suite for the blaze::CachedExpression class template and the
+// modification counters of the DynamicVector and DynamicMatrix class templates.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testVersion();
+   void testVector ();
+   void testMatrix ();
+
+   template< typename ET >
+   void testVectorCache( blaze::CachedExpression<ET> cached, blaze::DynamicMatrix<int>& A,
+                         blaze::DynamicVector<int>& x );
+
+   template< typename ET >
+   void testMatrixCache( blaze::CachedExpression<ET> cached, blaze::DynamicMatrix<int>& A,
+                         blaze::DynamicMatrix<int>& B );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+
+   void checkValidity( bool valid, bool expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a cached matrix/vector multiplication.
+//
+// \param cached The cached handle for the expression \f$ A^T \cdot x \f$.
+// \param A The matrix operand of the expression.
+// \param x The vector operand of the expression.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename ET >  // Type of the cached expression
+void ClassTest::testVectorCache( blaze::CachedExpression<ET> cached, blaze::DynamicMatrix<int>& A,
+                                 blaze::DynamicVector<int>& x )
+{
+   test_ = "Cached matrix/vector multiplication";
+
+   cached.track( A ).track( x );
+   checkValidity( cached.isValid(), false );
+
+   const blaze::DynamicVector<int>& result( cached.get() );
+   const blaze::DynamicVector<int> ref( trans(A) * x );
+   checkResult( result, ref );
+   checkValidity( cached.isValid(), true );
+
+   const int* const buffer( result.data() );
+
+   // Repeated use without modifications
+   checkResult( cached.get(), ref );
+   checkValidity( cached.get().data() == buffer, true );
+
+   // Assignment to a tracked operand
+   x = x * 2;
+   checkValidity( cached.isValid(), false );
+   checkResult( cached.get(), trans(A) * x );
+   checkValidity( cached.get().data() == buffer, true );
+
+   // Addition assignment to a tracked operand
+   A += A;
+   checkValidity( cached.isValid(), false );
+   checkResult( cached.get(), trans(A) * x );
+   checkValidity( cached.get().data() == buffer, true );
+
+   // Element-wise modification and explicit invalidation
+   x[0] = 7;
+   checkValidity( cached.isValid(), true );
+   cached.invalidate();
+   checkValidity( cached.isValid(), false );
+   checkResult( cached.get(), trans(A) * x );
+   checkValidity( cached.get().data() == buffer, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a cached matrix/matrix multiplication.
+//
+// \param cached The cached handle for the expression \f$ A \cdot B \f$.
+// \param A The left-hand side operand of the expression.
+// \param B The right-hand side operand of the expression.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename ET >  // Type of the cached expression
+void ClassTest::testMatrixCache( blaze::CachedExpression<ET> cached, blaze::DynamicMatrix<int>& A,
+                                 blaze::DynamicMatrix<int>& B )
+{
+   test_ = "Cached matrix/matrix multiplication";
+
+   cached.track( A ).track( B );
+
+   const blaze::DynamicMatrix<int> ref( A * B );
+   checkResult( cached.get(), ref );
+   checkValidity( cached.isValid(), true );
+
+   // Resizing of a tracked operand
+   B.resize( 3UL, 2UL );
+   checkValidity( cached.isValid(), false );
+   checkResult( cached.get(), A * B );
+
+   // Swap of a tracked operand
+   blaze::DynamicMatrix<int> C( 2UL, 3UL, 1 );
+   swap( A, C );
+   checkValidity( cached.isValid(), false );
+   checkResult( cached.get(), A * B );
+
+   // Scaling of a tracked operand
+   B *= 3;
+   checkValidity( cached.isValid(), false );
+   checkResult( cached.get(), A * B );
+   checkValidity( cached.isValid(), true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a cached expression.
+//
+// \param result The cached result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the cached result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid cached result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a validity condition.
+//
+// \param valid The actual condition.
+// \param expected The expected condition.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ClassTest::checkValidity( bool valid, bool expected ) const
+{
+   if( valid != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid cache state\n"
+          << " Details:\n"
+          << "   Result: " << valid << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the CachedExpression class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CachedExpression class test.
+*/
+#define RUN_CACHEDEXPRESSION_CLASS_TEST \
+   blazetest::mathtest::cachedexpression::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace cachedexpression
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
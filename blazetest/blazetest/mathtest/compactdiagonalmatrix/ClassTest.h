@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compactdiagonalmatrix/ClassTest.h
+//  \brief Header file for the CompactDiagonalMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPACTDIAGONALMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_COMPACTDIAGONALMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompactDiagonalMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compactdiagonalmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CompactDiagonalMatrix class template.
+//
+// This class represents a test suite for the blaze::CompactDiagonalMatrix class template. It
+// compares the results of the scaling kernels with the results of the according operations on
+// an equivalent DynamicMatrix. All operands contain small integral values, for which all results
+// are exact.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment();
+
+   template< bool SO1, bool SO2 >
+   void testDenseMatrixMult( size_t n, size_t m );
+
+   template< bool SO1, bool SO2 >
+   void testSparseMatrixMult( size_t n, size_t m );
+
+   void testVectorMult( size_t n );
+   void testResize();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   void randomize( blaze::CompactDiagonalMatrix<int,SO>& D ) const;
+
+   template< bool SO >
+   void randomize( blaze::DynamicMatrix<int,SO>& A ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a compact diagonal matrix with a dense matrix.
+//
+// \param n The number of rows and columns of the diagonal matrix.
+// \param m The number of columns/rows of the dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the diagonal matrix
+        , bool SO2 >  // Storage order of the dense matrix
+void ClassTest::testDenseMatrixMult( size_t n, size_t m )
+{
+   std::ostringstream oss;
+   oss << "CompactDiagonalMatrix/DynamicMatrix multiplication (" << n << "x" << n
+       << ", " << n << "x" << m << ")";
+   test_ = oss.str();
+
+   blaze::CompactDiagonalMatrix<int,SO1> D( n );
+   blaze::DynamicMatrix<int,SO2> A( n, m ), B( m, n );
+   randomize( D );
+   randomize( A );
+   randomize( B );
+
+   const blaze::DynamicMatrix<int,SO1> ref( D );
+
+   {
+      const blaze::DynamicMatrix<int,SO2> C( D * A );
+      checkResult( C, blaze::DynamicMatrix<int,SO2>( ref * A ) );
+   }
+
+   {
+      const blaze::DynamicMatrix<int,SO2> C( B * D );
+      checkResult( C, blaze::DynamicMatrix<int,SO2>( B * ref ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a compact diagonal matrix with a sparse matrix.
+//
+// \param n The number of rows and columns of the diagonal matrix.
+// \param m The number of columns/rows of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< bool SO1    // Storage order of the diagonal matrix
+        , bool SO2 >  // Storage order of the sparse matrix
+void ClassTest::testSparseMatrixMult( size_t n, size_t m )
+{
+   std::ostringstream oss;
+   oss << "CompactDiagonalMatrix/CompressedMatrix multiplication (" << n << "x" << n
+       << ", " << n << "x" << m << ")";
+   test_ = oss.str();
+
+   blaze::CompactDiagonalMatrix<int,SO1> D( n );
+   randomize( D );
+
+   blaze::CompressedMatrix<int,SO2> A( n, m ), B( m, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      if( m > 0UL ) {
+         A(i,blaze::rand<size_t>( 0UL, m-1UL )) = blaze::rand<int>( 1, 10 );
+         B(blaze::rand<size_t>( 0UL, m-1UL ),i) = blaze::rand<int>( 1, 10 );
+      }
+   }
+
+   const blaze::DynamicMatrix<int,SO1> ref( D );
+
+   {
+      const blaze::CompressedMatrix<int,SO2> C( D * A );
+      checkResult( C, blaze::DynamicMatrix<int,SO2>( ref * A ) );
+
+      if( C.nonZeros() > A.nonZeros() ) {
+         std::ostringstream oss2;
+         oss2 << " Test: " << test_ << "\n"
+              << " Error: Invalid number of non-zero elements\n"
+              << " Details:\n"
+              << "   Number of non-zeros  : " << C.nonZeros() << "\n"
+              << "   Expected upper limit : " << A.nonZeros() << "\n";
+         throw std::runtime_error( oss2.str() );
+      }
+   }
+
+   {
+      const blaze::CompressedMatrix<int,SO2> C( B * D );
+      checkResult( C, blaze::DynamicMatrix<int,SO2>( B * ref ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a compact diagonal matrix operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid compact diagonal matrix operation result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compact diagonal matrix with small random integral values.
+//
+// \param D The matrix to be initialized.
+// \return void
+*/
+template< bool SO >  // Storage order of the matrix
+void ClassTest::randomize( blaze::CompactDiagonalMatrix<int,SO>& D ) const
+{
+   for( size_t i=0UL; i<D.rows(); ++i )
+      D.diagonal()[i] = blaze::rand<int>( -10, 10 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix with small random integral values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< bool SO >  // Storage order of the matrix
+void ClassTest::randomize( blaze::DynamicMatrix<int,SO>& A ) const
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = blaze::rand<int>( -10, 10 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the CompactDiagonalMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompactDiagonalMatrix class test.
+*/
+#define RUN_COMPACTDIAGONALMATRIX_CLASS_TEST \
+   blazetest::mathtest::compactdiagonalmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compactdiagonalmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
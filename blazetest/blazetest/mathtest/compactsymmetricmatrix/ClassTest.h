@@ -0,0 +1,359 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compactsymmetricmatrix/ClassTest.h
+//  \brief Header file for the CompactSymmetricMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_COMPACTSYMMETRICMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_COMPACTSYMMETRICMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompactSymmetricMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compactsymmetricmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CompactSymmetricMatrix class template.
+//
+// This class represents a test suite for the blaze::CompactSymmetricMatrix class template. It
+// compares the results of the symmetric multiplication kernels with the results of the according
+// operations on an equivalent CompressedMatrix storing both triangles. All operands contain small
+// integral values, for which all results are exact.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<int>  cplx;  //!< Complex element type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAppend();
+
+   template< typename Type, bool SO, bool HF >
+   void testVectorMult( size_t n );
+
+   template< typename Type, bool SO, bool HF, bool SO2 >
+   void testMatrixMult( size_t n, size_t m );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool HF >
+   blaze::CompressedMatrix<Type> setup( size_t n ) const;
+
+   template< typename Type >
+   Type value() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a compact symmetric matrix with a dense vector.
+//
+// \param n The number of rows and columns of the symmetric matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the symmetric matrix
+        , bool HF >      // Hermitian flag
+void ClassTest::testVectorMult( size_t n )
+{
+   std::ostringstream oss;
+   oss << "CompactSymmetricMatrix/DynamicVector multiplication (" << n << "x" << n
+       << ( HF ? ", Hermitian" : ", symmetric" ) << ")";
+   test_ = oss.str();
+
+   const blaze::CompressedMatrix<Type> ref( setup<Type,HF>( n ) );
+   const blaze::CompactSymmetricMatrix<Type,SO,HF> A( ref );
+
+   checkResult( expand( A ), ref );
+
+   if( A.nonZeros() != ref.nonZeros() ) {
+      std::ostringstream oss2;
+      oss2 << " Test: " << test_ << "\n"
+           << " Error: Invalid number of non-zero elements\n"
+           << " Details:\n"
+           << "   Number of non-zeros          : " << A.nonZeros() << "\n"
+           << "   Expected number of non-zeros : " << ref.nonZeros() << "\n";
+      throw std::runtime_error( oss2.str() );
+   }
+
+   blaze::DynamicVector<Type> x( n );
+   for( size_t i=0UL; i<n; ++i )
+      x[i] = value<Type>();
+
+   const blaze::DynamicVector<Type> expected( ref * x );
+
+   checkResult( blaze::DynamicVector<Type>( A * x ), expected );
+
+   symv( x, A, x );
+   checkResult( x, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a compact symmetric matrix with a dense matrix.
+//
+// \param n The number of rows and columns of the symmetric matrix.
+// \param m The number of columns of the dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the symmetric matrix
+        , bool HF        // Hermitian flag
+        , bool SO2 >     // Storage order of the dense matrix
+void ClassTest::testMatrixMult( size_t n, size_t m )
+{
+   std::ostringstream oss;
+   oss << "CompactSymmetricMatrix/DynamicMatrix multiplication (" << n << "x" << n
+       << ", " << n << "x" << m << ( HF ? ", Hermitian" : ", symmetric" ) << ")";
+   test_ = oss.str();
+
+   const blaze::CompressedMatrix<Type> ref( setup<Type,HF>( n ) );
+   const blaze::CompactSymmetricMatrix<Type,SO,HF> A( ref );
+
+   blaze::DynamicMatrix<Type,SO2> B( n, m );
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=0UL; j<m; ++j )
+         B(i,j) = value<Type>();
+
+   checkResult( blaze::DynamicMatrix<Type,SO2>( A * B ),
+                blaze::DynamicMatrix<Type,SO2>( ref * B ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a compact symmetric matrix operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid compact symmetric matrix operation result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of a random symmetric (or Hermitian) sparse matrix with small integral values.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The symmetric (or Hermitian) sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool HF >      // Hermitian flag
+blaze::CompressedMatrix<Type> ClassTest::setup( size_t n ) const
+{
+   using blaze::conj;
+   using blaze::real;
+
+   blaze::CompressedMatrix<Type> A( n, n );
+
+   for( size_t k=0UL; k<3UL*n; ++k )
+   {
+      const size_t i( blaze::rand<size_t>( 0UL, n-1UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, n-1UL ) );
+      const Type v( value<Type>() );
+
+      if( i == j ) {
+         A(i,i) = ( HF )?( Type( real( v ) ) ):( v );
+      }
+      else {
+         A(i,j) = v;
+         A(j,i) = ( HF )?( Type( conj( v ) ) ):( v );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a small random integral value.
+//
+// \return The random value.
+*/
+template< typename Type >  // Data type of the value
+Type ClassTest::value() const
+{
+   return Type( blaze::rand<int>( -10, 10 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a small random complex value with integral components.
+//
+// \return The random value.
+*/
+template<>
+inline ClassTest::cplx ClassTest::value<ClassTest::cplx>() const
+{
+   return cplx( blaze::rand<int>( -10, 10 ), blaze::rand<int>( -10, 10 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the CompactSymmetricMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompactSymmetricMatrix class test.
+*/
+#define RUN_COMPACTSYMMETRICMATRIX_CLASS_TEST \
+   blazetest::mathtest::compactsymmetricmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compactsymmetricmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
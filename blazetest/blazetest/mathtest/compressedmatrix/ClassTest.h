@@ -104,6 +104,7 @@ class ClassTest
    void testSet         ();
    void testInsert      ();
    void testAppend      ();
+   void testSetFromTriplets();
    void testErase       ();
    void testResize      ();
    void testReserve     ();
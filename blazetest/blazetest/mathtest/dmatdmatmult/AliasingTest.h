@@ -184,7 +184,19 @@ class AliasingTest
                         0 & 1 & -2 \\
                         1 & 0 &  0 \\
                         \end{array}\right)\f]. */
+   DMat dF_;       //!< The first large row-major dense matrix.
+                   /*!< The \f$ 403 \times 403 \f$ matrix is initialized with
+                        \f$ F_{ij} = ((i+2j) \bmod 5) - 2 \f$. Its size spans several row and
+                        column panels of the tiled evaluation (see DMATDMATMULT_PANEL_SIZE)
+                        and is not a multiple of the panel size. */
+   DMat dG_;       //!< The second large row-major dense matrix.
+                   /*!< The \f$ 403 \times 403 \f$ matrix is initialized with
+                        \f$ G_{ij} = ((3i+j) \bmod 5) - 2 \f$. */
+   DMat dH_;       //!< The third large row-major dense matrix.
+                   /*!< The \f$ 403 \times 403 \f$ matrix is initialized with
+                        \f$ H_{ij} = (ij \bmod 3) - 1 \f$. */
    RMat result_;   //!< The dense matrix for the reference result.
+   DMat dresult_;  //!< The dense matrix for the reference result of the large matrices.
 
    std::string test_;  //!< Label of the currently performed test.
    //@}
@@ -0,0 +1,473 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/instructionset/ClassTest.h
+//  \brief Header file for the instruction set dispatch test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_INSTRUCTIONSET_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_INSTRUCTIONSET_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/InstructionSet.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace instructionset {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the runtime instruction set dispatch.
+//
+// This class represents a test suite for the runtime dispatched kernels. It selects all
+// instruction sets supported by the executing CPU in turn and compares the results of the
+// dispatched dense vector, dense matrix and sparse matrix kernels with serial reference
+// implementations.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSelection();
+
+   template< typename T > void testAddAssign();
+   template< typename T > void testDotProduct();
+   template< typename T > void testGemv();
+   template< typename T > void testGemm();
+   template< typename T > void testSpmv();
+
+   template< typename T1, typename T2 >
+   void compare( const T1& result, const T2& expected, const std::string& operation );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense vector with small integer values.
+//
+// \param v The vector to be initialized.
+// \param seed The seed of the sequence of values.
+// \return void
+//
+// The integer values guarantee exact results irrespective of the order of the floating point
+// operations of the dispatched kernels.
+*/
+template< typename T >  // Element type of the vector
+void initialize( blaze::DynamicVector<T>& v, size_t seed )
+{
+   for( size_t i=0UL; i<v.size(); ++i )
+      v[i] = static_cast<int>( ( i*seed + 3UL*seed ) % 7UL ) - 3;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with small integer values.
+//
+// \param m The matrix to be initialized.
+// \param seed The seed of the sequence of values.
+// \return void
+//
+// The integer values guarantee exact results irrespective of the order of the floating point
+// operations of the dispatched kernels.
+*/
+template< typename T  // Element type of the matrix
+        , bool SO >   // Storage order of the matrix
+void initialize( blaze::DynamicMatrix<T,SO>& m, size_t seed )
+{
+   for( size_t i=0UL; i<m.rows(); ++i )
+      for( size_t j=0UL; j<m.columns(); ++j )
+         m(i,j) = static_cast<int>( ( i*seed + j*( seed+2UL ) + seed ) % 7UL ) - 3;
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector addition and subtraction assignment kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the addition and subtraction assignment of dense vectors of various
+// (odd) sizes for the currently selected instruction set. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the vectors
+void ClassTest::testAddAssign()
+{
+   const size_t sizes[] = { 1UL, 2UL, 3UL, 7UL, 15UL, 16UL, 17UL, 31UL, 33UL, 63UL, 65UL, 127UL, 129UL, 1023UL, 1025UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      blaze::DynamicVector<T> x( n ), y( n ), ref( n );
+      initialize( x, 1UL );
+      initialize( y, 2UL );
+
+      for( size_t i=0UL; i<n; ++i )
+         ref[i] = y[i] + x[i];
+      y += x;
+      compare( y, ref, "addition assignment y += x" );
+
+      for( size_t i=0UL; i<n; ++i )
+         ref[i] = y[i] - x[i] - x[i];
+      y -= x;
+      y -= x;
+      compare( y, ref, "subtraction assignment y -= x" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector inner product kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the inner product of dense vectors of various (odd) sizes for the
+// currently selected instruction set. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T >  // Element type of the vectors
+void ClassTest::testDotProduct()
+{
+   const size_t sizes[] = { 1UL, 2UL, 3UL, 7UL, 15UL, 16UL, 17UL, 31UL, 33UL, 63UL, 65UL, 127UL, 129UL, 1023UL, 1025UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      blaze::DynamicVector<T> a( n ), b( n );
+      initialize( a, 3UL );
+      initialize( b, 4UL );
+
+      T ref = T();
+      for( size_t i=0UL; i<n; ++i )
+         ref += a[i] * b[i];
+
+      const T result( blaze::trans( a ) * b );
+      compare( result, ref, "inner product trans(a)*b" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix/dense vector multiplication kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of row-major dense matrices of various (odd) sizes
+// with dense vectors for the currently selected instruction set. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the matrix and vectors
+void ClassTest::testGemv()
+{
+   const size_t sizes[] = { 1UL, 3UL, 7UL, 16UL, 17UL, 33UL, 65UL, 129UL };
+   const size_t count( sizeof(sizes)/sizeof(size_t) );
+
+   for( size_t s=0UL; s<count; ++s )
+   {
+      const size_t m( sizes[s] );
+      const size_t n( sizes[count-s-1UL] + 2UL );
+
+      blaze::DynamicMatrix<T,blaze::rowMajor> A( m, n );
+      blaze::DynamicVector<T> x( n ), y( m ), ref( m );
+      initialize( A, 5UL );
+      initialize( x, 6UL );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         ref[i] = T();
+         for( size_t j=0UL; j<n; ++j )
+            ref[i] += A(i,j) * x[j];
+      }
+
+      y = A * x;
+      compare( y, ref, "multiplication y = A*x" );
+
+      y += A * x;
+      compare( y, T(2)*ref, "multiplication y += A*x" );
+
+      y -= A * x;
+      compare( y, ref, "multiplication y -= A*x" );
+
+      y = T(3) * ( A * x );
+      compare( y, T(3)*ref, "scaled multiplication y = 3*A*x" );
+
+      y += T(2) * ( A * x );
+      compare( y, T(5)*ref, "scaled multiplication y += 2*A*x" );
+
+      y -= T(4) * ( A * x );
+      compare( y, ref, "scaled multiplication y -= 4*A*x" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix/dense matrix multiplication kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of row-major dense matrices of various (odd) sizes
+// for the currently selected instruction set. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the matrices
+void ClassTest::testGemm()
+{
+   const size_t sizes[][3] = { {   1UL,  1UL,   1UL }, {  3UL,  5UL,  7UL }, {  7UL, 16UL,   9UL }
+                             , {  17UL, 33UL,  15UL }, { 31UL,  8UL, 65UL }, { 64UL, 63UL,  65UL }
+                             , { 129UL, 67UL, 131UL } };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(sizes[0]); ++s )
+   {
+      const size_t m( sizes[s][0] );
+      const size_t k( sizes[s][1] );
+      const size_t n( sizes[s][2] );
+
+      blaze::DynamicMatrix<T,blaze::rowMajor> A( m, k ), B( k, n ), C( m, n ), ref( m, n );
+      initialize( A, 7UL );
+      initialize( B, 8UL );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            ref(i,j) = T();
+            for( size_t l=0UL; l<k; ++l )
+               ref(i,j) += A(i,l) * B(l,j);
+         }
+      }
+
+      C = A * B;
+      compare( C, ref, "multiplication C = A*B" );
+
+      C += A * B;
+      compare( C, T(2)*ref, "multiplication C += A*B" );
+
+      C -= A * B;
+      compare( C, ref, "multiplication C -= A*B" );
+
+      C = T(3) * ( A * B );
+      compare( C, T(3)*ref, "scaled multiplication C = 3*A*B" );
+
+      C += T(2) * ( A * B );
+      compare( C, T(5)*ref, "scaled multiplication C += 2*A*B" );
+
+      C -= T(4) * ( A * B );
+      compare( C, ref, "scaled multiplication C -= 4*A*B" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse matrix/dense vector multiplication kernel.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of row-major sparse matrices with rows of various
+// (odd) numbers of non-zero elements with dense vectors for the currently selected instruction
+// set. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the matrix and vectors
+void ClassTest::testSpmv()
+{
+   const size_t sizes[] = { 1UL, 3UL, 7UL, 16UL, 17UL, 33UL, 65UL, 129UL, 1025UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      // Row i contains (i % 37) non-zero elements at scattered column indices
+      blaze::CompressedMatrix<T,blaze::rowMajor> A( n, n );
+      for( size_t i=0UL; i<n; ++i ) {
+         const size_t nonzeros( blaze::min( i % 37UL, n ) );
+         const size_t stride( ( n > nonzeros && nonzeros > 0UL )?( n / nonzeros ):( 1UL ) );
+         A.reserve( i, nonzeros );
+         for( size_t l=0UL; l<nonzeros; ++l )
+            A.append( i, l*stride, T( static_cast<int>( ( i + l ) % 7UL ) - 3 ) );
+         A.finalize( i );
+      }
+
+      blaze::DynamicVector<T> x( n ), y( n ), z( n ), ref( n );
+      initialize( x, 9UL );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         ref[i] = T();
+         for( typename blaze::CompressedMatrix<T,blaze::rowMajor>::ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+            ref[i] += element->value() * x[element->index()];
+      }
+
+      y = A * x;
+      compare( y, ref, "multiplication y = A*x" );
+
+      for( size_t i=0UL; i<n; ++i )
+         z[i] = ( A * x )[i];
+      compare( z, ref, "element access (A*x)[i]" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a dispatched kernel with the reference result.
+//
+// \param result The result of the dispatched kernel.
+// \param expected The reference result.
+// \param operation The description of the operation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the result of the dispatched kernel
+        , typename T2 >  // Type of the reference result
+void ClassTest::compare( const T1& result, const T2& expected, const std::string& operation )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << operation << "\n"
+          << " Details:\n"
+          << "   Selected instruction set: " << blaze::instructionSet() << "\n"
+          << "   Compiled instruction set: " << blaze::compiledInstructionSet() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime instruction set dispatch.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the instruction set dispatch test.
+*/
+#define RUN_INSTRUCTIONSET_CLASS_TEST \
+   blazetest::mathtest::instructionset::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace instructionset
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
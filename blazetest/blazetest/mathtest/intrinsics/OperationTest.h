@@ -125,6 +125,8 @@ class OperationTest : private blaze::NonCopyable
    void testAbsoluteValue ( blaze::FalseType );
    void testConjugate     ( blaze::TrueType );
    void testConjugate     ( blaze::FalseType );
+   void testTransposition ( blaze::TrueType );
+   void testTransposition ( blaze::FalseType );
    void testReduction     ();
    //@}
    //**********************************************************************************************
@@ -198,6 +200,7 @@ OperationTest<T>::OperationTest()
    testDivision      ( typename blaze::IsTrue< IT::division       >::Type() );
    testAbsoluteValue ( typename blaze::IsTrue< IT::absoluteValue  >::Type() );
    testConjugate     ( typename blaze::IsTrue< IT::conjugate      >::Type() );
+   testTransposition ( typename blaze::IsTrue< IT::transposition  >::Type() );
    testReduction     ();
 }
 //*************************************************************************************************
@@ -517,7 +520,6 @@ template< typename T >  // Data type of the intrinsic test
 void OperationTest<T>::testAbsoluteValue( blaze::TrueType )
 {
    using std::abs;
-   using blaze::abs;
    using blaze::loada;
    using blaze::storea;
 
@@ -599,6 +601,70 @@ void OperationTest<T>::testConjugate( blaze::FalseType )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the transposition operation.
+//
+// \return void
+// \exception std::runtime_error Transposition error detected.
+//
+// This function tests the in-register transposition by comparing the results of a vectorized
+// and a scalar transposition of square tiles. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testTransposition( blaze::TrueType )
+{
+   using blaze::loada;
+   using blaze::storea;
+
+   test_ = "Transposition operation";
+
+   initialize();
+
+   const size_t tile( IT::size * IT::size );
+
+   for( size_t t=0UL; t<N; t+=tile ) {
+      for( size_t i=0UL; i<IT::size; ++i ) {
+         for( size_t j=0UL; j<IT::size; ++j ) {
+            c_[t+i*IT::size+j] = a_[t+j*IT::size+i];
+         }
+      }
+   }
+
+   IntrinsicType r[IT::size];
+
+   for( size_t t=0UL; t<N; t+=tile )
+   {
+      for( size_t k=0UL; k<IT::size; ++k ) {
+         r[k] = loada( a_+t+k*IT::size );
+      }
+
+      transpose( r );
+
+      for( size_t k=0UL; k<IT::size; ++k ) {
+         storea( d_+t+k*IT::size, r[k] );
+      }
+   }
+
+   compare( c_, d_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the transposition operation.
+//
+// \return void
+//
+// This function is called in case the transposition operation is not available for the given
+// data type \a T.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testTransposition( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the reduction operation.
 //
@@ -0,0 +1,261 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mixedprecision/ClassTest.h
+//  \brief Header file for the mixed precision test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MIXEDPRECISION_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MIXEDPRECISION_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/Float16.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mixedprecision {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the mixed precision functionality.
+//
+// This class represents a test suite for the blaze::float16 and blaze::bfloat16 storage types
+// and for dense matrix/dense vector multiplications with mixed element types, i.e. half
+// precision matrices multiplied with single precision vectors and single precision operands
+// accumulated into double precision vectors.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testFloat16();
+   void testBFloat16();
+
+   template< typename T, bool SO >
+   void testMatVecMult( size_t m, size_t n );
+
+   void testDoubleAccumulation( size_t m, size_t n );
+
+   void checkBits( unsigned int result, unsigned int expected, float value ) const;
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a dense matrix/dense vector multiplication with the given storage type.
+//
+// \param m The number of rows of the matrix operand.
+// \param n The number of columns of the matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The matrix operand stores small integral values, which are exactly representable in all
+// storage types and for which the single precision results are independent of the order of
+// the accumulation.
+*/
+template< typename T  // Element type of the matrix operand
+        , bool SO >   // Storage order of the matrix operand
+void ClassTest::testMatVecMult( size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << "Mixed precision matrix/vector multiplication (" << sizeof(T)*8UL << "-bit storage, "
+       << ( SO ? "column-major " : "row-major " ) << m << "x" << n << ")";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<T,SO> A( m, n );
+   blaze::DynamicVector<float> x( n );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = float( blaze::rand<int>( -16, 16 ) );
+
+   for( size_t j=0UL; j<n; ++j )
+      x[j] = float( blaze::rand<int>( -16, 16 ) );
+
+   blaze::DynamicVector<float> ref( m, 0.0F );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref[i] += float( A(i,j) ) * x[j];
+
+   {
+      blaze::DynamicVector<float> y( A * x );
+      checkResult( y, ref );
+   }
+
+   {
+      blaze::DynamicVector<float> y( m, 2.0F );
+      y += A * x;
+
+      blaze::DynamicVector<float> expected( m );
+      for( size_t i=0UL; i<m; ++i )
+         expected[i] = 2.0F + ref[i];
+
+      checkResult( y, expected );
+   }
+
+   {
+      blaze::DynamicVector<float> y( m, 2.0F );
+      y -= A * x;
+
+      blaze::DynamicVector<float> expected( m );
+      for( size_t i=0UL; i<m; ++i )
+         expected[i] = 2.0F - ref[i];
+
+      checkResult( y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a mixed precision multiplication.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid mixed precision multiplication result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the mixed precision functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the mixed precision test.
+*/
+#define RUN_MIXEDPRECISION_CLASS_TEST \
+   blazetest::mathtest::mixedprecision::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mixedprecision
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,356 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/planarcomplex/ClassTest.h
+//  \brief Header file for the planar complex test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_PLANARCOMPLEX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_PLANARCOMPLEX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PlanarMatrix.h>
+#include <blaze/math/PlanarVector.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace planarcomplex {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the planar complex vector and matrix types.
+//
+// This class represents a test suite for the blaze::PlanarVector and blaze::PlanarMatrix class
+// templates. It compares the results of the planar kernels with the results of the according
+// operations on interleaved complex vectors and matrices. All operands contain small integral
+// values, for which all results are exact.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T >
+   void testVector( size_t n );
+
+   template< typename T, bool SO1, bool SO2 >
+   void testMatrix( size_t m, size_t n, size_t k );
+
+   void testFailures();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   void randomize( blaze::DynamicVector< blaze::complex<T> >& v ) const;
+
+   template< typename T, bool SO >
+   void randomize( blaze::DynamicMatrix< blaze::complex<T>, SO >& A ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise operations of the PlanarVector class template.
+//
+// \param n The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T >  // Floating point type of the real and imaginary parts
+void ClassTest::testVector( size_t n )
+{
+   typedef blaze::complex<T>  CT;
+
+   std::ostringstream oss;
+   oss << "PlanarVector operations (" << sizeof(T)*8UL << "-bit, size " << n << ")";
+   test_ = oss.str();
+
+   blaze::DynamicVector<CT> a( n ), b( n );
+   randomize( a );
+   randomize( b );
+
+   const blaze::PlanarVector<T> x( a ), y( b );
+   blaze::PlanarVector<T> z;
+
+   checkResult( interleave( x ), a );
+
+   blaze::add( z, x, y );
+   checkResult( interleave( z ), blaze::DynamicVector<CT>( a + b ) );
+
+   blaze::sub( z, x, y );
+   checkResult( interleave( z ), blaze::DynamicVector<CT>( a - b ) );
+
+   blaze::mult( z, x, y );
+   checkResult( interleave( z ), blaze::DynamicVector<CT>( a * b ) );
+
+   z = a;
+   blaze::mult( z, z, y );
+   checkResult( interleave( z ), blaze::DynamicVector<CT>( a * b ) );
+
+   blaze::conj( z, x );
+   checkResult( interleave( z ), blaze::DynamicVector<CT>( conj( a ) ) );
+
+   blaze::DynamicVector<T> r;
+   blaze::abs( r, x );
+
+   blaze::DynamicVector<T> expected( n );
+   for( size_t i=0UL; i<n; ++i )
+      expected[i] = std::sqrt( a[i].real()*a[i].real() + a[i].imag()*a[i].imag() );
+
+   checkResult( r, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the operations of the PlanarMatrix class template.
+//
+// \param m The number of rows of the left-hand side operand.
+// \param n The number of columns of the right-hand side operand.
+// \param k The number of columns of the left-hand side operand.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T  // Floating point type of the real and imaginary parts
+        , bool SO1    // Storage order of the left-hand side operand
+        , bool SO2 >  // Storage order of the right-hand side operand
+void ClassTest::testMatrix( size_t m, size_t n, size_t k )
+{
+   typedef blaze::complex<T>  CT;
+
+   std::ostringstream oss;
+   oss << "PlanarMatrix operations (" << sizeof(T)*8UL << "-bit, "
+       << m << "x" << k << " * " << k << "x" << n << ")";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<CT,SO1> A( m, k ), D( m, k );
+   blaze::DynamicMatrix<CT,SO2> B( k, n );
+   randomize( A );
+   randomize( B );
+   randomize( D );
+
+   const blaze::PlanarMatrix<T,SO1> PA( A ), PD( D );
+   const blaze::PlanarMatrix<T,SO2> PB( B );
+
+   const blaze::DynamicMatrix<CT,blaze::rowMajor> ref( A * B );
+
+   {
+      blaze::PlanarMatrix<T,blaze::rowMajor> PC;
+      blaze::gemm4m( PC, PA, PB );
+      checkResult( interleave( PC ), ref );
+   }
+
+   {
+      blaze::PlanarMatrix<T,blaze::columnMajor> PC;
+      blaze::gemm3m( PC, PA, PB );
+      checkResult( interleave( PC ), ref );
+   }
+
+   {
+      blaze::PlanarMatrix<T,SO1> PC;
+      blaze::add( PC, PA, PD );
+      checkResult( interleave( PC ), blaze::DynamicMatrix<CT,SO1>( A + D ) );
+
+      blaze::sub( PC, PA, PD );
+      checkResult( interleave( PC ), blaze::DynamicMatrix<CT,SO1>( A - D ) );
+
+      blaze::conj( PC, PA );
+      checkResult( interleave( PC ), blaze::DynamicMatrix<CT,SO1>( conj( A ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a planar complex operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid planar complex operation result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given complex vector with small random integral values.
+//
+// \param v The vector to be initialized.
+// \return void
+*/
+template< typename T >  // Floating point type of the real and imaginary parts
+void ClassTest::randomize( blaze::DynamicVector< blaze::complex<T> >& v ) const
+{
+   for( size_t i=0UL; i<v.size(); ++i )
+      v[i] = blaze::complex<T>( T( blaze::rand<int>( -10, 10 ) ), T( blaze::rand<int>( -10, 10 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given complex matrix with small random integral values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< typename T  // Floating point type of the real and imaginary parts
+        , bool SO >   // Storage order of the matrix
+void ClassTest::randomize( blaze::DynamicMatrix< blaze::complex<T>, SO >& A ) const
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = blaze::complex<T>( T( blaze::rand<int>( -10, 10 ) ), T( blaze::rand<int>( -10, 10 ) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the planar complex vector and matrix types.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the planar complex test.
+*/
+#define RUN_PLANARCOMPLEX_CLASS_TEST \
+   blazetest::mathtest::planarcomplex::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace planarcomplex
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,366 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/quantizedmult/ClassTest.h
+//  \brief Header file for the quantized multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_QUANTIZEDMULT_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_QUANTIZEDMULT_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace quantizedmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the quantized multiplication functions.
+//
+// This class represents a test suite for the blaze::qgemm() and blaze::qgemv() functions. It
+// compares the results of the quantized kernels for 8-bit and 16-bit operands in various
+// storage orders with a scalar reference computation.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T, bool SO1, bool SO2 >
+   void testGemm( size_t m, size_t n, size_t k );
+
+   template< typename T, bool SO >
+   void testGemv( size_t m, size_t n );
+
+   void testExtremeValues();
+   void testFailures();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T, bool SO >
+   void randomize( blaze::DynamicMatrix<T,SO>& A ) const;
+
+   template< typename T >
+   void randomize( blaze::DynamicVector<T>& x ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the quantized matrix/matrix multiplication for the given operand types.
+//
+// \param m The number of rows of the left-hand side operand.
+// \param n The number of columns of the right-hand side operand.
+// \param k The number of columns of the left-hand side operand.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T  // Element type of the quantized operands
+        , bool SO1    // Storage order of the left-hand side operand
+        , bool SO2 >  // Storage order of the right-hand side operand
+void ClassTest::testGemm( size_t m, size_t n, size_t k )
+{
+   std::ostringstream oss;
+   oss << "Quantized matrix/matrix multiplication (" << sizeof(T)*8UL << "-bit, "
+       << m << "x" << k << " * " << k << "x" << n << ")";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<T,SO1> A( m, k );
+   blaze::DynamicMatrix<T,SO2> B( k, n );
+   randomize( A );
+   randomize( B );
+
+   blaze::DynamicMatrix<int> ref( m, n, 0 );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         for( size_t l=0UL; l<k; ++l )
+            ref(i,j) += int( A(i,l) ) * int( B(l,j) );
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> C;
+      blaze::qgemm( C, A, B );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::DynamicMatrix<int,blaze::columnMajor> C( m+2UL, n+1UL, 0 );
+      blaze::DenseSubmatrix< blaze::DynamicMatrix<int,blaze::columnMajor> > S(
+         submatrix( C, 1UL, 0UL, m, n ) );
+      blaze::qgemm( S, A, B );
+      checkResult( S, ref );
+   }
+
+   {
+      blaze::DynamicVector<float> rowScale( m ), colScale( n );
+      for( size_t i=0UL; i<m; ++i ) rowScale[i] = 0.5F + float( i );
+      for( size_t j=0UL; j<n; ++j ) colScale[j] = 0.25F * float( j+1UL );
+
+      blaze::DynamicMatrix<float,blaze::rowMajor> C;
+      blaze::qgemm( C, A, B, rowScale, colScale );
+
+      blaze::DynamicMatrix<float,blaze::rowMajor> expected( m, n );
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            expected(i,j) = rowScale[i] * colScale[j] * float( ref(i,j) );
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the quantized matrix/vector multiplication for the given operand types.
+//
+// \param m The number of rows of the matrix operand.
+// \param n The number of columns of the matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T  // Element type of the quantized operands
+        , bool SO >   // Storage order of the matrix operand
+void ClassTest::testGemv( size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << "Quantized matrix/vector multiplication (" << sizeof(T)*8UL << "-bit, "
+       << m << "x" << n << ")";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<T,SO> A( m, n );
+   blaze::DynamicVector<T> x( n );
+   randomize( A );
+   randomize( x );
+
+   blaze::DynamicVector<int> ref( m, 0 );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref[i] += int( A(i,j) ) * int( x[j] );
+
+   {
+      blaze::DynamicVector<int> y;
+      blaze::qgemv( y, A, x );
+      checkResult( y, ref );
+   }
+
+   {
+      blaze::DynamicVector<float> rowScale( m );
+      for( size_t i=0UL; i<m; ++i ) rowScale[i] = 0.125F * float( i+1UL );
+
+      blaze::DynamicVector<float> y;
+      blaze::qgemv( y, A, x, rowScale, 2.0F );
+
+      blaze::DynamicVector<float> expected( m );
+      for( size_t i=0UL; i<m; ++i )
+         expected[i] = rowScale[i] * 2.0F * float( ref[i] );
+
+      checkResult( y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a quantized multiplication.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid quantized multiplication result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given quantized matrix with random values.
+//
+// \param A The matrix to be initialized.
+// \return void
+//
+// The matrix is initialized with random values that cover the complete value range of its
+// element type (except for -32768 in case of 16-bit values).
+*/
+template< typename T  // Element type of the matrix
+        , bool SO >   // Storage order of the matrix
+void ClassTest::randomize( blaze::DynamicMatrix<T,SO>& A ) const
+{
+   const int lo( sizeof(T) == 1UL ? -128 : -32767 );
+   const int hi( sizeof(T) == 1UL ?  127 :  32767 );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = T( blaze::rand<int>( lo, hi ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given quantized vector with random values.
+//
+// \param x The vector to be initialized.
+// \return void
+//
+// The vector is initialized with random values that cover the complete value range of its
+// element type (except for -32768 in case of 16-bit values).
+*/
+template< typename T >  // Element type of the vector
+void ClassTest::randomize( blaze::DynamicVector<T>& x ) const
+{
+   const int lo( sizeof(T) == 1UL ? -128 : -32767 );
+   const int hi( sizeof(T) == 1UL ?  127 :  32767 );
+
+   for( size_t i=0UL; i<x.size(); ++i )
+      x[i] = T( blaze::rand<int>( lo, hi ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the quantized multiplication functions.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the quantized multiplication test.
+*/
+#define RUN_QUANTIZEDMULT_CLASS_TEST \
+   blazetest::mathtest::quantizedmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace quantizedmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,236 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smpdmatdmatmult/ClassTest.h
+//  \brief Header file for the SMP dense matrix/dense matrix multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_SMPDMATDMATMULT_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SMPDMATDMATMULT_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpdmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP dense matrix/dense matrix multiplication test.
+//
+// This class represents a test suite for the shared memory parallel assignment of dense matrix/
+// dense matrix multiplications. It tests the 2D thread mapping and the split of the inner
+// dimension of the product, and compares the results of parallel products of several shapes
+// with the serial evaluation of the same products.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testThreadMapping();
+   void testTall         ();
+   void testWide         ();
+   void testSquare       ();
+   void testInnerSplit   ();
+
+   template< bool SO1, bool SO2, bool SO3 >
+   void testProduct( size_t m, size_t n, size_t k );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a single parallel dense matrix/dense matrix multiplication.
+//
+// \param m The number of rows of the left-hand side matrix.
+// \param n The number of columns of the right-hand side matrix.
+// \param k The inner dimension of the product.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the product of a random \f$ m \times k \f$ and a random
+// \f$ k \times n \f$ matrix via the default (parallel) assignment, addition assignment, and
+// subtraction assignment and compares the results with the serial evaluation. Since all values
+// are small integers, the results don't depend on the order of the summation.
+*/
+template< bool SO1    // Storage order of the left-hand side matrix
+        , bool SO2    // Storage order of the right-hand side matrix
+        , bool SO3 >  // Storage order of the target matrix
+void ClassTest::testProduct( size_t m, size_t n, size_t k )
+{
+   blaze::DynamicMatrix<double,SO1> A( m, k );
+   blaze::DynamicMatrix<double,SO2> B( k, n );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<k; ++j )
+         A(i,j) = blaze::rand<int>( -5, 5 );
+
+   for( size_t i=0UL; i<k; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         B(i,j) = blaze::rand<int>( -5, 5 );
+
+   blaze::DynamicMatrix<double,SO3> ref( blaze::serial( A * B ) );
+   blaze::DynamicMatrix<double,SO3> C( m, n, 1.0 );
+
+   C = A * B;
+
+   if( C != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel assignment of a " << m << "x" << k << " * " << k << "x" << n
+          << " product failed\n"
+          << " Details:\n"
+          << "   Storage orders: " << SO1 << SO2 << SO3 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   C += A * B;
+   ref *= 2.0;
+
+   if( C != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel addition assignment of a " << m << "x" << k << " * " << k << "x" << n
+          << " product failed\n"
+          << " Details:\n"
+          << "   Storage orders: " << SO1 << SO2 << SO3 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   C -= A * B;
+   ref *= 0.5;
+
+   if( C != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel subtraction assignment of a " << m << "x" << k << " * " << k << "x" << n
+          << " product failed\n"
+          << " Details:\n"
+          << "   Storage orders: " << SO1 << SO2 << SO3 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP dense matrix/dense matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP dense matrix/dense matrix multiplication test.
+*/
+#define RUN_SMPDMATDMATMULT_CLASS_TEST \
+   blazetest::mathtest::smpdmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smpdmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,227 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smppartitioning/ClassTest.h
+//  \brief Header file for the workload partitioning test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_SMPPARTITIONING_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SMPPARTITIONING_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Functions.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smppartitioning {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the workload partitioning of SMP assignments.
+//
+// This class represents a test suite for the partitioning of SMP assignments with sparse
+// operands by the number of non-zero elements. All tests use sparse matrices with a single
+// dense row (or column), for which an equal number of rows per thread results in a severe
+// load imbalance.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPartitioning();
+   void testSpMV        ();
+   void testSpMM        ();
+
+   template< bool SO >
+   void initialize( blaze::CompressedMatrix<double,SO>& A, size_t m, size_t n, size_t dense );
+
+   template< typename T1, typename T2 >
+   void compare( const T1& result, const T2& expected, const std::string& operation );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a sparse matrix with a single dense row/column.
+//
+// \param A The sparse matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param dense The index of the dense row (row-major) or column (column-major).
+// \return void
+//
+// This function initializes the given sparse matrix such that all rows (row-major) or columns
+// (column-major) contain two non-zero elements, except for the given dense row/column, which
+// is completely filled. All values are small integers.
+*/
+template< bool SO >  // Storage order of the sparse matrix
+void ClassTest::initialize( blaze::CompressedMatrix<double,SO>& A, size_t m, size_t n, size_t dense )
+{
+   const size_t outer( SO ? n : m );
+   const size_t inner( SO ? m : n );
+
+   A.resize( m, n, false );
+   A.reset();
+   A.reserve( 2UL*outer + inner );
+
+   for( size_t i=0UL; i<outer; ++i )
+   {
+      if( i == dense ) {
+         for( size_t j=0UL; j<inner; ++j )
+            A.append( SO ? j : i, SO ? i : j, double( 1 + int( j % 3UL ) ) );
+      }
+      else {
+         const size_t j1( ( i*7UL ) % inner );
+         const size_t j2( ( i*7UL + inner/2UL ) % inner );
+         A.append( SO ? blaze::min( j1, j2 ) : i, SO ? i : blaze::min( j1, j2 ), double( 1 + int( i % 4UL ) ) );
+         A.append( SO ? blaze::max( j1, j2 ) : i, SO ? i : blaze::max( j1, j2 ), -2.0 );
+      }
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a parallel operation with the serial result.
+//
+// \param result The result of the parallel operation.
+// \param expected The result of the serial operation.
+// \param operation The description of the operation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the parallel result
+        , typename T2 >  // Type of the serial result
+void ClassTest::compare( const T1& result, const T2& expected, const std::string& operation )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel " << operation << " failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the workload partitioning of SMP assignments.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the workload partitioning test.
+*/
+#define RUN_SMPPARTITIONING_CLASS_TEST \
+   blazetest::mathtest::smppartitioning::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smppartitioning
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -82,6 +82,7 @@ class OperationTest
    //@{
    void testBuiltinTypes();
    void testClassTypes();
+   void testLargeAllocation();
    void testNullPointer();
    //@}
    //**********************************************************************************************
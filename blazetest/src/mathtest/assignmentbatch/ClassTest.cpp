@@ -0,0 +1,290 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/assignmentbatch/ClassTest.cpp
+//  \brief Source file for the assignment batch test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/assignmentbatch/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace assignmentbatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the assignment batch test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   blaze::setNumThreads( 4UL );
+
+   testBasics();
+   testCG();
+   testDependences();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the recording, clearing and running of assignment batches.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the size(), clear() and run() functions of the AssignmentBatch class.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBasics()
+{
+   test_ = "AssignmentBatch recording";
+
+   blaze::DynamicVector<double> a( 100UL, 1.0 ), b( 100UL, 2.0 ), c;
+
+   blaze::AssignmentBatch batch;
+   batch.assign( c, a + b );
+   batch.assign( a, 2.0 * c );
+
+   if( batch.size() != 2UL || c.size() != 100UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid recording of assignments\n"
+          << " Details:\n"
+          << "   Number of assignments: " << batch.size() << " (expected 2)\n"
+          << "   Size of the target   : " << c.size() << " (expected 100)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   batch.clear();
+   batch.run();
+
+   compare( a, blaze::DynamicVector<double>( 100UL, 1.0 ), "cleared batch" );
+
+   batch.assign( c, a + b );
+   batch.assign( a, 2.0 * c );
+   batch.run();
+
+   compare( c, blaze::DynamicVector<double>( 100UL, 3.0 ), "first assignment" );
+   compare( a, blaze::DynamicVector<double>( 100UL, 6.0 ), "second assignment" );
+
+   if( batch.size() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignments not removed after run()\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a batch of conjugate gradient iterations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function records the vector updates of several iterations of a conjugate gradient
+// style solver and compares the results with the sequential execution of the same updates.
+// The updates contain matrix/vector multiplications, element-wise updates reading their own
+// target, and a write after read of the search direction. All values are integers, which
+// guarantees exact results irrespective of the order of the floating point operations. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCG()
+{
+   test_ = "Conjugate gradient iterations";
+
+   const size_t n( 1003UL );
+
+   blaze::DynamicMatrix<double> A( n, n, 0.0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) = 2.0;
+      if( i > 0UL    ) A(i,i-1UL) = -1.0;
+      if( i+1UL < n  ) A(i,i+1UL) = -1.0;
+   }
+
+   blaze::DynamicVector<double> x( n, 0.0 ), r( n ), p( n ), q( n ), t( n ), s( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      r[i] = static_cast<double>( static_cast<int>( i % 7UL ) - 3 );
+      p[i] = static_cast<double>( static_cast<int>( i % 3UL ) - 1 );
+   }
+
+   blaze::DynamicVector<double> xs( x ), rs( r ), ps( p ), qs( q ), ts( t ), ss( s );
+
+   blaze::AssignmentBatch batch;
+
+   for( int it=0; it<4; ++it )
+   {
+      const double alpha( ( it % 2 ) ? -1.0 : 1.0 );
+      const double beta ( ( it % 2 ) ? 1.0 : -1.0 );
+
+      // Recorded iteration
+      batch.assign( q, A * p );
+      batch.assign( x, x + alpha * p );
+      batch.assign( r, r - alpha * q );
+      batch.assign( t, A * r );
+      batch.assign( p, r + beta * p );  // Write after read of p
+      batch.assign( s, p + t );
+      batch.assign( p, 2.0 * p - t );   // Write after write of p
+      batch.run();
+
+      // Sequential iteration
+      qs = blaze::serial( A * ps );
+      xs = blaze::serial( xs + alpha * ps );
+      rs = blaze::serial( rs - alpha * qs );
+      ts = blaze::serial( A * rs );
+      ps = blaze::serial( rs + beta * ps );
+      ss = blaze::serial( ps + ts );
+      ps = blaze::serial( 2.0 * ps - ts );
+
+      compare( q, qs, "matrix/vector multiplication q = A*p" );
+      compare( x, xs, "update x = x + alpha*p" );
+      compare( r, rs, "update r = r - alpha*q" );
+      compare( t, ts, "matrix/vector multiplication t = A*r" );
+      compare( s, ss, "update s = p + t" );
+      compare( p, ps, "updates p = r + beta*p and p = 2*p - t" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of batches with statements of different sizes and self-referencing products.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests batches containing statements of different sizes (which can't be fused)
+// and matrix/vector multiplications reading their own target vector (which can't be tiled).
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDependences()
+{
+   test_ = "Dependences between statements of different kind";
+
+   const size_t m( 517UL );
+   const size_t n( 301UL );
+
+   blaze::DynamicMatrix<double> A( m, n ), B( n, n );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = static_cast<double>( static_cast<int>( ( i + j ) % 3UL ) - 1 );
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         B(i,j) = ( i == j ) ? 1.0 : ( ( j == i+1UL ) ? -1.0 : 0.0 );
+
+   blaze::DynamicVector<double> u( n ), v( m ), w( n );
+   for( size_t i=0UL; i<n; ++i )
+      u[i] = static_cast<double>( static_cast<int>( i % 5UL ) - 2 );
+
+   blaze::DynamicVector<double> us( u ), vs( v ), ws( w );
+
+   blaze::AssignmentBatch batch;
+   batch.assign( w, u + u );
+   batch.assign( v, A * w );       // Read after write of w (different size)
+   batch.assign( u, B * u );       // Self-referencing product
+   batch.assign( w, w - u );       // Read after write of u
+   batch.assign( v, v + 3.0 * v );
+   batch.run();
+
+   ws = blaze::serial( us + us );
+   vs = blaze::serial( A * ws );
+   us = blaze::serial( B * us );
+   ws = blaze::serial( ws - us );
+   vs = blaze::serial( vs + 3.0 * vs );
+
+   compare( u, us, "self-referencing product" );
+   compare( v, vs, "product with a vector of different size" );
+   compare( w, ws, "update after a self-referencing product" );
+}
+//*************************************************************************************************
+
+} // namespace assignmentbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running assignment batch test..." << std::endl;
+
+   try
+   {
+      RUN_ASSIGNMENTBATCH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during assignment batch test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
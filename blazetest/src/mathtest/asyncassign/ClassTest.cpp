@@ -0,0 +1,344 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/asyncassign/ClassTest.cpp
+//  \brief Source file for the asynchronous assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/StaticVector.h>
+#include <blazetest/mathtest/asyncassign/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace asyncassign {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the asynchronous assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   blaze::setNumThreads( 4UL );
+
+   testCompletion();
+   testExceptions();
+   testConflicts();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the completion of asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the isReady(), wait() and waitAll() functions for vector and matrix
+// assignments. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompletion()
+{
+   test_ = "Completion of asynchronous assignments";
+
+   const blaze::AsyncHandle empty;
+
+   if( !empty.isReady() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Default constructed handle is not ready\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   empty.wait();
+
+   const size_t n( 501UL );
+
+   blaze::DynamicMatrix<int> A( n, n );
+   blaze::DynamicVector<int> x( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = static_cast<int>( i % 5UL ) - 2;
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = static_cast<int>( ( i + j ) % 3UL ) - 1;
+   }
+
+   const blaze::DynamicVector<int> y_ref( blaze::serial( A * x ) );
+   const blaze::DynamicMatrix<int> B_ref( blaze::serial( A + A ) );
+
+   // Single vector assignment
+   {
+      blaze::DynamicVector<int> y;
+
+      const blaze::AsyncHandle handle( blaze::asyncAssign( y, A * x ) );
+      handle.wait();
+
+      if( !handle.isReady() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Handle is not ready after wait()\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      compare( y, y_ref, "vector assignment" );
+   }
+
+   // Several independent assignments
+   {
+      blaze::DynamicVector<int> y1, y2;
+      blaze::DynamicMatrix<int> B;
+
+      std::vector<blaze::AsyncHandle> handles;
+      handles.push_back( blaze::asyncAssign( y1, A * x ) );
+      handles.push_back( blaze::asyncAssign( B , A + A ) );
+      handles.push_back( blaze::asyncAssign( y2, trans( A ) * x ) );
+      blaze::waitAll( handles );
+
+      for( size_t k=0UL; k<handles.size(); ++k ) {
+         if( !handles[k].isReady() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Handle " << k << " is not ready after waitAll()\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      compare( y1, y_ref, "first vector assignment" );
+      compare( B , B_ref, "matrix assignment" );
+      compare( y2, blaze::serial( trans( A ) * x ), "second vector assignment" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions thrown during asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown during an asynchronous assignment (including
+// the exception thrown in case the target cannot be resized) is rethrown by the wait() and
+// waitAll() functions. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testExceptions()
+{
+   test_ = "Exceptions thrown during asynchronous assignments";
+
+   blaze::DynamicVector<int> x( 5UL, 1 );
+
+   // Failed assignment waited for via wait()
+   {
+      blaze::StaticVector<int,3UL> s;
+
+      try {
+         const blaze::AsyncHandle handle( blaze::asyncAssign( s, x ) );
+         handle.wait();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid assignment to a static vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Failed assignment waited for via waitAll()
+   {
+      blaze::DynamicVector<int> y;
+      blaze::StaticVector<int,3UL> s;
+
+      try {
+         std::vector<blaze::AsyncHandle> handles;
+         handles.push_back( blaze::asyncAssign( y, 2 * x ) );
+         handles.push_back( blaze::asyncAssign( s, x ) );
+         blaze::waitAll( handles );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid assignment to a static vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      compare( y, 2 * x, "assignment preceding a failed assignment" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ordering of conflicting asynchronous assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a sequence of conflicting asynchronous assignments (write after
+// read, read after write, and write after write) gives the same result as the according
+// sequence of synchronous assignments. Additionally, it tests that the targets are resized
+// before the asyncAssign() function returns, such that expressions involving the targets of
+// assignments in flight can be created safely, and that a resizing assignment whose source
+// aliases the target is handled correctly. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConflicts()
+{
+   test_ = "Ordering of conflicting asynchronous assignments";
+
+   const size_t n( 801UL );
+
+   blaze::DynamicMatrix<int> A( n, n );
+   blaze::DynamicVector<int> a( n ), b( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = static_cast<int>( i % 7UL ) - 3;
+      b[i] = static_cast<int>( i % 4UL ) - 1;
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = static_cast<int>( ( 2UL*i + j ) % 5UL ) - 2;
+   }
+
+   // Synchronous reference sequence
+   blaze::DynamicVector<int> a_ref( a ), c_ref, d_ref, e_ref;
+   c_ref = blaze::serial( A * a_ref );
+   a_ref = blaze::serial( 2 * b );
+   d_ref = blaze::serial( a_ref + c_ref );
+   e_ref = blaze::serial( A * b );
+   e_ref = blaze::serial( d_ref - b );
+
+   // Asynchronous sequence
+   blaze::DynamicVector<int> c, d, e;
+
+   std::vector<blaze::AsyncHandle> handles;
+   handles.push_back( blaze::asyncAssign( c, A * a    ) );  // Reads a
+
+   if( c.size() != n ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Target of an assignment in flight has not been resized\n"
+          << " Details:\n"
+          << "   Size of the target = " << c.size() << "\n"
+          << "   Expected size      = " << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   handles.push_back( blaze::asyncAssign( a, 2 * b    ) );  // Write after read of a
+   handles.push_back( blaze::asyncAssign( d, a + c    ) );  // Read after write of a and c
+   handles.push_back( blaze::asyncAssign( e, A * b    ) );
+   handles.push_back( blaze::asyncAssign( e, d - b    ) );  // Write after write of e
+   blaze::waitAll( handles );
+
+   compare( c, c_ref, "assignment preceding a write after read" );
+   compare( a, a_ref, "write after read" );
+   compare( d, d_ref, "read after write" );
+   compare( e, e_ref, "write after write" );
+
+   // Resizing assignment whose source aliases the target
+   {
+      blaze::DynamicMatrix<int> B( n/2UL, n );
+
+      for( size_t i=0UL; i<n/2UL; ++i ) {
+         for( size_t j=0UL; j<n; ++j )
+            B(i,j) = static_cast<int>( ( i + 3UL*j ) % 4UL ) - 1;
+      }
+
+      blaze::DynamicVector<int> f( b );
+      const blaze::DynamicVector<int> f_ref( blaze::serial( B * f ) );
+
+      const blaze::AsyncHandle handle( blaze::asyncAssign( f, B * f ) );
+      handle.wait();
+
+      compare( f, f_ref, "resizing assignment with aliasing" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace asyncassign
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous assignment test..." << std::endl;
+
+   try
+   {
+      RUN_ASYNCASSIGN_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
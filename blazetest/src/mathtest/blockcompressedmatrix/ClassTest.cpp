@@ -0,0 +1,298 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testConstructors();
+   testAppend();
+   testExpressions();
+
+   testVectorMult<3UL,3UL>(   0UL,   0UL );
+   testVectorMult<3UL,3UL>(   7UL,   5UL );
+   testVectorMult<2UL,4UL>(   9UL,   4UL );
+   testVectorMult<1UL,1UL>(  13UL,  13UL );
+   testVectorMult<3UL,3UL>( 401UL, 401UL );
+   testVectorMult<2UL,4UL>( 509UL, 251UL );
+
+   testMatrixMult<3UL,3UL,rowMajor>   (   7UL,   5UL,  6UL );
+   testMatrixMult<3UL,3UL,columnMajor>(   7UL,   5UL,  6UL );
+   testMatrixMult<2UL,4UL,rowMajor>   (   9UL,   4UL, 11UL );
+   testMatrixMult<2UL,4UL,columnMajor>(   9UL,   4UL, 11UL );
+   testMatrixMult<3UL,3UL,rowMajor>   ( 101UL, 101UL,  9UL );
+   testMatrixMult<2UL,4UL,columnMajor>( 127UL,  63UL,  9UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors and assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testConstructors()
+{
+   test_ = "BlockCompressedMatrix constructors";
+
+   {
+      blaze::CompressedMatrix<int> ref( 4UL, 6UL );
+      ref(0UL,0UL) = 1;
+      ref(1UL,5UL) = 2;
+      ref(3UL,2UL) = 3;
+
+      const blaze::BlockCompressedMatrix<int,2UL> A( ref );
+
+      checkResult( A, ref );
+
+      if( A.nonZeroBlocks() != 3UL || A.nonZeroBlocks( 0UL ) != 2UL || A.nonZeros() != 12UL ||
+          A.nonZeros( 3UL ) != 2UL || A(1UL,4UL) != 0 || A(2UL,0UL) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix state\n"
+             << " Details:\n"
+             << "   Number of non-zero blocks : " << A.nonZeroBlocks() << "\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( 6UL, 4UL, 0 );
+      ref(5UL,3UL) = 4;
+
+      blaze::BlockCompressedMatrix<int,3UL,2UL> A;
+      A = ref;
+
+      checkResult( A, ref );
+
+      if( A.nonZeroBlocks() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero blocks\n"
+             << " Details:\n"
+             << "   Number of non-zero blocks : " << A.nonZeroBlocks() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const blaze::CompressedMatrix<int> ref( 5UL, 6UL );
+
+      try {
+         const blaze::BlockCompressedMatrix<int,2UL> A( ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of BlockCompressedMatrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block-wise setup of a BlockCompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "BlockCompressedMatrix::append()";
+
+   typedef blaze::BlockCompressedMatrix<int,2UL>  MT;
+
+   MT::BlockType K( 1 );
+
+   MT A( 4UL, 6UL, 3UL );
+   A.append( 0UL, 0UL, K );
+   A.append( 0UL, 2UL, K );
+   A.finalize( 0UL );
+   A.append( 1UL, 1UL, K );
+   A.finalize( 1UL );
+
+   A.findBlock( 1UL, 1UL )->value()(0UL,1UL) = 5;
+
+   blaze::DynamicMatrix<int> ref( 4UL, 6UL, 0 );
+   submatrix( ref, 0UL, 0UL, 2UL, 2UL ) = K;
+   submatrix( ref, 0UL, 4UL, 2UL, 2UL ) = K;
+   submatrix( ref, 2UL, 2UL, 2UL, 2UL ) = K;
+   ref(2UL,3UL) = 5;
+
+   checkResult( A, ref );
+
+   if( A.findBlock( 1UL, 0UL ) != A.endBlocks( 1UL ) || A.find( 2UL, 1UL ) != A.end( 2UL ) ||
+       A.find( 2UL, 3UL )->value() != 5 || A.lowerBound( 1UL, 2UL )->index() != 4UL ||
+       A.upperBound( 0UL, 1UL )->index() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid lookup result\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix within expression templates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testExpressions()
+{
+   test_ = "BlockCompressedMatrix expressions";
+
+   const blaze::CompressedMatrix<int> ref( setup( 12UL, 9UL ) );
+   const blaze::BlockCompressedMatrix<int,3UL> A( ref );
+
+   const blaze::DynamicVector<int> x( 12UL, 2 );
+   const blaze::CompressedMatrix<int> B( trans( ref ) );
+
+   checkResult( blaze::DynamicMatrix<int>( A + ref ), blaze::DynamicMatrix<int>( ref + ref ) );
+   checkResult( blaze::CompressedMatrix<int>( A * B ), blaze::CompressedMatrix<int>( ref * B ) );
+   checkResult( blaze::DynamicVector<int>( trans( A ) * x ), blaze::DynamicVector<int>( trans( ref ) * x ) );
+   checkResult( blaze::CompressedMatrix<int,blaze::columnMajor>( 2 * A ), 2 * ref );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of a random sparse matrix with small integral values.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The sparse matrix.
+*/
+blaze::CompressedMatrix<int> ClassTest::setup( size_t m, size_t n ) const
+{
+   blaze::CompressedMatrix<int> A( m, n );
+
+   if( n == 0UL )
+      return A;
+
+   for( size_t k=0UL; k<3UL*m; ++k ) {
+      A( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ) ) = blaze::rand<int>( -10, 10 );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
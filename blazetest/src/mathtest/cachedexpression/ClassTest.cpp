@@ -0,0 +1,222 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/cachedexpression/ClassTest.cpp
+//  \brief Source file for the CachedExpression class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/cachedexpression/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace cachedexpression {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CachedExpression class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   testVersion();
+   testVector();
+   testMatrix();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the modification counters of DynamicVector and DynamicMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testVersion()
+{
+   test_ = "DynamicVector modification counter";
+
+   {
+      blaze::DynamicVector<int> a( 5UL, 1 );
+      blaze::DynamicVector<int> b( 5UL, 2 );
+
+      size_t version( a.version() );
+
+      a = b;
+      checkValidity( a.version() != version, true );
+      version = a.version();
+
+      a += b;
+      checkValidity( a.version() != version, true );
+      version = a.version();
+
+      a.resize( 7UL );
+      checkValidity( a.version() != version, true );
+      version = a.version();
+
+      a[0] = 3;
+      a.reserve( 20UL );
+      checkValidity( a.version() == version, true );
+
+      swap( a, b );
+      checkValidity( a.version() != version, true );
+   }
+
+   test_ = "DynamicMatrix modification counter";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor>    A( 3UL, 3UL, 1 );
+      blaze::DynamicMatrix<int,blaze::columnMajor> B( 3UL, 3UL, 2 );
+
+      size_t versionA( A.version() );
+      size_t versionB( B.version() );
+
+      A = B;
+      B -= A;
+      checkValidity( A.version() != versionA && B.version() != versionB, true );
+      versionA = A.version();
+      versionB = B.version();
+
+      transpose( A );
+      B.reset();
+      checkValidity( A.version() != versionA && B.version() != versionB, true );
+      versionA = A.version();
+      versionB = B.version();
+
+      A(1,1) = 5;
+      B(1,1) = 5;
+      checkValidity( A.version() == versionA && B.version() == versionB, true );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of cached vector expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testVector()
+{
+   blaze::DynamicMatrix<int> A( 4UL, 3UL );
+   blaze::DynamicVector<int> x( 4UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = static_cast<int>( i*A.columns() + j ) - 5;
+      x[i] = static_cast<int>( i ) + 1;
+   }
+
+   testVectorCache( blaze::cache( trans(A) * x ), A, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of cached matrix expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMatrix()
+{
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   blaze::DynamicMatrix<int> B( 3UL, 4UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = static_cast<int>( i + j ) - 1;
+
+   for( size_t i=0UL; i<B.rows(); ++i )
+      for( size_t j=0UL; j<B.columns(); ++j )
+         B(i,j) = static_cast<int>( i*j ) + 2;
+
+   testMatrixCache( blaze::cache( A * B ), A, B );
+}
+//*************************************************************************************************
+
+} // namespace cachedexpression
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CachedExpression class test..." << std::endl;
+
+   try
+   {
+      RUN_CACHEDEXPRESSION_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CachedExpression class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
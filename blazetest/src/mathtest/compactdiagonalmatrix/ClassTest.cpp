@@ -0,0 +1,339 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compactdiagonalmatrix/ClassTest.cpp
+//  \brief Source file for the CompactDiagonalMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/compactdiagonalmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compactdiagonalmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompactDiagonalMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testConstructors();
+   testAssignment();
+
+   testDenseMatrixMult<rowMajor,rowMajor>      (  0UL,  3UL );
+   testDenseMatrixMult<rowMajor,columnMajor>   (  7UL, 13UL );
+   testDenseMatrixMult<columnMajor,rowMajor>   ( 16UL,  5UL );
+   testDenseMatrixMult<columnMajor,columnMajor>( 33UL, 31UL );
+
+   testSparseMatrixMult<rowMajor,rowMajor>      (  0UL,  3UL );
+   testSparseMatrixMult<rowMajor,columnMajor>   (  7UL, 13UL );
+   testSparseMatrixMult<columnMajor,rowMajor>   ( 16UL,  5UL );
+   testSparseMatrixMult<columnMajor,columnMajor>( 33UL, 31UL );
+
+   testVectorMult(  0UL );
+   testVectorMult( 17UL );
+
+   testResize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testConstructors()
+{
+   test_ = "CompactDiagonalMatrix constructors";
+
+   {
+      blaze::CompactDiagonalMatrix<int> D( 4UL, 3 );
+
+      blaze::DynamicMatrix<int> ref( 4UL, 4UL, 0 );
+      for( size_t i=0UL; i<4UL; ++i )
+         ref(i,i) = 3;
+
+      checkResult( D, ref );
+
+      if( D.nonZeros() != 4UL || D.nonZeros( 2UL ) != 1UL || D(1UL,2UL) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix state\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<int> d( 5UL );
+      for( size_t i=0UL; i<5UL; ++i )
+         d[i] = int( i );
+
+      blaze::CompactDiagonalMatrix<int,blaze::columnMajor> D( d );
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( 5UL, 5UL, 0 );
+      for( size_t i=0UL; i<5UL; ++i )
+         ref(i,i) = int( i );
+
+      checkResult( D, ref );
+
+      const blaze::CompactDiagonalMatrix<int> D2( ref );
+      checkResult( D2, ref );
+   }
+
+   {
+      blaze::DynamicMatrix<int> A( 3UL, 3UL, 0 );
+      A(0UL,1UL) = 1;
+
+      try {
+         const blaze::CompactDiagonalMatrix<int> D( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-diagonal CompactDiagonalMatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testAssignment()
+{
+   test_ = "CompactDiagonalMatrix assignment";
+
+   blaze::CompactDiagonalMatrix<int> D1( 6UL ), D2( 6UL ), D3;
+   randomize( D1 );
+   randomize( D2 );
+
+   const blaze::DynamicMatrix<int> ref1( D1 ), ref2( D2 );
+
+   D3 = 2 * D1;
+   checkResult( D3, blaze::DynamicMatrix<int>( 2 * ref1 ) );
+
+   D3 += D2;
+   checkResult( D3, blaze::DynamicMatrix<int>( 2 * ref1 + ref2 ) );
+
+   D3 -= D1;
+   checkResult( D3, blaze::DynamicMatrix<int>( ref1 + ref2 ) );
+
+   D3 *= 3;
+   checkResult( D3, blaze::DynamicMatrix<int>( 3 * ( ref1 + ref2 ) ) );
+
+   D3 = D1 * D2;
+   checkResult( D3, blaze::DynamicMatrix<int>( ref1 * ref2 ) );
+
+   blaze::CompressedMatrix<int> S( 6UL, 6UL );
+   S(3UL,3UL) = 7;
+   D3 = S;
+   checkResult( D3, S );
+
+   S(3UL,4UL) = 1;
+
+   try {
+      D3 = S;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment of non-diagonal matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << D3 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      D3 = blaze::DynamicMatrix<int>( 6UL, 5UL, 0 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment of non-square matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << D3 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a compact diagonal matrix with dense and sparse vectors.
+//
+// \param n The number of rows and columns of the diagonal matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testVectorMult( size_t n )
+{
+   std::ostringstream oss;
+   oss << "CompactDiagonalMatrix/vector multiplication (size " << n << ")";
+   test_ = oss.str();
+
+   blaze::CompactDiagonalMatrix<int> D( n );
+   randomize( D );
+
+   const blaze::DynamicMatrix<int> ref( D );
+
+   blaze::DynamicVector<int,blaze::columnVector> x( n );
+   blaze::DynamicVector<int,blaze::rowVector> y( n );
+   blaze::CompressedVector<int,blaze::columnVector> s( n );
+   blaze::CompressedVector<int,blaze::rowVector> t( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = blaze::rand<int>( -10, 10 );
+      y[i] = blaze::rand<int>( -10, 10 );
+      if( i % 3UL == 0UL ) {
+         s[i] = blaze::rand<int>( 1, 10 );
+         t[i] = blaze::rand<int>( 1, 10 );
+      }
+   }
+
+   checkResult( blaze::DynamicVector<int,blaze::columnVector>( D * x ),
+                blaze::DynamicVector<int,blaze::columnVector>( ref * x ) );
+   checkResult( blaze::DynamicVector<int,blaze::rowVector>( y * D ),
+                blaze::DynamicVector<int,blaze::rowVector>( y * ref ) );
+   checkResult( blaze::CompressedVector<int,blaze::columnVector>( D * s ),
+                blaze::DynamicVector<int,blaze::columnVector>( ref * s ) );
+   checkResult( blaze::CompressedVector<int,blaze::rowVector>( t * D ),
+                blaze::DynamicVector<int,blaze::rowVector>( t * ref ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testResize()
+{
+   test_ = "CompactDiagonalMatrix::resize()";
+
+   blaze::CompactDiagonalMatrix<int> D( 3UL, 2 );
+   D.resize( 5UL );
+
+   blaze::DynamicMatrix<int> ref( 5UL, 5UL, 0 );
+   ref(0UL,0UL) = ref(1UL,1UL) = ref(2UL,2UL) = 2;
+
+   checkResult( D, ref );
+
+   D.resize( 2UL );
+   ref.resize( 2UL, 2UL );
+
+   checkResult( D, ref );
+
+   clear( D );
+
+   if( !isDefault( D ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << D << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compactdiagonalmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompactDiagonalMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPACTDIAGONALMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompactDiagonalMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
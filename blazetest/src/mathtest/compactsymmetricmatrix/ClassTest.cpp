@@ -0,0 +1,253 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compactsymmetricmatrix/ClassTest.cpp
+//  \brief Source file for the CompactSymmetricMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/compactsymmetricmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compactsymmetricmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompactSymmetricMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testConstructors();
+   testAppend();
+
+   testVectorMult<int,rowMajor,false>    (   0UL );
+   testVectorMult<int,rowMajor,false>    (  17UL );
+   testVectorMult<int,columnMajor,false> (  17UL );
+   testVectorMult<cplx,rowMajor,true>    (  23UL );
+   testVectorMult<cplx,columnMajor,true> (  23UL );
+   testVectorMult<int,rowMajor,false>    ( 997UL );
+   testVectorMult<cplx,columnMajor,true> ( 997UL );
+
+   testMatrixMult<int,rowMajor,false,rowMajor>      (  16UL,  5UL );
+   testMatrixMult<int,rowMajor,false,columnMajor>   (  16UL,  5UL );
+   testMatrixMult<int,columnMajor,false,rowMajor>   (  33UL,  7UL );
+   testMatrixMult<cplx,columnMajor,true,columnMajor>(  33UL,  7UL );
+   testMatrixMult<cplx,rowMajor,true,rowMajor>      ( 211UL, 13UL );
+   testMatrixMult<int,columnMajor,false,columnMajor>( 211UL, 13UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompactSymmetricMatrix constructors and assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testConstructors()
+{
+   test_ = "CompactSymmetricMatrix constructors";
+
+   {
+      blaze::CompressedMatrix<int> ref( 4UL, 4UL );
+      ref(0UL,0UL) = 1;
+      ref(0UL,3UL) = ref(3UL,0UL) = 2;
+      ref(2UL,1UL) = ref(1UL,2UL) = 3;
+
+      const blaze::CompactSymmetricMatrix<int> A( ref );
+      const blaze::CompactSymmetricMatrix<int,blaze::columnMajor> B( ref );
+
+      checkResult( expand( A ), ref );
+      checkResult( expand( B ), ref );
+
+      if( A.triangle().nonZeros() != 3UL || B.triangle().nonZeros() != 3UL ||
+          A(3UL,0UL) != 2 || B(0UL,3UL) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix state\n"
+             << " Details:\n"
+             << "   Stored triangle (row-major):\n" << A.triangle() << "\n"
+             << "   Stored triangle (column-major):\n" << B.triangle() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<cplx> ref( 3UL, 3UL, cplx() );
+      ref(1UL,1UL) = cplx( 2, 0 );
+      ref(0UL,2UL) = cplx( 1, 4 );
+      ref(2UL,0UL) = cplx( 1, -4 );
+
+      blaze::CompactSymmetricMatrix<cplx,blaze::rowMajor,true> A;
+      A = ref;
+
+      checkResult( expand( A ), ref );
+
+      ref(2UL,0UL) = cplx( 1, 4 );
+
+      try {
+         A = ref;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-Hermitian matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << expand( A ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      blaze::DynamicMatrix<int> A( 3UL, 3UL, 0 );
+      A(0UL,1UL) = 1;
+
+      try {
+         const blaze::CompactSymmetricMatrix<int> S( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-symmetric CompactSymmetricMatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << expand( S ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise setup of a CompactSymmetricMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "CompactSymmetricMatrix::append()";
+
+   blaze::CompactSymmetricMatrix<int,blaze::columnMajor> A( 3UL, 4UL );
+   A.append( 0UL, 0UL, 2 );
+   A.append( 2UL, 0UL, 1 );
+   A.finalize( 0UL );
+   A.append( 1UL, 1UL, 3 );
+   A.finalize( 1UL );
+   A.append( 2UL, 2UL, 4 );
+   A.finalize( 2UL );
+
+   blaze::CompressedMatrix<int> ref( 3UL, 3UL );
+   ref(0UL,0UL) = 2;
+   ref(0UL,2UL) = ref(2UL,0UL) = 1;
+   ref(1UL,1UL) = 3;
+   ref(2UL,2UL) = 4;
+
+   checkResult( expand( A ), ref );
+
+   A.set( 0UL, 1UL, 5 );
+   ref(0UL,1UL) = ref(1UL,0UL) = 5;
+
+   checkResult( expand( A ), ref );
+
+   if( A.nonZeros() != 7UL || A.triangle().nonZeros() != 5UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros        : " << A.nonZeros() << "\n"
+          << "   Number of stored non-zeros : " << A.triangle().nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compactsymmetricmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompactSymmetricMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPACTSYMMETRICMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompactSymmetricMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -38,7 +38,9 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <vector>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
@@ -84,6 +86,7 @@ ClassTest::ClassTest()
    testSet();
    testInsert();
    testAppend();
+   testSetFromTriplets();
    testErase();
    testResize();
    testReserve();
@@ -6939,6 +6942,224 @@ void ClassTest::testAppend()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c setFromTriplets() member function of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c setFromTriplets() member function of the
+// CompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSetFromTriplets()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix::setFromTriplets()";
+
+      // Setting from unsorted triplets with duplicates
+      {
+         std::vector< blaze::Triplet<int> > triplets;
+         triplets.push_back( blaze::Triplet<int>( 3UL, 1UL, 3 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 3UL, 5 ) );
+         triplets.push_back( blaze::Triplet<int>( 0UL, 3UL, 4 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 0UL, 1 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 3UL, 2 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 1UL, 2 ) );
+         triplets.push_back( blaze::Triplet<int>( 3UL, 1UL, 1 ) );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 4UL, 4UL );
+         mat(2,2) = 9;
+         mat.setFromTriplets( triplets.begin(), triplets.end() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 5UL );
+         checkNonZeros( mat, 5UL );
+         checkNonZeros( mat, 0UL, 1UL );
+         checkNonZeros( mat, 1UL, 3UL );
+         checkNonZeros( mat, 2UL, 0UL );
+         checkNonZeros( mat, 3UL, 1UL );
+
+         if( mat(1,0) != 1 || mat(1,1) != 2 || mat(3,1) != 4 || mat(0,3) != 4 || mat(1,3) != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setting from triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 4 )\n( 1 2 0 7 )\n( 0 0 0 0 )\n( 0 4 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         // Setting from the same triplets with a custom combination of duplicates
+         mat.setFromTriplets( triplets.begin(), triplets.end(), std::multiplies<int>() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkNonZeros( mat, 5UL );
+
+         if( mat(1,0) != 1 || mat(1,1) != 2 || mat(3,1) != 3 || mat(0,3) != 4 || mat(1,3) != 10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setting from triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 4 )\n( 1 2 0 10 )\n( 0 0 0 0 )\n( 0 3 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         // Setting from an empty range
+         mat.setFromTriplets( triplets.end(), triplets.end() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkNonZeros( mat, 0UL );
+      }
+
+      // Trying to set from a triplet with an invalid index
+      {
+         std::vector< blaze::Triplet<int> > triplets;
+         triplets.push_back( blaze::Triplet<int>( 0UL, 1UL, 1 ) );
+         triplets.push_back( blaze::Triplet<int>( 2UL, 4UL, 2 ) );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+         mat(1,1) = 3;
+
+         try {
+            mat.setFromTriplets( triplets.begin(), triplets.end() );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setting from an invalid triplet succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkNonZeros( mat, 1UL );
+
+         if( mat(1,1) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed setting from triplets modified the matrix\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 0 )\n( 0 3 0 0 )\n( 0 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix::setFromTriplets()";
+
+      // Setting from unsorted triplets with duplicates
+      {
+         std::vector< blaze::Triplet<int> > triplets;
+         triplets.push_back( blaze::Triplet<int>( 3UL, 1UL, 3 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 3UL, 5 ) );
+         triplets.push_back( blaze::Triplet<int>( 0UL, 3UL, 4 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 0UL, 1 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 3UL, 2 ) );
+         triplets.push_back( blaze::Triplet<int>( 1UL, 1UL, 2 ) );
+         triplets.push_back( blaze::Triplet<int>( 3UL, 1UL, 1 ) );
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 4UL, 4UL );
+         mat(2,2) = 9;
+         mat.setFromTriplets( triplets.begin(), triplets.end() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 5UL );
+         checkNonZeros( mat, 5UL );
+         checkNonZeros( mat, 0UL, 1UL );
+         checkNonZeros( mat, 1UL, 2UL );
+         checkNonZeros( mat, 2UL, 0UL );
+         checkNonZeros( mat, 3UL, 2UL );
+
+         if( mat(1,0) != 1 || mat(1,1) != 2 || mat(3,1) != 4 || mat(0,3) != 4 || mat(1,3) != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setting from triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 4 )\n( 1 2 0 7 )\n( 0 0 0 0 )\n( 0 4 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         // Setting from the same triplets with a custom combination of duplicates
+         mat.setFromTriplets( triplets.begin(), triplets.end(), std::multiplies<int>() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkNonZeros( mat, 5UL );
+
+         if( mat(1,0) != 1 || mat(1,1) != 2 || mat(3,1) != 3 || mat(0,3) != 4 || mat(1,3) != 10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setting from triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 4 )\n( 1 2 0 10 )\n( 0 0 0 0 )\n( 0 3 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         // Setting from an empty range
+         mat.setFromTriplets( triplets.end(), triplets.end() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkNonZeros( mat, 0UL );
+      }
+
+      // Trying to set from a triplet with an invalid index
+      {
+         std::vector< blaze::Triplet<int> > triplets;
+         triplets.push_back( blaze::Triplet<int>( 0UL, 1UL, 1 ) );
+         triplets.push_back( blaze::Triplet<int>( 2UL, 4UL, 2 ) );
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+         mat(1,1) = 3;
+
+         try {
+            mat.setFromTriplets( triplets.begin(), triplets.end() );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setting from an invalid triplet succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkNonZeros( mat, 1UL );
+
+         if( mat(1,1) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed setting from triplets modified the matrix\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 0 )\n( 0 3 0 0 )\n( 0 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c erase() member function of the CompressedMatrix class template.
 //
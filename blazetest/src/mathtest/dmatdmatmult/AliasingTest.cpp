@@ -175,6 +175,118 @@ void AliasingTest::testDMatDMatMult()
    }
 
 
+   // Assignment to operand of left-hand side element-wise compound
+   {
+      test_ = "DMatDMatMult - Assignment to operand of left-hand side element-wise compound";
+
+      initialize();
+
+      result_ = ( dC3x3_ + dD3x3_ ) * dE3x3_;
+      dC3x3_  = ( dC3x3_ + dD3x3_ ) * dE3x3_;
+
+      checkResult( dC3x3_, result_ );
+   }
+
+   // Assignment to operand of right-hand side element-wise compound
+   {
+      test_ = "DMatDMatMult - Assignment to operand of right-hand side element-wise compound";
+
+      initialize();
+
+      result_ = dC3x3_ * ( dD3x3_ - dE3x3_ );
+      dD3x3_  = dC3x3_ * ( dD3x3_ - dE3x3_ );
+
+      checkResult( dD3x3_, result_ );
+   }
+
+   // Addition assignment to operand of left-hand side element-wise compound
+   {
+      test_ = "DMatDMatMult - Addition assignment to operand of left-hand side element-wise compound";
+
+      initialize();
+
+      result_ =  dC3x3_;
+      result_ += ( dC3x3_ + dD3x3_ ) * dE3x3_;
+      dC3x3_  += ( dC3x3_ + dD3x3_ ) * dE3x3_;
+
+      checkResult( dC3x3_, result_ );
+   }
+
+   // Assignment to operand of left-hand side element-wise compound (multiple panels)
+   {
+      test_ = "DMatDMatMult - Assignment to operand of left-hand side element-wise compound (multiple panels)";
+
+      initialize();
+
+      dresult_ = DMat( dF_ + dG_ ) * dH_;
+      dF_      = ( dF_ + dG_ ) * dH_;
+
+      checkResult( dF_, dresult_ );
+   }
+
+   // Assignment to operand of right-hand side element-wise compound (multiple panels)
+   {
+      test_ = "DMatDMatMult - Assignment to operand of right-hand side element-wise compound (multiple panels)";
+
+      initialize();
+
+      dresult_ = dF_ * DMat( dG_ - dH_ );
+      dG_      = dF_ * ( dG_ - dH_ );
+
+      checkResult( dG_, dresult_ );
+   }
+
+   // Assignment to right-hand side operand of a left-hand side element-wise compound (multiple panels)
+   {
+      test_ = "DMatDMatMult - Assignment to right-hand side operand of a left-hand side element-wise compound (multiple panels)";
+
+      initialize();
+
+      dresult_ = DMat( dF_ + dG_ ) * dH_;
+      dH_      = ( dF_ + dG_ ) * dH_;
+
+      checkResult( dH_, dresult_ );
+   }
+
+   // Assignment to left-hand side operand of a right-hand side element-wise compound (multiple panels)
+   {
+      test_ = "DMatDMatMult - Assignment to left-hand side operand of a right-hand side element-wise compound (multiple panels)";
+
+      initialize();
+
+      dresult_ = dF_ * DMat( dG_ - dH_ );
+      dF_      = dF_ * ( dG_ - dH_ );
+
+      checkResult( dF_, dresult_ );
+   }
+
+   // Addition assignment to operand of left-hand side element-wise compound (multiple panels)
+   {
+      test_ = "DMatDMatMult - Addition assignment to operand of left-hand side element-wise compound (multiple panels)";
+
+      initialize();
+
+      dresult_ =  dF_;
+      dresult_ += DMat( dF_ + dG_ ) * dH_;
+      dF_      += ( dF_ + dG_ ) * dH_;
+
+      checkResult( dF_, dresult_ );
+   }
+
+   // Subtraction assignment to operand of right-hand side element-wise compound (multiple panels)
+   {
+      test_ = "DMatDMatMult - Subtraction assignment to operand of right-hand side element-wise compound (multiple panels)";
+
+      initialize();
+
+      dresult_ =  dG_;
+      dresult_ -= dF_ * DMat( dG_ - dH_ );
+      dG_      -= dF_ * ( dG_ - dH_ );
+
+      checkResult( dG_, dresult_ );
+   }
+
+
    //=====================================================================================
    // Multiplication with addition assignment
    //=====================================================================================
@@ -1595,6 +1707,21 @@ void AliasingTest::initialize()
    tdE3x3_(2,0) =  1;
    tdE3x3_(2,1) =  0;
    tdE3x3_(2,2) =  0;
+
+   // Initializing the large row-major dense matrices
+   const size_t n( 403UL );
+
+   dF_.resize( n, n, false );
+   dG_.resize( n, n, false );
+   dH_.resize( n, n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         dF_(i,j) = int( ( i+2UL*j ) % 5UL ) - 2;
+         dG_(i,j) = int( ( 3UL*i+j ) % 5UL ) - 2;
+         dH_(i,j) = int( ( i*j ) % 3UL ) - 1;
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -44,6 +44,7 @@
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/UpperMatrix.h>
+#include <blaze/system/CacheSize.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/policies/Deallocate.h>
@@ -1346,6 +1347,80 @@ void ClassTest::testAssignment()
       }
    }
 
+   {
+      test_ = "Row-major/row-major DynamicMatrix dense matrix assignment (streaming)";
+
+      const size_t rows   ( 131UL );
+      const size_t columns( blaze::cacheSize / ( sizeof(int) * 3UL * rows ) + 5UL );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( rows, columns ), mat2( rows, columns ), mat3;
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            mat1(i,j) = int( ( i+j ) % 7UL );
+            mat2(i,j) = int( ( i*j ) % 5UL ) - 2;
+         }
+      }
+
+      mat3 = mat1 + mat2 + mat1;
+
+      checkRows   ( mat3, rows    );
+      checkColumns( mat3, columns );
+
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            if( mat3(i,j) != mat1(i,j)*2 + mat2(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Assignment failed\n"
+                   << " Details:\n"
+                   << "   Invalid element (" << i << "," << j << "): " << mat3(i,j) << "\n"
+                   << "   Expected element: " << ( mat1(i,j)*2 + mat2(i,j) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major/row-major DynamicMatrix dense matrix assignment (streaming, unaligned/unpadded)";
+
+      using blaze::unaligned;
+      using blaze::unpadded;
+      using blaze::rowMajor;
+
+      const size_t rows   ( 131UL );
+      const size_t columns( blaze::cacheSize / ( sizeof(int) * 3UL * rows ) + 5UL );
+
+      typedef blaze::CustomMatrix<int,unaligned,unpadded,rowMajor>  UnalignedUnpadded;
+      blaze::UniqueArray<int> array( new int[rows*columns+1UL] );
+      UnalignedUnpadded mat1( array.get()+1UL, rows, columns );
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            mat1(i,j) = int( i*columns + j );
+         }
+      }
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat2;
+      mat2 = mat1;
+
+      checkRows   ( mat2, rows    );
+      checkColumns( mat2, columns );
+
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            if( mat2(i,j) != int( i*columns + j ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Assignment failed\n"
+                   << " Details:\n"
+                   << "   Invalid element (" << i << "," << j << "): " << mat2(i,j) << "\n"
+                   << "   Expected element: " << int( i*columns + j ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
    {
       test_ = "Row-major/column-major DynamicMatrix dense matrix assignment (aligned/padded)";
 
@@ -2195,6 +2270,80 @@ void ClassTest::testAssignment()
       }
    }
 
+   {
+      test_ = "Column-major/column-major DynamicMatrix dense matrix assignment (streaming)";
+
+      const size_t columns( 131UL );
+      const size_t rows   ( blaze::cacheSize / ( sizeof(int) * 3UL * columns ) + 5UL );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( rows, columns ), mat2( rows, columns ), mat3;
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            mat1(i,j) = int( ( i+j ) % 7UL );
+            mat2(i,j) = int( ( i*j ) % 5UL ) - 2;
+         }
+      }
+
+      mat3 = mat1 + mat2 + mat1;
+
+      checkRows   ( mat3, rows    );
+      checkColumns( mat3, columns );
+
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            if( mat3(i,j) != mat1(i,j)*2 + mat2(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Assignment failed\n"
+                   << " Details:\n"
+                   << "   Invalid element (" << i << "," << j << "): " << mat3(i,j) << "\n"
+                   << "   Expected element: " << ( mat1(i,j)*2 + mat2(i,j) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major/column-major DynamicMatrix dense matrix assignment (streaming, unaligned/unpadded)";
+
+      using blaze::unaligned;
+      using blaze::unpadded;
+      using blaze::columnMajor;
+
+      const size_t columns( 131UL );
+      const size_t rows   ( blaze::cacheSize / ( sizeof(int) * 3UL * columns ) + 5UL );
+
+      typedef blaze::CustomMatrix<int,unaligned,unpadded,columnMajor>  UnalignedUnpadded;
+      blaze::UniqueArray<int> array( new int[rows*columns+1UL] );
+      UnalignedUnpadded mat1( array.get()+1UL, rows, columns );
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            mat1(i,j) = int( i*columns + j );
+         }
+      }
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat2;
+      mat2 = mat1;
+
+      checkRows   ( mat2, rows    );
+      checkColumns( mat2, columns );
+
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            if( mat2(i,j) != int( i*columns + j ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Assignment failed\n"
+                   << " Details:\n"
+                   << "   Invalid element (" << i << "," << j << "): " << mat2(i,j) << "\n"
+                   << "   Expected element: " << int( i*columns + j ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
    {
       test_ = "Column-major/row-major DynamicMatrix dense matrix assignment (lower)";
 
@@ -7749,6 +7898,128 @@ void ClassTest::testTranspose()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // Self-transpose of a 67x67 matrix
+      {
+         const size_t m( 67UL );
+         const size_t n( 67UL );
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = int( i*n + j );
+
+         transpose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != int( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << int( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 45x70 matrix
+      {
+         const size_t m( 45UL );
+         const size_t n( 70UL );
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = int( i*n + j );
+
+         transpose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != int( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << int( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 300x130 matrix by several threads
+      {
+         const size_t m( 300UL );
+         const size_t n( 130UL );
+         const size_t threads( blaze::getNumThreads() );
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = int( i*n + j );
+
+         blaze::setNumThreads( 4UL );
+         transpose( mat );
+         blaze::setNumThreads( threads );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != int( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << int( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 67x67 double precision matrix
+      {
+         const size_t n( 67UL );
+
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( n, n );
+         for( size_t i=0UL; i<n; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = double( i*n + j );
+
+         transpose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               if( mat(i,j) != double( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << double( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
    }
 
    {
@@ -7910,6 +8181,128 @@ void ClassTest::testTranspose()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // Self-transpose of a 67x67 matrix
+      {
+         const size_t m( 67UL );
+         const size_t n( 67UL );
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = int( i*n + j );
+
+         transpose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != int( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << int( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 45x70 matrix
+      {
+         const size_t m( 45UL );
+         const size_t n( 70UL );
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = int( i*n + j );
+
+         transpose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != int( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << int( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 300x130 matrix by several threads
+      {
+         const size_t m( 300UL );
+         const size_t n( 130UL );
+         const size_t threads( blaze::getNumThreads() );
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = int( i*n + j );
+
+         blaze::setNumThreads( 4UL );
+         transpose( mat );
+         blaze::setNumThreads( threads );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != int( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << int( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 67x67 double precision matrix
+      {
+         const size_t n( 67UL );
+
+         blaze::DynamicMatrix<double,blaze::columnMajor> mat( n, n );
+         for( size_t i=0UL; i<n; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = double( i*n + j );
+
+         transpose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               if( mat(i,j) != double( j*n + i ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << double( j*n + i ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
    }
 
    {
@@ -8093,6 +8486,66 @@ void ClassTest::testCTranspose()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // Self-transpose of a 67x67 matrix
+      {
+         const size_t m( 67UL );
+         const size_t n( 67UL );
+
+         blaze::DynamicMatrix<cplx,blaze::rowMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = cplx( int(i), int(j) );
+
+         ctranspose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != cplx( int(j), -int(i) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << cplx( int(j), -int(i) ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 45x70 matrix
+      {
+         const size_t m( 45UL );
+         const size_t n( 70UL );
+
+         blaze::DynamicMatrix<cplx,blaze::rowMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = cplx( int(i), int(j) );
+
+         ctranspose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != cplx( int(j), -int(i) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << cplx( int(j), -int(i) ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
    }
 
    {
@@ -8270,6 +8723,66 @@ void ClassTest::testCTranspose()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // Self-transpose of a 67x67 matrix
+      {
+         const size_t m( 67UL );
+         const size_t n( 67UL );
+
+         blaze::DynamicMatrix<cplx,blaze::columnMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = cplx( int(i), int(j) );
+
+         ctranspose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != cplx( int(j), -int(i) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << cplx( int(j), -int(i) ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Self-transpose of a 45x70 matrix
+      {
+         const size_t m( 45UL );
+         const size_t n( 70UL );
+
+         blaze::DynamicMatrix<cplx,blaze::columnMajor> mat( m, n );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               mat(i,j) = cplx( int(i), int(j) );
+
+         ctranspose( mat );
+
+         checkRows   ( mat, n );
+         checkColumns( mat, m );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<m; ++j ) {
+               if( mat(i,j) != cplx( int(j), -int(i) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition failed\n"
+                      << " Details:\n"
+                      << "   Invalid element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                      << "   Expected element: " << cplx( int(j), -int(i) ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
    }
 
    {
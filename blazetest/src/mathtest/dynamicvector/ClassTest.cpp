@@ -43,6 +43,7 @@
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/shims/Equal.h>
+#include <blaze/system/CacheSize.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/policies/Deallocate.h>
 #include <blaze/util/Random.h>
@@ -618,6 +619,34 @@ void ClassTest::testAssignment()
    }
 
 
+   {
+      test_ = "DynamicVector linear combination assignment (streaming)";
+
+      const size_t size( blaze::cacheSize / sizeof(int) + 7UL );
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( size ), vec2( size ), vec3( size );
+      for( size_t i=0UL; i<size; ++i ) {
+         vec1[i] = int( i % 7UL );
+         vec2[i] = int( i % 5UL ) - 2;
+      }
+
+      vec3 = vec1*2 + vec2*3 - vec1;
+
+      for( size_t i=0UL; i<size; ++i ) {
+         if( vec3[i] != vec1[i] + vec2[i]*3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Index          = " << i << "\n"
+                << "   Result         = " << vec3[i] << "\n"
+                << "   Expected result: " << ( vec1[i] + vec2[i]*3 ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
    //=====================================================================================
    // Sparse vector assignment
    //=====================================================================================
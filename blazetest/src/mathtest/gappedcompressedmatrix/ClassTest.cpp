@@ -0,0 +1,319 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/gappedcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the GappedCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/gappedcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace gappedcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GappedCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   testConstructors();
+   testInsert();
+
+   testUpdates(    1UL,    5UL,    50UL );
+   testUpdates(    7UL,   11UL,   300UL );
+   testUpdates(   64UL,   64UL,  2000UL );
+   testUpdates(  333UL,  100UL, 10000UL );
+   testUpdates( 1000UL, 1000UL, 20000UL );
+
+   testCompact();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the GappedCompressedMatrix constructors and assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testConstructors()
+{
+   test_ = "GappedCompressedMatrix constructors";
+
+   {
+      const blaze::GappedCompressedMatrix<int> A( 3UL, 4UL, 10UL );
+
+      checkIntact( A );
+      checkResult( A, blaze::CompressedMatrix<int>( 3UL, 4UL ) );
+
+      if( A.capacity() != 10UL || A.capacity( 0UL ) != 4UL || A.capacity( 2UL ) != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity\n"
+             << " Details:\n"
+             << "   Capacity         : " << A.capacity() << "\n"
+             << "   Expected capacity: 10\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( 4UL, 5UL, 0 );
+      ref(0UL,1UL) = 1;
+      ref(2UL,4UL) = 2;
+      ref(3UL,0UL) = 3;
+
+      const blaze::GappedCompressedMatrix<int> A( ref );
+      checkIntact( A );
+      checkResult( A, ref );
+
+      blaze::GappedCompressedMatrix<int> B( A );
+      checkIntact( B );
+      checkResult( B, ref );
+
+      B = 2 * ref;
+      checkIntact( B );
+      checkResult( B, 2 * ref );
+
+      B = A;
+      checkIntact( B );
+      checkResult( B, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element insertion into a GappedCompressedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testInsert()
+{
+   test_ = "GappedCompressedMatrix::insert()";
+
+   blaze::GappedCompressedMatrix<int> A( 3UL, 5UL );
+   blaze::CompressedMatrix<int> ref( 3UL, 5UL );
+
+   A.insert( 1UL, 3UL, 1 );
+   A.insert( 1UL, 0UL, 2 );
+   A.insert( 0UL, 4UL, 3 );
+   A(2UL,2UL) = 4;
+   A.set( 1UL, 3UL, 5 );
+
+   ref(1UL,3UL) = 5;
+   ref(1UL,0UL) = 2;
+   ref(0UL,4UL) = 3;
+   ref(2UL,2UL) = 4;
+
+   checkIntact( A );
+   checkResult( A, ref );
+
+   if( A.find( 1UL, 0UL ) != A.begin( 1UL ) || A.find( 1UL, 1UL ) != A.end( 1UL ) ||
+       A.lowerBound( 1UL, 1UL )->index() != 3UL || A.upperBound( 1UL, 3UL ) != A.end( 1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid lookup result\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      A.insert( 1UL, 0UL, 6 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Insertion of duplicate element succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of random sequences of insertions and deletions.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param updates The number of random updates.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testUpdates( size_t m, size_t n, size_t updates )
+{
+   std::ostringstream oss;
+   oss << "GappedCompressedMatrix updates (" << m << "x" << n << ", " << updates << " updates)";
+   test_ = oss.str();
+
+   blaze::GappedCompressedMatrix<int> A( m, n );
+   blaze::CompressedMatrix<int> ref( m, n );
+
+   for( size_t k=0UL; k<updates; ++k )
+   {
+      const size_t i( blaze::rand<size_t>( 0UL, m-1UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, n-1UL ) );
+      const int    v( blaze::rand<int>( 1, 10 ) );
+
+      switch( blaze::rand<int>( 0, 4 ) ) {
+         case 0 : A.erase( i, j );    ref.erase( i, j ); break;
+         case 1 : A(i,j) = v;         ref(i,j) = v;      break;
+         default: A.set( i, j, v );   ref(i,j) = v;      break;
+      }
+
+      checkIntact( A );
+   }
+
+   checkResult( A, ref );
+   checkResult( blaze::DynamicVector<int>( A * blaze::DynamicVector<int>( n, 2 ) ),
+                blaze::DynamicVector<int>( ref * blaze::DynamicVector<int>( n, 2 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the GappedCompressedMatrix::compact() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testCompact()
+{
+   test_ = "GappedCompressedMatrix::compact()";
+
+   blaze::GappedCompressedMatrix<int> A( 50UL, 40UL );
+
+   for( size_t k=0UL; k<400UL; ++k ) {
+      A.set( blaze::rand<size_t>( 0UL, 49UL ), blaze::rand<size_t>( 0UL, 39UL ), blaze::rand<int>( 1, 10 ) );
+   }
+
+   const blaze::CompressedMatrix<int> B( A.compact() );
+
+   checkResult( B, A );
+
+   if( B.nonZeros() != A.nonZeros() || B.capacity() != A.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid compacted matrix\n"
+          << " Details:\n"
+          << "   Number of non-zeros : " << B.nonZeros() << "\n"
+          << "   Capacity            : " << B.capacity() << "\n"
+          << "   Expected            : " << A.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the invariants of a gapped compressed matrix.
+//
+// \param m The matrix to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkIntact( const blaze::GappedCompressedMatrix<int>& m ) const
+{
+   if( !isIntact( m ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros : " << m.nonZeros() << "\n"
+          << "   Capacity            : " << m.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace gappedcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running GappedCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_GAPPEDCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during GappedCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
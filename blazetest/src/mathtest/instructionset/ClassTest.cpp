@@ -0,0 +1,199 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/instructionset/ClassTest.cpp
+//  \brief Source file for the instruction set dispatch test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/instructionset/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace instructionset {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the instruction set dispatch test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   blaze::setNumThreads( 4UL );
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::setThreshold( "DMATDVECMULT_THRESHOLD", 0UL );
+   blaze::setThreshold( "DMATDMATMULT_THRESHOLD", 0UL );
+#endif
+
+   const blaze::InstructionSet initial( blaze::instructionSet() );
+
+   testSelection();
+
+   for( int isa=blaze::defaultInstructionSet; isa<=blaze::supportedInstructionSet(); ++isa )
+   {
+      blaze::setInstructionSet( static_cast<blaze::InstructionSet>( isa ) );
+
+      test_ = "Dense vector addition/subtraction assignment";
+      testAddAssign<float>();
+      testAddAssign<double>();
+
+      test_ = "Dense vector inner product";
+      testDotProduct<float>();
+      testDotProduct<double>();
+
+      test_ = "Dense matrix/dense vector multiplication";
+      testGemv<float>();
+      testGemv<double>();
+
+      test_ = "Dense matrix/dense matrix multiplication";
+      testGemm<float>();
+      testGemm<double>();
+
+      test_ = "Sparse matrix/dense vector multiplication";
+      testSpmv<float>();
+      testSpmv<double>();
+   }
+
+   blaze::setInstructionSet( initial );
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::resetThresholds();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the selection of the instruction set.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setInstructionSet() function. Supported instruction sets have to be
+// selected as requested, unsupported instruction sets have to be replaced by the most powerful
+// supported instruction set. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testSelection()
+{
+   test_ = "Selection of the instruction set";
+
+   const blaze::InstructionSet supported( blaze::supportedInstructionSet() );
+
+   if( blaze::compiledInstructionSet() > supported ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Compiled instruction set not supported\n"
+          << " Details:\n"
+          << "   Compiled instruction set : " << blaze::compiledInstructionSet() << "\n"
+          << "   Supported instruction set: " << supported << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( int isa=blaze::defaultInstructionSet; isa<=blaze::avx512InstructionSet; ++isa )
+   {
+      blaze::setInstructionSet( static_cast<blaze::InstructionSet>( isa ) );
+
+      const int expected( ( isa < supported )?( isa ):( supported ) );
+
+      if( blaze::instructionSet() != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid instruction set selected\n"
+             << " Details:\n"
+             << "   Requested instruction set: " << isa << "\n"
+             << "   Selected instruction set : " << blaze::instructionSet() << "\n"
+             << "   Expected instruction set : " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace instructionset
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running instruction set dispatch test..." << std::endl;
+
+   try
+   {
+      RUN_INSTRUCTIONSET_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during instruction set dispatch test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixreader/ClassTest.cpp
+//  \brief Source file for the text file reader class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/matrixreader/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixreader {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the file reader class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                                // Label of the currently performed test
+   , file_( "blazetest_matrixreader.tmp" )  // Name of the temporary text file
+{
+   testCoordinate();
+   testArray();
+   testCSV();
+   testFailures();
+
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of reading Matrix Market files in coordinate format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testCoordinate()
+{
+   test_ = "Matrix Market coordinate format (general)";
+
+   {
+      writeFile( "%%MatrixMarket matrix coordinate real general\n"
+                 "% Unordered entries with a duplicate\n"
+                 "\n"
+                 "3 4 5\n"
+                 "3 4 -2e1\n"
+                 "1 1 1.5\n"
+                 "2 2 3\n"
+                 "1 1 0.5\n"
+                 "2 3 .25\n" );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 3UL, 4UL, 0.0 );
+      ref(0,0) =   2.0;
+      ref(1,1) =   3.0;
+      ref(1,2) =  0.25;
+      ref(2,3) = -20.0;
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+      compareMatrices( A, ref );
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> B;
+      blaze::readMatrixMarket( file_, B );
+      compareMatrices( B, ref );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> C;
+      blaze::readMatrixMarket( file_, C );
+      compareMatrices( C, ref );
+
+      blaze::StaticMatrix<double,3UL,4UL,blaze::rowMajor> D;
+      blaze::readMatrixMarket( file_, D );
+      compareMatrices( D, ref );
+   }
+
+   test_ = "Matrix Market coordinate format (symmetric)";
+
+   {
+      writeFile( "%%MatrixMarket matrix coordinate integer symmetric\n"
+                 "3 3 3\n"
+                 "1 1 1\n"
+                 "3 1 2\n"
+                 "3 2 4\n" );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( 3UL, 3UL, 0 );
+      ref(0,0) = 1;
+      ref(0,2) = ref(2,0) = 2;
+      ref(1,2) = ref(2,1) = 4;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+      compareMatrices( A, ref );
+
+      blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::columnMajor> > B;
+      blaze::readMatrixMarket( file_, B );
+      compareMatrices( B, ref );
+
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<int,blaze::rowMajor> > C;
+      blaze::readMatrixMarket( file_, C );
+      compareMatrices( C, ref );
+   }
+
+   test_ = "Matrix Market coordinate format (hermitian)";
+
+   {
+      typedef blaze::complex<double>  cplx;
+
+      writeFile( "%%MatrixMarket matrix coordinate complex hermitian\n"
+                 "2 2 2\n"
+                 "1 1 1 0\n"
+                 "2 1 1 2\n" );
+
+      blaze::DynamicMatrix<cplx,blaze::rowMajor> ref( 2UL, 2UL );
+      ref(0,0) = cplx( 1.0,  0.0 );
+      ref(0,1) = cplx( 1.0, -2.0 );
+      ref(1,0) = cplx( 1.0,  2.0 );
+      ref(1,1) = cplx( 0.0,  0.0 );
+
+      blaze::CompressedMatrix<cplx,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+      compareMatrices( A, ref );
+   }
+
+   test_ = "Matrix Market coordinate format (pattern)";
+
+   {
+      writeFile( "%%MatrixMarket matrix coordinate pattern general\n"
+                 "2 3 2\n"
+                 "2 3\n"
+                 "1 2\n" );
+
+      blaze::DynamicMatrix<float,blaze::rowMajor> ref( 2UL, 3UL, 0.0F );
+      ref(0,1) = 1.0F;
+      ref(1,2) = 1.0F;
+
+      blaze::CompressedMatrix<float,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+      compareMatrices( A, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reading Matrix Market files in array format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testArray()
+{
+   test_ = "Matrix Market array format (general)";
+
+   {
+      writeFile( "%%MatrixMarket matrix array integer general\n"
+                 "2 3\n"
+                 "1\n2\n3\n4\n5\n6\n" );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( 2UL, 3UL );
+      ref(0,0) = 1; ref(0,1) = 3; ref(0,2) = 5;
+      ref(1,0) = 2; ref(1,1) = 4; ref(1,2) = 6;
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> A;
+      blaze::readMatrixMarket( file_, A );
+      compareMatrices( A, ref );
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> B;
+      blaze::readMatrixMarket( file_, B );
+      compareMatrices( B, ref );
+   }
+
+   test_ = "Matrix Market array format (skew-symmetric)";
+
+   {
+      writeFile( "%%MatrixMarket matrix array real skew-symmetric\n"
+                 "3 3\n"
+                 "1\n2\n3\n" );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 3UL, 3UL, 0.0 );
+      ref(1,0) =  1.0; ref(0,1) = -1.0;
+      ref(2,0) =  2.0; ref(0,2) = -2.0;
+      ref(2,1) =  3.0; ref(1,2) = -3.0;
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> A;
+      blaze::readMatrixMarket( file_, A );
+      compareMatrices( A, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reading CSV files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testCSV()
+{
+   test_ = "CSV file";
+
+   {
+      writeFile( "1, 2.5,0\r\n"
+                 "\n"
+                 "0,-1e-3 ,4\n" );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 2UL, 3UL, 0.0 );
+      ref(0,0) =    1.0;
+      ref(0,1) =    2.5;
+      ref(1,1) = -0.001;
+      ref(1,2) =    4.0;
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::readCSV( file_, A );
+      compareMatrices( A, ref );
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> B;
+      blaze::readCSV( file_, B );
+      compareMatrices( B, ref );
+
+      if( B.nonZeros() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros : " << B.nonZeros() << "\n"
+             << "   Expected number     : 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::StaticMatrix<double,2UL,3UL,blaze::columnMajor> C;
+      blaze::readCSV( file_, C );
+      compareMatrices( C, ref );
+   }
+
+   test_ = "Tab-separated file";
+
+   {
+      writeFile( "1\t2\n"
+                 "3\t4" );
+
+      blaze::DynamicMatrix<float,blaze::rowMajor> ref( 2UL, 2UL );
+      ref(0,0) = 1.0F; ref(0,1) = 2.0F;
+      ref(1,0) = 3.0F; ref(1,1) = 4.0F;
+
+      blaze::DynamicMatrix<float,blaze::columnMajor> A;
+      blaze::readCSV( file_, A, '\t' );
+      compareMatrices( A, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reading invalid files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Reader failures";
+
+   const char* const files[] = {
+      "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n3 1 1\n",  // Invalid index
+      "%%MatrixMarket matrix coordinate real general\n2 2 3\n1 1 1\n",         // Missing entries
+      "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 x\n",         // Invalid value
+      "%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 2\n",    // Complex to real
+      "%%MatrixMarket matrix array real symmetric\n2 3\n1\n2\n3\n",            // Non-square symmetric
+      "%%MatrixMarket vector coordinate real general\n2 1\n1 1\n"              // Invalid banner
+   };
+
+   for( size_t i=0UL; i<sizeof(files)/sizeof(files[0]); ++i )
+   {
+      writeFile( files[i] );
+
+      try {
+         blaze::CompressedMatrix<double,blaze::rowMajor> A;
+         blaze::readMatrixMarket( file_, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading an invalid Matrix Market file succeeded\n"
+             << " Details:\n"
+             << "   File:\n" << files[i] << "\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Error:" ) != std::string::npos ) throw;
+      }
+   }
+
+   writeFile( "1,2\n3\n" );
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::readCSV( file_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a ragged CSV file succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Error:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::readCSV( "blazetest_matrixreader.missing", A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a missing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Error:" ) != std::string::npos ) throw;
+   }
+}
+//*************************************************************************************************
+
+} // namespace matrixreader
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running matrix reader class test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXREADER_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during matrix reader class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,300 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mixedprecision/ClassTest.cpp
+//  \brief Source file for the mixed precision test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <blazetest/mathtest/mixedprecision/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mixedprecision {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the mixed precision test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   using blaze::float16;
+   using blaze::bfloat16;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testFloat16();
+   testBFloat16();
+
+   testMatVecMult<float16,rowMajor>   (  1UL,   1UL );
+   testMatVecMult<float16,rowMajor>   (  7UL,  15UL );
+   testMatVecMult<float16,rowMajor>   ( 37UL, 100UL );
+   testMatVecMult<float16,columnMajor>( 23UL,  41UL );
+   testMatVecMult<bfloat16,rowMajor>  (  3UL,   8UL );
+   testMatVecMult<bfloat16,rowMajor>  ( 42UL,  67UL );
+   testMatVecMult<bfloat16,columnMajor>( 9UL,  33UL );
+
+   testDoubleAccumulation(  1UL,   1UL );
+   testDoubleAccumulation(  6UL,  13UL );
+   testDoubleAccumulation( 45UL, 128UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the float16 storage type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rounding of single precision values to half precision (including
+// subnormal values, ties and overflow) and the exact round trip of all half precision values.
+*/
+void ClassTest::testFloat16()
+{
+   using blaze::float16;
+
+   test_ = "float16 conversion";
+
+   checkBits( float16(  1.0F ).bits(), 0x3C00U,  1.0F );
+   checkBits( float16( -2.0F ).bits(), 0xC000U, -2.0F );
+   checkBits( float16( 65504.0F ).bits(), 0x7BFFU, 65504.0F );
+   checkBits( float16( 65520.0F ).bits(), 0x7C00U, 65520.0F );
+   checkBits( float16( 5.9604645E-8F ).bits(), 0x0001U, 5.9604645E-8F );
+   checkBits( float16( 2.9802322E-8F ).bits(), 0x0000U, 2.9802322E-8F );
+   checkBits( float16( 8.9406967E-8F ).bits(), 0x0002U, 8.9406967E-8F );
+   checkBits( float16( 1.00048828125F ).bits(), 0x3C00U, 1.00048828125F );
+   checkBits( float16( 1.00146484375F ).bits(), 0x3C02U, 1.00146484375F );
+
+   if( float( float16( std::numeric_limits<float>::quiet_NaN() ) ) ==
+       float( float16( std::numeric_limits<float>::quiet_NaN() ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: NaN conversion failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "float16 round trip";
+
+   for( unsigned int bits=0U; bits<0x10000U; ++bits )
+   {
+      if( ( bits & 0x7C00U ) == 0x7C00U && ( bits & 0x03FFU ) != 0U )
+         continue;
+
+      const float value( float16::fromBits( static_cast<blaze::uint16_t>( bits ) ) );
+      checkBits( float16( value ).bits(), bits, value );
+   }
+
+   test_ = "float16 compound assignment";
+
+   float16 h( 1.5F );
+   h += 2.0F;
+   h *= 4.0F;
+   h -= 1.0F;
+   h /= 2.0F;
+   checkBits( h.bits(), float16( 6.5F ).bits(), 6.5F );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the bfloat16 storage type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rounding of single precision values to bfloat16 (including ties and
+// overflow) and the exact round trip of all bfloat16 values.
+*/
+void ClassTest::testBFloat16()
+{
+   using blaze::bfloat16;
+
+   test_ = "bfloat16 conversion";
+
+   checkBits( bfloat16(  1.0F ).bits(), 0x3F80U,  1.0F );
+   checkBits( bfloat16( -2.0F ).bits(), 0xC000U, -2.0F );
+   checkBits( bfloat16( 1.00390625F ).bits(), 0x3F80U, 1.00390625F );
+   checkBits( bfloat16( 1.01171875F ).bits(), 0x3F82U, 1.01171875F );
+   checkBits( bfloat16( std::numeric_limits<float>::max() ).bits(), 0x7F80U,
+              std::numeric_limits<float>::max() );
+
+   if( float( bfloat16( std::numeric_limits<float>::quiet_NaN() ) ) ==
+       float( bfloat16( std::numeric_limits<float>::quiet_NaN() ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: NaN conversion failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "bfloat16 round trip";
+
+   for( unsigned int bits=0U; bits<0x10000U; ++bits )
+   {
+      if( ( bits & 0x7F80U ) == 0x7F80U && ( bits & 0x007FU ) != 0U )
+         continue;
+
+      const float value( bfloat16::fromBits( static_cast<blaze::uint16_t>( bits ) ) );
+      checkBits( bfloat16( value ).bits(), bits, value );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the double precision accumulation of single precision operands.
+//
+// \param m The number of rows of the matrix operand.
+// \param n The number of columns of the matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The products of the operands require more than 24 significant bits, but are exactly
+// representable in double precision. Therefore the result is exact if and only if the
+// products are computed and accumulated in double precision. Since the accumulation in double
+// precision relies on the converting intrinsic loads, the test is skipped in case these are
+// not available for the current instruction set.
+*/
+void ClassTest::testDoubleAccumulation( size_t m, size_t n )
+{
+   if( !blaze::IntrinsicConversion<double,float>::value )
+      return;
+
+   std::ostringstream oss;
+   oss << "Double precision accumulation of single precision operands (" << m << "x" << n << ")";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> A( m, n );
+   blaze::DynamicVector<float> x( n );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = float( blaze::rand<int>( -4095, 4095 ) ) + 0.25F;
+
+   for( size_t j=0UL; j<n; ++j )
+      x[j] = float( blaze::rand<int>( -4095, 4095 ) ) + 0.125F;
+
+   blaze::DynamicVector<double> ref( m, 0.0 );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref[i] += double( A(i,j) ) * double( x[j] );
+
+   blaze::DynamicVector<double> y( m );
+   y = A * x;
+
+   checkResult( y, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the bit pattern of a converted value.
+//
+// \param result The computed bit pattern.
+// \param expected The expected bit pattern.
+// \param value The converted single precision value.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkBits( unsigned int result, unsigned int expected, float value ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid conversion result\n"
+          << " Details:\n"
+          << "   Converted value: " << value << "\n"
+          << "   Result: " << std::hex << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace mixedprecision
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running mixed precision test..." << std::endl;
+
+   try
+   {
+      RUN_MIXEDPRECISION_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during mixed precision test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,556 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/parallelsection/ClassTest.cpp
+//  \brief Source file for the parallel section test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/parallelsection/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace parallelsection {
+
+//=================================================================================================
+//
+//  AUXILIARY DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loop body recording the identifier of the executing thread.
+*/
+struct Recorder
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the Recorder class.
+   //
+   // \param ids The vector of thread identifiers.
+   */
+   explicit Recorder( std::vector<boost::thread::id>& ids )
+      : ids_( &ids )  // The vector of thread identifiers
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Records the identifier of the executing thread for the given iteration.
+   //
+   // \param k The index of the iteration.
+   // \return void
+   */
+   void operator()( size_t k ) {
+      (*ids_)[k] = boost::this_thread::get_id();
+      boost::this_thread::sleep( boost::posix_time::milliseconds( 2 ) );
+   }
+   //**********************************************************************************************
+
+   std::vector<boost::thread::id>* ids_;  //!< The vector of thread identifiers.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loop body recording the parallel section state of the executing thread.
+*/
+struct SectionRecorder
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the SectionRecorder class.
+   //
+   // \param active Per-iteration flag whether a parallel section was active.
+   */
+   explicit SectionRecorder( std::vector<int>& active )
+      : active_( &active )  // Per-iteration flag for the active parallel section
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Records the parallel section state of the executing thread for the given iteration.
+   //
+   // \param k The index of the iteration.
+   // \return void
+   */
+   void operator()( size_t k ) {
+      (*active_)[k] = blaze::isParallelSectionActive();
+      boost::this_thread::sleep( boost::posix_time::milliseconds( 2 ) );
+   }
+   //**********************************************************************************************
+
+   std::vector<int>* active_;  //!< Per-iteration flag whether a parallel section was active.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loop body executing a nested parallel loop.
+//
+// Each iteration executes a nested parallel loop and records whether all iterations of the
+// nested loop have been executed by the thread executing the outer iteration.
+*/
+struct NestedLoop
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the NestedLoop class.
+   //
+   // \param serial Per-iteration flag whether the nested loop was executed serially.
+   */
+   explicit NestedLoop( std::vector<int>& serial )
+      : serial_( &serial )  // Per-iteration flag for the serial execution of the nested loop
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Executes a nested parallel loop for the given iteration.
+   //
+   // \param k The index of the iteration.
+   // \return void
+   */
+   void operator()( size_t k ) {
+      std::vector<boost::thread::id> ids( 8UL );
+      Recorder recorder( ids );
+      blaze::smpFor( ids.size(), recorder );
+
+      (*serial_)[k] = ( std::count( ids.begin(), ids.end(), boost::this_thread::get_id() ) == 8 );
+   }
+   //**********************************************************************************************
+
+   std::vector<int>* serial_;  //!< Per-iteration flag for the serial execution of the nested loop.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loop body executing a nested SMP assignment.
+*/
+struct NestedAssignment
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the NestedAssignment class.
+   //
+   // \param a The left-hand side operand of the addition.
+   // \param b The right-hand side operand of the addition.
+   // \param results The vectors for the results of the nested assignments.
+   */
+   explicit NestedAssignment( const blaze::DynamicVector<int>& a, const blaze::DynamicVector<int>& b,
+                              std::vector< blaze::DynamicVector<int> >& results )
+      : a_      ( &a       )  // The left-hand side operand of the addition
+      , b_      ( &b       )  // The right-hand side operand of the addition
+      , results_( &results )  // The vectors for the results of the nested assignments
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Executes the nested assignment for the given iteration.
+   //
+   // \param k The index of the iteration.
+   // \return void
+   */
+   void operator()( size_t k ) {
+      (*results_)[k] = (*a_) + (*b_);
+   }
+   //**********************************************************************************************
+
+   const blaze::DynamicVector<int>* a_;               //!< The left-hand side operand of the addition.
+   const blaze::DynamicVector<int>* b_;               //!< The right-hand side operand of the addition.
+   std::vector< blaze::DynamicVector<int> >* results_;  //!< The vectors for the results.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task recording the parallel section state of the executing thread.
+//
+// \param active The recorded state of the parallel section.
+// \return void
+*/
+void recordSection( int* active )
+{
+   *active = blaze::isParallelSectionActive() || blaze::isParallelSectionNested();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the parallel section test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   blaze::setNumThreads( 4UL );
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::setThreshold( "SMP_DVECDVECADD_THRESHOLD", 0UL );
+#endif
+
+   testSections();
+   testThreads();
+   testDispatch();
+   testWorkers();
+   testAssignment();
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::resetThresholds();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel section state of a single thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the isParallelSectionActive() and isParallelSectionNested() functions
+// for nested parallel sections of the calling thread. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSections()
+{
+   test_ = "Parallel section state";
+
+   bool outer ( true  );
+   bool single( false );
+   bool nested( false );
+   bool left  ( false );
+
+   outer = blaze::isParallelSectionActive() || blaze::isParallelSectionNested();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      single = blaze::isParallelSectionActive() && !blaze::isParallelSectionNested();
+
+      BLAZE_PARALLEL_SECTION
+      {
+         nested = blaze::isParallelSectionActive() && blaze::isParallelSectionNested();
+      }
+
+      left = blaze::isParallelSectionActive() && !blaze::isParallelSectionNested();
+   }
+
+   if( outer || !single || !nested || !left ||
+       blaze::isParallelSectionActive() || blaze::isParallelSectionNested() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid parallel section state\n"
+          << " Details:\n"
+          << "   Before the first section: " << outer  << " (expected 0)\n"
+          << "   Within a single section : " << single << " (expected 1)\n"
+          << "   Within a nested section : " << nested << " (expected 1)\n"
+          << "   After the nested section: " << left   << " (expected 1)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the independence of the parallel sections of different threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the parallel sections of a thread are not visible to other threads.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testThreads()
+{
+   test_ = "Parallel sections of independent threads";
+
+   int active( 1 );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      BLAZE_PARALLEL_SECTION
+      {
+         boost::thread thread( boost::bind( recordSection, &active ) );
+         thread.join();
+      }
+   }
+
+   if( active ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel section of another thread detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dispatch of parallel loops.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a top-level parallel loop is executed by several threads (in case
+// more than one thread is available), whereas nested loops and loops within a serial section
+// are executed by the calling thread. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDispatch()
+{
+   test_ = "Dispatch of parallel loops";
+
+   const bool parallel( blaze::getNumThreads() > 1UL );
+
+   // Top-level loop
+   {
+      std::vector<boost::thread::id> ids( 32UL );
+      Recorder recorder( ids );
+      blaze::smpFor( ids.size(), recorder );
+
+      checkIds( ids, parallel, "top-level loop" );
+   }
+
+   // Loop within a serial section
+   {
+      std::vector<boost::thread::id> ids( 32UL );
+      Recorder recorder( ids );
+
+      BLAZE_SERIAL_SECTION
+      {
+         blaze::smpFor( ids.size(), recorder );
+      }
+
+      checkIds( ids, false, "loop within a serial section" );
+   }
+
+   // Nested loops
+   {
+      std::vector<int> serial( 16UL, 0 );
+      NestedLoop loop( serial );
+      blaze::smpFor( serial.size(), loop );
+
+      if( std::count( serial.begin(), serial.end(), 1 ) != 16 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Nested loop not executed by the executing thread\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel section state of the threads executing a parallel loop.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all threads executing the iterations of a parallel loop (as for
+// instance the worker threads of an OpenMP parallel region) are within an active parallel
+// section, which is required by the SMP backend functions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testWorkers()
+{
+   test_ = "Parallel section state of the executing threads";
+
+   const bool parallel( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE ||
+                        BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+   std::vector<int> active( 32UL, -1 );
+   SectionRecorder recorder( active );
+   blaze::smpFor( active.size(), recorder );
+
+   const int expected( parallel ? 1 : 0 );
+   const size_t count( std::count( active.begin(), active.end(), expected ) );
+
+   if( count != active.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid parallel section state of an executing thread\n"
+          << " Details:\n"
+          << "   Number of iterations              : " << active.size() << "\n"
+          << "   Iterations with the expected state: " << count << "\n"
+          << "   Expected parallel section state   : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of top-level and nested SMP assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests SMP assignments issued by the calling thread and SMP assignments
+// issued from within a parallel loop, which are executed serially by the executing thread.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   test_ = "Top-level and nested SMP assignments";
+
+   const size_t n( 10007UL );
+
+   blaze::DynamicVector<int> a( n ), b( n ), ref( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = static_cast<int>( i % 17UL );
+      b[i] = static_cast<int>( i % 5UL  ) - 2;
+      ref[i] = a[i] + b[i];
+   }
+
+   blaze::DynamicVector<int> c( n );
+   c = a + b;
+
+   if( c != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Top-level assignment failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::vector< blaze::DynamicVector<int> > results( 8UL );
+   NestedAssignment assignment( a, b, results );
+   blaze::smpFor( results.size(), assignment );
+
+   for( size_t k=0UL; k<results.size(); ++k ) {
+      if( results[k] != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Nested assignment failed\n"
+             << " Details:\n"
+             << "   Iteration: " << k << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the identifiers of the threads that executed a parallel loop.
+//
+// \param ids The recorded thread identifiers.
+// \param parallel \a true if several threads are expected, \a false for the calling thread.
+// \param operation The description of the loop.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkIds( const std::vector<boost::thread::id>& ids, bool parallel,
+                          const std::string& operation )
+{
+   const boost::thread::id self( boost::this_thread::get_id() );
+
+   std::vector<boost::thread::id> unique( ids );
+   std::sort( unique.begin(), unique.end() );
+   unique.erase( std::unique( unique.begin(), unique.end() ), unique.end() );
+
+   if( std::find( unique.begin(), unique.end(), boost::thread::id() ) != unique.end() ||
+       ( parallel && unique.size() < 2UL ) ||
+       ( !parallel && ( unique.size() != 1UL || unique[0] != self ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid dispatch of a " << operation << "\n"
+          << " Details:\n"
+          << "   Number of executing threads: " << unique.size() << "\n"
+          << "   Expected parallel execution: " << parallel << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace parallelsection
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel section test..." << std::endl;
+
+   try
+   {
+      RUN_PARALLELSECTION_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel section test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
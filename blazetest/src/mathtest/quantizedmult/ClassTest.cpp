@@ -0,0 +1,223 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/quantizedmult/ClassTest.cpp
+//  \brief Source file for the quantized multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/quantizedmult/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace quantizedmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the quantized multiplication test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testGemm<signed char,rowMajor,columnMajor>(  1UL,  1UL,   1UL );
+   testGemm<signed char,rowMajor,columnMajor>(  7UL,  5UL,  33UL );
+   testGemm<signed char,rowMajor,columnMajor>( 67UL, 38UL, 200UL );
+   testGemm<signed char,columnMajor,rowMajor>( 19UL, 21UL,  95UL );
+   testGemm<short,rowMajor,columnMajor>      (  3UL,  9UL,  17UL );
+   testGemm<short,rowMajor,columnMajor>      ( 41UL, 36UL, 130UL );
+   testGemm<short,columnMajor,columnMajor>   ( 22UL, 13UL,  64UL );
+
+   testGemv<signed char,rowMajor>   (  1UL,   1UL );
+   testGemv<signed char,rowMajor>   ( 45UL, 301UL );
+   testGemv<signed char,columnMajor>( 17UL,  48UL );
+   testGemv<short,rowMajor>         ( 33UL,  71UL );
+
+   testExtremeValues();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the 32-bit accumulation of extreme values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that neither the products nor the partial sums of the quantized kernels
+// saturate or overflow in case the operands contain the extreme values of their value range.
+*/
+void ClassTest::testExtremeValues()
+{
+   test_ = "Quantized multiplication of extreme 8-bit values";
+
+   {
+      blaze::DynamicMatrix<signed char,blaze::rowMajor> A( 5UL, 1000UL, -128 );
+      blaze::DynamicMatrix<signed char,blaze::columnMajor> B( 1000UL, 6UL, -128 );
+      B(0,0) = 127;
+
+      blaze::DynamicMatrix<int> C;
+      blaze::qgemm( C, A, B );
+
+      blaze::DynamicMatrix<int> ref( 5UL, 6UL, 1000*16384 );
+      for( size_t i=0UL; i<5UL; ++i )
+         ref(i,0) = 999*16384 - 128*127;
+
+      checkResult( C, ref );
+   }
+
+   test_ = "Quantized multiplication of extreme 16-bit values";
+
+   {
+      blaze::DynamicMatrix<short,blaze::rowMajor> A( 3UL, 2UL, -32767 );
+      blaze::DynamicVector<short> x( 2UL, -32767 );
+
+      blaze::DynamicVector<int> y;
+      blaze::qgemv( y, A, x );
+
+      const blaze::DynamicVector<int> ref( 3UL, 2*32767*32767 );
+
+      checkResult( y, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size checks of the quantized multiplication functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Quantized multiplication with non-matching sizes";
+
+   blaze::DynamicMatrix<signed char> A( 4UL, 5UL, 1 );
+   blaze::DynamicMatrix<signed char> B( 6UL, 3UL, 1 );
+   blaze::DynamicVector<signed char> x( 6UL, 1 );
+   blaze::DynamicVector<float> scale( 3UL, 1.0F );
+
+   blaze::DynamicMatrix<float> C;
+   blaze::DynamicVector<float> y;
+
+   try {
+      blaze::qgemm( C, A, B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix multiplication with non-matching sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::qgemv( y, A, x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix/vector multiplication with non-matching sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::DynamicMatrix<signed char> D( 5UL, 3UL, 1 );
+      blaze::qgemm( C, A, D, scale, scale );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix multiplication with invalid scale factors succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace quantizedmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running quantized multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_QUANTIZEDMULT_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during quantized multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
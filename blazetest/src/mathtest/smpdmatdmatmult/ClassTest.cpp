@@ -0,0 +1,261 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smpdmatdmatmult/ClassTest.cpp
+//  \brief Source file for the SMP dense matrix/dense matrix multiplication test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/smpdmatdmatmult/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smpdmatdmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMP dense matrix/dense matrix multiplication test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   blaze::setNumThreads( 4UL );
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   const char* const thresholds[] = { "SMP_DMATDMATMULT_THRESHOLD" , "SMP_DMATTDMATMULT_THRESHOLD",
+                                      "SMP_TDMATDMATMULT_THRESHOLD", "SMP_TDMATTDMATMULT_THRESHOLD" };
+
+   for( size_t i=0UL; i<sizeof(thresholds)/sizeof(thresholds[0]); ++i ) {
+      blaze::setThreshold( thresholds[i], 0UL );
+   }
+#endif
+
+   testThreadMapping();
+   testTall();
+   testWide();
+   testSquare();
+   testInnerSplit();
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::resetThresholds();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the 2D thread mapping and the inner dimension split decision.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the shape of the thread grids created by the createThreadMapping()
+// function and the decision of the isReductionBeneficial() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testThreadMapping()
+{
+   test_ = "Thread mapping";
+
+   const size_t shapes[][4] = { { 4UL, 1000UL,   10UL, 4UL },  // Tall target: horizontal strips
+                                { 4UL,   10UL, 1000UL, 1UL },  // Wide target: vertical strips
+                                { 4UL,  300UL,  300UL, 2UL },  // Square target: square blocks
+                                { 6UL,    2UL,  500UL, 1UL },  // Tiny number of rows
+                                { 1UL,  100UL,  100UL, 1UL } };
+
+   for( size_t s=0UL; s<sizeof(shapes)/sizeof(shapes[0]); ++s )
+   {
+      const blaze::ThreadMapping mapping( blaze::createThreadMapping( shapes[s][0], shapes[s][1], shapes[s][2] ) );
+
+      if( mapping.first != shapes[s][3] || mapping.first * mapping.second != shapes[s][0] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid thread mapping\n"
+             << " Details:\n"
+             << "   Threads: " << shapes[s][0] << ", target: " << shapes[s][1] << "x" << shapes[s][2] << "\n"
+             << "   Result  : " << mapping.first << "x" << mapping.second << "\n"
+             << "   Expected: " << shapes[s][3] << "x" << shapes[s][0] / shapes[s][3] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( !blaze::isReductionBeneficial( 4UL, 16UL, 12UL, 4000UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inner dimension not split for a small target and a large inner dimension\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::isReductionBeneficial( 4UL, 300UL, 300UL, 300UL ) ||
+       blaze::isReductionBeneficial( 1UL, 16UL, 12UL, 4000UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inner dimension split for a large target or a single thread\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel products with a tall target matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testTall()
+{
+   test_ = "Tall target matrix";
+
+   testProduct<blaze::rowMajor   ,blaze::rowMajor   ,blaze::rowMajor   >( 301UL, 37UL, 53UL );
+   testProduct<blaze::rowMajor   ,blaze::columnMajor,blaze::rowMajor   >( 301UL, 37UL, 53UL );
+   testProduct<blaze::columnMajor,blaze::rowMajor   ,blaze::columnMajor>( 301UL, 37UL, 53UL );
+   testProduct<blaze::columnMajor,blaze::columnMajor,blaze::columnMajor>( 1001UL, 7UL, 33UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel products with a wide target matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testWide()
+{
+   test_ = "Wide target matrix";
+
+   testProduct<blaze::rowMajor   ,blaze::rowMajor   ,blaze::rowMajor   >( 37UL, 301UL, 53UL );
+   testProduct<blaze::rowMajor   ,blaze::columnMajor,blaze::columnMajor>( 37UL, 301UL, 53UL );
+   testProduct<blaze::columnMajor,blaze::rowMajor   ,blaze::rowMajor   >( 7UL, 1001UL, 33UL );
+   testProduct<blaze::columnMajor,blaze::columnMajor,blaze::columnMajor>( 37UL, 301UL, 53UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel products with a square target matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testSquare()
+{
+   test_ = "Square target matrix";
+
+   testProduct<blaze::rowMajor   ,blaze::rowMajor   ,blaze::rowMajor   >( 128UL, 128UL, 128UL );
+   testProduct<blaze::rowMajor   ,blaze::columnMajor,blaze::columnMajor>( 131UL, 131UL, 67UL );
+   testProduct<blaze::columnMajor,blaze::rowMajor   ,blaze::rowMajor   >( 131UL, 131UL, 67UL );
+   testProduct<blaze::columnMajor,blaze::columnMajor,blaze::columnMajor>( 128UL, 128UL, 128UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel products with a small target matrix and a large inner dimension.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests products that are evaluated by splitting the inner dimension among the
+// threads and by reducing the partial products (including inner dimensions that are not a
+// multiple of the number of threads). In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testInnerSplit()
+{
+   test_ = "Small target matrix with large inner dimension";
+
+   testProduct<blaze::rowMajor   ,blaze::rowMajor   ,blaze::rowMajor   >( 16UL, 12UL, 4000UL );
+   testProduct<blaze::rowMajor   ,blaze::columnMajor,blaze::rowMajor   >( 16UL, 12UL, 4001UL );
+   testProduct<blaze::columnMajor,blaze::rowMajor   ,blaze::columnMajor>( 9UL, 13UL, 3999UL );
+   testProduct<blaze::columnMajor,blaze::columnMajor,blaze::columnMajor>( 3UL, 5UL, 10007UL );
+}
+//*************************************************************************************************
+
+} // namespace smpdmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP dense matrix/dense matrix multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_SMPDMATDMATMULT_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP dense matrix/dense matrix multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,354 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smppartitioning/ClassTest.cpp
+//  \brief Source file for the workload partitioning test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/smp/Partitioning.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/smppartitioning/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smppartitioning {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the workload partitioning test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   blaze::setNumThreads( 4UL );
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   const char* const thresholds[] = { "SMP_SMATDVECMULT_THRESHOLD", "SMP_TDVECTSMATMULT_THRESHOLD",
+                                      "SMP_SMATDMATMULT_THRESHOLD", "SMP_SMATTDMATMULT_THRESHOLD" ,
+                                      "SMP_DMATTSMATMULT_THRESHOLD" };
+
+   for( size_t i=0UL; i<sizeof(thresholds)/sizeof(thresholds[0]); ++i ) {
+      blaze::setThreshold( thresholds[i], 0UL );
+   }
+#endif
+
+   testPartitioning();
+   testSpMV();
+   testSpMM();
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::resetThresholds();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the partitioning of a sparse matrix by its number of non-zero elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the bounds computed by the partitionByNonZeros() function for a sparse
+// matrix with a single dense row. The bounds have to cover all rows, have to be rounded to the
+// given granularity, and have to balance the workload of the parts. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPartitioning()
+{
+   test_ = "Partitioning by non-zero elements";
+
+   const size_t m( 1000UL );
+   const size_t n( 1000UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   initialize( A, m, n, 100UL );
+
+   const size_t total( m + A.nonZeros() );
+
+   for( size_t parts=1UL; parts<=8UL; ++parts )
+   {
+      for( size_t granularity=1UL; granularity<=8UL; granularity*=2UL )
+      {
+         std::vector<size_t> bounds;
+         blaze::partitionByNonZeros( A, parts, granularity, bounds );
+
+         if( bounds.size() != parts+1UL || bounds.front() != 0UL || bounds.back() != m ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid range of the partitioning\n"
+                << " Details:\n"
+                << "   Parts: " << parts << ", granularity: " << granularity << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<parts; ++i )
+         {
+            size_t work( 0UL );
+            for( size_t j=bounds[i]; j<bounds[i+1UL]; ++j ) {
+               work += 1UL + A.nonZeros( j );
+            }
+
+            if( bounds[i+1UL] < bounds[i] || ( i > 0UL && bounds[i] % granularity != 0UL ) ||
+                work > total/parts + n + granularity*3UL ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid part detected\n"
+                   << " Details:\n"
+                   << "   Parts: " << parts << ", granularity: " << granularity << "\n"
+                   << "   Part " << i << ": [" << bounds[i] << "," << bounds[i+1UL] << ")\n"
+                   << "   Workload: " << work << " (total " << total << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         if( parts == 4UL && granularity == 1UL && ( bounds[1] >= 250UL || bounds[1] <= 100UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Dense row not balanced\n"
+                << " Details:\n"
+                << "   First part: [0," << bounds[1] << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel sparse matrix/dense vector multiplications with a skewed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares parallel sparse matrix/dense vector multiplications with the serial
+// evaluation. Both vectorizable (aligned and padded) and unaligned target vectors are used.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSpMV()
+{
+   test_ = "Sparse matrix/dense vector multiplication";
+
+   const size_t sizes[][3] = { { 1000UL, 1000UL,   3UL },
+                               { 1001UL,  517UL, 999UL },
+                               {   37UL, 2003UL,  17UL } };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(sizes[0]); ++s )
+   {
+      const size_t m( sizes[s][0] );
+      const size_t n( sizes[s][1] );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      initialize( A, m, n, sizes[s][2] % m );
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> B;
+      initialize( B, n, m, sizes[s][2] % m );
+
+      blaze::DynamicVector<double,blaze::columnVector> x( n );
+      for( size_t i=0UL; i<n; ++i )
+         x[i] = double( int( i % 5UL ) - 2 );
+
+      blaze::DynamicVector<double,blaze::rowVector> xt( trans( x ) );
+
+      // Row-major sparse matrix/dense vector multiplication
+      {
+         const blaze::DynamicVector<double,blaze::columnVector> ref( blaze::serial( A * x ) );
+
+         blaze::DynamicVector<double,blaze::columnVector> y( m, 1.0 );
+         y = A * x;
+         compare( y, ref, "assignment to a vectorizable vector" );
+
+         y += A * x;
+         compare( y, 2.0*ref, "addition assignment to a vectorizable vector" );
+
+         y -= A * x;
+         compare( y, ref, "subtraction assignment to a vectorizable vector" );
+
+         blaze::DynamicVector<double,blaze::columnVector> z( m+1UL, 0.0 );
+         subvector( z, 1UL, m ) = A * x;
+         compare( subvector( z, 1UL, m ), ref, "assignment to an unaligned subvector" );
+      }
+
+      // Transpose dense vector/column-major sparse matrix multiplication
+      {
+         const blaze::DynamicVector<double,blaze::rowVector> ref( blaze::serial( xt * B ) );
+
+         blaze::DynamicVector<double,blaze::rowVector> y( m, 1.0 );
+         y = xt * B;
+         compare( y, ref, "assignment of a transpose dense vector/sparse matrix product" );
+
+         y += xt * B;
+         compare( y, 2.0*ref, "addition assignment of a transpose dense vector/sparse matrix product" );
+
+         blaze::DynamicVector<double,blaze::rowVector> z( m+1UL, 0.0 );
+         subvector( z, 1UL, m ) = xt * B;
+         compare( subvector( z, 1UL, m ), ref, "assignment of a transpose dense vector/sparse matrix product to an unaligned subvector" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel sparse matrix/dense matrix multiplications with a skewed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares parallel sparse matrix/dense matrix and dense matrix/sparse matrix
+// multiplications with the serial evaluation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSpMM()
+{
+   test_ = "Sparse matrix/dense matrix multiplication";
+
+   const size_t m( 701UL );
+   const size_t n(  29UL );
+   const size_t k( 503UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   initialize( A, m, k, 350UL );
+
+   blaze::CompressedMatrix<double,blaze::columnMajor> S;
+   initialize( S, k, m, 350UL );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> B( k, n );
+   for( size_t i=0UL; i<k; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         B(i,j) = double( int( ( i + j ) % 5UL ) - 2 );
+
+   const blaze::DynamicMatrix<double,blaze::columnMajor> TB( B );
+   const blaze::DynamicMatrix<double,blaze::rowMajor> D( trans( B ) );
+
+   // Row-major sparse matrix/row-major dense matrix multiplication
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref( blaze::serial( A * B ) );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> C( m, n, 1.0 );
+      C = A * B;
+      compare( C, ref, "assignment of a sparse matrix/dense matrix product" );
+
+      C += A * B;
+      compare( C, 2.0*ref, "addition assignment of a sparse matrix/dense matrix product" );
+
+      C -= A * B;
+      compare( C, ref, "subtraction assignment of a sparse matrix/dense matrix product" );
+   }
+
+   // Row-major sparse matrix/column-major dense matrix multiplication
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref( blaze::serial( A * TB ) );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> C( m, n, 1.0 );
+      C = A * TB;
+      compare( C, ref, "assignment of a sparse matrix/transpose dense matrix product" );
+
+      C += A * TB;
+      compare( C, 2.0*ref, "addition assignment of a sparse matrix/transpose dense matrix product" );
+   }
+
+   // Row-major dense matrix/column-major sparse matrix multiplication
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref( blaze::serial( D * S ) );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> C( n, m, 1.0 );
+      C = D * S;
+      compare( C, ref, "assignment of a dense matrix/sparse matrix product" );
+
+      C -= D * S;
+      compare( C, 0.0*ref, "subtraction assignment of a dense matrix/sparse matrix product" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smppartitioning
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running workload partitioning test..." << std::endl;
+
+   try
+   {
+      RUN_SMPPARTITIONING_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during workload partitioning test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,549 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/threadcontext/ClassTest.cpp
+//  \brief Source file for the thread context test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/ref.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/threadcontext/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace threadcontext {
+
+//=================================================================================================
+//
+//  AUXILIARY DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loop body recording the identifier of the executing thread.
+*/
+struct Recorder
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the Recorder class.
+   //
+   // \param ids The vector of thread identifiers.
+   */
+   explicit Recorder( std::vector<boost::thread::id>& ids )
+      : ids_( &ids )  // The vector of thread identifiers
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Records the identifier of the executing thread for the given iteration.
+   //
+   // \param k The index of the iteration.
+   // \return void
+   */
+   void operator()( size_t k ) {
+      (*ids_)[k] = boost::this_thread::get_id();
+      boost::this_thread::sleep( boost::posix_time::milliseconds( 1 ) );
+   }
+   //**********************************************************************************************
+
+   std::vector<boost::thread::id>* ids_;  //!< The vector of thread identifiers.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Simulated request thread with its own thread context.
+//
+// Each request creates a context with the given number of threads, binds it to the executing
+// thread, and repeatedly evaluates a parallel loop and a parallel matrix/vector multiplication.
+// All identifiers of the threads that executed the loop are recorded.
+*/
+struct Request
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the Request class.
+   //
+   // \param threads The number of threads of the context of the request.
+   // \param A The matrix of the multiplication.
+   // \param x The vector of the multiplication.
+   // \param ref The reference result of the multiplication.
+   */
+   explicit Request( size_t threads, const blaze::DynamicMatrix<int>& A,
+                     const blaze::DynamicVector<int>& x, const blaze::DynamicVector<int>& ref )
+      : threads_( threads )  // The number of threads of the context
+      , A_      ( &A      )  // The matrix of the multiplication
+      , x_      ( &x      )  // The vector of the multiplication
+      , ref_    ( &ref    )  // The reference result of the multiplication
+      , size_   ( 0UL     )  // The number of threads within the scope
+      , ids_    ()           // The identifiers of the executing threads
+      , error_  ()           // The error message of the request
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Executes the request.
+   //
+   // \return void
+   */
+   void operator()() {
+      try {
+         blaze::ThreadContext context( threads_ );
+         blaze::ThreadContextScope scope( context );
+
+         size_ = blaze::getNumThreads();
+
+         for( size_t i=0UL; i<20UL; ++i )
+         {
+            std::vector<boost::thread::id> ids( 16UL );
+            Recorder recorder( ids );
+            blaze::smpFor( ids.size(), recorder );
+            ids_.insert( ids_.end(), ids.begin(), ids.end() );
+
+            blaze::DynamicVector<int> y;
+            y = (*A_) * (*x_);
+
+            if( y != *ref_ ) {
+               error_ = "Invalid matrix/vector multiplication";
+               return;
+            }
+         }
+      }
+      catch( std::exception& ex ) {
+         error_ = ex.what();
+      }
+   }
+   //**********************************************************************************************
+
+   size_t threads_;                          //!< The number of threads of the context.
+   const blaze::DynamicMatrix<int>* A_;      //!< The matrix of the multiplication.
+   const blaze::DynamicVector<int>* x_;      //!< The vector of the multiplication.
+   const blaze::DynamicVector<int>* ref_;    //!< The reference result of the multiplication.
+   size_t size_;                             //!< The number of threads within the scope.
+   std::vector<boost::thread::id> ids_;      //!< The identifiers of the executing threads.
+   std::string error_;                       //!< The error message of the request.
+};
+//*************************************************************************************************
+
+
+#if defined(__linux__) && ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+//*************************************************************************************************
+/*!\brief Loop body checking the CPU affinity of the executing thread.
+*/
+struct AffinityChecker
+{
+   //**********************************************************************************************
+   /*!\brief Constructor for the AffinityChecker class.
+   //
+   // \param cpu The CPU the threads of the context are expected to be pinned to.
+   // \param pinned Per-iteration flag whether the executing thread was pinned to the CPU.
+   */
+   explicit AffinityChecker( size_t cpu, std::vector<int>& pinned )
+      : cpu_   ( cpu       )  // The expected CPU
+      , owner_ ( pthread_self() )  // The thread issuing the loop
+      , pinned_( &pinned   )  // Per-iteration flag for the pinning of the executing thread
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Checks the affinity of the executing thread for the given iteration.
+   //
+   // \param k The index of the iteration.
+   // \return void
+   //
+   // The thread issuing the loop is not a member of the context and therefore not checked.
+   */
+   void operator()( size_t k ) {
+      cpu_set_t set;
+      CPU_ZERO( &set );
+      pthread_getaffinity_np( pthread_self(), sizeof( cpu_set_t ), &set );
+
+      if( pthread_equal( pthread_self(), owner_ ) )
+         (*pinned_)[k] = -1;
+      else
+         (*pinned_)[k] = ( CPU_COUNT( &set ) == 1 && CPU_ISSET( cpu_, &set ) );
+   }
+   //**********************************************************************************************
+
+   size_t cpu_;                //!< The expected CPU.
+   pthread_t owner_;           //!< The thread issuing the loop.
+   std::vector<int>* pinned_;  //!< Per-iteration flag for the pinning of the executing thread.
+};
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the thread context test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   blaze::setNumThreads( 4UL );
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::setThreshold( "SMP_DMATDVECMULT_THRESHOLD", 0UL );
+#endif
+
+   testConstruction();
+   testScope();
+   testRequests();
+   testPinning();
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   blaze::resetThresholds();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the construction of thread contexts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction of thread contexts, including the handling of invalid
+// numbers of threads and invalid lists of CPUs. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstruction()
+{
+   test_ = "ThreadContext construction";
+
+   {
+      blaze::ThreadContext context( 3UL );
+
+      if( context.size() != ( blaze::getNumThreads() > 1UL ? 3UL : 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid context size\n"
+             << " Details:\n"
+             << "   Result: " << context.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      blaze::ThreadContext context( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction of a context without threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      const std::vector<size_t> cpus;
+      blaze::ThreadContext context( 2UL, cpus );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction of a context with an empty list of CPUs succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the binding of thread contexts to the calling thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a ThreadContextScope binds the context to the calling thread, that
+// nested scopes are supported, and that the previous binding is restored at the end of each
+// scope. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScope()
+{
+   test_ = "ThreadContextScope binding";
+
+   const size_t global( blaze::getNumThreads() );
+   const bool parallel( global > 1UL );
+
+   blaze::ThreadContext outer( 2UL );
+   blaze::ThreadContext inner( 3UL );
+
+   size_t sizes[3] = { 0UL, 0UL, 0UL };
+
+   {
+      blaze::ThreadContextScope outerScope( outer );
+      sizes[0] = blaze::getNumThreads();
+
+      {
+         blaze::ThreadContextScope innerScope( inner );
+         sizes[1] = blaze::getNumThreads();
+      }
+
+      sizes[2] = blaze::getNumThreads();
+   }
+
+   if( sizes[0] != ( parallel ? 2UL : 1UL ) || sizes[1] != ( parallel ? 3UL : 1UL ) ||
+       sizes[2] != ( parallel ? 2UL : 1UL ) || blaze::getNumThreads() != global ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Outer scope      : " << sizes[0] << "\n"
+          << "   Inner scope      : " << sizes[1] << "\n"
+          << "   After inner scope: " << sizes[2] << "\n"
+          << "   After outer scope: " << blaze::getNumThreads() << " (expected " << global << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of several request threads with independent thread contexts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs several request threads concurrently, each of which binds its own thread
+// context. It tests that all operations of a request are executed correctly, that each request
+// uses at most the threads of its own context, and that no thread is shared between requests.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRequests()
+{
+   test_ = "Concurrent requests with independent thread contexts";
+
+   const bool parallel( blaze::getNumThreads() > 1UL );
+   const size_t m( 203UL );
+   const size_t n( 157UL );
+
+   blaze::DynamicMatrix<int> A( m, n );
+   blaze::DynamicVector<int> x( n );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = static_cast<int>( ( i + 2UL*j ) % 7UL ) - 3;
+
+   for( size_t j=0UL; j<n; ++j )
+      x[j] = static_cast<int>( j % 3UL ) - 1;
+
+   blaze::DynamicVector<int> ref;
+   ref = blaze::serial( A * x );
+
+   std::vector<Request> requests;
+   for( size_t r=0UL; r<4UL; ++r )
+      requests.push_back( Request( 2UL + r%2UL, A, x, ref ) );
+
+   boost::thread_group group;
+   for( size_t r=0UL; r<requests.size(); ++r )
+      group.create_thread( boost::ref( requests[r] ) );
+   group.join_all();
+
+   std::vector< std::vector<boost::thread::id> > ids( requests.size() );
+
+   for( size_t r=0UL; r<requests.size(); ++r )
+   {
+      const Request& request( requests[r] );
+
+      if( !request.error_.empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Request " << r << " failed\n"
+             << " Details:\n"
+             << "   " << request.error_ << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ids[r] = request.ids_;
+      std::sort( ids[r].begin(), ids[r].end() );
+      ids[r].erase( std::unique( ids[r].begin(), ids[r].end() ), ids[r].end() );
+
+      const size_t expected( parallel ? request.threads_ : 1UL );
+
+      if( request.size_ != expected || ids[r].size() > expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of threads of request " << r << "\n"
+             << " Details:\n"
+             << "   Number of threads within the scope: " << request.size_ << "\n"
+             << "   Number of executing threads       : " << ids[r].size() << "\n"
+             << "   Expected number of threads        : " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t r=0UL; r<ids.size(); ++r ) {
+      for( size_t s=r+1UL; s<ids.size(); ++s )
+      {
+         std::vector<boost::thread::id> shared;
+         std::set_intersection( ids[r].begin(), ids[r].end(), ids[s].begin(), ids[s].end(),
+                                std::back_inserter( shared ) );
+
+         if( !shared.empty() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Requests " << r << " and " << s << " share threads\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the pinning of the threads of a context.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates a context whose threads are pinned to a single CPU and tests the
+// affinity of all threads of the context. Pinning is only supported by the C++11 and Boost
+// thread backends on Linux. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testPinning()
+{
+   test_ = "ThreadContext pinning";
+
+#if defined(__linux__) && ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+   cpu_set_t allowed;
+   CPU_ZERO( &allowed );
+   pthread_getaffinity_np( pthread_self(), sizeof( cpu_set_t ), &allowed );
+
+   size_t cpu( 0UL );
+   for( size_t i=0UL; i<static_cast<size_t>( CPU_SETSIZE ); ++i ) {
+      if( CPU_ISSET( i, &allowed ) ) cpu = i;
+   }
+
+   const std::vector<size_t> cpus( 1UL, cpu );
+   blaze::ThreadContext context( 3UL, cpus );
+   blaze::ThreadContextScope scope( context );
+
+   std::vector<int> pinned( 24UL, 0 );
+   AffinityChecker checker( cpu, pinned );
+   blaze::smpFor( pinned.size(), checker );
+
+   if( std::count( pinned.begin(), pinned.end(), 0 ) != 0 ||
+       std::count( pinned.begin(), pinned.end(), 1 ) == 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Thread of the context not pinned\n"
+          << " Details:\n"
+          << "   Expected CPU: " << cpu << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+#else
+   const std::vector<size_t> cpus( 1UL, 0UL );
+   blaze::ThreadContext context( 3UL, cpus );
+   blaze::ThreadContextScope scope( context );
+
+   if( blaze::getNumThreads() != context.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads of a pinned context\n"
+          << " Details:\n"
+          << "   Result: " << blaze::getNumThreads() << "\n"
+          << "   Expected result: " << context.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadcontext
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread context test..." << std::endl;
+
+   try
+   {
+      RUN_THREADCONTEXT_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread context test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,510 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/concurrentmemorypool/ClassTest.cpp
+//  \brief Source file for the ConcurrentMemoryPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/ConcurrentMemoryPool.h>
+#include <blazetest/utiltest/concurrentmemorypool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace concurrentmemorypool {
+
+//=================================================================================================
+//
+//  AUXILIARY DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory pool used in the concurrency test.
+*/
+typedef blaze::ConcurrentMemoryPool<16UL,4UL,8UL>  SharedPool;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Worker function of the concurrency test.
+//
+// \param objects The objects allocated by the main thread, to be released by the worker.
+// \param errors The number of detected errors.
+// \return void
+//
+// The worker releases all given objects and afterwards repeatedly allocates, fills, checks, and
+// releases objects of all size classes.
+*/
+void worker( std::vector<void*>* objects, size_t* errors )
+{
+   for( size_t i=0UL; i<objects->size(); ++i )
+      SharedPool::free( (*objects)[i], 64UL );
+
+   std::vector<unsigned char*> ptrs( 100UL );
+
+   for( size_t iteration=0UL; iteration<100UL; ++iteration )
+   {
+      for( size_t i=0UL; i<ptrs.size(); ++i ) {
+         ptrs[i] = static_cast<unsigned char*>( SharedPool::malloc( 1UL + i%64UL ) );
+         std::memset( ptrs[i], int( i%256UL ), 1UL + i%64UL );
+      }
+
+      for( size_t i=0UL; i<ptrs.size(); ++i ) {
+         for( size_t j=0UL; j<1UL+i%64UL; ++j ) {
+            if( ptrs[i][j] != i%256UL )
+               ++(*errors);
+         }
+         SharedPool::free( ptrs[i], 1UL + i%64UL );
+      }
+   }
+
+   SharedPool::flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory pool used in the depot test.
+*/
+typedef blaze::ConcurrentMemoryPool<16UL,1UL,8UL>  DepotPool;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Worker function of the depot test.
+//
+// \param objects The objects allocated by the worker.
+// \param count The number of objects to be allocated.
+// \return void
+*/
+void drainer( std::vector<void*>* objects, size_t count )
+{
+   for( size_t i=0UL; i<count; ++i )
+      objects->push_back( DepotPool::malloc( 16UL ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ConcurrentMemoryPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testSizeClasses();
+   testReuse();
+   testConcurrency();
+   testDepot();
+   testTrim();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the allocation of objects of different size classes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocation of objects of all size classes as well as of
+// objects exceeding the largest size class. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSizeClasses()
+{
+   test_ = "Size classes";
+
+   typedef blaze::ConcurrentMemoryPool<16UL,16UL,32UL>  Pool;
+
+   std::vector<void*> ptrs;
+
+   for( size_t size=1UL; size<=300UL; ++size ) {
+      ptrs.push_back( Pool::malloc( size ) );
+      std::memset( ptrs.back(), 0xFF, size );
+
+      if( reinterpret_cast<size_t>( ptrs.back() ) % sizeof(void*) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Object size: " << size << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t size=1UL; size<=300UL; ++size )
+      Pool::free( ptrs[size-1UL], size );
+
+   const Pool::Statistics stats( Pool::statistics() );
+
+   if( stats.allocations != 256UL || stats.deallocations != 256UL || stats.chunks != 16UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid statistics detected\n"
+          << " Details:\n"
+          << "   Allocations  : " << stats.allocations << " (expected 256)\n"
+          << "   Deallocations: " << stats.deallocations << " (expected 256)\n"
+          << "   Chunks       : " << stats.chunks << " (expected 16)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of released objects.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reuse of objects released to the memory pool and of the
+// return of objects to the global depot. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testReuse()
+{
+   test_ = "Reuse";
+
+   typedef blaze::ConcurrentMemoryPool<32UL,2UL,4UL>  Pool;
+
+   void* const ptr1( Pool::malloc( 24UL ) );
+   Pool::free( ptr1, 24UL );
+   void* const ptr2( Pool::malloc( 32UL ) );
+
+   if( ptr1 != ptr2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Released object not reused\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   Pool::free( ptr2, 32UL );
+   Pool::flush();
+
+   const Pool::Statistics stats( Pool::statistics() );
+
+   if( stats.returned == 0UL || stats.chunks != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Cached objects not returned to the global depot\n"
+          << " Details:\n"
+          << "   Returned batches: " << stats.returned << "\n"
+          << "   Chunks          : " << stats.chunks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   void* const ptr3( Pool::malloc( 32UL ) );
+   Pool::free( ptr3, 32UL );
+
+   if( Pool::statistics().acquired != 1UL || Pool::statistics().chunks != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Objects not acquired from the global depot\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent use of the memory pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the concurrent allocation and deallocation of objects by
+// several threads, including the release of objects allocated on a different thread. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConcurrency()
+{
+   test_ = "Concurrency";
+
+   const size_t threads( 4UL );
+
+   std::vector< std::vector<void*> > objects( threads );
+   std::vector<size_t> errors( threads, 0UL );
+
+   for( size_t t=0UL; t<threads; ++t ) {
+      for( size_t i=0UL; i<50UL; ++i )
+         objects[t].push_back( SharedPool::malloc( 64UL ) );
+   }
+
+   boost::thread_group group;
+
+   for( size_t t=0UL; t<threads; ++t )
+      group.create_thread( boost::bind( worker, &objects[t], &errors[t] ) );
+
+   group.join_all();
+
+   for( size_t t=0UL; t<threads; ++t ) {
+      if( errors[t] != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Corrupted objects detected\n"
+             << " Details:\n"
+             << "   Thread: " << t << "\n"
+             << "   Errors: " << errors[t] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const SharedPool::Statistics stats( SharedPool::statistics() );
+
+   if( stats.allocations != stats.deallocations ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid statistics detected\n"
+          << " Details:\n"
+          << "   Allocations  : " << stats.allocations << "\n"
+          << "   Deallocations: " << stats.deallocations << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent removal of batches from the global depot.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of several threads concurrently draining a global depot that
+// contains a large number of batches. Every object has to be handed to exactly one thread, and
+// since the depot never runs empty, no thread is allowed to allocate an additional memory chunk.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDepot()
+{
+   test_ = "Depot";
+
+   const size_t threads( 4UL );
+   const size_t count( 500UL );
+
+   std::vector<void*> ptrs;
+
+   for( size_t i=0UL; i<threads*count; ++i )
+      ptrs.push_back( DepotPool::malloc( 16UL ) );
+   for( size_t i=0UL; i<ptrs.size(); ++i )
+      DepotPool::free( ptrs[i], 16UL );
+
+   DepotPool::flush();
+
+   const DepotPool::Statistics before( DepotPool::statistics() );
+
+   std::vector< std::vector<void*> > objects( threads );
+
+   boost::thread_group group;
+
+   for( size_t t=0UL; t<threads; ++t )
+      group.create_thread( boost::bind( drainer, &objects[t], count ) );
+
+   group.join_all();
+
+   ptrs.clear();
+   for( size_t t=0UL; t<threads; ++t )
+      ptrs.insert( ptrs.end(), objects[t].begin(), objects[t].end() );
+
+   std::sort( ptrs.begin(), ptrs.end() );
+
+   if( std::adjacent_find( ptrs.begin(), ptrs.end() ) != ptrs.end() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Object handed to several threads\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const DepotPool::Statistics after( DepotPool::statistics() );
+
+   if( after.chunks != before.chunks || after.acquired < before.acquired + threads*count/8UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Batches not acquired from the global depot\n"
+          << " Details:\n"
+          << "   Chunks before draining  : " << before.chunks << "\n"
+          << "   Chunks after draining   : " << after.chunks << "\n"
+          << "   Acquired batches        : " << after.acquired - before.acquired << "\n"
+          << "   Expected acquired (min.): " << threads*count/8UL << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<ptrs.size(); ++i )
+      DepotPool::free( ptrs[i], 16UL );
+
+   DepotPool::flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the release of unused memory chunks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the trim() function, which returns all completely unused
+// memory chunks to the system. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testTrim()
+{
+   test_ = "Trim";
+
+   typedef blaze::ConcurrentMemoryPool<64UL,4UL,16UL>  Pool;
+
+   std::vector<void*> ptrs;
+
+   for( size_t i=0UL; i<5000UL; ++i )
+      ptrs.push_back( Pool::malloc( 64UL ) );
+
+   const size_t chunks( Pool::statistics().chunks );
+
+   if( chunks < 5UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of memory chunks\n"
+          << " Details:\n"
+          << "   Chunks: " << chunks << " (expected at least 5)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Releasing all objects except for the first one
+   for( size_t i=1UL; i<ptrs.size(); ++i )
+      Pool::free( ptrs[i], 64UL );
+
+   Pool::trim();
+
+   const Pool::Statistics stats( Pool::statistics() );
+
+   if( stats.chunks != 1UL || stats.reserved == 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unused memory chunks not released\n"
+          << " Details:\n"
+          << "   Chunks before trim: " << chunks << "\n"
+          << "   Chunks after trim : " << stats.chunks << " (expected 1)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Reusing the remaining chunk
+   for( size_t i=1UL; i<100UL; ++i ) {
+      ptrs[i] = Pool::malloc( 64UL );
+      std::memset( ptrs[i], 0xFF, 64UL );
+   }
+
+   if( Pool::statistics().chunks != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Remaining memory chunk not reused after trim\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<100UL; ++i )
+      Pool::free( ptrs[i], 64UL );
+
+   Pool::trim();
+
+   if( Pool::statistics().chunks != 0UL || Pool::statistics().reserved != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Memory chunks not released after release of all objects\n"
+          << " Details:\n"
+          << "   Chunks: " << Pool::statistics().chunks << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace concurrentmemorypool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ConcurrentMemoryPool class test..." << std::endl;
+
+   try
+   {
+      RUN_CONCURRENTMEMORYPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ConcurrentMemoryPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -42,6 +42,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <blaze/math/StaticVector.h>
+#include <blaze/system/NUMA.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/Null.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
@@ -71,6 +72,7 @@ OperationTest::OperationTest()
 {
    testBuiltinTypes();
    testClassTypes();
+   testLargeAllocation();
    testNullPointer();
 }
 //*************************************************************************************************
@@ -270,6 +272,56 @@ void OperationTest::testClassTypes()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the allocation and deallocation of large arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocation and deallocation of arrays exceeding the
+// large allocation threshold (see the blaze::largeAllocationThreshold setting). In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLargeAllocation()
+{
+   test_ = "Large allocation (double)";
+
+   const size_t n( blaze::largeAllocationThreshold / sizeof(double) + 1UL );
+
+   double* array = blaze::allocate<double>( n );
+
+   const size_t alignment( blaze::AlignmentOf<double>::value );
+   const size_t deviation( reinterpret_cast<size_t>( array ) % alignment );
+
+   if( deviation != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n"
+          << " Details:\n"
+          << "   Expected alignment: " << alignment << "\n"
+          << "   Deviation         : " << deviation << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      array[i] = static_cast<double>( i );
+   }
+
+   if( array[0UL] != 0.0 || array[n-1UL] != static_cast<double>( n-1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid array elements detected\n"
+          << " Details:\n"
+          << "   First element : " << array[0UL] << "\n"
+          << "   Last element  : " << array[n-1UL] << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::deallocate( array );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of a deallocation of a NULL pointer.
 //
@@ -0,0 +1,541 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/memoryarena/ClassTest.cpp
+//  \brief Source file for the MemoryArena class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <boost/thread/thread.hpp>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/NUMA.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/MemoryArena.h>
+#include <blazetest/utiltest/memoryarena/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace memoryarena {
+
+//=================================================================================================
+//
+//  AUXILIARY DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Worker function of the foreign thread test.
+//
+// \param vector The vector to be destroyed by the worker thread.
+// \param matrix The matrix to be destroyed by the worker thread.
+// \param array The address of an array allocated by the worker thread.
+// \return void
+//
+// The worker destroys the given vector and matrix, which have been allocated on the main thread,
+// and allocates an array to be deallocated by the main thread.
+*/
+void worker( blaze::DynamicVector<double>* vector, blaze::DynamicMatrix<double>* matrix, double** array )
+{
+   delete vector;
+   delete matrix;
+
+   *array = blaze::allocate<double>( 64UL );
+   for( size_t i=0UL; i<64UL; ++i )
+      (*array)[i] = 1.0;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MemoryArena class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAllocation();
+   testSection();
+   testContainers();
+   testRelease();
+   testLiveBlocks();
+   testForeignThread();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the allocation of aligned memory from a memory arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the direct allocation of aligned memory from a memory arena.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocation()
+{
+   test_ = "Direct allocation";
+
+   blaze::MemoryArena arena( 1024UL );
+
+   for( size_t alignment=8UL; alignment<=128UL; alignment*=2UL )
+   {
+      blaze::byte* const ptr( arena.allocate( 100UL, alignment ) );
+
+      if( reinterpret_cast<size_t>( ptr ) % alignment != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Expected alignment: " << alignment << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( !arena.owns( ptr ) || !arena.owns( ptr+99UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Allocated memory not owned by the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::byte* const large( arena.allocate( 4096UL, 64UL ) );
+
+   if( !arena.owns( large ) || !arena.owns( large+4095UL ) || arena.capacity() < 4096UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Allocation exceeding the chunk size failed\n"
+          << " Details:\n"
+          << "   Capacity: " << arena.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( arena.used() != 5UL*100UL + 4096UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of used bytes\n"
+          << " Details:\n"
+          << "   Result  : " << arena.used() << "\n"
+          << "   Expected: " << 5UL*100UL + 4096UL << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ArenaSection class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the activation of memory arenas via (nested) arena sections.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSection()
+{
+   test_ = "ArenaSection";
+
+   blaze::MemoryArena outer, inner;
+
+   if( blaze::MemoryArena::active() != NULL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Active arena detected outside of an arena section\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      blaze::ArenaSection section1( outer );
+
+      double* ptr1 = blaze::allocate<double>( 16UL );
+
+      {
+         blaze::ArenaSection section2( inner );
+
+         double* ptr2 = blaze::allocate<double>( 16UL );
+
+         if( !inner.owns( ptr2 ) || outer.owns( ptr2 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocation not drawn from the innermost arena\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::deallocate( ptr2 );
+      }
+
+      if( blaze::MemoryArena::active() != &outer || !outer.owns( ptr1 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Outer arena not reactivated\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( ptr1 );
+   }
+
+   if( blaze::MemoryArena::active() != NULL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Active arena detected after the end of all arena sections\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   double* ptr3 = blaze::allocate<double>( 16UL );
+
+   if( outer.owns( ptr3 ) || inner.owns( ptr3 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Allocation drawn from an inactive arena\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::deallocate( ptr3 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of dense and sparse containers drawing memory from a memory arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of vectors, matrices, and expression temporaries drawing their
+// memory from a memory arena. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testContainers()
+{
+   test_ = "Containers";
+
+   blaze::MemoryArena arena;
+
+   {
+      blaze::ArenaSection section( arena );
+
+      blaze::DynamicVector<double> a( 100UL, 2.0 );
+      blaze::DynamicMatrix<double> A( 10UL, 10UL, 1.0 );
+      blaze::CompressedMatrix<double> S( 10UL, 10UL );
+      S(2,3) = 4.0;
+
+      if( !arena.owns( a.data() ) || !arena.owns( A.data() ) || !arena.owns( S.begin(2UL) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Container memory not drawn from the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const size_t used( arena.used() );
+
+      blaze::DynamicMatrix<double> B( A * A + S );
+
+      if( arena.used() <= used || B(2,3) != 14.0 || B(0,0) != 10.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid evaluation of an expression within an arena section\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::DynamicVector<double> b( 100UL, 2.0 );
+
+   if( arena.owns( b.data() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Container memory drawn from an inactive arena\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      blaze::ArenaSection section( arena );
+
+      blaze::DynamicVector<double> c( blaze::largeAllocationThreshold / sizeof(double) + 1UL );
+
+      if( arena.owns( c.data() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Large allocation drawn from the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the bulk release of a memory arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the release() function of the MemoryArena class. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRelease()
+{
+   test_ = "Release";
+
+   blaze::MemoryArena arena( 4096UL );
+
+   blaze::byte* const first( arena.allocate( 1000UL, 16UL ) );
+   arena.allocate( 8000UL, 16UL );
+
+   const size_t capacity( arena.capacity() );
+
+   arena.release();
+
+   if( arena.used() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of used bytes after release\n"
+          << " Details:\n"
+          << "   Result  : " << arena.used() << "\n"
+          << "   Expected: 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::byte* const second( arena.allocate( 1000UL, 16UL ) );
+   arena.allocate( 8000UL, 16UL );
+
+   if( first != second || arena.capacity() != capacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Memory chunks not reused after release\n"
+          << " Details:\n"
+          << "   Capacity before release: " << capacity << "\n"
+          << "   Capacity after release : " << arena.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the tracking of live memory blocks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the liveBlocks() function of the MemoryArena class, which
+// counts the memory blocks drawn via the allocate() function that have not been deallocated
+// yet. Among others, it detects a container that has been created before an arena section and
+// that has been resized within the section. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLiveBlocks()
+{
+   test_ = "Live blocks";
+
+   blaze::MemoryArena arena;
+   blaze::DynamicVector<double> outer;
+
+   {
+      blaze::ArenaSection section( arena );
+
+      blaze::DynamicVector<double> a( 100UL, 2.0 );
+      blaze::complex<double>* const values( blaze::allocate< blaze::complex<double> >( 10UL ) );
+
+      if( arena.liveBlocks() != 2UL || !blaze::checkAlignment( a.data() ) || !blaze::checkAlignment( values ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid live memory blocks\n"
+             << " Details:\n"
+             << "   Number of live blocks: " << arena.liveBlocks() << "\n"
+             << "   Expected number      : 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( values );
+
+      outer.resize( 50UL );
+      outer = 2.0 * a;
+   }
+
+   if( arena.liveBlocks() != 1UL || !arena.owns( outer.data() ) || outer[49] != 4.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Container resized within an arena section not detected\n"
+          << " Details:\n"
+          << "   Number of live blocks: " << arena.liveBlocks() << "\n"
+          << "   Expected number      : 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::DynamicVector<double>().swap( outer );
+
+   if( arena.liveBlocks() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deallocated memory block not detected\n"
+          << " Details:\n"
+          << "   Number of live blocks: " << arena.liveBlocks() << "\n"
+          << "   Expected number      : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   arena.release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the deallocation of memory on a foreign thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the deallocation of arena memory on a thread different from
+// the thread the arena has been created on, and of the deallocation of regular memory on the
+// thread of an arena. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testForeignThread()
+{
+   test_ = "Deallocation on a foreign thread";
+
+   blaze::MemoryArena arena;
+
+   blaze::DynamicVector<double>* vector( NULL );
+   blaze::DynamicMatrix<double>* matrix( NULL );
+   double* array( NULL );
+
+   {
+      blaze::ArenaSection section( arena );
+
+      vector = new blaze::DynamicVector<double>( 100UL, 2.0 );
+      matrix = new blaze::DynamicMatrix<double>( 10UL, 10UL, 1.0 );
+
+      if( !arena.owns( vector->data() ) || !arena.owns( matrix->data() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Container memory not drawn from the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      boost::thread thread( worker, vector, matrix, &array );
+      thread.join();
+
+      if( arena.owns( array ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Allocation of a foreign thread drawn from the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( array );
+   }
+
+   if( arena.liveBlocks() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deallocation on a foreign thread not detected\n"
+          << " Details:\n"
+          << "   Number of live blocks: " << arena.liveBlocks() << "\n"
+          << "   Expected number      : 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   arena.release();
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      double* const ptr( blaze::allocate<double>( 1000UL ) );
+      ptr[999UL] = 1.0;
+      blaze::deallocate( ptr );
+   }
+}
+//*************************************************************************************************
+
+} // namespace memoryarena
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MemoryArena class test..." << std::endl;
+
+   try
+   {
+      RUN_MEMORYARENA_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MemoryArena class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
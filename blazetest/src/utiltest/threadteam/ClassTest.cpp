@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadteam/ClassTest.cpp
+//  \brief Source file for the ThreadTeam class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/bind.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/ThreadTeam.h>
+#include <blazetest/utiltest/threadteam/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadteam {
+
+//=================================================================================================
+//
+//  AUXILIARY DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The type of the tested thread team.
+*/
+typedef blaze::ThreadTeam< boost::thread
+                         , boost::mutex
+                         , boost::unique_lock<boost::mutex>
+                         , boost::condition_variable >  Team;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task incrementing all elements of the given range of a vector.
+//
+// \param values The vector of values.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return void
+*/
+void increment( std::vector<int>* values, size_t begin, size_t end )
+{
+   for( size_t i=begin; i<end; ++i )
+      ++(*values)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task recording the identifier of the executing thread.
+//
+// \param ids The vector of thread identifiers.
+// \param index The index of the task.
+// \return void
+*/
+void record( std::vector<boost::thread::id>* ids, size_t index )
+{
+   (*ids)[index] = boost::this_thread::get_id();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadTeam class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testExecution();
+   testAssignment();
+   testResize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the execution of scheduled tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the execution of tasks in many consecutive fork-join
+// operations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExecution()
+{
+   test_ = "Execution";
+
+   Team team( 4UL );
+   std::vector<int> values( 1000UL, 0 );
+
+   for( size_t iteration=0UL; iteration<1000UL; ++iteration )
+   {
+      for( size_t i=0UL; i<10UL; ++i )
+         team.schedule( boost::bind( increment, &values, i*100UL, (i+1UL)*100UL ) );
+
+      team.wait();
+
+      if( !team.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Unexecuted tasks detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t i=0UL; i<values.size(); ++i ) {
+      if( values[i] != 1000 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result detected\n"
+             << " Details:\n"
+             << "   Index   : " << i << "\n"
+             << "   Result  : " << values[i] << "\n"
+             << "   Expected: 1000\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the static assignment of tasks to team members.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the round-robin assignment of tasks to the members of the
+// team. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   test_ = "Static assignment";
+
+   Team team( 3UL );
+   std::vector<boost::thread::id> ids( 6UL );
+
+   for( size_t iteration=0UL; iteration<10UL; ++iteration )
+   {
+      for( size_t i=0UL; i<ids.size(); ++i )
+         team.schedule( record, &ids, i );
+
+      team.wait();
+
+      if( ids[0] != boost::this_thread::get_id() || ids[3] != ids[0] ||
+          ids[1] == ids[0] || ids[4] != ids[1] ||
+          ids[2] == ids[0] || ids[2] == ids[1] || ids[5] != ids[2] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid assignment of tasks to team members detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function of the ThreadTeam class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of changing the number of team members. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "Resize";
+
+   Team team( 2UL );
+   std::vector<int> values( 100UL, 0 );
+
+   const size_t sizes[] = { 1UL, 5UL, 3UL, 1UL };
+
+   for( size_t s=0UL; s<4UL; ++s )
+   {
+      team.resize( sizes[s] );
+
+      if( team.size() != sizes[s] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid team size detected\n"
+             << " Details:\n"
+             << "   Result  : " << team.size() << "\n"
+             << "   Expected: " << sizes[s] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<10UL; ++i )
+         team.schedule( boost::bind( increment, &values, i*10UL, (i+1UL)*10UL ) );
+
+      team.wait();
+   }
+
+   for( size_t i=0UL; i<values.size(); ++i ) {
+      if( values[i] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result detected\n"
+             << " Details:\n"
+             << "   Index   : " << i << "\n"
+             << "   Result  : " << values[i] << "\n"
+             << "   Expected: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      team.resize( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resize to zero members succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace threadteam
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadTeam class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADTEAM_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadTeam class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
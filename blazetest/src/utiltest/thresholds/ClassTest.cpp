@@ -0,0 +1,296 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/thresholds/ClassTest.cpp
+//  \brief Source file for the runtime thresholds test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/utiltest/thresholds/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace thresholds {
+
+//=================================================================================================
+//
+//  AUXILIARY DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting the value of an environment variable.
+//
+// \param name The name of the environment variable.
+// \param value The new value of the environment variable.
+// \return void
+*/
+void setEnvironment( const char* name, const char* value )
+{
+#if defined(_MSC_VER)
+   _putenv_s( name, value );
+#else
+   setenv( name, value, 1 );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the runtime thresholds test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+   testEnvironment();
+   testSetThreshold();
+   testUnknownThreshold();
+   testReset();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+//*************************************************************************************************
+/*!\brief Test of the initialization of the thresholds via environment variables.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the environment variables overriding the compile time
+// defaults of the thresholds. Since the environment is evaluated on the first use of any
+// threshold, this test has to be run before any other use of the thresholds. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testEnvironment()
+{
+   test_ = "Environment variables";
+
+   setEnvironment( "BLAZE_SMP_DVECASSIGN_THRESHOLD", "1234" );
+   setEnvironment( "BLAZE_SMP_DVECDVECADD_THRESHOLD", "12x" );
+
+   if( blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" ) != 1234UL ||
+       blaze::SMP_DVECASSIGN_THRESHOLD != 1234UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Environment variable not applied\n"
+          << " Details:\n"
+          << "   Result  : " << blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" ) << "\n"
+          << "   Expected: 1234\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const size_t expected( BLAZE_DEBUG_MODE ? blaze::SMP_DVECDVECADD_DEBUG_THRESHOLD
+                                           : blaze::SMP_DVECDVECADD_USER_THRESHOLD );
+
+   if( blaze::getThreshold( "SMP_DVECDVECADD_THRESHOLD" ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid environment variable not ignored\n"
+          << " Details:\n"
+          << "   Result  : " << blaze::getThreshold( "SMP_DVECDVECADD_THRESHOLD" ) << "\n"
+          << "   Expected: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of changing the value of a threshold via the setThreshold()
+// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSetThreshold()
+{
+   test_ = "setThreshold() function";
+
+   blaze::setThreshold( "DMATDMATMULT_THRESHOLD", 4321UL );
+
+   if( blaze::getThreshold( "DMATDMATMULT_THRESHOLD" ) != 4321UL ||
+       blaze::DMATDMATMULT_THRESHOLD != 4321UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threshold not changed\n"
+          << " Details:\n"
+          << "   Result  : " << blaze::getThreshold( "DMATDMATMULT_THRESHOLD" ) << "\n"
+          << "   Expected: 4321\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::getThreshold( "TDMATDMATMULT_THRESHOLD" ) == 4321UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unrelated threshold changed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the access to an unknown threshold.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the getThreshold() and setThreshold() functions for an
+// unknown threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUnknownThreshold()
+{
+   test_ = "Unknown threshold";
+
+   try {
+      blaze::getThreshold( "UNKNOWN_THRESHOLD" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access to an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::setThreshold( "SMP_DVECASSIGN", 1UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Change of an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resetThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of resetting all thresholds to their compile time defaults,
+// including the thresholds set via environment variables. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "resetThresholds() function";
+
+   blaze::resetThresholds();
+
+   const size_t expected1( BLAZE_DEBUG_MODE ? blaze::SMP_DVECASSIGN_DEBUG_THRESHOLD
+                                            : blaze::SMP_DVECASSIGN_USER_THRESHOLD );
+   const size_t expected2( BLAZE_DEBUG_MODE ? blaze::DMATDMATMULT_DEBUG_THRESHOLD
+                                            : blaze::DMATDMATMULT_USER_THRESHOLD );
+
+   if( blaze::SMP_DVECASSIGN_THRESHOLD != expected1 || blaze::DMATDMATMULT_THRESHOLD != expected2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Thresholds not reset to their defaults\n"
+          << " Details:\n"
+          << "   Result  : " << size_t( blaze::SMP_DVECASSIGN_THRESHOLD ) << ", "
+                             << size_t( blaze::DMATDMATMULT_THRESHOLD ) << "\n"
+          << "   Expected: " << expected1 << ", " << expected2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+#endif
+
+} // namespace thresholds
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime thresholds test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDS_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime thresholds test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************